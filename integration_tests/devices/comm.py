@@ -477,6 +477,7 @@ class Comm(object):
 
     def __init__(self, frame_decoder):
         self._frame_decoder = frame_decoder
+        self._unpacked = []
 
         self.transmitter = TransmitterDevice()
         self.receiver = ReceiverDevice()
@@ -512,13 +513,22 @@ class Comm(object):
     def get_frame(self, timeout=None, filter_type=None):
         start = time.time()
         while timeout is None or (time.time() - start < timeout):
-            f = None
-            try:
-                f = self.transmitter.get_message_from_buffer(None if timeout is None else time.time() - start)
-            except Empty:
-                continue
+            if len(self._unpacked) > 0:
+                frame = self._frame_decoder.decode(self._unpacked.pop(0))
+            else:
+                f = None
+                try:
+                    f = self.transmitter.get_message_from_buffer(None if timeout is None else time.time() - start)
+                except Empty:
+                    continue
 
-            frame = self._frame_decoder.decode(f)
+                frame = self._frame_decoder.decode(f)
+
+            # short responses packed together by OBC are returned one by one
+            packed_frames = getattr(frame, 'packed_frames', None)
+            if packed_frames is not None:
+                self._unpacked += packed_frames
+                continue
 
             if filter_type is not None:
                 if not isinstance(frame, filter_type):
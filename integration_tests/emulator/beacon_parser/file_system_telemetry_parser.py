@@ -6,8 +6,11 @@ class FileSystemTelemetryParser(CategoryParser):
         CategoryParser.__init__(self, '07: File System', reader, store)
 
     def get_bit_count(self):
-        return 32
+        return 40
 
     def parse(self):
-        self.append_dword("Free Space")
+        self.append("Free Space", 24)
+        self.append_byte("Chunk Cache Hit Rate")
+        self.append("Erase Queue Depth", 4)
+        self.append("Longest Erase Stall", 4)
 
@@ -1,4 +1,4 @@
-from emulator.beacon_parser.units import TelemetryUnit
+from emulator.beacon_parser.units import TelemetryUnit, BoolType, TimeFromHalfSeconds
 from parser import CategoryParser
 
 
@@ -71,6 +71,8 @@ class StartupParser(CategoryParser):
         return 7 * 8
 
     def parse(self):
-        self.append_dword("Boot Counter")
+        self.append("Boot Counter", 24)
         self.append_byte("Boot Index", value_type=BootIndex)
         self.append_word("Boot Reason", value_type=BootReason)
+        self.append("Mounted From Checkpoint", 1, value_type=BoolType)
+        self.append("Mount Duration", 7, value_type=TimeFromHalfSeconds)
@@ -43,6 +43,14 @@ class TimeFromSeconds(TelemetryUnit):
         return '{}'.format(self.converted)
 
 
+class TimeFromHalfSeconds(TelemetryUnit):
+    def __init__(self, raw):
+        super(TimeFromHalfSeconds, self).__init__(raw, timedelta(milliseconds=raw * 500))
+
+    def __str__(self):
+        return '{}'.format(self.converted)
+
+
 class TimeFromTwoSeconds(TelemetryUnit):
     def __init__(self, raw):
         super(TimeFromTwoSeconds, self).__init__(raw, timedelta(seconds=raw * 2))
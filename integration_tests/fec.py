@@ -0,0 +1,86 @@
+BLOCK_SIZE = 230
+MAX_DATA_BLOCKS = 128
+POLYNOMIAL = 0x11D
+
+
+def _build_tables():
+    exp = [0] * 512
+    log = [0] * 256
+    x = 1
+    for i in range(0, 255):
+        exp[i] = x
+        log[x] = i
+        x <<= 1
+        if x & 0x100:
+            x ^= POLYNOMIAL
+
+    for i in range(255, 512):
+        exp[i] = exp[i - 255]
+
+    return exp, log
+
+
+_EXP, _LOG = _build_tables()
+
+
+def multiply(a, b):
+    if a == 0 or b == 0:
+        return 0
+
+    return _EXP[_LOG[a] + _LOG[b]]
+
+
+def inverse(a):
+    return _EXP[255 - _LOG[a]]
+
+
+def repair_coefficient(repair_index, data_index):
+    return inverse((MAX_DATA_BLOCKS + repair_index) ^ data_index)
+
+
+def rebuild_group(group_size, parts, repairs, block_size=BLOCK_SIZE):
+    """
+    Rebuilds group of file parts sent by FecDownloadFile (see libs/base/Include/base/erasure.hpp).
+    :param group_size: number of parts in group (K)
+    :param parts: dict: index of part in group -> list of byte values
+    :param repairs: dict: index of repair frame -> list of byte values
+    :param block_size: size of single part
+    :return: list of K parts, each padded with zeros to block_size. None if not enough frames were received
+    """
+    rows = []
+    values = []
+
+    for i, data in parts.items():
+        row = [0] * group_size
+        row[i] = 1
+        rows.append(row)
+        values.append(list(data) + [0] * (block_size - len(data)))
+
+    for j, data in repairs.items():
+        rows.append([repair_coefficient(j, i) for i in range(0, group_size)])
+        values.append(list(data) + [0] * (block_size - len(data)))
+
+    if len(rows) < group_size:
+        return None
+
+    rows = rows[0:group_size]
+    values = values[0:group_size]
+
+    for col in range(0, group_size):
+        pivot = next(r for r in range(col, group_size) if rows[r][col] != 0)
+        rows[col], rows[pivot] = rows[pivot], rows[col]
+        values[col], values[pivot] = values[pivot], values[col]
+
+        scale = inverse(rows[col][col])
+        rows[col] = [multiply(v, scale) for v in rows[col]]
+        values[col] = [multiply(v, scale) for v in values[col]]
+
+        for r in range(0, group_size):
+            factor = rows[r][col]
+            if r == col or factor == 0:
+                continue
+
+            rows[r] = [a ^ multiply(factor, b) for a, b in zip(rows[r], rows[col])]
+            values[r] = [a ^ multiply(factor, b) for a, b in zip(values[r], values[col])]
+
+    return values
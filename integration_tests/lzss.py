@@ -0,0 +1,40 @@
+MIN_MATCH_LENGTH = 3
+
+
+def decompress(data):
+    """
+    Decodes single block compressed by OBC (see libs/base/Include/base/lzss.hpp).
+    :param data: list of byte values
+    :return: list of decompressed byte values
+    """
+    data = list(data)
+    output = []
+    i = 0
+
+    while i < len(data):
+        control = data[i]
+        i += 1
+
+        for bit in range(0, 8):
+            if i >= len(data):
+                break
+
+            if control & (1 << bit) == 0:
+                output.append(data[i])
+                i += 1
+                continue
+
+            if i + 2 > len(data):
+                raise ValueError('Truncated match at offset {}'.format(i))
+
+            distance = data[i] + 1
+            length = data[i + 1] + MIN_MATCH_LENGTH
+            i += 2
+
+            if distance > len(output):
+                raise ValueError('Match distance {} beyond block start'.format(distance))
+
+            for _ in range(0, length):
+                output.append(output[-distance])
+
+    return output
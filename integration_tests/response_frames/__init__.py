@@ -24,6 +24,9 @@ from memory import *
 from file_system import *
 from comm import *
 from time import *
+from telecommand_statistics import *
+from packed import *
+from telemetry_range import *
 
 frame_types = []
 frame_types += map(lambda t: t[1], inspect.getmembers(pong, predicate=inspect.isclass))
@@ -45,6 +48,9 @@ frame_types += map(lambda t: t[1], inspect.getmembers(file_system, predicate=ins
 frame_types += map(lambda t: t[1], inspect.getmembers(comm, predicate=inspect.isclass))
 frame_types += map(lambda t: t[1], inspect.getmembers(time, predicate=inspect.isclass))
 frame_types += map(lambda t: t[1], inspect.getmembers(stop_antenna_deployment, predicate=inspect.isclass))
+frame_types += map(lambda t: t[1], inspect.getmembers(telecommand_statistics, predicate=inspect.isclass))
+frame_types += map(lambda t: t[1], inspect.getmembers(packed, predicate=inspect.isclass))
+frame_types += map(lambda t: t[1], inspect.getmembers(telemetry_range, predicate=inspect.isclass))
 frame_types = filter(lambda t: issubclass(t, ResponseFrame) and t != ResponseFrame, frame_types)
 frame_types = reduce(lambda t, x: t + [x] if x not in t else t, frame_types, [])
 
@@ -105,7 +105,11 @@ class FileSendSuccessFrame(GenericSuccessResponseFrame):
 
 @response_frame(DownlinkApid.FileSend)
 class FileSendErrorFrame(GenericErrorResponseFrame):
-    pass
+    COMPRESSED = 0x06
+
+    @classmethod
+    def matches(cls, payload):
+        return len(payload) >= 2 and payload[1] not in [0, FileSendErrorFrame.COMPRESSED]
 
 
 @response_frame(DownlinkApid.FileList)
@@ -1,8 +1,9 @@
 import struct
 
-from response_frames import response_frame
-from response_frames.common import DownlinkApid, GenericSuccessResponseFrame
+from response_frames import response_frame, ResponseFrame
+from response_frames.common import DownlinkApid, GenericSuccessResponseFrame, FileSendSuccessFrame
 from utils import ensure_string
+import lzss
 
 
 @response_frame(DownlinkApid.FileList)
@@ -29,3 +30,36 @@ class FileListSuccessFrame(GenericSuccessResponseFrame):
         return "{}, #files: {}".format(
             super(FileListSuccessFrame, self).__repr__(),
             len(self.file_list))
+
+
+@response_frame(0x25)
+class FileSendCompletedFrame(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        self.correlation_id = self.payload()[0]
+        (self.status, self.sent, self.resume_seq, self.chunks_count) = struct.unpack(
+            '<BLLL', ensure_string(self.payload()[1:14]))
+
+    def __repr__(self):
+        return "{}: CID={:03d} Status={} Sent={} Resume={} Chunks={}".format(
+            self.__class__.__name__, self.correlation_id, self.status, self.sent, self.resume_seq, self.chunks_count)
+
+
+@response_frame(0x26)
+class FileRepairFrame(GenericSuccessResponseFrame):
+    pass
+
+
+@response_frame(DownlinkApid.FileSend)
+class FileSendCompressedFrame(FileSendSuccessFrame):
+    @classmethod
+    def matches(cls, payload):
+        return len(payload) >= 2 and payload[1] == 0x06
+
+    def decode(self):
+        super(FileSendCompressedFrame, self).decode()
+        self.compressed_size = len(self.response)
+        self.response = lzss.decompress(self.response)
@@ -0,0 +1,36 @@
+from response_frames import response_frame, ResponseFrame
+
+
+def unpack_records(payload):
+    """
+    Splits payload of packed frame into separate downlink frames.
+    :param payload: payload of packed frame (list of byte values)
+    :return: list of raw downlink frames (header with sequence number 0 followed by payload)
+    """
+    frames = []
+    rest = list(payload)
+
+    while len(rest) >= 2:
+        apid = rest[0] & 0x3F
+        length = rest[1]
+
+        if len(rest) < 2 + length:
+            break
+
+        frames.append([apid, 0, 0] + rest[2:2 + length])
+        rest = rest[2 + length:]
+
+    return frames
+
+
+@response_frame(0x27)
+class PackedFrame(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        self.packed_frames = unpack_records(self.payload())
+
+    def __repr__(self):
+        return '{}: {} frames'.format(self.__class__.__name__, len(self.packed_frames))
@@ -0,0 +1,103 @@
+import struct
+
+from response_frames import response_frame, ResponseFrame
+
+
+class TelecommandStatisticsEntry(object):
+    def __init__(self, code, invocations, failures, worst_execution_time):
+        self.code = code
+        self.invocations = invocations
+        self.failures = failures
+        self.worst_execution_time = worst_execution_time
+
+    def __repr__(self):
+        return 'TC 0x{:02X}: invocations={} failures={} worst={}ms'.format(
+            self.code, self.invocations, self.failures, self.worst_execution_time)
+
+
+@response_frame(0x24)
+class TelecommandStatisticsFrame(ResponseFrame):
+    ENTRY_SIZE = 7
+
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        self.correlation_id = self.payload()[0]
+        self.status = self.payload()[1]
+        self.entries = []
+
+        data = bytearray(self.payload()[2:])
+        for offset in range(0, len(data) - self.ENTRY_SIZE + 1, self.ENTRY_SIZE):
+            (code, invocations, failures, worst) = struct.unpack_from('<BHHH', data, offset)
+            self.entries.append(TelecommandStatisticsEntry(code, invocations, failures, worst))
+
+    def __str__(self):
+        return 'Telecommand statistics (Correlation {}, {} entries)'.format(self.correlation_id, len(self.entries))
+
+
+class ExecutionLaneStatistics(object):
+    def __init__(self, executed, rejected, depth, max_depth, last_wait, max_wait):
+        self.executed = executed
+        self.rejected = rejected
+        self.depth = depth
+        self.max_depth = max_depth
+        self.last_wait = last_wait
+        self.max_wait = max_wait
+
+    def __repr__(self):
+        return 'executed={} rejected={} depth={}/{} wait={}/{}ms'.format(
+            self.executed, self.rejected, self.depth, self.max_depth, self.last_wait, self.max_wait)
+
+
+@response_frame(0x2A)
+class LinkStatisticsFrame(ResponseFrame):
+    LANE_SIZE = 14
+
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        self.correlation_id = self.payload()[0]
+        self.status = self.payload()[1]
+
+        data = bytearray(self.payload()[2:])
+        (self.polls, self.frame_polls,
+         self.polling_interval, self.last_latency, self.max_latency, self.average_latency) = struct.unpack_from('<LLHHHH', data, 0)
+
+        offset = struct.calcsize('<LLHHHH')
+        (self.fast_lane, self.normal_lane) = [
+            ExecutionLaneStatistics(*struct.unpack_from('<LLBBHH', data, offset + i * self.LANE_SIZE)) for i in range(2)]
+
+        offset += 2 * self.LANE_SIZE
+        (self.avoided_transactions,) = struct.unpack_from('<L', data, offset)
+
+        offset += struct.calcsize('<L')
+        (self.downlink_sent, self.downlink_rejected, self.downlink_dropped, self.downlink_overflows, self.downlink_packed,
+         self.downlink_free_slots) = struct.unpack_from('<LLLLLB', data, offset)
+
+        offset += struct.calcsize('<LLLLLB')
+        self.sent_per_bitrate = dict(zip([1200, 2400, 4800, 9600], struct.unpack_from('<LLLL', data, offset)))
+
+    def __str__(self):
+        return 'Link statistics (Correlation {})'.format(self.correlation_id)
+
+
+@response_frame(0x2B)
+class TurnaroundStatisticsFrame(ResponseFrame):
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        self.correlation_id = self.payload()[0]
+        self.status = self.payload()[1]
+
+        data = bytearray(self.payload()[2:])
+        (self.minimum_turnaround, self.exchanges, self.nacks, self.failures, self.longest) = struct.unpack_from('<HLLLH', data, 0)
+        self.histogram = list(struct.unpack_from('<LLLLLL', data, struct.calcsize('<HLLLH')))
+
+    def __str__(self):
+        return 'Turnaround statistics (Correlation {})'.format(self.correlation_id)
@@ -0,0 +1,27 @@
+import struct
+
+from response_frames import response_frame, ResponseFrame
+from response_frames.common import GenericSuccessResponseFrame
+from utils import ensure_string
+
+
+@response_frame(0x28)
+class TelemetryRangeFrame(GenericSuccessResponseFrame):
+    pass
+
+
+@response_frame(0x29)
+class TelemetryRangeCompletedFrame(ResponseFrame):
+    LIMIT_REACHED = 0x05
+
+    @classmethod
+    def matches(cls, payload):
+        return True
+
+    def decode(self):
+        self.correlation_id = self.payload()[0]
+        (self.status, self.sent, self.last_time) = struct.unpack('<BLQ', ensure_string(self.payload()[1:14]))
+
+    def __repr__(self):
+        return "{}: CID={:03d} Status={} Sent={} LastTime={}".format(
+            self.__class__.__name__, self.correlation_id, self.status, self.sent, self.last_time)
@@ -10,6 +10,7 @@ from utils import ensure_string
 obc_path = sys.argv[1]
 length = int(sys.argv[2])
 local_file = sys.argv[3]
+compressed = len(sys.argv) > 4 and sys.argv[4] == 'compressed'
 
 chunks_count = int(ceil(length / 230.0))
 
@@ -29,7 +30,7 @@ with open(local_file, 'wb') as local:
         chunks = range(*r)
 
         print 'Requesting...'
-        system.comm.put_frame(DownloadFile(0x45, obc_path, chunks))
+        system.comm.put_frame(DownloadFile(0x45, obc_path, chunks, compressed))
 
         while len(chunks) > 0:
             print '\tWaiting for chunks {}:'.format(chunks)
@@ -38,7 +39,7 @@ with open(local_file, 'wb') as local:
             except Empty:
                 print '\t\tTimeout waiting for frame'
 
-            if type(part) is not FileSendSuccessFrame:
+            if not isinstance(part, FileSendSuccessFrame):
                 print '\t\tIgnoring {} (not success)'.format(part)
                 continue
 
@@ -19,9 +19,15 @@ from eps import *
 from adcs import *
 from memory import *
 from ping import *
+from telecommand_statistics import *
+from telemetry_range import *
 
 __all__ = [
     'DownloadFile',
+    'SelectiveDownloadFile',
+    'FecDownloadFile',
+    'AbortTransfer',
+    'DownloadTelemetryRange',
     'EnterIdleState',
     'RemoveFile',
     'PerformDetumblingExperiment',
@@ -63,6 +69,11 @@ __all__ = [
     'StopSailDeployment',
     'ReadMemory',
     'PingTelecommand',
+    'GetTelecommandStatistics',
+    'GetLinkStatistics',
+    'ExpectPass',
+    'SetMinimumTurnaround',
+    'GetTurnaroundStatistics',
     'CorrelatedTelecommand'
 ]
 
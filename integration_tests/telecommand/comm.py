@@ -50,3 +50,28 @@ class SetBitrate(CorrelatedTelecommand):
         return "{}, bitrate={}".format(
             super(SetBitrate, self).__repr__(),
             self._bitrate)
+
+
+class ExpectPass(CorrelatedTelecommand):
+    def __init__(self, correlation_id, duration):
+        super(ExpectPass, self).__init__(correlation_id)
+        self._duration = duration
+
+    def apid(self):
+        return 0x2C
+
+    def payload(self):
+        return struct.pack('<BH', self._correlation_id, self._duration)
+
+
+class SetMinimumTurnaround(CorrelatedTelecommand):
+    def __init__(self, correlation_id, command, turnaround):
+        super(SetMinimumTurnaround, self).__init__(correlation_id)
+        self._command = command
+        self._turnaround = turnaround
+
+    def apid(self):
+        return 0x2F
+
+    def payload(self):
+        return struct.pack('<BBB', self._correlation_id, self._command, self._turnaround)
@@ -4,19 +4,24 @@ from telecommand.base import Telecommand, CorrelatedTelecommand
 from utils import ensure_byte_list
 
 
+COMPRESSION_FLAG = 0x80
+
+
 class DownloadFile(CorrelatedTelecommand):
-    def __init__(self, correlation_id, path, seqs):
+    def __init__(self, correlation_id, path, seqs, compressed=False):
         super(DownloadFile, self).__init__(correlation_id)
         self._path = path
         self._seqs = seqs
+        self._compressed = compressed
 
     def apid(self):
         return 0xAB
 
     def payload(self):
         seqs_bytes = ensure_byte_list(struct.pack('<' + 'L' * len(self._seqs), *self._seqs))
+        path_length = len(self._path) | (COMPRESSION_FLAG if self._compressed else 0)
 
-        return [self._correlation_id, len(self._path)] + list(self._path) + [0x0] + seqs_bytes
+        return [self._correlation_id, path_length] + list(self._path) + [0x0] + seqs_bytes
 
     def __repr__(self):
         return "{}, cid={:02d}, {} chunks of '{}'".format(
@@ -25,6 +30,99 @@ class DownloadFile(CorrelatedTelecommand):
             len(self._seqs), self._path)
 
 
+class SelectiveDownloadFile(CorrelatedTelecommand):
+    BITMAP = 0x01
+    RANGE = 0x02
+
+    def __init__(self, correlation_id, path, seqs, start_seq=None, compressed=False):
+        super(SelectiveDownloadFile, self).__init__(correlation_id)
+        self._compressed = compressed
+        self._path = path
+        self._seqs = sorted(set(seqs))
+        self._start_seq = self._seqs[0] if start_seq is None and len(self._seqs) > 0 else (start_seq or 0)
+
+    def apid(self):
+        return 0xB3
+
+    def _selectors(self):
+        result = []
+        cursor = self._start_seq
+        seqs = [s for s in self._seqs if s >= cursor]
+
+        while len(seqs) > 0:
+            run = 1
+            while run < len(seqs) and seqs[run] == seqs[0] + run and run < 0xFFFF:
+                run += 1
+
+            if run >= 4 or seqs[0] - cursor >= 16:
+                result += list(struct.pack('<BHH', self.RANGE, seqs[0] - cursor, run))
+                cursor = seqs[0] + run
+                seqs = seqs[run:]
+                continue
+
+            last = 0
+            while last + 1 < len(seqs) and seqs[last + 1] - seqs[last] <= 16 and seqs[last + 1] - cursor < 0xFF * 8:
+                last += 1
+
+            bitmap_length = ((seqs[last] - cursor) // 8) + 1
+            bitmap = [0] * bitmap_length
+            while len(seqs) > 0 and seqs[0] < cursor + bitmap_length * 8:
+                bitmap[(seqs[0] - cursor) // 8] |= 1 << ((seqs[0] - cursor) % 8)
+                seqs = seqs[1:]
+
+            result += [self.BITMAP, bitmap_length] + bitmap
+            cursor += bitmap_length * 8
+
+        return result
+
+    def payload(self):
+        start_seq_bytes = ensure_byte_list(struct.pack('<L', self._start_seq))
+        selectors = ensure_byte_list(self._selectors())
+        path_length = len(self._path) | (COMPRESSION_FLAG if self._compressed else 0)
+
+        return [self._correlation_id, path_length] + list(self._path) + [0x0] + start_seq_bytes + selectors
+
+    def __repr__(self):
+        return "{}, cid={:02d}, {} chunks of '{}' from {}".format(
+            super(SelectiveDownloadFile, self).__repr__(),
+            self._correlation_id,
+            len(self._seqs), self._path, self._start_seq)
+
+
+class FecDownloadFile(CorrelatedTelecommand):
+    def __init__(self, correlation_id, path, groups, group_size, repair_count):
+        super(FecDownloadFile, self).__init__(correlation_id)
+        self._path = path
+        self._groups = groups
+        self._group_size = group_size
+        self._repair_count = repair_count
+
+    def apid(self):
+        return 0xB4
+
+    def payload(self):
+        groups_bytes = ensure_byte_list(struct.pack('<' + 'L' * len(self._groups), *self._groups))
+
+        return [self._correlation_id, len(self._path)] + list(self._path) + [0x0, self._group_size, self._repair_count] + groups_bytes
+
+    def __repr__(self):
+        return "{}, cid={:02d}, {} groups ({}+{}) of '{}'".format(
+            super(FecDownloadFile, self).__repr__(),
+            self._correlation_id,
+            len(self._groups), self._group_size, self._repair_count, self._path)
+
+
+class AbortTransfer(CorrelatedTelecommand):
+    def __init__(self, correlation_id):
+        super(AbortTransfer, self).__init__(correlation_id)
+
+    def apid(self):
+        return 0x2E
+
+    def payload(self):
+        return [self._correlation_id]
+
+
 class RemoveFile(CorrelatedTelecommand):
     def __init__(self, correlation_id, path):
         super(RemoveFile, self).__init__(correlation_id)
@@ -0,0 +1,38 @@
+import struct
+
+from telecommand.base import CorrelatedTelecommand
+
+
+class GetTelecommandStatistics(CorrelatedTelecommand):
+    def __init__(self, correlation_id, first_code=0):
+        super(GetTelecommandStatistics, self).__init__(correlation_id)
+        self.first_code = first_code
+
+    def apid(self):
+        return 0x2A
+
+    def payload(self):
+        return struct.pack('<BB', self._correlation_id, self.first_code)
+
+
+class GetLinkStatistics(CorrelatedTelecommand):
+    def __init__(self, correlation_id):
+        super(GetLinkStatistics, self).__init__(correlation_id)
+
+    def apid(self):
+        return 0x2B
+
+    def payload(self):
+        return [self._correlation_id]
+
+
+class GetTurnaroundStatistics(CorrelatedTelecommand):
+    def __init__(self, correlation_id, command):
+        super(GetTurnaroundStatistics, self).__init__(correlation_id)
+        self.command = command
+
+    def apid(self):
+        return 0x30
+
+    def payload(self):
+        return struct.pack('<BB', self._correlation_id, self.command)
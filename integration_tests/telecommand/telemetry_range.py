@@ -0,0 +1,25 @@
+import struct
+
+from telecommand.base import CorrelatedTelecommand
+from utils import ensure_byte_list
+
+
+class DownloadTelemetryRange(CorrelatedTelecommand):
+    def __init__(self, correlation_id, from_time, to_time, stride=1, limit=0):
+        super(DownloadTelemetryRange, self).__init__(correlation_id)
+        self._from = from_time
+        self._to = to_time
+        self._stride = stride
+        self._limit = limit
+
+    def apid(self):
+        return 0xB5
+
+    def payload(self):
+        return [self._correlation_id] + ensure_byte_list(struct.pack('<QQHH', self._from, self._to, self._stride, self._limit))
+
+    def __repr__(self):
+        return "{}, cid={:02d}, [{}, {}] ms, stride={}, limit={}".format(
+            super(DownloadTelemetryRange, self).__repr__(),
+            self._correlation_id,
+            self._from, self._to, self._stride, self._limit)
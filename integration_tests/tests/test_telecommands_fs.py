@@ -1,8 +1,9 @@
 import struct
 
+import fec
 import telecommand
-from response_frames.common import FileRemoveErrorFrame, FileSendErrorFrame, FileRemoveSuccessFrame
-from response_frames.file_system import FileListSuccessFrame
+from response_frames.common import FileRemoveErrorFrame, FileSendErrorFrame, FileRemoveSuccessFrame, FileSendSuccessFrame
+from response_frames.file_system import FileListSuccessFrame, FileSendCompressedFrame, FileRepairFrame, FileSendCompletedFrame
 from response_frames.common import DownlinkApid
 from system import auto_power_on, runlevel
 from tests.base import RestartPerTest
@@ -53,6 +54,64 @@ class FileSystemTelecommandsTest(RestartPerTest):
 
         self.assertAlmostEqual(received, data)
 
+    @runlevel(2)
+    def test_receive_compressed_multipart_file(self):
+        self._start()
+
+        data = ''.join(map(lambda x: x * 300, ['A', 'B', 'C'])) + '\xAA' * 480
+
+        p = "/test"
+
+        self.system.obc.write_file(p, data)
+
+        self.system.comm.put_frame(telecommand.DownloadFile(correlation_id=0x11, path=p, seqs=range(0, 6), compressed=True))
+
+        frames = [self.system.comm.get_frame(20)] + [self.system.comm.get_frame(1) for _ in range(0, 5)]
+
+        frames = sorted(frames, key=lambda x: x.seq())
+
+        received = ''
+        for f in frames:
+            self.assertIsInstance(f, FileSendSuccessFrame)
+            received += ''.join([chr(b) for b in f.response])
+
+        self.assertEqual(received, data)
+        self.assertTrue(any(isinstance(f, FileSendCompressedFrame) for f in frames))
+
+    @runlevel(2)
+    def test_receive_file_with_erasure_coding(self):
+        self._start()
+
+        data = ''.join(map(lambda x: x * 230, ['A', 'B', 'C', 'D', 'E'])) + 'F' * 100
+
+        p = "/test"
+
+        self.system.obc.write_file(p, data)
+
+        self.system.comm.put_frame(telecommand.FecDownloadFile(correlation_id=0x11, path=p, groups=[0, 1], group_size=4, repair_count=2))
+
+        parts = {}
+        repairs = {}
+        while True:
+            frame = self.system.comm.get_frame(20)
+            if isinstance(frame, FileSendCompletedFrame):
+                break
+
+            if isinstance(frame, FileRepairFrame):
+                repairs[frame.seq()] = frame.response
+            else:
+                parts[frame.seq()] = frame.response
+
+        self.assertEqual(frame.status, 0)
+        self.assertEqual(frame.sent, 10)
+        self.assertEqual(frame.chunks_count, 6)
+
+        # drop two parts of first group and rebuild them from repair frames
+        group = fec.rebuild_group(4, {0: parts[0], 3: parts[3]}, {0: repairs[0], 1: repairs[1]})
+
+        received = ''.join([chr(b) for b in sum(group, [])])
+        self.assertEqual(received, data[0:4 * 230])
+
     @runlevel(2)
     def test_should_respond_with_error_frame_for_non_existent_file_when_downloading(self):
         self._start()
@@ -47,4 +47,11 @@ uint16_t CRC_calc(uint8_t* start, uint8_t* end);
  */
 uint16_t CRC_calc(gsl::span<const uint8_t> buffer);
 
+/**
+ * @brief Calculates CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320) for given area
+ * @param buffer Span containing area
+ * @return Calculated crc
+ */
+uint32_t CRC32_calc(gsl::span<const uint8_t> buffer);
+
 #endif
@@ -0,0 +1,77 @@
+#ifndef LIBS_BASE_INCLUDE_BASE_ERASURE_HPP_
+#define LIBS_BASE_INCLUDE_BASE_ERASURE_HPP_
+
+#include <cstdint>
+#include <gsl/span>
+
+namespace erasure
+{
+    /**
+     * @defgroup erasure Erasure coding
+     * @ingroup base
+     *
+     * @brief Systematic erasure code over GF(2^8) for groups of equally sized blocks.
+     *
+     * Group of K data blocks is extended with M repair blocks. Repair block j is a linear combination of
+     * data blocks: R_j = sum(C(j, i) * D_i), where C is a Cauchy matrix C(j, i) = 1 / (x_j + y_i) with
+     * x_j = @ref MaxDataBlocks + j and y_i = i. Every square sub-matrix of Cauchy matrix is invertible, so any
+     * K out of K + M blocks are enough to rebuild the whole group (the code is MDS).
+     *
+     * Field uses polynomial x^8 + x^4 + x^3 + x^2 + 1 (0x11D). Logarithm and exponent tables are computed
+     * at compile time and are placed in flash memory.
+     *
+     * Blocks shorter than the rest of the group are treated as padded with zeros.
+     *
+     * @{
+     */
+
+    /** @brief Maximal number of data blocks in group */
+    constexpr std::uint8_t MaxDataBlocks = 128;
+
+    /** @brief Maximal number of repair blocks in group */
+    constexpr std::uint8_t MaxRepairBlocks = 128;
+
+    /**
+     * @brief Multiplies two field elements
+     * @param[in] a First factor
+     * @param[in] b Second factor
+     * @return Product
+     */
+    std::uint8_t Multiply(std::uint8_t a, std::uint8_t b);
+
+    /**
+     * @brief Calculates multiplicative inverse of field element
+     * @param[in] a Non-zero field element
+     * @return Inverse of a. Zero for zero argument.
+     */
+    std::uint8_t Inverse(std::uint8_t a);
+
+    /**
+     * @brief Returns coefficient of data block in repair block
+     * @param[in] repairIndex Index of repair block (0-based, less than @ref MaxRepairBlocks)
+     * @param[in] dataIndex Index of data block (0-based, less than @ref MaxDataBlocks)
+     * @return Coefficient
+     */
+    std::uint8_t RepairCoefficient(std::uint8_t repairIndex, std::uint8_t dataIndex);
+
+    /**
+     * @brief Adds data block multiplied by coefficient to repair block
+     * @param[inout] repair Repair block
+     * @param[in] data Data block. Must not be longer than repair block.
+     * @param[in] coefficient Coefficient
+     */
+    void Accumulate(gsl::span<std::uint8_t> repair, gsl::span<const std::uint8_t> data, std::uint8_t coefficient);
+
+    /**
+     * @brief Adds data block to all repair blocks of group
+     * @param[inout] repairs Repair blocks laid out one after another, each of data block size
+     * @param[in] blockSize Size of single block
+     * @param[in] dataIndex Index of data block in group
+     * @param[in] data Data block. Must not be longer than blockSize.
+     */
+    void Encode(gsl::span<std::uint8_t> repairs, std::size_t blockSize, std::uint8_t dataIndex, gsl::span<const std::uint8_t> data);
+
+    /** @} */
+}
+
+#endif /* LIBS_BASE_INCLUDE_BASE_ERASURE_HPP_ */
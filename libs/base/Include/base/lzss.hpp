@@ -0,0 +1,55 @@
+#ifndef LIBS_BASE_INCLUDE_BASE_LZSS_HPP_
+#define LIBS_BASE_INCLUDE_BASE_LZSS_HPP_
+
+#include <cstdint>
+#include <gsl/span>
+
+namespace lzss
+{
+    /**
+     * @defgroup lzss Block compression
+     * @ingroup base
+     *
+     * @brief Small footprint LZSS compression of independent blocks.
+     *
+     * Compressed block is a sequence of groups. Each group starts with control byte followed by up to 8 tokens.
+     * Bit i (LSB first) of control byte describes i-th token in group:
+     *  - 0 - literal: single byte copied to output
+     *  - 1 - match: two bytes - distance minus 1 and length minus @ref MinMatchLength. Match copies bytes
+     *    starting distance bytes before current output position (source and destination may overlap)
+     *
+     * Window is limited to the block itself so each block can be decoded without any other data.
+     * Neither compression nor decompression uses memory other than provided buffers.
+     *
+     * @{
+     */
+
+    /** @brief Shortest encoded match */
+    constexpr std::uint16_t MinMatchLength = 3;
+
+    /** @brief Longest encoded match */
+    constexpr std::uint16_t MaxMatchLength = MinMatchLength + 0xFF;
+
+    /** @brief Largest distance of encoded match */
+    constexpr std::uint16_t MaxDistance = 0x100;
+
+    /**
+     * @brief Compresses single block.
+     * @param[in] input Data to compress
+     * @param[in] output Buffer for compressed data
+     * @return Part of output buffer containing compressed data. Empty span if output buffer is too small.
+     */
+    gsl::span<std::uint8_t> Compress(gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output);
+
+    /**
+     * @brief Decompresses single block.
+     * @param[in] input Compressed data
+     * @param[in] output Buffer for decompressed data
+     * @return Part of output buffer containing decompressed data. Empty span if input is malformed or output buffer is too small.
+     */
+    gsl::span<std::uint8_t> Decompress(gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output);
+
+    /** @} */
+}
+
+#endif /* LIBS_BASE_INCLUDE_BASE_LZSS_HPP_ */
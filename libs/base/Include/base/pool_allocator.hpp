@@ -0,0 +1,190 @@
+#ifndef LIBS_BASE_INCLUDE_BASE_POOL_ALLOCATOR_HPP_
+#define LIBS_BASE_INCLUDE_BASE_POOL_ALLOCATOR_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gsl/span>
+#include "utils.h"
+
+namespace memory
+{
+    /**
+     * @defgroup pool_allocator Fixed-size block pool allocator
+     * @ingroup base
+     *
+     * @brief Allocator serving requests from pools of equally sized blocks.
+     *
+     * Every size class owns contiguous part of single arena, divided into blocks linked into free list. Request is
+     * served by the class with the smallest block that fits it, so both allocation and release take constant time
+     * and released block can always be reused by next request of the same class. Allocator never falls back to
+     * another class: if the matching class is exhausted (or request is larger than every block) null pointer is
+     * returned and caller is expected to use general purpose heap instead.
+     *
+     * @{
+     */
+
+    /**
+     * @brief Size class of @ref PoolAllocator
+     */
+    struct PoolClass
+    {
+        /** @brief Size of single block in bytes */
+        std::size_t BlockSize;
+        /** @brief Number of blocks */
+        std::size_t Capacity;
+    };
+
+    /**
+     * @brief Usage statistics of single size class
+     */
+    struct PoolStatistics
+    {
+        /** @brief Size of single block in bytes (after alignment) */
+        std::size_t BlockSize;
+        /** @brief Number of blocks */
+        std::uint16_t Capacity;
+        /** @brief Number of allocated blocks */
+        std::uint16_t InUse;
+        /** @brief Highest number of blocks allocated at the same time */
+        std::uint16_t HighWaterMark;
+        /** @brief Number of requests that matched this class when all its blocks were allocated */
+        std::uint32_t Overflows;
+    };
+
+    /**
+     * @brief Size-class allocator built on fixed-size block pools
+     *
+     * Allocator must be initialized with arena of at least @ref ArenaSize bytes before use. Until then every request
+     * is left to the caller.
+     */
+    class PoolAllocator : private NotCopyable, private NotMoveable
+    {
+      public:
+        /** @brief Alignment of every block */
+        static constexpr std::size_t Alignment = 8;
+
+        /**
+         * @brief State of single size class
+         */
+        struct Pool
+        {
+            /** @brief Free block (overlays block memory) */
+            struct FreeBlock
+            {
+                /** @brief Next free block */
+                FreeBlock* Next;
+            };
+
+            /** @brief Size class */
+            PoolClass Class;
+            /** @brief First byte of pool memory */
+            std::uint8_t* Begin;
+            /** @brief First byte past pool memory */
+            std::uint8_t* End;
+            /** @brief Free blocks */
+            FreeBlock* FreeList;
+            /** @brief Number of allocated blocks */
+            std::uint16_t InUse;
+            /** @brief Highest number of blocks allocated at the same time */
+            std::uint16_t HighWaterMark;
+            /** @brief Number of requests that matched this class when all its blocks were allocated */
+            std::uint32_t Overflows;
+        };
+
+        /**
+         * @brief Constructs @ref PoolAllocator instance
+         * @param[in] pools Size classes storage. Class of each pool must be set before use.
+         */
+        PoolAllocator(gsl::span<Pool> pools);
+
+        /**
+         * @brief Calculates arena size required by all size classes
+         * @return Arena size in bytes
+         */
+        std::size_t ArenaSize() const;
+
+        /**
+         * @brief Divides arena into blocks and resets statistics
+         * @param[in] arena Arena aligned to @ref Alignment
+         * @return true on success, false if arena is not aligned or is too small (allocator stays disabled)
+         *
+         * Blocks allocated from previous arena must not be used anymore.
+         */
+        bool Initialize(gsl::span<std::uint8_t> arena);
+
+        /**
+         * @brief Allocates block from the smallest size class that fits request
+         * @param[in] size Requested size
+         * @return Pointer to allocated block or nullptr if there is no free block of matching class
+         */
+        void* Allocate(std::size_t size);
+
+        /**
+         * @brief Returns block to its pool
+         * @param[in] ptr Pointer to block
+         * @return true if block belongs to this allocator, false if it must be released elsewhere
+         */
+        bool Free(void* ptr);
+
+        /**
+         * @brief Returns number of size classes
+         * @return Number of size classes
+         */
+        std::size_t Classes() const;
+
+        /**
+         * @brief Returns usage statistics of size class
+         * @param[in] index Size class index
+         * @return Statistics
+         */
+        PoolStatistics Statistics(std::size_t index) const;
+
+      private:
+        /**
+         * @brief Finds the smallest size class that fits request
+         * @param[in] size Requested size
+         * @return Pointer to pool or nullptr if request is larger than every block
+         */
+        Pool* Match(std::size_t size);
+
+        /** @brief Size classes */
+        gsl::span<Pool> _pools;
+    };
+
+    inline std::size_t PoolAllocator::Classes() const
+    {
+        return static_cast<std::size_t>(this->_pools.size());
+    }
+
+    /**
+     * @brief Pool allocator with size classes storage placed in object
+     * @tparam Count Number of size classes
+     */
+    template <std::size_t Count> class StaticPoolAllocator final : public PoolAllocator
+    {
+      public:
+        /**
+         * @brief Constructs @ref StaticPoolAllocator instance
+         * @param[in] classes Size classes
+         */
+        StaticPoolAllocator(const std::array<PoolClass, Count>& classes);
+
+      private:
+        /** @brief Size classes storage */
+        std::array<Pool, Count> _poolsStorage;
+    };
+
+    template <std::size_t Count>
+    StaticPoolAllocator<Count>::StaticPoolAllocator(const std::array<PoolClass, Count>& classes) : PoolAllocator(_poolsStorage)
+    {
+        for (std::size_t i = 0; i < Count; i++)
+        {
+            this->_poolsStorage[i] = Pool{classes[i], nullptr, nullptr, nullptr, 0, 0, 0};
+        }
+    }
+
+    /** @} */
+}
+
+#endif /* LIBS_BASE_INCLUDE_BASE_POOL_ALLOCATOR_HPP_ */
@@ -44,6 +44,40 @@ uint16_t CRC_calc(uint8_t* start, uint8_t* end)
     return crc;
 }
 
+namespace
+{
+    /** @brief Lookup table for byte-wise CRC-32 calculation */
+    struct CRC32Table
+    {
+        /** @brief CRC of each byte value */
+        uint32_t Entries[256];
+    };
+
+    /**
+     * @brief Generates CRC-32 lookup table
+     * @return Lookup table
+     */
+    constexpr CRC32Table GenerateCRC32Table()
+    {
+        CRC32Table table{};
+
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t crc = i;
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+            }
+
+            table.Entries[i] = crc;
+        }
+
+        return table;
+    }
+
+    constexpr CRC32Table Table32 = GenerateCRC32Table();
+}
+
 uint16_t CRC_calc(gsl::span<const uint8_t> buffer)
 {
     uint16_t crc = 0;
@@ -58,3 +92,15 @@ uint16_t CRC_calc(gsl::span<const uint8_t> buffer)
     }
     return crc;
 }
+
+uint32_t CRC32_calc(gsl::span<const uint8_t> buffer)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (auto data : buffer)
+    {
+        crc = (crc >> 8) ^ Table32.Entries[(crc ^ data) & 0xFF];
+    }
+
+    return crc ^ 0xFFFFFFFF;
+}
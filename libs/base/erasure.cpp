@@ -0,0 +1,101 @@
+#include "erasure.hpp"
+
+namespace erasure
+{
+    namespace
+    {
+        /**
+         * @brief Logarithm and exponent tables of GF(2^8)
+         */
+        struct FieldTables
+        {
+            constexpr FieldTables() : Exp(), Log()
+            {
+                std::uint16_t x = 1;
+                for (std::uint16_t i = 0; i < 255; i++)
+                {
+                    Exp[i] = static_cast<std::uint8_t>(x);
+                    Log[x] = static_cast<std::uint8_t>(i);
+
+                    x <<= 1;
+                    if ((x & 0x100) != 0)
+                    {
+                        x ^= Polynomial;
+                    }
+                }
+
+                for (std::uint16_t i = 255; i < 512; i++)
+                {
+                    Exp[i] = Exp[i - 255];
+                }
+            }
+
+            /** @brief Field generator polynomial */
+            static constexpr std::uint16_t Polynomial = 0x11D;
+
+            /** @brief Powers of generator, doubled to avoid modulo reduction of summed logarithms */
+            std::uint8_t Exp[512];
+
+            /** @brief Logarithms of non-zero field elements */
+            std::uint8_t Log[256];
+        };
+
+        constexpr FieldTables Field{};
+    }
+
+    std::uint8_t Multiply(std::uint8_t a, std::uint8_t b)
+    {
+        if (a == 0 || b == 0)
+        {
+            return 0;
+        }
+
+        return Field.Exp[Field.Log[a] + Field.Log[b]];
+    }
+
+    std::uint8_t Inverse(std::uint8_t a)
+    {
+        if (a == 0)
+        {
+            return 0;
+        }
+
+        return Field.Exp[255 - Field.Log[a]];
+    }
+
+    std::uint8_t RepairCoefficient(std::uint8_t repairIndex, std::uint8_t dataIndex)
+    {
+        return Inverse((MaxDataBlocks + repairIndex) ^ dataIndex);
+    }
+
+    void Accumulate(gsl::span<std::uint8_t> repair, gsl::span<const std::uint8_t> data, std::uint8_t coefficient)
+    {
+        if (coefficient == 0)
+        {
+            return;
+        }
+
+        const std::uint8_t logCoefficient = Field.Log[coefficient];
+        auto out = repair.begin();
+
+        for (auto value : data)
+        {
+            if (value != 0)
+            {
+                *out ^= Field.Exp[Field.Log[value] + logCoefficient];
+            }
+
+            ++out;
+        }
+    }
+
+    void Encode(gsl::span<std::uint8_t> repairs, std::size_t blockSize, std::uint8_t dataIndex, gsl::span<const std::uint8_t> data)
+    {
+        const auto count = repairs.size() / blockSize;
+
+        for (std::size_t j = 0; j < count; j++)
+        {
+            Accumulate(repairs.subspan(j * blockSize, blockSize), data, RepairCoefficient(static_cast<std::uint8_t>(j), dataIndex));
+        }
+    }
+}
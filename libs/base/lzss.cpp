@@ -0,0 +1,130 @@
+#include "lzss.hpp"
+#include <algorithm>
+
+namespace lzss
+{
+    gsl::span<std::uint8_t> Compress(gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output)
+    {
+        const std::ptrdiff_t inputSize = input.size();
+        const std::ptrdiff_t outputSize = output.size();
+
+        std::ptrdiff_t in = 0;
+        std::ptrdiff_t out = 0;
+        std::ptrdiff_t control = 0;
+        std::uint8_t bit = 8;
+
+        while (in < inputSize)
+        {
+            if (bit == 8)
+            {
+                if (out >= outputSize)
+                {
+                    return {};
+                }
+
+                control = out++;
+                output[control] = 0;
+                bit = 0;
+            }
+
+            std::ptrdiff_t bestLength = 0;
+            std::ptrdiff_t bestDistance = 0;
+            const std::ptrdiff_t maxLength = std::min<std::ptrdiff_t>(MaxMatchLength, inputSize - in);
+
+            for (std::ptrdiff_t candidate = in - 1; candidate >= std::max<std::ptrdiff_t>(0, in - MaxDistance); candidate--)
+            {
+                std::ptrdiff_t length = 0;
+                while (length < maxLength && input[candidate + length] == input[in + length])
+                {
+                    length++;
+                }
+
+                if (length > bestLength)
+                {
+                    bestLength = length;
+                    bestDistance = in - candidate;
+
+                    if (length == maxLength)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if (bestLength >= MinMatchLength)
+            {
+                if (out + 2 > outputSize)
+                {
+                    return {};
+                }
+
+                output[control] |= (1 << bit);
+                output[out++] = static_cast<std::uint8_t>(bestDistance - 1);
+                output[out++] = static_cast<std::uint8_t>(bestLength - MinMatchLength);
+                in += bestLength;
+            }
+            else
+            {
+                if (out + 1 > outputSize)
+                {
+                    return {};
+                }
+
+                output[out++] = input[in++];
+            }
+
+            bit++;
+        }
+
+        return output.subspan(0, out);
+    }
+
+    gsl::span<std::uint8_t> Decompress(gsl::span<const std::uint8_t> input, gsl::span<std::uint8_t> output)
+    {
+        const std::ptrdiff_t inputSize = input.size();
+        const std::ptrdiff_t outputSize = output.size();
+
+        std::ptrdiff_t in = 0;
+        std::ptrdiff_t out = 0;
+
+        while (in < inputSize)
+        {
+            const auto control = input[in++];
+
+            for (std::uint8_t bit = 0; bit < 8 && in < inputSize; bit++)
+            {
+                if ((control & (1 << bit)) == 0)
+                {
+                    if (out >= outputSize)
+                    {
+                        return {};
+                    }
+
+                    output[out++] = input[in++];
+                    continue;
+                }
+
+                if (in + 2 > inputSize)
+                {
+                    return {};
+                }
+
+                const std::ptrdiff_t distance = input[in] + 1;
+                const std::ptrdiff_t length = input[in + 1] + MinMatchLength;
+                in += 2;
+
+                if (distance > out || out + length > outputSize)
+                {
+                    return {};
+                }
+
+                for (std::ptrdiff_t i = 0; i < length; i++, out++)
+                {
+                    output[out] = output[out - distance];
+                }
+            }
+        }
+
+        return output.subspan(0, out);
+    }
+}
@@ -0,0 +1,147 @@
+#include "pool_allocator.hpp"
+#include <algorithm>
+#include "os.h"
+
+using namespace memory;
+
+constexpr std::size_t PoolAllocator::Alignment;
+
+/**
+ * @brief Rounds block size up to allocator alignment
+ * @param[in] size Block size
+ * @return Aligned block size
+ */
+static constexpr std::size_t AlignedSize(std::size_t size)
+{
+    return (std::max<std::size_t>(size, sizeof(PoolAllocator::Pool::FreeBlock)) + PoolAllocator::Alignment - 1) &
+        ~(PoolAllocator::Alignment - 1);
+}
+
+PoolAllocator::PoolAllocator(gsl::span<Pool> pools) : _pools(pools)
+{
+}
+
+std::size_t PoolAllocator::ArenaSize() const
+{
+    std::size_t size = 0;
+
+    for (auto& pool : this->_pools)
+    {
+        size += AlignedSize(pool.Class.BlockSize) * pool.Class.Capacity;
+    }
+
+    return size;
+}
+
+bool PoolAllocator::Initialize(gsl::span<std::uint8_t> arena)
+{
+    for (auto& pool : this->_pools)
+    {
+        pool = Pool{pool.Class, nullptr, nullptr, nullptr, 0, 0, 0};
+    }
+
+    if (reinterpret_cast<std::uintptr_t>(arena.data()) % Alignment != 0 || static_cast<std::size_t>(arena.size()) < ArenaSize())
+    {
+        return false;
+    }
+
+    auto next = arena.data();
+
+    for (auto& pool : this->_pools)
+    {
+        const auto blockSize = AlignedSize(pool.Class.BlockSize);
+
+        pool.Begin = next;
+        pool.End = next + blockSize * pool.Class.Capacity;
+
+        // blocks are linked in address order, so first allocations are placed at the beginning of pool
+        for (auto block = pool.End; block != pool.Begin;)
+        {
+            block -= blockSize;
+
+            auto free = reinterpret_cast<Pool::FreeBlock*>(block);
+            free->Next = pool.FreeList;
+            pool.FreeList = free;
+        }
+
+        next = pool.End;
+    }
+
+    return true;
+}
+
+void* PoolAllocator::Allocate(std::size_t size)
+{
+    auto pool = Match(size);
+    if (pool == nullptr || pool->Begin == nullptr)
+    {
+        return nullptr;
+    }
+
+    CriticalSection cs;
+
+    auto block = pool->FreeList;
+    if (block == nullptr)
+    {
+        pool->Overflows++;
+        return nullptr;
+    }
+
+    pool->FreeList = block->Next;
+    pool->InUse++;
+    pool->HighWaterMark = std::max(pool->HighWaterMark, pool->InUse);
+
+    return block;
+}
+
+bool PoolAllocator::Free(void* ptr)
+{
+    auto address = static_cast<std::uint8_t*>(ptr);
+
+    for (auto& pool : this->_pools)
+    {
+        if (address < pool.Begin || address >= pool.End)
+        {
+            continue;
+        }
+
+        CriticalSection cs;
+
+        auto block = static_cast<Pool::FreeBlock*>(ptr);
+        block->Next = pool.FreeList;
+        pool.FreeList = block;
+        pool.InUse--;
+
+        return true;
+    }
+
+    return false;
+}
+
+PoolStatistics PoolAllocator::Statistics(std::size_t index) const
+{
+    const auto& pool = this->_pools[index];
+
+    CriticalSection cs;
+
+    return PoolStatistics{AlignedSize(pool.Class.BlockSize),
+        static_cast<std::uint16_t>(pool.Class.Capacity),
+        pool.InUse,
+        pool.HighWaterMark,
+        pool.Overflows};
+}
+
+PoolAllocator::Pool* PoolAllocator::Match(std::size_t size)
+{
+    Pool* match = nullptr;
+
+    for (auto& pool : this->_pools)
+    {
+        if (pool.Class.BlockSize >= size && (match == nullptr || pool.Class.BlockSize < match->Class.BlockSize))
+        {
+            match = &pool;
+        }
+    }
+
+    return match;
+}
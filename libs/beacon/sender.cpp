@@ -19,11 +19,9 @@ namespace beacon
     {
         LOG(LOG_LEVEL_INFO, "Send beacon!");
 
-        auto telemetry = this->_telemetry.GetState();
-
         std::chrono::seconds beaconDelay;
 
-        if (!WriteBeaconPayload(telemetry, this->_frame.PayloadWriter()))
+        if (!WriteBeaconPayload(this->_telemetry.GetState(), this->_frame.PayloadWriter()))
         {
             beaconDelay = 5s;
         }
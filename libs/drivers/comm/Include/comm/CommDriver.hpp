@@ -5,6 +5,9 @@
 
 #include "IBeaconController.hpp"
 #include "ITransmitter.hpp"
+#include "PollingScheduler.hpp"
+#include "TelemetryCache.hpp"
+#include "TurnaroundProfile.hpp"
 #include "base/os.h"
 #include "comm.hpp"
 #include "error_counter/error_counter.hpp"
@@ -20,10 +23,12 @@ COMM_BEGIN
  * perform requested action.
  */
 
-class CommObject final : public ITransmitter,      //
-                         public IBeaconController, //
+class CommObject final : public IBufferedTransmitter, //
+                         public IBeaconController,    //
                          public ICommTelemetryProvider,
-                         public ICommHardwareObserver
+                         public ICommHardwareObserver,
+                         public IReceiverPolling,
+                         public ICommDiagnostics
 {
   public:
     /**
@@ -85,6 +90,20 @@ class CommObject final : public ITransmitter,      //
      */
     inline void SetFrameHandler(IHandleFrame& handler);
 
+    /**
+     * @brief Selects the way the received frames are downloaded from the hardware.
+     * @param[in] mode Requested receive mode
+     *
+     * In @ref ReceiveMode::SingleTransaction mode every frame is retrieved with single I2C transaction
+     * so draining receiver buffer costs one GetFrame and one RemoveFrame transaction per frame.
+     * In @ref ReceiveMode::Adaptive mode the same holds for frames not longer than the previously received one,
+     * while the size of every transaction follows the length of the received frames.
+     *
+     * @remark This method must be called when COMM driver is suspended (like just after initialisation). No internal synchronization is
+     * performed
+     */
+    inline void SetReceiveMode(ReceiveMode mode);
+
     /**
      * @brief Queries comm driver for a number of received and not yet processed frames.
      *
@@ -106,6 +125,7 @@ class CommObject final : public ITransmitter,      //
      * @return Operation status, true in case of success, false otherwise.
      *
      * The contents of the telemetry object is undefined in case of the failure.
+     * Responses that are still valid in the telemetry cache are not read again from the hardware.
      */
     bool GetReceiverTelemetry(ReceiverTelemetry& telemetry);
 
@@ -116,6 +136,7 @@ class CommObject final : public ITransmitter,      //
      * @return Operation status, true in case of success, false otherwise.
      *
      * The contents of the telemetry object is undefined in case of the failure.
+     * Responses that are still valid in the telemetry cache are not read again from the hardware.
      */
     bool GetTransmitterTelemetry(TransmitterTelemetry& telemetry);
 
@@ -127,6 +148,16 @@ class CommObject final : public ITransmitter,      //
      */
     virtual bool SendFrame(gsl::span<const std::uint8_t> frame) override final;
 
+    /**
+     * @brief Adds the requested frame to the send queue.
+     *
+     * @param[in] frame Buffer containing frame contents.
+     * @param[out] freeSlots Number of free slots in transmitter's buffer after the frame has been added,
+     * 0xFF when the frame has been rejected by the transmitter.
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    virtual bool SendFrame(gsl::span<const std::uint8_t> frame, std::uint8_t& freeSlots) override final;
+
     /**
      * @brief Requests the contents of the oldest received frame from the queue.
      *
@@ -138,6 +169,7 @@ class CommObject final : public ITransmitter,      //
      * The contents of the frame object is undefined in case of the failure.
      * If the buffer too short to fit entire frame and it header only the part of the frame that will
      * fit into this frame will be retrieved, parsed and returned back to the called.
+     * The number of I2C transactions used to retrieve the frame depends on the selected receive mode.
      */
     bool ReceiveFrame(gsl::span<std::uint8_t> buffer, Frame& frame);
 
@@ -220,6 +252,7 @@ class CommObject final : public ITransmitter,      //
      *
      * This function queries the state of the underlying hardware and processes any not yet received frames.
      * Additionally it resets hardware watchdog either via transmitter or via receiver.
+     * Result of every poll is reported to the polling scheduler.
      */
     bool PollHardware();
 
@@ -227,6 +260,18 @@ class CommObject final : public ITransmitter,      //
 
     void WaitForComLoop() final override;
 
+    virtual void ExpectPass(std::chrono::milliseconds until) final override;
+
+    virtual PollingStatistics GetPollingStatistics() final override;
+
+    virtual std::uint32_t GetAvoidedTransactions() final override;
+
+    virtual TurnaroundStatistics GetTurnaroundStatistics(ResponseCommand command) final override;
+
+    virtual std::chrono::milliseconds GetMinimumTurnaround(ResponseCommand command) final override;
+
+    virtual void SetMinimumTurnaround(ResponseCommand command, std::chrono::milliseconds turnaround) final override;
+
     /** @brief Error counter type */
     using ErrorCounter = error_counter::ErrorCounter<0>;
 
@@ -236,6 +281,9 @@ class CommObject final : public ITransmitter,      //
     /** @brief Id of semaphore used for receiver synchronization. */
     static constexpr std::uint8_t receiverSemaphoreId = 2;
 
+    /** @brief Id of semaphore used for telemetry cache refresh synchronization. */
+    static constexpr std::uint8_t telemetrySemaphoreId = 3;
+
   private:
     /** @brief Error reporter type */
     using ErrorReporter = error_counter::AggregatedErrorReporter<ErrorCounter::DeviceId>;
@@ -287,6 +335,26 @@ class CommObject final : public ITransmitter,      //
         gsl::span<uint8_t> outBuffer,                           //
         error_counter::AggregatedErrorCounter& resultAggregator //
         );
+
+    /**
+     * @brief Retrieves response to telemetry query either from telemetry cache or from the hardware.
+     *
+     * Response read from the hardware is stored in the telemetry cache. Failed queries are not cached.
+     * @param[in] query Cached query identifier.
+     * @param[in] address Address of the device which should receive the command.
+     * @param[in] command Command code to send.
+     * @param[out] outBuffer Buffer for the device's response.
+     * @param[in] now Current uptime.
+     * @param[in] resultAggregator Aggregator for error counter
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    bool QueryTelemetry(TelemetryQuery query,                   //
+        Address address,                                        //
+        std::uint8_t command,                                   //
+        gsl::span<std::uint8_t> outBuffer,                      //
+        std::chrono::milliseconds now,                          //
+        error_counter::AggregatedErrorCounter& resultAggregator //
+        );
     /**
      * @brief This procedure will try to download the oldest not yet processed frame from the hardware.
      *
@@ -364,18 +432,36 @@ class CommObject final : public ITransmitter,      //
     /** @brief Comm driver upper interface. */
     IHandleFrame* _frameHandler;
 
+    /** @brief Mode used for downloading received frames. */
+    ReceiveMode _receiveMode;
+
+    /** @brief Length of the last received frame used for sizing first transaction in adaptive receive mode. */
+    std::uint16_t _expectedFrameSize;
+
     /** @brief Handle to comm background task. */
     void* _pollingTaskHandle;
 
     /** @brief Event group used to communicate with background task. */
     EventGroup _pollingTaskFlags;
 
+    /** @brief Scheduler of the receiver polling. */
+    PollingScheduler _pollingScheduler;
+
     /** @brief Semaphore used for transmitter synchronization. */
     OSSemaphoreHandle transmitterSemaphore;
 
     /** @brief Semaphore used for receiver synchronization. */
     OSSemaphoreHandle receiverSemaphore;
 
+    /** @brief Semaphore that serializes telemetry refreshes so concurrent requests share single hardware read. */
+    OSSemaphoreHandle telemetrySemaphore;
+
+    /** @brief Cache of hardware telemetry responses. */
+    TelemetryCache _telemetryCache;
+
+    /** @brief Latency profile of hardware exchanges. */
+    TurnaroundProfile _turnaround;
+
     struct LastSendTimestamp
     {
         std::chrono::milliseconds Timestamp;
@@ -400,11 +486,24 @@ inline bool CommObject::SendFrame(gsl::span<const std::uint8_t> frame)
     return ScheduleFrameTransmission(frame, remainingBufferSize, errorContext.Counter());
 }
 
+inline bool CommObject::SendFrame(gsl::span<const std::uint8_t> frame, std::uint8_t& freeSlots)
+{
+    error_counter::AggregatedErrorReporter<0> errorContext(_error);
+    freeSlots = 0xFF;
+    return ScheduleFrameTransmission(frame, freeSlots, errorContext.Counter());
+}
+
 inline void CommObject::SetFrameHandler(IHandleFrame& handler)
 {
     this->_frameHandler = &handler;
 }
 
+inline void CommObject::SetReceiveMode(ReceiveMode mode)
+{
+    this->_receiveMode = mode;
+    this->_expectedFrameSize = 0;
+}
+
 COMM_END
 
 #endif
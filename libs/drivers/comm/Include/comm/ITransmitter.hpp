@@ -55,6 +55,25 @@ struct ITransmitter
     virtual bool ResetTransmitter() = 0;
 };
 
+/**
+ * @brief Transmitter interface that reports state of the transmitter's hardware frame buffer.
+ * @ingroup LowerCommDriver
+ */
+struct IBufferedTransmitter : public ITransmitter
+{
+    using ITransmitter::SendFrame;
+
+    /**
+     * @brief Adds the requested frame to the send queue.
+     *
+     * @param[in] frame Buffer containing frame contents.
+     * @param[out] freeSlots Number of free slots in transmitter's buffer after the frame has been added,
+     * 0xFF when the frame has been rejected by the transmitter.
+     * @return Operation status, true in case of success, false otherwise.
+     */
+    virtual bool SendFrame(gsl::span<const std::uint8_t> frame, std::uint8_t& freeSlots) = 0;
+};
+
 COMM_END
 
 #endif /* LIBS_DRIVERS_COMM_ITRANSMITTER_HPP */
@@ -0,0 +1,87 @@
+#ifndef LIBS_DRIVERS_COMM_POLLING_SCHEDULER_HPP
+#define LIBS_DRIVERS_COMM_POLLING_SCHEDULER_HPP
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include "comm.hpp"
+
+COMM_BEGIN
+
+/**
+ * @brief Adaptive scheduler of the receiver polling performed by comm task.
+ * @ingroup LowerCommDriver
+ *
+ * Polling interval is kept at its minimum right after a frame is received and while the pass window is active.
+ * Every poll that does not find any frame outside of the pass window doubles the interval until it reaches its maximum.
+ * Receiving a frame extends the pass window by configured activity hold time as more frames are expected to come.
+ *
+ * All methods are safe to be called from different tasks.
+ */
+class PollingScheduler final
+{
+  public:
+    /**
+     * @brief ctor.
+     * @param[in] minInterval Polling interval used while frames are expected.
+     * @param[in] maxInterval Longest polling interval used when receiver stays idle.
+     * @param[in] activityHold Time after last received frame during which the polling interval is kept at minimum.
+     */
+    PollingScheduler(std::chrono::milliseconds minInterval, std::chrono::milliseconds maxInterval, std::chrono::milliseconds activityHold);
+
+    /**
+     * @brief Returns time that comm task should wait before the next poll.
+     * @param[in] now Current uptime
+     * @return Polling interval.
+     */
+    std::chrono::milliseconds NextInterval(std::chrono::milliseconds now) const;
+
+    /**
+     * @brief Updates scheduler state after single receiver poll.
+     * @param[in] now Current uptime
+     * @param[in] frameReceived True if poll found at least one frame
+     */
+    void PollCompleted(std::chrono::milliseconds now, bool frameReceived);
+
+    /**
+     * @brief Informs scheduler about predicted communication window.
+     * @param[in] until Uptime at which the predicted pass ends.
+     */
+    void ExpectPass(std::chrono::milliseconds until);
+
+    /**
+     * @brief Returns current polling statistics.
+     * @return Polling statistics.
+     */
+    PollingStatistics Statistics() const;
+
+  private:
+    /** @brief Minimal polling interval */
+    const std::chrono::milliseconds _minInterval;
+
+    /** @brief Maximal polling interval */
+    const std::chrono::milliseconds _maxInterval;
+
+    /** @brief Time during which polling interval is kept at minimum after received frame */
+    const std::chrono::milliseconds _activityHold;
+
+    /** @brief Polling interval used when there is no active pass window */
+    std::chrono::milliseconds _idleInterval;
+
+    /** @brief Uptime at which pass window ends */
+    std::chrono::milliseconds _passEnd;
+
+    /** @brief Uptime of the previous poll */
+    std::chrono::milliseconds _lastPoll;
+
+    /** @brief Sum of polling latencies, used for calculating average */
+    std::uint32_t _totalLatency;
+
+    /** @brief Collected statistics */
+    PollingStatistics _statistics;
+};
+
+COMM_END
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef LIBS_DRIVERS_COMM_TELEMETRY_CACHE_HPP
+#define LIBS_DRIVERS_COMM_TELEMETRY_CACHE_HPP
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include "comm.hpp"
+#include "gsl/span"
+
+COMM_BEGIN
+
+/**
+ * @brief Enumerator of hardware telemetry queries whose responses are cached by comm driver.
+ * @ingroup LowerCommDriver
+ */
+enum class TelemetryQuery : std::uint8_t
+{
+    ReceiverUptime = 0,          //!< Receiver uptime
+    ReceiverInstant,             //!< Receiver instantaneous telemetry
+    TransmitterUptime,           //!< Transmitter uptime
+    TransmitterState,            //!< Transmitter state (bitrate, idle state, beacon)
+    TransmitterLastTransmission, //!< Transmitter telemetry of the last transmission
+    TransmitterInstant,          //!< Transmitter instantaneous telemetry
+    Count                        //!< Number of cached queries
+};
+
+/**
+ * @brief Cache of the raw responses to comm hardware telemetry queries.
+ * @ingroup LowerCommDriver
+ *
+ * Every query has its own time-to-live: instantaneous measurements expire after few seconds, uptime and
+ * transmitter state are kept longer (uptime is extrapolated by the consumer using @ref Age).
+ * Entries that are known to change because of issued commands (like bitrate change or reset) are invalidated explicitly.
+ *
+ * All methods are safe to be called from different tasks.
+ */
+class TelemetryCache final
+{
+  public:
+    /** @brief Size of the longest cached response */
+    static constexpr std::uint8_t MaxResponseSize = 14;
+
+    /**
+     * @brief ctor.
+     */
+    TelemetryCache();
+
+    /**
+     * @brief Retrieves cached response if it is still valid.
+     * @param[in] query Telemetry query
+     * @param[in] now Current uptime
+     * @param[out] response Buffer for cached response
+     * @return True if valid response was found and copied to the buffer, false otherwise.
+     */
+    bool Read(TelemetryQuery query, std::chrono::milliseconds now, gsl::span<std::uint8_t> response);
+
+    /**
+     * @brief Stores response that has just been read from hardware.
+     * @param[in] query Telemetry query
+     * @param[in] now Current uptime
+     * @param[in] response Response read from hardware
+     */
+    void Store(TelemetryQuery query, std::chrono::milliseconds now, gsl::span<const std::uint8_t> response);
+
+    /**
+     * @brief Returns age of cached response.
+     * @param[in] query Telemetry query
+     * @param[in] now Current uptime
+     * @return Time elapsed since the response was read from hardware, zero if there is no valid response.
+     */
+    std::chrono::milliseconds Age(TelemetryQuery query, std::chrono::milliseconds now) const;
+
+    /**
+     * @brief Drops cached response.
+     * @param[in] query Telemetry query
+     */
+    void Invalidate(TelemetryQuery query);
+
+    /**
+     * @brief Drops all cached responses of the transmitter.
+     */
+    void InvalidateTransmitter();
+
+    /**
+     * @brief Drops all cached responses of the receiver.
+     */
+    void InvalidateReceiver();
+
+    /**
+     * @brief Returns number of hardware transactions that were served from cache.
+     * @return Number of avoided transactions.
+     */
+    std::uint32_t AvoidedTransactions() const;
+
+    /**
+     * @brief Returns time-to-live of the response to the given query.
+     * @param[in] query Telemetry query
+     * @return Time-to-live.
+     */
+    static std::chrono::milliseconds TimeToLive(TelemetryQuery query);
+
+  private:
+    /** @brief Single cache entry */
+    struct Entry
+    {
+        /** @brief Raw response */
+        std::array<std::uint8_t, MaxResponseSize> Response;
+
+        /** @brief Uptime at which the response was read from hardware */
+        std::chrono::milliseconds Timestamp;
+
+        /** @brief Flag indicating that the entry contains valid response */
+        bool Valid;
+    };
+
+    /** @brief Cache entries */
+    std::array<Entry, static_cast<std::size_t>(TelemetryQuery::Count)> _entries;
+
+    /** @brief Number of hardware transactions served from cache */
+    std::uint32_t _avoidedTransactions;
+};
+
+inline std::uint32_t TelemetryCache::AvoidedTransactions() const
+{
+    return this->_avoidedTransactions;
+}
+
+COMM_END
+
+#endif
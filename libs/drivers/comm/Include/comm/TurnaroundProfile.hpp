@@ -0,0 +1,98 @@
+#ifndef LIBS_DRIVERS_COMM_TURNAROUND_PROFILE_HPP
+#define LIBS_DRIVERS_COMM_TURNAROUND_PROFILE_HPP
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include "comm.hpp"
+
+COMM_BEGIN
+
+/**
+ * @brief Per-command latency profile of comm hardware exchanges.
+ * @ingroup LowerCommDriver
+ *
+ * Profile holds minimum time that driver waits between command write and response read. Every command starts
+ * with @ref DefaultMinimumTurnaround and can be lowered from ground once turnaround is measured on hardware;
+ * zero turnaround does not suspend calling task at all.
+ * If hardware does not acknowledge response read the read is repeated every @ref PollInterval up to
+ * @ref MaxPolls times, so underestimated turnaround costs additional poll instead of failed exchange.
+ *
+ * Measured turnaround distribution is recorded for each command so the profile can be tuned from flight data.
+ *
+ * All methods are safe to be called from different tasks.
+ */
+class TurnaroundProfile final
+{
+  public:
+    /** @brief Interval between consecutive response polls */
+    static constexpr std::chrono::milliseconds PollInterval{1};
+
+    /** @brief Maximum number of response reads in single exchange */
+    static constexpr std::uint8_t MaxPolls = 5;
+
+    /** @brief Minimum turnaround of every command until overridden */
+    static constexpr std::chrono::milliseconds DefaultMinimumTurnaround{2};
+
+    /**
+     * @brief ctor.
+     */
+    TurnaroundProfile();
+
+    /**
+     * @brief Maps hardware command to profile entry.
+     * @param[in] address Device address
+     * @param[in] command Command code
+     * @return Profile entry.
+     */
+    static ResponseCommand Classify(Address address, std::uint8_t command);
+
+    /**
+     * @brief Returns time to wait between command write and the first response read.
+     * @param[in] command Profiled command
+     * @return Minimum turnaround.
+     */
+    std::chrono::milliseconds MinimumTurnaround(ResponseCommand command) const;
+
+    /**
+     * @brief Overrides minimum turnaround of the command.
+     * @param[in] command Profiled command
+     * @param[in] turnaround New minimum turnaround
+     */
+    void SetMinimumTurnaround(ResponseCommand command, std::chrono::milliseconds turnaround);
+
+    /**
+     * @brief Records single exchange.
+     * @param[in] command Profiled command
+     * @param[in] turnaround Time measured between command write and last response read
+     * @param[in] nacks Number of response reads that were not acknowledged
+     * @param[in] success True if response has been read
+     */
+    void Record(ResponseCommand command, std::chrono::milliseconds turnaround, std::uint8_t nacks, bool success);
+
+    /**
+     * @brief Returns turnaround statistics of the command.
+     * @param[in] command Profiled command
+     * @return Turnaround statistics.
+     */
+    TurnaroundStatistics Statistics(ResponseCommand command) const;
+
+  private:
+    /**
+     * @brief Selects histogram bucket for measured turnaround.
+     * @param[in] turnaround Measured turnaround
+     * @return Bucket index.
+     */
+    static std::uint8_t Bucket(std::chrono::milliseconds turnaround);
+
+    /** @brief Minimum turnaround of each command */
+    std::array<std::chrono::milliseconds, static_cast<std::size_t>(ResponseCommand::Count)> _minimum;
+
+    /** @brief Statistics of each command */
+    std::array<TurnaroundStatistics, static_cast<std::size_t>(ResponseCommand::Count)> _statistics;
+};
+
+COMM_END
+
+#endif
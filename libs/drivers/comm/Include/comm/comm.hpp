@@ -1,6 +1,8 @@
 #ifndef SRC_DEVICES_COMM_H_
 #define SRC_DEVICES_COMM_H_
 
+#include <array>
+#include <chrono>
 #include <cstdint>
 #include <gsl/span>
 #include "base/fwd.hpp"
@@ -57,6 +59,8 @@ struct IHandleFrame;
 struct ITransmitter;
 struct IBeaconController;
 struct ICommTelemetryProvider;
+struct IReceiverPolling;
+struct ICommDiagnostics;
 
 /**
  * @brief Maximum allowed single frame content length.
@@ -196,6 +200,58 @@ constexpr std::size_t TransmitterTelemetry::BitSize()
     return 17 + 2 + 6 * BitLength<uint12_t> + 1 + 1;
 }
 
+/**
+ * @brief Enumerator of supported modes of downloading received frames from the hardware.
+ */
+enum class ReceiveMode
+{
+    /**
+     * @brief Frame length is queried with the first GetFrame transaction and the frame itself is
+     * downloaded with the second one.
+     */
+    TwoPhase,
+
+    /**
+     * @brief Frame header and payload are downloaded with single GetFrame transaction that is large enough
+     * to fit the longest uplink frame, the actual frame length is taken from the received header.
+     */
+    SingleTransaction,
+
+    /**
+     * @brief First GetFrame transaction is sized for the frame as long as the previously received one. When the
+     * length from the received header shows that the frame did not fit, the frame is downloaded again with the
+     * second transaction sized for the actual frame length (like in @ref ReceiveMode::TwoPhase mode).
+     */
+    Adaptive,
+};
+
+/**
+ * @brief This type contains statistics of the receiver polling performed by the comm task.
+ *
+ * Polling latency is measured as time elapsed since the previous poll for every poll that found
+ * frames in the receiver buffer, it is therefore the upper bound of time the oldest frame waited for pickup.
+ */
+struct PollingStatistics
+{
+    /** @brief Total number of receiver polls */
+    std::uint32_t Polls;
+
+    /** @brief Number of polls that found at least one frame */
+    std::uint32_t FramePolls;
+
+    /** @brief Currently used polling interval */
+    std::chrono::milliseconds CurrentInterval;
+
+    /** @brief Polling latency of the last poll that found frames */
+    std::chrono::milliseconds LastLatency;
+
+    /** @brief Maximal observed polling latency */
+    std::chrono::milliseconds MaxLatency;
+
+    /** @brief Average polling latency */
+    std::chrono::milliseconds AverageLatency;
+};
+
 /** Type that contains status of the frame count query. */
 struct ReceiverFrameCount
 {
@@ -277,6 +333,107 @@ struct ICommHardwareObserver
     virtual void WaitForComLoop() = 0;
 };
 
+/**
+ * @brief Interface of object that schedules the receiver polling.
+ */
+struct IReceiverPolling
+{
+    /**
+     * @brief Informs comm driver about predicted communication window.
+     *
+     * Receiver is polled with the minimal interval until the window ends.
+     * @param[in] until Uptime at which the predicted pass ends.
+     */
+    virtual void ExpectPass(std::chrono::milliseconds until) = 0;
+
+    /**
+     * @brief Returns statistics of the receiver polling.
+     * @return Polling statistics.
+     */
+    virtual PollingStatistics GetPollingStatistics() = 0;
+};
+
+/**
+ * @brief Enumerator of comm hardware commands that are followed by response read.
+ * @ingroup LowerCommDriver
+ */
+enum class ResponseCommand : std::uint8_t
+{
+    ReceiverGetFrameCount = 0,               //!< Receiver frame count
+    ReceiverGetFrame,                        //!< Receiver frame (both header and full frame read)
+    ReceiverGetUptime,                       //!< Receiver uptime
+    ReceiverGetTelemetry,                    //!< Receiver instantaneous telemetry
+    TransmitterSendFrame,                    //!< Transmitter send frame (response contains free slots count)
+    TransmitterGetUptime,                    //!< Transmitter uptime
+    TransmitterGetState,                     //!< Transmitter state
+    TransmitterGetTelemetryLastTransmission, //!< Transmitter telemetry of the last transmission
+    TransmitterGetTelemetryInstant,          //!< Transmitter instantaneous telemetry
+    Other,                                   //!< Any other command
+    Count                                    //!< Number of profiled commands
+};
+
+/**
+ * @brief Distribution of measured command turnaround times.
+ * @ingroup LowerCommDriver
+ *
+ * Turnaround is measured with uptime clock (1ms resolution) from command write to acknowledged response read.
+ * Buckets cover (in milliseconds): 0, 1, 2, 3-4, 5-8 and 9 and more. Turnaround shorter than configured minimum
+ * cannot be observed, so profile is tuned down by lowering the minimum and watching the number of not acknowledged reads.
+ */
+struct TurnaroundStatistics
+{
+    /** @brief Number of histogram buckets */
+    static constexpr std::uint8_t BucketsCount = 6;
+
+    /** @brief Number of successful exchanges */
+    std::uint32_t Exchanges;
+
+    /** @brief Number of response reads that were not acknowledged by hardware */
+    std::uint32_t Nacks;
+
+    /** @brief Number of exchanges that failed after all response polls */
+    std::uint32_t Failures;
+
+    /** @brief Longest measured turnaround */
+    std::chrono::milliseconds Longest;
+
+    /** @brief Turnaround histogram */
+    std::array<std::uint32_t, BucketsCount> Histogram;
+};
+
+/**
+ * @brief Interface of object exposing comm driver diagnostics.
+ */
+struct ICommDiagnostics
+{
+    /**
+     * @brief Returns number of hardware transactions that were served from telemetry cache.
+     * @return Number of avoided transactions.
+     */
+    virtual std::uint32_t GetAvoidedTransactions() = 0;
+
+    /**
+     * @brief Returns turnaround statistics of the command.
+     * @param[in] command Profiled command
+     * @return Turnaround statistics.
+     */
+    virtual TurnaroundStatistics GetTurnaroundStatistics(ResponseCommand command) = 0;
+
+    /**
+     * @brief Returns time waited between command write and the first response read.
+     * @param[in] command Profiled command
+     * @return Minimum turnaround.
+     */
+    virtual std::chrono::milliseconds GetMinimumTurnaround(ResponseCommand command) = 0;
+
+    /**
+     * @brief Overrides minimum turnaround of the command.
+     * @param[in] command Profiled command
+     * @param[in] turnaround New minimum turnaround
+     */
+    virtual void SetMinimumTurnaround(ResponseCommand command, std::chrono::milliseconds turnaround) = 0;
+};
+
 /** @}*/
 COMM_END
 
@@ -0,0 +1,77 @@
+#include "PollingScheduler.hpp"
+#include <algorithm>
+#include "base/os.h"
+
+using namespace std::chrono_literals;
+
+COMM_BEGIN
+
+PollingScheduler::PollingScheduler(
+    std::chrono::milliseconds minInterval, std::chrono::milliseconds maxInterval, std::chrono::milliseconds activityHold)
+    : _minInterval(minInterval),   //
+      _maxInterval(maxInterval),   //
+      _activityHold(activityHold), //
+      _idleInterval(minInterval),  //
+      _passEnd(0ms),               //
+      _lastPoll(0ms),              //
+      _totalLatency(0),            //
+      _statistics{0, 0, minInterval, 0ms, 0ms, 0ms}
+{
+}
+
+std::chrono::milliseconds PollingScheduler::NextInterval(std::chrono::milliseconds now) const
+{
+    CriticalSection cs;
+
+    if (now < this->_passEnd)
+    {
+        return this->_minInterval;
+    }
+
+    return this->_idleInterval;
+}
+
+void PollingScheduler::PollCompleted(std::chrono::milliseconds now, bool frameReceived)
+{
+    CriticalSection cs;
+
+    this->_statistics.Polls++;
+
+    if (frameReceived)
+    {
+        const auto latency = now - this->_lastPoll;
+
+        this->_statistics.FramePolls++;
+        this->_statistics.LastLatency = latency;
+        this->_statistics.MaxLatency = std::max(this->_statistics.MaxLatency, latency);
+        this->_totalLatency += static_cast<std::uint32_t>(latency.count());
+        this->_statistics.AverageLatency = std::chrono::milliseconds(this->_totalLatency / this->_statistics.FramePolls);
+
+        this->_idleInterval = this->_minInterval;
+        this->_passEnd = std::max(this->_passEnd, now + this->_activityHold);
+    }
+    else if (now >= this->_passEnd)
+    {
+        this->_idleInterval = std::min(this->_idleInterval * 2, this->_maxInterval);
+    }
+
+    this->_lastPoll = now;
+    this->_statistics.CurrentInterval = (now < this->_passEnd) ? this->_minInterval : this->_idleInterval;
+}
+
+void PollingScheduler::ExpectPass(std::chrono::milliseconds until)
+{
+    CriticalSection cs;
+
+    this->_passEnd = std::max(this->_passEnd, until);
+    this->_idleInterval = this->_minInterval;
+}
+
+PollingStatistics PollingScheduler::Statistics() const
+{
+    CriticalSection cs;
+
+    return this->_statistics;
+}
+
+COMM_END
@@ -0,0 +1,112 @@
+#include "TelemetryCache.hpp"
+#include <algorithm>
+#include "base/os.h"
+#include "utils.h"
+
+using namespace std::chrono_literals;
+
+COMM_BEGIN
+
+/** @brief Time-to-live of instantaneous measurements */
+static constexpr std::chrono::milliseconds InstantTimeToLive = 5s;
+
+/** @brief Time-to-live of transmitter state, changes of the state are tracked with explicit invalidation */
+static constexpr std::chrono::milliseconds StateTimeToLive = 30s;
+
+/** @brief Time-to-live of uptime, cached uptime is extrapolated with the entry age */
+static constexpr std::chrono::milliseconds UptimeTimeToLive = 60s;
+
+TelemetryCache::TelemetryCache() : _avoidedTransactions(0)
+{
+    for (auto& entry : this->_entries)
+    {
+        entry.Response.fill(0);
+        entry.Timestamp = 0ms;
+        entry.Valid = false;
+    }
+}
+
+std::chrono::milliseconds TelemetryCache::TimeToLive(TelemetryQuery query)
+{
+    switch (query)
+    {
+        case TelemetryQuery::ReceiverUptime:
+        case TelemetryQuery::TransmitterUptime:
+            return UptimeTimeToLive;
+        case TelemetryQuery::TransmitterState:
+            return StateTimeToLive;
+        default:
+            return InstantTimeToLive;
+    }
+}
+
+bool TelemetryCache::Read(TelemetryQuery query, std::chrono::milliseconds now, gsl::span<std::uint8_t> response)
+{
+    CriticalSection cs;
+
+    const auto& entry = this->_entries[num(query)];
+    const auto age = now - entry.Timestamp;
+    if (!entry.Valid || age < 0ms || age >= TimeToLive(query) || response.size() > MaxResponseSize)
+    {
+        return false;
+    }
+
+    std::copy_n(entry.Response.begin(), response.size(), response.begin());
+    this->_avoidedTransactions++;
+    return true;
+}
+
+void TelemetryCache::Store(TelemetryQuery query, std::chrono::milliseconds now, gsl::span<const std::uint8_t> response)
+{
+    if (response.size() > MaxResponseSize)
+    {
+        return;
+    }
+
+    CriticalSection cs;
+
+    auto& entry = this->_entries[num(query)];
+    std::copy(response.begin(), response.end(), entry.Response.begin());
+    entry.Timestamp = now;
+    entry.Valid = true;
+}
+
+std::chrono::milliseconds TelemetryCache::Age(TelemetryQuery query, std::chrono::milliseconds now) const
+{
+    CriticalSection cs;
+
+    const auto& entry = this->_entries[num(query)];
+    if (!entry.Valid || now < entry.Timestamp)
+    {
+        return 0ms;
+    }
+
+    return now - entry.Timestamp;
+}
+
+void TelemetryCache::Invalidate(TelemetryQuery query)
+{
+    CriticalSection cs;
+
+    this->_entries[num(query)].Valid = false;
+}
+
+void TelemetryCache::InvalidateTransmitter()
+{
+    CriticalSection cs;
+
+    this->_entries[num(TelemetryQuery::TransmitterUptime)].Valid = false;
+    this->_entries[num(TelemetryQuery::TransmitterState)].Valid = false;
+    this->_entries[num(TelemetryQuery::TransmitterLastTransmission)].Valid = false;
+    this->_entries[num(TelemetryQuery::TransmitterInstant)].Valid = false;
+}
+
+void TelemetryCache::InvalidateReceiver()
+{
+    CriticalSection cs;
+
+    this->_entries[num(TelemetryQuery::ReceiverUptime)].Valid = false;
+    this->_entries[num(TelemetryQuery::ReceiverInstant)].Valid = false;
+}
+
+COMM_END
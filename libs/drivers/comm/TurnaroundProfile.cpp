@@ -0,0 +1,125 @@
+#include "TurnaroundProfile.hpp"
+#include <algorithm>
+#include "base/os.h"
+#include "utils.h"
+
+using namespace std::chrono_literals;
+
+COMM_BEGIN
+
+constexpr std::uint8_t TurnaroundStatistics::BucketsCount;
+constexpr std::chrono::milliseconds TurnaroundProfile::PollInterval;
+constexpr std::uint8_t TurnaroundProfile::MaxPolls;
+constexpr std::chrono::milliseconds TurnaroundProfile::DefaultMinimumTurnaround;
+
+TurnaroundProfile::TurnaroundProfile()
+{
+    this->_minimum.fill(DefaultMinimumTurnaround);
+
+    for (auto& statistics : this->_statistics)
+    {
+        statistics.Exchanges = 0;
+        statistics.Nacks = 0;
+        statistics.Failures = 0;
+        statistics.Longest = 0ms;
+        statistics.Histogram.fill(0);
+    }
+}
+
+ResponseCommand TurnaroundProfile::Classify(Address address, std::uint8_t command)
+{
+    if (address == Address::Receiver)
+    {
+        switch (static_cast<ReceiverCommand>(command))
+        {
+            case ReceiverCommand::GetFrameCount:
+                return ResponseCommand::ReceiverGetFrameCount;
+            case ReceiverCommand::GetFrame:
+                return ResponseCommand::ReceiverGetFrame;
+            case ReceiverCommand::GetUptime:
+                return ResponseCommand::ReceiverGetUptime;
+            case ReceiverCommand::GetTelemetry:
+                return ResponseCommand::ReceiverGetTelemetry;
+            default:
+                return ResponseCommand::Other;
+        }
+    }
+
+    switch (static_cast<TransmitterCommand>(command))
+    {
+        case TransmitterCommand::SendFrame:
+            return ResponseCommand::TransmitterSendFrame;
+        case TransmitterCommand::GetUptime:
+            return ResponseCommand::TransmitterGetUptime;
+        case TransmitterCommand::GetState:
+            return ResponseCommand::TransmitterGetState;
+        case TransmitterCommand::GetTelemetryLastTransmission:
+            return ResponseCommand::TransmitterGetTelemetryLastTransmission;
+        case TransmitterCommand::GetTelemetryInstant:
+            return ResponseCommand::TransmitterGetTelemetryInstant;
+        default:
+            return ResponseCommand::Other;
+    }
+}
+
+std::chrono::milliseconds TurnaroundProfile::MinimumTurnaround(ResponseCommand command) const
+{
+    CriticalSection cs;
+
+    return this->_minimum[num(command)];
+}
+
+void TurnaroundProfile::SetMinimumTurnaround(ResponseCommand command, std::chrono::milliseconds turnaround)
+{
+    CriticalSection cs;
+
+    this->_minimum[num(command)] = std::max(turnaround, 0ms);
+}
+
+void TurnaroundProfile::Record(ResponseCommand command, std::chrono::milliseconds turnaround, std::uint8_t nacks, bool success)
+{
+    CriticalSection cs;
+
+    auto& statistics = this->_statistics[num(command)];
+
+    statistics.Nacks += nacks;
+    if (!success)
+    {
+        statistics.Failures++;
+        return;
+    }
+
+    statistics.Exchanges++;
+    statistics.Longest = std::max(statistics.Longest, turnaround);
+    statistics.Histogram[Bucket(turnaround)]++;
+}
+
+TurnaroundStatistics TurnaroundProfile::Statistics(ResponseCommand command) const
+{
+    CriticalSection cs;
+
+    return this->_statistics[num(command)];
+}
+
+std::uint8_t TurnaroundProfile::Bucket(std::chrono::milliseconds turnaround)
+{
+    const auto ms = turnaround.count();
+    if (ms <= 2)
+    {
+        return static_cast<std::uint8_t>(std::max<decltype(ms)>(ms, 0));
+    }
+
+    if (ms <= 4)
+    {
+        return 3;
+    }
+
+    if (ms <= 8)
+    {
+        return 4;
+    }
+
+    return 5;
+}
+
+COMM_END
@@ -5,6 +5,7 @@
 */
 #include "comm.hpp"
 #include <stdnoreturn.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
@@ -34,6 +35,18 @@ static constexpr std::uint8_t TransmitterBufferSize = 40;
 
 static constexpr std::uint8_t ReceiverBufferSize = 64;
 
+/** @brief Size of the header (length, doppler, rssi) preceding each received frame. */
+static constexpr std::uint8_t ReceivedFrameHeaderSize = 6;
+
+/** @brief Receiver polling interval used while frames are expected. */
+static constexpr std::chrono::milliseconds MinPollingInterval = 100ms;
+
+/** @brief Longest receiver polling interval used when receiver stays idle. */
+static constexpr std::chrono::milliseconds MaxPollingInterval = 2s;
+
+/** @brief Time after last received frame during which receiver is polled with minimal interval. */
+static constexpr std::chrono::milliseconds PollingActivityHold = 15s;
+
 Beacon::Beacon() : period(0s)
 {
 }
@@ -45,12 +58,16 @@ Beacon::Beacon(std::chrono::seconds beaconPeriod, gsl::span<const std::uint8_t>
 }
 
 CommObject::CommObject(error_counter::ErrorCounting& errors, II2CBus& low)
-    : _error(errors),                                                              //
-      _low(low),                                                                   //
-      _frameHandler(nullptr),                                                      //
-      _pollingTaskHandle(nullptr),                                                 //
-      transmitterSemaphore(System::CreateBinarySemaphore(transmitterSemaphoreId)), //
-      receiverSemaphore(System::CreateBinarySemaphore(receiverSemaphoreId)),       //
+    : _error(errors),                                                                 //
+      _low(low),                                                                      //
+      _frameHandler(nullptr),                                                         //
+      _receiveMode(ReceiveMode::TwoPhase),                                            //
+      _expectedFrameSize(0),                                                          //
+      _pollingTaskHandle(nullptr),                                                    //
+      _pollingScheduler(MinPollingInterval, MaxPollingInterval, PollingActivityHold), //
+      transmitterSemaphore(System::CreateBinarySemaphore(transmitterSemaphoreId)),    //
+      receiverSemaphore(System::CreateBinarySemaphore(receiverSemaphoreId)),          //
+      telemetrySemaphore(System::CreateBinarySemaphore(telemetrySemaphoreId)),        //
       _lastFrameStatus{{0, 0}}
 {
 }
@@ -119,9 +136,28 @@ bool CommObject::SendBufferWithResponse(Address address, //
         return false >> resultAggregator;
     }
 
-    System::SleepTask(2ms);
-    result = this->_low.Read(num(address), outBuffer);
+    const auto command = TurnaroundProfile::Classify(address, inputBuffer[0]);
+    const auto minimumTurnaround = this->_turnaround.MinimumTurnaround(command);
+    const auto written = System::GetUptime();
+    if (minimumTurnaround > 0ms)
+    {
+        System::SleepTask(minimumTurnaround);
+    }
+
+    std::uint8_t nacks = 0;
+    while (true)
+    {
+        result = this->_low.Read(num(address), outBuffer);
+        if (result != I2CResult::Nack || ++nacks == TurnaroundProfile::MaxPolls)
+        {
+            break;
+        }
+
+        System::SleepTask(TurnaroundProfile::PollInterval);
+    }
+
     const auto status = (result == I2CResult::OK);
+    this->_turnaround.Record(command, System::GetUptime() - written, nacks, status);
     if (!status)
     {
         LOGF(LOG_LEVEL_ERROR,
@@ -144,6 +180,28 @@ bool CommObject::SendCommandWithResponse(Address address, //
     return SendBufferWithResponse(address, gsl::span<const uint8_t>(&command, 1), outBuffer, resultAggregator);
 }
 
+bool CommObject::QueryTelemetry(TelemetryQuery query, //
+    Address address,                                  //
+    uint8_t command,                                  //
+    span<uint8_t> outBuffer,                          //
+    std::chrono::milliseconds now,                    //
+    AggregatedErrorCounter& resultAggregator          //
+    )
+{
+    if (this->_telemetryCache.Read(query, now, outBuffer))
+    {
+        return true;
+    }
+
+    if (!this->SendCommandWithResponse(address, command, outBuffer, resultAggregator))
+    {
+        return false;
+    }
+
+    this->_telemetryCache.Store(query, now, outBuffer);
+    return true;
+}
+
 OSResult CommObject::Initialize()
 {
     ErrorReporter errorContext(_error);
@@ -166,6 +224,14 @@ OSResult CommObject::Initialize()
         return result;
     }
 
+    result = System::GiveSemaphore(telemetrySemaphore);
+    if (OS_RESULT_FAILED(result))
+    {
+        LOGF(LOG_LEVEL_FATAL, "[comm] Unable to release telemetry semaphore (%d)", num(result));
+        errorContext.Counter().Failure();
+        return result;
+    }
+
     result = this->_pollingTaskFlags.Initialize();
     if (OS_RESULT_FAILED(result))
     {
@@ -234,19 +300,26 @@ bool CommObject::Reset()
 
 bool CommObject::ResetInternal(AggregatedErrorCounter& resultAggregator)
 {
-    return this->SendCommand(Address::Receiver, num(ReceiverCommand::HardReset), resultAggregator);
+    const auto status = this->SendCommand(Address::Receiver, num(ReceiverCommand::HardReset), resultAggregator);
+    this->_telemetryCache.InvalidateReceiver();
+    this->_telemetryCache.InvalidateTransmitter();
+    return status;
 }
 
 bool CommObject::ResetTransmitter()
 {
     ErrorReporter errorContext(_error);
-    return this->SendCommand(Address::Transmitter, num(TransmitterCommand::SoftReset), errorContext.Counter());
+    const auto status = this->SendCommand(Address::Transmitter, num(TransmitterCommand::SoftReset), errorContext.Counter());
+    this->_telemetryCache.InvalidateTransmitter();
+    return status;
 }
 
 bool CommObject::ResetReceiver()
 {
     ErrorReporter errorContext(_error);
-    return this->SendCommand(Address::Receiver, num(ReceiverCommand::SoftReset), errorContext.Counter());
+    const auto status = this->SendCommand(Address::Receiver, num(ReceiverCommand::SoftReset), errorContext.Counter());
+    this->_telemetryCache.InvalidateReceiver();
+    return status;
 }
 
 ReceiverFrameCount CommObject::GetFrameCount()
@@ -303,14 +376,25 @@ bool CommObject::GetReceiverTelemetryInternal(ReceiverTelemetry& telemetry, Aggr
 {
     memset(&telemetry, 0, sizeof(ReceiverTelemetry));
 
+    Lock lock(telemetrySemaphore, InfiniteTimeout);
+    if (!lock())
+    {
+        LOG(LOG_LEVEL_ERROR, "[comm] Unable to acquire telemetry semaphore");
+        resultAggregator.Failure();
+        return false;
+    }
+
+    const auto now = System::GetUptime();
     bool result = true;
 
     {
         std::array<uint8_t, 4> buffer;
 
-        const bool status = this->SendCommandWithResponse(Address::Receiver, //
-            num(ReceiverCommand::GetUptime),                                 //
-            span<uint8_t>(buffer),                                           //
+        const bool status = this->QueryTelemetry(TelemetryQuery::ReceiverUptime, //
+            Address::Receiver,                                                   //
+            num(ReceiverCommand::GetUptime),                                     //
+            span<uint8_t>(buffer),                                               //
+            now,                                                                 //
             resultAggregator);
 
         if (!status)
@@ -325,6 +409,8 @@ bool CommObject::GetReceiverTelemetryInternal(ReceiverTelemetry& telemetry, Aggr
             telemetry.Uptime += std::chrono::minutes(r.ReadByte());
             telemetry.Uptime += std::chrono::hours(r.ReadByte());
             telemetry.Uptime += std::chrono::hours(r.ReadByte() * 24);
+            telemetry.Uptime +=
+                std::chrono::duration_cast<std::chrono::seconds>(this->_telemetryCache.Age(TelemetryQuery::ReceiverUptime, now));
         }
     }
 
@@ -337,10 +423,12 @@ bool CommObject::GetReceiverTelemetryInternal(ReceiverTelemetry& telemetry, Aggr
 
     {
         uint8_t buffer[14] = {0};
-        const bool status = this->SendCommandWithResponse( //
-            Address::Receiver,                             //
-            num(ReceiverCommand::GetTelemetry),            //
-            span<uint8_t>(buffer),                         //
+        const bool status = this->QueryTelemetry( //
+            TelemetryQuery::ReceiverInstant,      //
+            Address::Receiver,                    //
+            num(ReceiverCommand::GetTelemetry),   //
+            span<uint8_t>(buffer),                //
+            now,                                  //
             resultAggregator);
 
         if (!status)
@@ -374,14 +462,25 @@ bool CommObject::GetTransmitterTelemetryInternal(TransmitterTelemetry& telemetry
 {
     memset(&telemetry, 0, sizeof(TransmitterTelemetry));
 
+    Lock lock(telemetrySemaphore, InfiniteTimeout);
+    if (!lock())
+    {
+        LOG(LOG_LEVEL_ERROR, "[comm] Unable to acquire telemetry semaphore");
+        resultAggregator.Failure();
+        return false;
+    }
+
+    const auto now = System::GetUptime();
     bool result = true;
 
     {
         std::array<uint8_t, 4> buffer;
 
-        const bool status = this->SendCommandWithResponse(Address::Transmitter, //
-            num(TransmitterCommand::GetUptime),                                 //
-            span<uint8_t>(buffer),                                              //
+        const bool status = this->QueryTelemetry(TelemetryQuery::TransmitterUptime, //
+            Address::Transmitter,                                                   //
+            num(TransmitterCommand::GetUptime),                                     //
+            span<uint8_t>(buffer),                                                  //
+            now,                                                                    //
             resultAggregator);
 
         if (!status)
@@ -396,15 +495,19 @@ bool CommObject::GetTransmitterTelemetryInternal(TransmitterTelemetry& telemetry
             telemetry.Uptime += std::chrono::minutes(r.ReadByte());
             telemetry.Uptime += std::chrono::hours(r.ReadByte());
             telemetry.Uptime += std::chrono::hours(r.ReadByte() * 24);
+            telemetry.Uptime +=
+                std::chrono::duration_cast<std::chrono::seconds>(this->_telemetryCache.Age(TelemetryQuery::TransmitterUptime, now));
         }
     }
 
     {
         uint8_t buffer;
 
-        const bool status = this->SendCommandWithResponse(Address::Transmitter, //
-            num(TransmitterCommand::GetState),                                  //
-            span<uint8_t>(&buffer, 1),                                          //
+        const bool status = this->QueryTelemetry(TelemetryQuery::TransmitterState, //
+            Address::Transmitter,                                                  //
+            num(TransmitterCommand::GetState),                                     //
+            span<uint8_t>(&buffer, 1),                                             //
+            now,                                                                   //
             resultAggregator);
 
         if (!status)
@@ -425,10 +528,12 @@ bool CommObject::GetTransmitterTelemetryInternal(TransmitterTelemetry& telemetry
 
     {
         uint8_t buffer[8] = {0};
-        const bool status = this->SendCommandWithResponse(         //
+        const bool status = this->QueryTelemetry(                  //
+            TelemetryQuery::TransmitterLastTransmission,           //
             Address::Transmitter,                                  //
             num(TransmitterCommand::GetTelemetryLastTransmission), //
             span<uint8_t>(buffer),                                 //
+            now,                                                   //
             resultAggregator);
 
         if (!status)
@@ -447,10 +552,12 @@ bool CommObject::GetTransmitterTelemetryInternal(TransmitterTelemetry& telemetry
 
     {
         uint8_t buffer[8] = {0};
-        const bool status = this->SendCommandWithResponse( //
-            Address::Transmitter,                          //
-            num(TransmitterCommand::GetTelemetryInstant),  //
-            span<uint8_t>(buffer),                         //
+        const bool status = this->QueryTelemetry(         //
+            TelemetryQuery::TransmitterInstant,           //
+            Address::Transmitter,                         //
+            num(TransmitterCommand::GetTelemetryInstant), //
+            span<uint8_t>(buffer),                        //
+            now,                                          //
             resultAggregator);
 
         if (!status)
@@ -489,13 +596,13 @@ bool CommObject::GetTransmitterTelemetry(TransmitterTelemetry& telemetry)
  */
 static gsl::span<std::uint8_t> ReceiveSpan(std::uint16_t frameSize, gsl::span<std::uint8_t> buffer)
 {
-    if (buffer.size() <= frameSize + 6)
+    if (buffer.size() <= frameSize + ReceivedFrameHeaderSize)
     {
         return buffer;
     }
     else
     {
-        return buffer.subspan(0, frameSize + 6);
+        return buffer.subspan(0, frameSize + ReceivedFrameHeaderSize);
     }
 }
 
@@ -512,22 +619,41 @@ bool CommObject::ReceiveFrameInternal(gsl::span<std::uint8_t> buffer, Frame& fra
         return false;
     }
 
-    bool status = this->SendCommandWithResponse(Address::Receiver, num(ReceiverCommand::GetFrame), buffer.subspan(0, 2), resultAggregator);
-    if (!status)
+    gsl::span<std::uint8_t> received = buffer.subspan(0, 2);
+    if (this->_receiveMode == ReceiveMode::SingleTransaction)
     {
-        return status;
+        received = ReceiveSpan(MaxUplinkFrameSize, buffer);
+    }
+    else if (this->_receiveMode == ReceiveMode::Adaptive && this->_expectedFrameSize > 0)
+    {
+        received = ReceiveSpan(this->_expectedFrameSize, buffer);
     }
 
-    Reader reader(buffer.subspan(0, 2));
-    auto size = reader.ReadWordLE();
-    buffer = ReceiveSpan(size, buffer);
-    status = this->SendCommandWithResponse(Address::Receiver, num(ReceiverCommand::GetFrame), buffer, resultAggregator);
+    bool status = this->SendCommandWithResponse(Address::Receiver, num(ReceiverCommand::GetFrame), received, resultAggregator);
     if (!status)
     {
         return status;
     }
 
-    reader.Initialize(buffer);
+    Reader reader(received);
+    const auto size = reader.ReadWordLE();
+    if (this->_receiveMode == ReceiveMode::Adaptive)
+    {
+        this->_expectedFrameSize = size;
+    }
+
+    // frame (or at least its header) did not fit into the first transaction
+    if (received.size() < ReceiveSpan(size, buffer).size())
+    {
+        received = ReceiveSpan(size, buffer);
+        status = this->SendCommandWithResponse(Address::Receiver, num(ReceiverCommand::GetFrame), received, resultAggregator);
+        if (!status)
+        {
+            return status;
+        }
+    }
+
+    reader.Initialize(received);
     const auto fullSize = reader.ReadWordLE();
     const auto doppler = reader.ReadWordLE();
     const auto rssi = reader.ReadWordLE();
@@ -540,7 +666,7 @@ bool CommObject::ReceiveFrameInternal(gsl::span<std::uint8_t> buffer, Frame& fra
     else
     {
         LOGF(LOG_LEVEL_DEBUG, "[comm] Received frame %d bytes", static_cast<int>(fullSize));
-        auto span = reader.ReadArray(reader.RemainingSize());
+        auto span = reader.ReadArray(gsl::narrow_cast<std::uint16_t>(std::min<std::int32_t>(reader.RemainingSize(), fullSize)));
         frameContent = gsl::span<std::uint8_t>(const_cast<std::uint8_t*>(span.data()), span.size());
         this->_lastFrameStatus = {doppler, rssi};
     }
@@ -645,13 +771,17 @@ bool CommObject::UpdateBeaconInternal(const Beacon& beaconData, AggregatedErrorC
         return false;
     }
 
-    return (this->_low.Write(num(Address::Transmitter), writer.Capture()) == I2CResult::OK) >> resultAggregator;
+    const auto status = (this->_low.Write(num(Address::Transmitter), writer.Capture()) == I2CResult::OK) >> resultAggregator;
+    this->_telemetryCache.Invalidate(TelemetryQuery::TransmitterState);
+    return status;
 }
 
 bool CommObject::ClearBeacon()
 {
     ErrorReporter errorContext(_error);
-    return this->SendCommand(Address::Transmitter, num(TransmitterCommand::ClearBeacon), errorContext.Counter());
+    const auto status = this->SendCommand(Address::Transmitter, num(TransmitterCommand::ClearBeacon), errorContext.Counter());
+    this->_telemetryCache.Invalidate(TelemetryQuery::TransmitterState);
+    return status;
 }
 
 bool CommObject::SetTransmitterStateWhenIdle(IdleState requestedState)
@@ -667,7 +797,9 @@ bool CommObject::SetTransmitterStateWhenIdle(IdleState requestedState)
     uint8_t buffer[2];
     buffer[0] = num(TransmitterCommand::SetIdleState);
     buffer[1] = num(requestedState);
-    return (this->_low.Write(num(Address::Transmitter), buffer) == I2CResult::OK) >> _error;
+    const auto status = (this->_low.Write(num(Address::Transmitter), buffer) == I2CResult::OK) >> _error;
+    this->_telemetryCache.Invalidate(TelemetryQuery::TransmitterState);
+    return status;
 }
 
 bool CommObject::SetTransmitterBitRate(Bitrate bitrate)
@@ -683,7 +815,9 @@ bool CommObject::SetTransmitterBitRate(Bitrate bitrate)
     uint8_t buffer[2];
     buffer[0] = num(TransmitterCommand::SetBitRate);
     buffer[1] = num(bitrate);
-    return (this->_low.Write(num(Address::Transmitter), buffer) == I2CResult::OK) >> _error;
+    const auto status = (this->_low.Write(num(Address::Transmitter), buffer) == I2CResult::OK) >> _error;
+    this->_telemetryCache.Invalidate(TelemetryQuery::TransmitterState);
+    return status;
 }
 
 bool CommObject::GetTelemetry(CommTelemetry& telemetry)
@@ -744,6 +878,8 @@ bool CommObject::PollHardware()
         LOG(LOG_LEVEL_ERROR, "[comm] Unable to reset comm watchdog. ");
     }
 
+    this->_pollingScheduler.PollCompleted(System::GetUptime(), anyFrame);
+
     return anyFrame;
 }
 
@@ -799,6 +935,36 @@ void CommObject::WaitForComLoop()
     this->_pollingTaskFlags.WaitAny(TaskFlagPing, true, InfiniteTimeout);
 }
 
+void CommObject::ExpectPass(std::chrono::milliseconds until)
+{
+    this->_pollingScheduler.ExpectPass(until);
+}
+
+PollingStatistics CommObject::GetPollingStatistics()
+{
+    return this->_pollingScheduler.Statistics();
+}
+
+std::uint32_t CommObject::GetAvoidedTransactions()
+{
+    return this->_telemetryCache.AvoidedTransactions();
+}
+
+TurnaroundStatistics CommObject::GetTurnaroundStatistics(ResponseCommand command)
+{
+    return this->_turnaround.Statistics(command);
+}
+
+std::chrono::milliseconds CommObject::GetMinimumTurnaround(ResponseCommand command)
+{
+    return this->_turnaround.MinimumTurnaround(command);
+}
+
+void CommObject::SetMinimumTurnaround(ResponseCommand command, std::chrono::milliseconds turnaround)
+{
+    this->_turnaround.SetMinimumTurnaround(command, turnaround);
+}
+
 void CommObject::CommTask(void* param)
 {
     CommObject* comm = (CommObject*)param;
@@ -810,8 +976,9 @@ void CommObject::CommTask(void* param)
     for (;;)
     {
         comm->_pollingTaskFlags.Set(TaskFlagPing);
-        const OSEventBits result = comm->_pollingTaskFlags.WaitAny(TaskFlagPauseRequest, true, 1s);
-        if (result == TaskFlagPauseRequest)
+        const auto interval = comm->_pollingScheduler.NextInterval(System::GetUptime());
+        const OSEventBits result = comm->_pollingTaskFlags.WaitAny(TaskFlagPauseRequest, true, interval);
+        if ((result & TaskFlagPauseRequest) != 0)
         {
             LOG(LOG_LEVEL_WARNING, "Comm task paused");
             comm->_pollingTaskFlags.Clear(TaskFlagRunning);
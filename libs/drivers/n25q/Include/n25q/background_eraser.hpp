@@ -0,0 +1,234 @@
+#ifndef LIBS_DRIVERS_N25Q_INCLUDE_N25Q_BACKGROUND_ERASER_HPP_
+#define LIBS_DRIVERS_N25Q_INCLUDE_N25Q_BACKGROUND_ERASER_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <gsl/span>
+#include "base/os.h"
+#include "fs/yaffs.h"
+
+namespace devices
+{
+    namespace n25q
+    {
+        /**
+         * @defgroup n25q_background_eraser Background block eraser for N25Q Yaffs driver
+         * @ingroup n25q
+         *
+         * @{
+         */
+
+        /**
+         * @brief Destination of block erases performed by @ref BackgroundEraser
+         */
+        struct IBlockEraser
+        {
+            /**
+             * @brief Erases block
+             * @param[in] block Block number
+             * @return true on success
+             */
+            virtual bool EraseBlockNow(std::uint32_t block) = 0;
+        };
+
+        /**
+         * @brief Queue of blocks released by Yaffs that are erased by low priority task
+         *
+         * Yaffs erases block as soon as it becomes dirty, which in case of N25Q sector means hundreds of milliseconds
+         * (three times with redundant driver) spent in the middle of file write. Erase requests are queued instead and
+         * erased one by one by background task, only when device was not accessed for idle time. Block is considered
+         * empty by Yaffs as soon as erase is queued, so if Yaffs accesses block that is still queued, it is erased
+         * synchronously (together with all blocks queued before it) and the wait is recorded as stall.
+         *
+         * Blocks are always erased in order of requests, so state of memory after reset is the same as if Yaffs
+         * was interrupted before erasing first of queued blocks.
+         *
+         * If queue is full, oldest block is erased synchronously to make room for the new one.
+         *
+         * Block which erase failed is removed from queue and counted in statistics, erases queued after it proceed.
+         * Failure is reported only to access of that block (or to @ref Drain).
+         *
+         * All memory accesses must be made within @ref BlockAccess scope, which serializes them with background erase.
+         */
+        class BackgroundEraser : public services::fs::IYaffsDeviceEraser
+        {
+          public:
+            /**
+             * @brief Grants exclusive access to memory block
+             *
+             * Usage:
+             *
+             * @code
+             * {
+             *     BackgroundEraser::BlockAccess access(eraser, block);
+             *
+             *     if(!access())
+             *     {
+             *         // pending erase failed
+             *         return;
+             *     }
+             *
+             *     // access memory
+             * }
+             * @endcode
+             */
+            class BlockAccess final : private NotCopyable, private NotMoveable
+            {
+              public:
+                /**
+                 * @brief Waits for background erase and erases block if it is still queued
+                 * @param[in] eraser Background eraser (may be null)
+                 * @param[in] block Accessed block
+                 */
+                BlockAccess(BackgroundEraser* eraser, std::uint32_t block);
+
+                /**
+                 * @brief Releases access
+                 */
+                ~BlockAccess();
+
+                /**
+                 * @brief Checks if block is ready for access
+                 * @return true if block can be accessed, false if its pending erase failed
+                 */
+                bool operator()();
+
+              private:
+                /** @brief Background eraser */
+                BackgroundEraser* const _eraser;
+                /** @brief Block is ready for access */
+                bool _ready;
+            };
+
+            /**
+             * @brief Constructs @ref BackgroundEraser instance
+             * @param[in] queue Queue storage
+             * @param[in] idleTime Time without memory access required to start background erase
+             */
+            BackgroundEraser(gsl::span<std::uint32_t> queue, std::chrono::milliseconds idleTime);
+
+            /**
+             * @brief Creates synchronization primitives and starts background task
+             * @return Operation result
+             */
+            OSResult Initialize();
+
+            /**
+             * @brief Sets destination of block erases
+             * @param[in] eraser Block eraser
+             */
+            void SetEraser(IBlockEraser& eraser);
+
+            /**
+             * @brief Queues block erase
+             * @param[in] block Block number
+             * @return true if block will be erased later, false if it must be erased immediately (no eraser or queue)
+             */
+            bool Defer(std::uint32_t block);
+
+            /**
+             * @brief Erases first queued block if memory was not accessed for idle time
+             * @return true if block was erased
+             *
+             * This is single iteration of background task.
+             */
+            bool EraseIfIdle();
+
+            virtual OSResult Drain() override;
+
+            virtual services::fs::EraseStatistics Statistics() const override;
+
+            /** @brief Default time without memory access required to start background erase */
+            static constexpr std::chrono::milliseconds DefaultIdleTime = std::chrono::milliseconds(500);
+
+          private:
+            /**
+             * @brief Background task entry point
+             * @param This Pointer to @ref BackgroundEraser
+             */
+            static void EraserTask(BackgroundEraser* This);
+
+            /**
+             * @brief Checks if block is queued
+             * @param[in] block Block number
+             * @return true if block is queued
+             */
+            bool IsPending(std::uint32_t block) const;
+
+            /**
+             * @brief Erases first queued block
+             * @param[in] forced true if erase is performed synchronously on Yaffs request
+             * @return true on success, false on failure (block is removed from queue in both cases)
+             */
+            bool EraseFirst(bool forced);
+
+            /**
+             * @brief Records time Yaffs waited for memory access
+             * @param[in] stall Wait time
+             */
+            void RecordStall(std::chrono::milliseconds stall);
+
+            /** @brief Queue storage */
+            gsl::span<std::uint32_t> _queue;
+            /** @brief Index of first queued block */
+            std::ptrdiff_t _head;
+            /** @brief Number of queued blocks */
+            std::ptrdiff_t _count;
+            /** @brief Time without memory access required to start background erase */
+            const std::chrono::milliseconds _idleTime;
+            /** @brief Destination of block erases */
+            IBlockEraser* _eraser;
+            /** @brief Uptime at end of last memory access */
+            std::chrono::milliseconds _lastAccess;
+            /** @brief Statistics */
+            services::fs::EraseStatistics _statistics;
+            /** @brief Lock serializing memory access and queue modifications */
+            OSSemaphoreHandle _lock;
+            /** @brief Control flags */
+            EventGroup _control;
+            /** @brief Background task */
+            Task<BackgroundEraser*, 2_KB, TaskPriority::P1> _task;
+
+            /** @brief Control flags */
+            struct Event
+            {
+                /** @brief Queue is not empty */
+                static constexpr OSEventBits Pending = 1 << 0;
+            };
+        };
+
+        inline bool BackgroundEraser::BlockAccess::operator()()
+        {
+            return this->_ready;
+        }
+
+        /**
+         * @brief Background eraser with queue placed in object
+         * @tparam Capacity Maximum number of queued blocks
+         */
+        template <std::size_t Capacity> class StaticBackgroundEraser final : public BackgroundEraser
+        {
+          public:
+            /**
+             * @brief Constructs @ref StaticBackgroundEraser instance
+             * @param[in] idleTime Time without memory access required to start background erase
+             */
+            StaticBackgroundEraser(std::chrono::milliseconds idleTime = BackgroundEraser::DefaultIdleTime);
+
+          private:
+            /** @brief Queue storage */
+            std::array<std::uint32_t, Capacity> _queueStorage;
+        };
+
+        template <std::size_t Capacity>
+        StaticBackgroundEraser<Capacity>::StaticBackgroundEraser(std::chrono::milliseconds idleTime)
+            : BackgroundEraser(_queueStorage, idleTime)
+        {
+        }
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_DRIVERS_N25Q_INCLUDE_N25Q_BACKGROUND_ERASER_HPP_ */
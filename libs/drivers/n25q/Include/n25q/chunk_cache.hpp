@@ -0,0 +1,211 @@
+#ifndef LIBS_DRIVERS_N25Q_INCLUDE_N25Q_CHUNK_CACHE_HPP_
+#define LIBS_DRIVERS_N25Q_INCLUDE_N25Q_CHUNK_CACHE_HPP_
+
+#include <array>
+#include <cstdint>
+#include <gsl/span>
+#include "base/os.h"
+#include "fs/yaffs.h"
+
+namespace devices
+{
+    namespace n25q
+    {
+        /**
+         * @defgroup n25q_chunk_cache Chunk cache for N25Q Yaffs driver
+         * @ingroup n25q
+         *
+         * @{
+         */
+
+        /**
+         * @brief Chunk cache write policy
+         */
+        enum class ChunkCacheMode
+        {
+            WriteThrough, //!< Chunks are programmed immediately, cache holds copy of written data
+            WriteBack     //!< Programming is deferred until chunk is evicted or cache is flushed
+        };
+
+        /**
+         * @brief Destination of chunks written back by @ref ChunkCache
+         */
+        struct IChunkWriter
+        {
+            /**
+             * @brief Programs chunk in memory
+             * @param[in] chunk Chunk number
+             * @param[in] data Chunk data
+             * @return true on success
+             */
+            virtual bool ProgramChunk(std::uint32_t chunk, gsl::span<const std::uint8_t> data) = 0;
+        };
+
+        /**
+         * @brief LRU cache of memory chunks
+         *
+         * Cache holds fixed number of slots provided by owner (see @ref StaticChunkCache). Reads are served from cache
+         * if chunk is present, otherwise data read from memory should be stored in cache. Least recently used slot is
+         * replaced when cache is full.
+         *
+         * In @ref ChunkCacheMode::WriteBack mode written chunks are kept in cache and programmed on eviction or flush
+         * (in ascending chunk order). Chunks that are not programmed yet are lost on reset, so this mode trades
+         * durability for fewer memory operations.
+         *
+         * Cache is not thread safe, it relies on Yaffs lock.
+         */
+        class ChunkCache : public services::fs::IYaffsDeviceCache
+        {
+          public:
+            /**
+             * @brief Cache slot
+             */
+            struct Slot
+            {
+                /** @brief Cached chunk number */
+                std::uint32_t Chunk;
+                /** @brief Value of use counter at last access */
+                std::uint32_t LastUse;
+                /** @brief Number of valid bytes */
+                std::uint16_t Length;
+                /** @brief Slot holds chunk */
+                bool Valid;
+                /** @brief Slot holds data not written to memory yet */
+                bool Dirty;
+            };
+
+            /**
+             * @brief Constructs @ref ChunkCache instance
+             * @param[in] slots Slots descriptors
+             * @param[in] buffer Slots data buffer (slots.size() * chunkSize bytes)
+             * @param[in] chunkSize Size of single chunk
+             * @param[in] mode Write policy
+             */
+            ChunkCache(gsl::span<Slot> slots, gsl::span<std::uint8_t> buffer, std::size_t chunkSize, ChunkCacheMode mode);
+
+            /**
+             * @brief Sets destination of deferred writes
+             * @param[in] writer Chunk writer
+             */
+            void SetWriter(IChunkWriter& writer);
+
+            /**
+             * @brief Reads chunk from cache
+             * @param[in] chunk Chunk number
+             * @param[out] data Chunk data
+             * @return true if chunk was found in cache, false if memory needs to be read
+             */
+            bool Read(std::uint32_t chunk, gsl::span<std::uint8_t> data);
+
+            /**
+             * @brief Stores chunk which content matches memory
+             * @param[in] chunk Chunk number
+             * @param[in] data Chunk data
+             */
+            void Store(std::uint32_t chunk, gsl::span<const std::uint8_t> data);
+
+            /**
+             * @brief Defers chunk write
+             * @param[in] chunk Chunk number
+             * @param[in] data Chunk data
+             * @return true if chunk will be written back later, false if it must be programmed immediately
+             */
+            bool Defer(std::uint32_t chunk, gsl::span<const std::uint8_t> data);
+
+            /**
+             * @brief Drops chunks from range (including not written ones)
+             * @param[in] firstChunk First chunk to drop
+             * @param[in] count Number of chunks to drop
+             */
+            void Invalidate(std::uint32_t firstChunk, std::uint32_t count);
+
+            virtual OSResult Flush() override;
+
+            virtual services::fs::ChunkCacheStatistics Statistics() const override;
+
+          private:
+            /**
+             * @brief Finds slot holding chunk
+             * @param[in] chunk Chunk number
+             * @return Slot index or -1 if chunk is not cached
+             */
+            std::int32_t Find(std::uint32_t chunk) const;
+
+            /**
+             * @brief Selects slot for new chunk, writing back its previous content if needed
+             * @param[in] chunk Chunk number
+             * @return Slot index
+             */
+            std::size_t Allocate(std::uint32_t chunk);
+
+            /**
+             * @brief Writes dirty slot to memory
+             * @param[in] slot Slot index
+             * @return true on success
+             */
+            bool WriteBack(std::size_t slot);
+
+            /**
+             * @brief Copies data into slot
+             * @param[in] slot Slot index
+             * @param[in] chunk Chunk number
+             * @param[in] data Chunk data
+             * @param[in] dirty true if data is not written to memory
+             */
+            void Put(std::size_t slot, std::uint32_t chunk, gsl::span<const std::uint8_t> data, bool dirty);
+
+            /**
+             * @brief Returns data buffer of slot
+             * @param[in] slot Slot index
+             * @return Slot data buffer
+             */
+            gsl::span<std::uint8_t> Data(std::size_t slot);
+
+            /** @brief Slots descriptors */
+            gsl::span<Slot> _slots;
+            /** @brief Slots data */
+            gsl::span<std::uint8_t> _buffer;
+            /** @brief Chunk size */
+            const std::size_t _chunkSize;
+            /** @brief Write policy */
+            const ChunkCacheMode _mode;
+            /** @brief Destination of deferred writes */
+            IChunkWriter* _writer;
+            /** @brief Use counter */
+            std::uint32_t _useCounter;
+            /** @brief Statistics */
+            services::fs::ChunkCacheStatistics _statistics;
+        };
+
+        /**
+         * @brief Chunk cache with slots placed in object
+         * @tparam SlotsCount Number of slots
+         * @tparam ChunkSize Chunk size
+         */
+        template <std::size_t SlotsCount, std::size_t ChunkSize> class StaticChunkCache final : public ChunkCache
+        {
+          public:
+            /**
+             * @brief Constructs @ref StaticChunkCache instance
+             * @param[in] mode Write policy
+             */
+            StaticChunkCache(ChunkCacheMode mode);
+
+          private:
+            /** @brief Slots descriptors */
+            std::array<Slot, SlotsCount> _slotsStorage;
+            /** @brief Slots data */
+            alignas(4) std::array<std::uint8_t, SlotsCount * ChunkSize> _bufferStorage;
+        };
+
+        template <std::size_t SlotsCount, std::size_t ChunkSize>
+        StaticChunkCache<SlotsCount, ChunkSize>::StaticChunkCache(ChunkCacheMode mode)
+            : ChunkCache(_slotsStorage, _bufferStorage, ChunkSize, mode)
+        {
+        }
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_DRIVERS_N25Q_INCLUDE_N25Q_CHUNK_CACHE_HPP_ */
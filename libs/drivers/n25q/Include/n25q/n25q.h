@@ -93,6 +93,15 @@ namespace devices
             Timeout  //!< Timeout
         };
 
+        /**
+         * @brief Command used to read memory array
+         */
+        enum class ReadMode
+        {
+            Normal, //!< READ (0x03) command, supported up to 54MHz SPI clock
+            Fast    //!< FAST_READ (0x0B) command with 8 dummy clock cycles, supported up to 108MHz SPI clock
+        };
+
         class OperationWaiter;
 
         /**
@@ -190,8 +199,12 @@ namespace devices
              * @param[in] errors Errors counting mechanism
              * @param[in] deviceId Id associated with this N25Q chip, used for error counting.
              * @param[in] spi SPI interface to use
+             * @param[in] readMode Command used to read memory array
              */
-            N25QDriver(error_counter::IErrorCounting& errors, error_counter::Device deviceId, drivers::spi::ISPIInterface& spi);
+            N25QDriver(error_counter::IErrorCounting& errors,
+                error_counter::Device deviceId,
+                drivers::spi::ISPIInterface& spi,
+                ReadMode readMode = ReadMode::Normal);
 
             /**
              * @brief Reads data from memory starting from given address
@@ -325,6 +338,8 @@ namespace devices
             error_counter::IErrorCounting& _errors;
             /** @brief Device ID assigned to this chip - used for error counting */
             error_counter::Device _deviceId;
+            /** @brief Command used to read memory array */
+            const ReadMode _readMode;
 
             /** @brief Program page operation timeout
              * Datasheet states that this operation should take maximum 5 ms.
@@ -427,6 +442,39 @@ namespace devices
                 gsl::span<uint8_t> redundantBuffer1,
                 gsl::span<uint8_t> redundantBuffer2);
 
+            /**
+             * @brief Reads data protected by integrity tag from memory starting from given address.
+             * @param[in] address Start address
+             * @param[out] outputBuffer Output buffer
+             * @param[out] redundantBuffer1 First buffer used for redundant read
+             * @param[out] redundantBuffer2 Second buffer used for redundant read
+             * @return Operation result
+             *
+             * Data must have been written followed by its CRC-32 (@ref TagSize bytes, little endian) - tag of data read to
+             * outputBuffer is located at address + outputBuffer.size(). All buffers should have the same length. If not,
+             * the length of shortest buffer will be used as data size.
+             *
+             * Data is read from the first chip only, as long as its tag is valid. Otherwise data from the second chip is used
+             * if its tag is valid. If neither tag matches but both chips hold the same data and tag (e.g. erased area), data
+             * is returned as is. In any other case bitwise triple modular redundancy is performed using data from all 3 drivers.
+             *
+             * redundantBuffer1 and redundantBuffer2 are only written if data from the first chip fails integrity check.
+             */
+            OSResult ReadTaggedMemory(std::size_t address,
+                gsl::span<uint8_t> outputBuffer,
+                gsl::span<uint8_t> redundantBuffer1,
+                gsl::span<uint8_t> redundantBuffer2);
+
+            /**
+             * @brief Calculates integrity tag of data
+             * @param[in] data Data to protect
+             * @return Integrity tag stored after data
+             */
+            static std::uint32_t CalculateTag(gsl::span<const uint8_t> data);
+
+            /** @brief Size of integrity tag used by @ref ReadTaggedMemory */
+            static constexpr std::size_t TagSize = sizeof(std::uint32_t);
+
             /**
              * @brief Erases all 3 chips.
              * @return Operation result
@@ -485,6 +533,18 @@ namespace devices
             using ErrorCounter = error_counter::ErrorCounter<7>;
 
           private:
+            /**
+             * @brief Reads data and its integrity tag from single chip
+             * @param[in] driver Chip driver
+             * @param[in] address Start address
+             * @param[out] buffer Data buffer
+             * @param[out] valid Set to true if tag matches data
+             * @param[out] tag Tag read from memory
+             * @return Operation result
+             */
+            static OSResult ReadTagged(
+                IN25QDriver* driver, std::size_t address, gsl::span<uint8_t> buffer, bool& valid, std::array<uint8_t, TagSize>& tag);
+
             std::array<IN25QDriver*, 3> _n25qDrivers;
 
             /** @brief Error counter */
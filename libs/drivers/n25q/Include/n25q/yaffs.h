@@ -1,13 +1,20 @@
 #ifndef LIBS_DRIVERS_N25Q_INCLUDE_N25Q_YAFFS_H_
 #define LIBS_DRIVERS_N25Q_INCLUDE_N25Q_YAFFS_H_
 
+#include "background_eraser.hpp"
 #include "base/os.h"
+#include "base/writer.h"
+#include "chunk_cache.hpp"
 #include "fs/yaffs.h"
 #include "logger/logger.h"
 #include "n25q.h"
 #include "spi/spi.h"
 #include "yaffs.hpp"
 
+extern "C" {
+#include "yaffs_packedtags2.h"
+}
+
 namespace devices
 {
     namespace n25q
@@ -30,21 +37,55 @@ namespace devices
             Sector     //!< Sector
         };
 
+        /**
+         * @brief Possible methods of ensuring chunk integrity
+         *
+         * Methods use different on-flash chunk layouts, changing the method requires erasing the file system.
+         */
+        enum class ChunkIntegrity
+        {
+            Redundancy, //!< Each chunk is compared between chips on every read
+            Crc32       //!< Each chunk carries CRC-32 tag, other chips are read only if tag does not match
+        };
+
+        /**
+         * @brief Returns number of file data bytes stored by Yaffs in single chunk.
+         * @param[in] chunkSize Single chunk size
+         * @param[in] integrity Chunk integrity method
+         * @return Chunk size without CRC-32 tag and Yaffs in-band tags.
+         */
+        constexpr std::size_t DataBytesPerChunk(std::size_t chunkSize, ChunkIntegrity integrity)
+        {
+            return chunkSize - (integrity == ChunkIntegrity::Crc32 ? RedundantN25QDriver::TagSize : 0) -
+                   sizeof(yaffs_packed_tags2_tags_only);
+        }
+
         /**
          * @brief Yaffs driver for N25Q flash memory
          * @tparam blockMapping Block mapping
          * @tparam ChunkSize Single chunk size
          * @tparam TotalSize Total memory size
          */
-        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize> class N25QYaffsDevice
+        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
+        class N25QYaffsDevice : private IChunkWriter, private IBlockEraser
         {
           public:
             /**
              * @brief Constructs @ref N25QYaffsDevice instance
              * @param[in] mountPoint Mount point (absolute path)
              * @param[in] driver N25Q driver to use
+             * @param[in] integrity Chunk integrity method
+             * @param[in] cache Optional chunk cache (slots must hold at least ChunkSize bytes)
+             * @param[in] eraser Optional background eraser (must be initialized before mount)
+             *
+             * With @ref ChunkIntegrity::Crc32 last @ref RedundantN25QDriver::TagSize bytes of each chunk are occupied by CRC-32 of
+             * the rest of the chunk and are not available to Yaffs. Memory formatted with one method can't be mounted using the other.
              */
-            N25QYaffsDevice(const char* mountPoint, RedundantN25QDriver& driver);
+            N25QYaffsDevice(const char* mountPoint,
+                RedundantN25QDriver& driver,
+                ChunkIntegrity integrity = ChunkIntegrity::Redundancy,
+                ChunkCache* cache = nullptr,
+                BackgroundEraser* eraser = nullptr);
 
             /**
              * @brief Mounts device
@@ -122,13 +163,43 @@ namespace devices
             */
             static int CheckBadBlock(struct yaffs_dev* dev, int block_no);
 
+            /**
+             * @brief (Yaffs callback) Deinitializes device
+             * @param[in] dev Yaffs device
+             * @return Operation result
+             *
+             * Chunks held by write-back cache are programmed and queued blocks are erased before device is unmounted.
+             */
+            static int Deinitialise(struct yaffs_dev* dev);
+
+            /**
+             * @brief Programs chunk (appending integrity tag if needed)
+             * @param[in] chunk Chunk number
+             * @param[in] data Chunk data
+             * @return true on success
+             */
+            virtual bool ProgramChunk(std::uint32_t chunk, gsl::span<const std::uint8_t> data) override;
+
+            /**
+             * @brief Erases memory structure mapped to block
+             * @param[in] block Block number
+             * @return true on success
+             */
+            virtual bool EraseBlockNow(std::uint32_t block) override;
+
             /** @brief Yaffs device */
             yaffs_dev _device;
             /** @brief Low-level N25Q driver */
             RedundantN25QDriver& _driver;
             /** @brief Block mapping */
             const BlockMapping _blockMapping;
-            /** @brief First buffer for redundant reads */
+            /** @brief Chunk integrity method */
+            const ChunkIntegrity _integrity;
+            /** @brief Chunk cache (may be null) */
+            ChunkCache* const _cache;
+            /** @brief Background eraser (may be null) */
+            BackgroundEraser* const _eraser;
+            /** @brief First buffer for redundant reads (also used to assemble tagged chunk before write) */
             alignas(4) std::array<std::uint8_t, ChunkSize> _redundantReadBuffer1;
             /** @brief Second buffer for redundant reads */
             alignas(4) std::array<std::uint8_t, ChunkSize> _redundantReadBuffer2;
@@ -150,9 +221,13 @@ namespace devices
         };
 
         template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
-        N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::N25QYaffsDevice(const char* mountPoint, RedundantN25QDriver& driver)
-            : _driver(driver), //
-              _blockMapping(blockMapping)
+        N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::N25QYaffsDevice(
+            const char* mountPoint, RedundantN25QDriver& driver, ChunkIntegrity integrity, ChunkCache* cache, BackgroundEraser* eraser)
+            : _driver(driver),             //
+              _blockMapping(blockMapping), //
+              _integrity(integrity),       //
+              _cache(cache),               //
+              _eraser(eraser)
         {
             memset(&this->_device, 0, sizeof(this->_device));
 
@@ -161,7 +236,11 @@ namespace devices
             this->_device.param.inband_tags = true;
             this->_device.param.is_yaffs2 = true;
             this->_device.param.total_bytes_per_chunk = ChunkSize;
-            this->_device.param.chunks_per_block = BlockSize<blockMapping>::value / this->_device.param.total_bytes_per_chunk;
+            if (integrity == ChunkIntegrity::Crc32)
+            {
+                this->_device.param.total_bytes_per_chunk -= RedundantN25QDriver::TagSize;
+            }
+            this->_device.param.chunks_per_block = BlockSize<blockMapping>::value / ChunkSize;
             this->_device.param.spare_bytes_per_chunk = 0;
             this->_device.param.start_block = 1;
             this->_device.param.n_reserved_blocks = 3;
@@ -175,8 +254,19 @@ namespace devices
             this->_device.drv.drv_erase_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::EraseBlock;
             this->_device.drv.drv_mark_bad_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::MarkBadBlock;
             this->_device.drv.drv_check_bad_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::CheckBadBlock;
+            this->_device.drv.drv_deinitialise_fn = N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::Deinitialise;
 
-            auto blockSize = this->_device.param.chunks_per_block * this->_device.param.total_bytes_per_chunk;
+            if (this->_cache != nullptr)
+            {
+                this->_cache->SetWriter(*this);
+            }
+
+            if (this->_eraser != nullptr)
+            {
+                this->_eraser->SetEraser(*this);
+            }
+
+            auto blockSize = this->_device.param.chunks_per_block * ChunkSize;
 
             this->_device.param.end_block = TotalSize / blockSize //
                 - this->_device.param.start_block                 //
@@ -190,6 +280,17 @@ namespace devices
             if (OS_RESULT_SUCCEEDED(result))
             {
                 LOGF(LOG_LEVEL_INFO, "[Device %s] Mounted successfully", this->_device.param.name);
+
+                if (this->_cache != nullptr)
+                {
+                    deviceOperations.AttachCache(*this->_cache);
+                }
+
+                if (this->_eraser != nullptr)
+                {
+                    deviceOperations.AttachEraser(*this->_eraser);
+                }
+
                 return OSResult::Success;
             }
             else
@@ -232,13 +333,49 @@ namespace devices
 
             *ecc_result = yaffs_ecc_result::YAFFS_ECC_RESULT_NO_ERROR;
 
-            auto baseAddress = nand_chunk * dev->param.total_bytes_per_chunk;
+            auto baseAddress = nand_chunk * ChunkSize;
 
             gsl::span<uint8_t> outputBuffer(data, data_len);
+
+            if (This->_cache != nullptr && This->_cache->Read(nand_chunk, outputBuffer))
+            {
+                return YAFFS_OK;
+            }
+
             gsl::span<uint8_t> redundantBuffer1(This->_redundantReadBuffer1.data(), data_len);
             gsl::span<uint8_t> redundantBuffer2(This->_redundantReadBuffer2.data(), data_len);
 
-            This->_driver.ReadMemory(baseAddress, outputBuffer, redundantBuffer1, redundantBuffer2);
+            BackgroundEraser::BlockAccess access(This->_eraser, nand_chunk / dev->param.chunks_per_block);
+            if (!access())
+            {
+                return YAFFS_FAIL;
+            }
+
+            OSResult result;
+            if (This->_integrity == ChunkIntegrity::Crc32 && data_len == static_cast<int>(dev->param.total_bytes_per_chunk))
+            {
+                result = This->_driver.ReadTaggedMemory(baseAddress, outputBuffer, redundantBuffer1, redundantBuffer2);
+            }
+            else
+            {
+                result = This->_driver.ReadMemory(baseAddress, outputBuffer, redundantBuffer1, redundantBuffer2);
+            }
+
+            if (result != OSResult::Success)
+            {
+                LOGF(LOG_LEVEL_ERROR,
+                    "[Device %s] Read of chunk %ld failed Error %d",
+                    dev->param.name,
+                    static_cast<long>(nand_chunk),
+                    num(result));
+                *ecc_result = yaffs_ecc_result::YAFFS_ECC_RESULT_UNFIXED;
+                return YAFFS_FAIL;
+            }
+
+            if (This->_cache != nullptr)
+            {
+                This->_cache->Store(nand_chunk, outputBuffer);
+            }
 
             return YAFFS_OK;
         }
@@ -261,50 +398,131 @@ namespace devices
 
             auto This = reinterpret_cast<N25QYaffsDevice*>(dev->driver_context);
 
-            auto baseAddress = nand_chunk * dev->param.total_bytes_per_chunk;
+            if (data_len > static_cast<int>(dev->param.total_bytes_per_chunk))
+            {
+                LOGF(LOG_LEVEL_ERROR, "Trying to write to large page: %d bytes", data_len);
+                return YAFFS_FAIL;
+            }
 
             gsl::span<const uint8_t> buffer(data, data_len);
 
-            auto result = This->_driver.WriteMemory(baseAddress, buffer);
+            if (This->_cache != nullptr && This->_cache->Defer(nand_chunk, buffer))
+            {
+                return YAFFS_OK;
+            }
 
-            if (result != OperationResult::Success)
+            if (!This->ProgramChunk(nand_chunk, buffer))
             {
-                LOGF(LOG_LEVEL_ERROR, "[Device %s] Write to chunk %d failed Error %d", dev->param.name, nand_chunk, num(result));
                 return YAFFS_FAIL;
             }
 
+            if (This->_cache != nullptr)
+            {
+                This->_cache->Store(nand_chunk, buffer);
+            }
+
             return YAFFS_OK;
         }
 
+        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
+        bool N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::ProgramChunk(std::uint32_t chunk, gsl::span<const std::uint8_t> data)
+        {
+            auto baseAddress = chunk * ChunkSize;
+
+            gsl::span<const uint8_t> buffer = data;
+
+            if (this->_integrity == ChunkIntegrity::Crc32)
+            {
+                // chunk is written at once, with tag following data
+                auto tagged = gsl::make_span(this->_redundantReadBuffer1).subspan(0, data.size() + RedundantN25QDriver::TagSize);
+                std::copy(data.begin(), data.end(), tagged.begin());
+
+                Writer writer(tagged.subspan(data.size()));
+                writer.WriteDoubleWordLE(RedundantN25QDriver::CalculateTag(data));
+
+                buffer = tagged;
+            }
+
+            BackgroundEraser::BlockAccess access(this->_eraser, chunk / this->_device.param.chunks_per_block);
+            if (!access())
+            {
+                LOGF(LOG_LEVEL_ERROR,
+                    "[Device %s] Chunk %ld not written, pending erase failed",
+                    this->_device.param.name,
+                    static_cast<long>(chunk));
+                return false;
+            }
+
+            auto result = this->_driver.WriteMemory(baseAddress, buffer);
+
+            if (result != OperationResult::Success)
+            {
+                LOGF(LOG_LEVEL_ERROR,
+                    "[Device %s] Write to chunk %ld failed Error %d",
+                    this->_device.param.name,
+                    static_cast<long>(chunk),
+                    num(result));
+                return false;
+            }
+
+            return true;
+        }
+
         template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
         int N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::EraseBlock(struct yaffs_dev* dev, int block_no)
         {
             auto This = reinterpret_cast<N25QYaffsDevice*>(dev->driver_context);
 
-            LOGF(LOG_LEVEL_INFO, "[Device %s] Erasing block %d", dev->param.name, block_no);
+            if (This->_cache != nullptr)
+            {
+                This->_cache->Invalidate(block_no * dev->param.chunks_per_block, dev->param.chunks_per_block);
+            }
+
+            // checkpoint left in memory after Yaffs invalidated it would be restored on next mount
+            auto checkpoint = dev->block_info[block_no - dev->internal_start_block].block_state == YAFFS_BLOCK_STATE_CHECKPOINT;
+
+            if (This->_eraser != nullptr && !checkpoint && This->_eraser->Defer(block_no))
+            {
+                LOGF(LOG_LEVEL_INFO, "[Device %s] Block %d queued for erase", dev->param.name, block_no);
+                return YAFFS_OK;
+            }
+
+            BackgroundEraser::BlockAccess access(This->_eraser, block_no);
+
+            return This->EraseBlockNow(block_no) ? YAFFS_OK : YAFFS_FAIL;
+        }
+
+        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
+        bool N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::EraseBlockNow(std::uint32_t block)
+        {
+            LOGF(LOG_LEVEL_INFO, "[Device %s] Erasing block %ld", this->_device.param.name, static_cast<long>(block));
 
-            auto baseAddress = block_no * dev->param.chunks_per_block * dev->param.total_bytes_per_chunk;
+            auto baseAddress = block * this->_device.param.chunks_per_block * ChunkSize;
 
             auto result = OperationResult::Failure;
 
-            switch (This->_blockMapping)
+            switch (this->_blockMapping)
             {
                 case devices::n25q::BlockMapping::Sector:
-                    result = This->_driver.EraseSector(baseAddress);
+                    result = this->_driver.EraseSector(baseAddress);
                     break;
 
                 case devices::n25q::BlockMapping::SubSector:
-                    result = This->_driver.EraseSubSector(baseAddress);
+                    result = this->_driver.EraseSubSector(baseAddress);
                     break;
             }
 
             if (result != OperationResult::Success)
             {
-                LOGF(LOG_LEVEL_ERROR, "[Device %s] Erase block failed: %d Error %d", dev->param.name, block_no, num(result));
-                return YAFFS_FAIL;
+                LOGF(LOG_LEVEL_ERROR,
+                    "[Device %s] Erase block failed: %ld Error %d",
+                    this->_device.param.name,
+                    static_cast<long>(block),
+                    num(result));
+                return false;
             }
 
-            return YAFFS_OK;
+            return true;
         }
 
         template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
@@ -324,6 +542,26 @@ namespace devices
             return YAFFS_OK;
         }
 
+        template <BlockMapping blockMapping, std::size_t ChunkSize, std::size_t TotalSize>
+        int N25QYaffsDevice<blockMapping, ChunkSize, TotalSize>::Deinitialise(struct yaffs_dev* dev)
+        {
+            auto This = reinterpret_cast<N25QYaffsDevice*>(dev->driver_context);
+
+            if (This->_cache != nullptr && OS_RESULT_FAILED(This->_cache->Flush()))
+            {
+                LOGF(LOG_LEVEL_ERROR, "[Device %s] Failed to flush chunk cache", dev->param.name);
+                return YAFFS_FAIL;
+            }
+
+            if (This->_eraser != nullptr && OS_RESULT_FAILED(This->_eraser->Drain()))
+            {
+                LOGF(LOG_LEVEL_ERROR, "[Device %s] Failed to erase queued blocks", dev->param.name);
+                return YAFFS_FAIL;
+            }
+
+            return YAFFS_OK;
+        }
+
         /** @} */
     }
 }
@@ -0,0 +1,246 @@
+#include <algorithm>
+
+#include "background_eraser.hpp"
+#include "logger/logger.h"
+
+using namespace devices::n25q;
+using namespace std::chrono_literals;
+using services::fs::EraseStatistics;
+
+constexpr std::chrono::milliseconds BackgroundEraser::DefaultIdleTime;
+constexpr OSEventBits BackgroundEraser::Event::Pending;
+
+BackgroundEraser::BlockAccess::BlockAccess(BackgroundEraser* eraser, std::uint32_t block) : _eraser(eraser), _ready(true)
+{
+    if (this->_eraser == nullptr)
+    {
+        return;
+    }
+
+    const auto start = System::GetUptime();
+
+    System::TakeSemaphore(this->_eraser->_lock, InfiniteTimeout);
+
+    // queued blocks are erased in order, so all blocks queued before accessed one are erased too
+    while (this->_eraser->IsPending(block))
+    {
+        const auto first = this->_eraser->_queue[this->_eraser->_head];
+        const auto erased = this->_eraser->EraseFirst(true);
+
+        if (first == block)
+        {
+            this->_ready = erased;
+        }
+    }
+
+    this->_eraser->RecordStall(System::GetUptime() - start);
+}
+
+BackgroundEraser::BlockAccess::~BlockAccess()
+{
+    if (this->_eraser == nullptr)
+    {
+        return;
+    }
+
+    this->_eraser->_lastAccess = System::GetUptime();
+
+    System::GiveSemaphore(this->_eraser->_lock);
+}
+
+BackgroundEraser::BackgroundEraser(gsl::span<std::uint32_t> queue, std::chrono::milliseconds idleTime)
+    : _queue(queue),                     //
+      _head(0),                          //
+      _count(0),                         //
+      _idleTime(idleTime),               //
+      _eraser(nullptr),                  //
+      _lastAccess(0ms),                  //
+      _statistics{0, 0, 0, 0, 0ms, 0ms}, //
+      _lock(nullptr),                    //
+      _task("BackgroundErase", this, EraserTask)
+{
+}
+
+OSResult BackgroundEraser::Initialize()
+{
+    this->_lock = System::CreateBinarySemaphore();
+    if (this->_lock == nullptr)
+    {
+        return OSResult::NotEnoughMemory;
+    }
+
+    System::GiveSemaphore(this->_lock);
+
+    auto result = this->_control.Initialize();
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    return this->_task.Create();
+}
+
+void BackgroundEraser::SetEraser(IBlockEraser& eraser)
+{
+    this->_eraser = &eraser;
+}
+
+bool BackgroundEraser::Defer(std::uint32_t block)
+{
+    if (this->_eraser == nullptr || this->_queue.size() == 0)
+    {
+        return false;
+    }
+
+    const auto start = System::GetUptime();
+
+    Lock lock(this->_lock, InfiniteTimeout);
+
+    if (this->_count == this->_queue.size())
+    {
+        EraseFirst(true);
+    }
+
+    this->_queue[(this->_head + this->_count) % this->_queue.size()] = block;
+    this->_count++;
+
+    {
+        CriticalSection cs;
+        this->_statistics.Pending = static_cast<std::uint16_t>(this->_count);
+    }
+
+    this->_control.Set(Event::Pending);
+
+    RecordStall(System::GetUptime() - start);
+
+    this->_lastAccess = System::GetUptime();
+
+    return true;
+}
+
+bool BackgroundEraser::EraseIfIdle()
+{
+    Lock lock(this->_lock, InfiniteTimeout);
+
+    if (this->_count == 0)
+    {
+        this->_control.Clear(Event::Pending);
+        return false;
+    }
+
+    if (System::GetUptime() - this->_lastAccess < this->_idleTime)
+    {
+        return false;
+    }
+
+    auto erased = EraseFirst(false);
+
+    this->_lastAccess = System::GetUptime();
+
+    if (this->_count == 0)
+    {
+        this->_control.Clear(Event::Pending);
+    }
+
+    return erased;
+}
+
+OSResult BackgroundEraser::Drain()
+{
+    if (this->_lock == nullptr)
+    {
+        return OSResult::Success;
+    }
+
+    Lock lock(this->_lock, InfiniteTimeout);
+
+    auto result = OSResult::Success;
+
+    while (this->_count > 0)
+    {
+        if (!EraseFirst(true))
+        {
+            result = OSResult::IOError;
+        }
+    }
+
+    this->_control.Clear(Event::Pending);
+
+    return result;
+}
+
+EraseStatistics BackgroundEraser::Statistics() const
+{
+    CriticalSection cs;
+
+    return this->_statistics;
+}
+
+void BackgroundEraser::EraserTask(BackgroundEraser* This)
+{
+    while (1)
+    {
+        This->_control.WaitAny(Event::Pending, false, InfiniteTimeout);
+
+        System::SleepTask(This->_idleTime);
+
+        This->EraseIfIdle();
+    }
+}
+
+bool BackgroundEraser::IsPending(std::uint32_t block) const
+{
+    for (std::ptrdiff_t i = 0; i < this->_count; i++)
+    {
+        if (this->_queue[(this->_head + i) % this->_queue.size()] == block)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool BackgroundEraser::EraseFirst(bool forced)
+{
+    const auto block = this->_queue[this->_head];
+
+    // failed block is dropped as well, otherwise it would block all erases queued after it
+    this->_head = (this->_head + 1) % this->_queue.size();
+    this->_count--;
+
+    const auto erased = this->_eraser->EraseBlockNow(block);
+    if (!erased)
+    {
+        LOGF(LOG_LEVEL_ERROR, "[eraser] Erase of block %ld failed", static_cast<long>(block));
+    }
+
+    CriticalSection cs;
+    this->_statistics.Pending = static_cast<std::uint16_t>(this->_count);
+    if (!erased)
+    {
+        this->_statistics.Failures++;
+    }
+    else if (forced)
+    {
+        this->_statistics.ForcedErases++;
+    }
+    else
+    {
+        this->_statistics.BackgroundErases++;
+    }
+
+    return erased;
+}
+
+void BackgroundEraser::RecordStall(std::chrono::milliseconds stall)
+{
+    if (stall == 0ms)
+    {
+        return;
+    }
+
+    CriticalSection cs;
+    this->_statistics.LongestStall = std::max(this->_statistics.LongestStall, stall);
+    this->_statistics.TotalStall += stall;
+}
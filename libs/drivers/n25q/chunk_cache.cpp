@@ -0,0 +1,211 @@
+#include <algorithm>
+
+#include "chunk_cache.hpp"
+#include "logger/logger.h"
+
+using namespace devices::n25q;
+using services::fs::ChunkCacheStatistics;
+
+ChunkCache::ChunkCache(gsl::span<Slot> slots, gsl::span<std::uint8_t> buffer, std::size_t chunkSize, ChunkCacheMode mode)
+    : _slots(slots),          //
+      _buffer(buffer),        //
+      _chunkSize(chunkSize),  //
+      _mode(mode),            //
+      _writer(nullptr),       //
+      _useCounter(0),         //
+      _statistics{0, 0, 0}
+{
+    for (auto& slot : this->_slots)
+    {
+        slot.Chunk = 0;
+        slot.LastUse = 0;
+        slot.Length = 0;
+        slot.Valid = false;
+        slot.Dirty = false;
+    }
+}
+
+void ChunkCache::SetWriter(IChunkWriter& writer)
+{
+    this->_writer = &writer;
+}
+
+bool ChunkCache::Read(std::uint32_t chunk, gsl::span<std::uint8_t> data)
+{
+    auto index = Find(chunk);
+
+    if (index < 0 || this->_slots[index].Length < data.size())
+    {
+        this->_statistics.Misses++;
+        return false;
+    }
+
+    auto source = Data(index).subspan(0, data.size());
+    std::copy(source.begin(), source.end(), data.begin());
+
+    this->_slots[index].LastUse = ++this->_useCounter;
+    this->_statistics.Hits++;
+
+    return true;
+}
+
+void ChunkCache::Store(std::uint32_t chunk, gsl::span<const std::uint8_t> data)
+{
+    if (data.size() > static_cast<std::ptrdiff_t>(this->_chunkSize))
+    {
+        return;
+    }
+
+    auto index = Find(chunk);
+    if (index >= 0)
+    {
+        Put(index, chunk, data, false);
+        return;
+    }
+
+    Put(Allocate(chunk), chunk, data, false);
+}
+
+bool ChunkCache::Defer(std::uint32_t chunk, gsl::span<const std::uint8_t> data)
+{
+    if (this->_mode != ChunkCacheMode::WriteBack || this->_writer == nullptr || data.size() > static_cast<std::ptrdiff_t>(this->_chunkSize))
+    {
+        return false;
+    }
+
+    auto index = Find(chunk);
+    if (index < 0)
+    {
+        index = Allocate(chunk);
+    }
+
+    Put(index, chunk, data, true);
+
+    return true;
+}
+
+void ChunkCache::Invalidate(std::uint32_t firstChunk, std::uint32_t count)
+{
+    for (auto& slot : this->_slots)
+    {
+        if (slot.Valid && slot.Chunk >= firstChunk && slot.Chunk - firstChunk < count)
+        {
+            slot.Valid = false;
+            slot.Dirty = false;
+        }
+    }
+}
+
+OSResult ChunkCache::Flush()
+{
+    auto result = OSResult::Success;
+
+    while (true)
+    {
+        // programming in ascending order keeps chunks within block written sequentially
+        std::int32_t next = -1;
+        for (std::ptrdiff_t i = 0; i < this->_slots.size(); i++)
+        {
+            if (this->_slots[i].Valid && this->_slots[i].Dirty && (next < 0 || this->_slots[i].Chunk < this->_slots[next].Chunk))
+            {
+                next = i;
+            }
+        }
+
+        if (next < 0)
+        {
+            return result;
+        }
+
+        if (!WriteBack(next))
+        {
+            result = OSResult::IOError;
+        }
+    }
+}
+
+ChunkCacheStatistics ChunkCache::Statistics() const
+{
+    return this->_statistics;
+}
+
+std::int32_t ChunkCache::Find(std::uint32_t chunk) const
+{
+    for (std::ptrdiff_t i = 0; i < this->_slots.size(); i++)
+    {
+        if (this->_slots[i].Valid && this->_slots[i].Chunk == chunk)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+std::size_t ChunkCache::Allocate(std::uint32_t chunk)
+{
+    std::size_t victim = 0;
+
+    for (std::ptrdiff_t i = 0; i < this->_slots.size(); i++)
+    {
+        if (!this->_slots[i].Valid)
+        {
+            return i;
+        }
+
+        if (this->_slots[i].LastUse < this->_slots[victim].LastUse)
+        {
+            victim = i;
+        }
+    }
+
+    if (this->_slots[victim].Dirty)
+    {
+        WriteBack(victim);
+    }
+
+    LOGF(LOG_LEVEL_TRACE,
+        "[chunk cache] Chunk %ld replaced by %ld",
+        static_cast<long>(this->_slots[victim].Chunk),
+        static_cast<long>(chunk));
+
+    this->_slots[victim].Valid = false;
+    this->_statistics.Evictions++;
+
+    return victim;
+}
+
+bool ChunkCache::WriteBack(std::size_t slot)
+{
+    auto& s = this->_slots[slot];
+
+    // chunk is not retried - repeated programming of NOR memory would not fix it
+    s.Dirty = false;
+
+    if (!this->_writer->ProgramChunk(s.Chunk, Data(slot).subspan(0, s.Length)))
+    {
+        LOGF(LOG_LEVEL_ERROR, "[chunk cache] Write back of chunk %ld failed", static_cast<long>(s.Chunk));
+        s.Valid = false;
+        return false;
+    }
+
+    return true;
+}
+
+void ChunkCache::Put(std::size_t slot, std::uint32_t chunk, gsl::span<const std::uint8_t> data, bool dirty)
+{
+    auto& s = this->_slots[slot];
+
+    std::copy(data.begin(), data.end(), Data(slot).begin());
+
+    s.Chunk = chunk;
+    s.Length = static_cast<std::uint16_t>(data.size());
+    s.LastUse = ++this->_useCounter;
+    s.Valid = true;
+    s.Dirty = s.Dirty || dirty;
+}
+
+gsl::span<std::uint8_t> ChunkCache::Data(std::size_t slot)
+{
+    return this->_buffer.subspan(slot * this->_chunkSize, this->_chunkSize);
+}
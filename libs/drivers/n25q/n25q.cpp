@@ -25,6 +25,7 @@ enum N25QCommand
     ReadStatusRegister = 0x05,
     ReadFlagStatusRegister = 0x70,
     ReadMemory = 0x03,
+    FastReadMemory = 0x0B,
     WriteEnable = 0x06,
     WriteDisable = 0x05,
     ProgramMemory = 0x02,
@@ -78,10 +79,12 @@ template <typename Action> static OSResult Retry(std::uint8_t retries, Action ac
 N25QDriver::N25QDriver(                    //
     error_counter::IErrorCounting& errors, //
     error_counter::Device deviceId,        //
-    ISPIInterface& spi)
-    : _spi(spi),          //
-      _errors(errors),    //
-      _deviceId(deviceId) //
+    ISPIInterface& spi,                    //
+    ReadMode readMode)
+    : _spi(spi),           //
+      _errors(errors),     //
+      _deviceId(deviceId), //
+      _readMode(readMode)  //
 
 {
 }
@@ -149,14 +152,24 @@ FlagStatus N25QDriver::ReadFlagStatus()
 OSResult N25QDriver::ReadMemory(std::size_t address, gsl::span<uint8_t> buffer)
 {
     auto r = Retry(RetryCount, [this, address, &buffer]() {
-        array<uint8_t, 4> command;
+        array<uint8_t, 5> command;
         Writer writer(command);
 
-        writer.WriteByte(N25QCommand::ReadMemory);
-        WriterWriteAddress(writer, address);
+        if (this->_readMode == ReadMode::Fast)
+        {
+            writer.WriteByte(N25QCommand::FastReadMemory);
+            WriterWriteAddress(writer, address);
+            // dummy byte provides 8 clock cycles required by fast read
+            writer.WriteByte(0);
+        }
+        else
+        {
+            writer.WriteByte(N25QCommand::ReadMemory);
+            WriterWriteAddress(writer, address);
+        }
 
         SPISelectSlave slave(this->_spi);
-        auto r = this->_spi.Write(command);
+        auto r = this->_spi.Write(writer.Capture());
 
         if (r != OSResult::Success)
         {
@@ -2,7 +2,9 @@
 #include <array>
 #include <cstring>
 
+#include "base/crc.h"
 #include "base/os.h"
+#include "base/reader.h"
 
 #include "n25q.h"
 
@@ -15,6 +17,8 @@ using namespace devices::n25q;
 using redundancy::Vote;
 using redundancy::CorrectBuffer;
 
+constexpr std::size_t RedundantN25QDriver::TagSize;
+
 RedundantN25QDriver::RedundantN25QDriver(         //
     error_counter::IErrorCounting& errorCounting, //
     std::array<IN25QDriver*, 3> n25qDrivers)
@@ -71,6 +75,102 @@ OSResult RedundantN25QDriver::ReadMemory( //
     return OSResult::Success;
 }
 
+OSResult RedundantN25QDriver::ReadTaggedMemory( //
+    std::size_t address,                        //
+    gsl::span<uint8_t> outputBuffer,            //
+    gsl::span<uint8_t> redundantBuffer1,        //
+    gsl::span<uint8_t> redundantBuffer2)
+{
+    auto bufferLength = std::min(outputBuffer.length(), std::min(redundantBuffer1.length(), redundantBuffer2.length()));
+
+    auto normalizedOutputBuffer = outputBuffer.subspan(0, bufferLength);
+
+    std::array<uint8_t, TagSize> tag1;
+    bool valid = false;
+
+    auto r = ReadTagged(_n25qDrivers[0], address, normalizedOutputBuffer, valid, tag1);
+
+    if (r != OSResult::Success)
+    {
+        return r;
+    }
+
+    if (valid)
+    {
+        _error.Success();
+        return OSResult::Success;
+    }
+
+    auto normalizedRedundantBuffer1 = redundantBuffer1.subspan(0, bufferLength);
+    std::array<uint8_t, TagSize> tag2;
+
+    r = ReadTagged(_n25qDrivers[1], address, normalizedRedundantBuffer1, valid, tag2);
+
+    if (r != OSResult::Success)
+    {
+        return r;
+    }
+
+    if (valid)
+    {
+        _error.Failure();
+        std::copy(normalizedRedundantBuffer1.begin(), normalizedRedundantBuffer1.end(), normalizedOutputBuffer.begin());
+        return OSResult::Success;
+    }
+
+    auto compareResult = memcmp(normalizedOutputBuffer.data(), normalizedRedundantBuffer1.data(), normalizedOutputBuffer.size()) == 0 //
+        && tag1 == tag2;
+
+    if (compareResult)
+    {
+        _error.Success();
+        return OSResult::Success;
+    }
+
+    {
+        _error.Failure();
+        auto normalizedRedundantBuffer2 = redundantBuffer2.subspan(0, bufferLength);
+
+        r = _n25qDrivers[2]->ReadMemory(address, normalizedRedundantBuffer2);
+        if (r != OSResult::Success)
+        {
+            return r;
+        }
+
+        CorrectBuffer(normalizedOutputBuffer, normalizedRedundantBuffer1, normalizedRedundantBuffer2);
+    }
+
+    return OSResult::Success;
+}
+
+std::uint32_t RedundantN25QDriver::CalculateTag(gsl::span<const uint8_t> data)
+{
+    return CRC32_calc(data);
+}
+
+OSResult RedundantN25QDriver::ReadTagged(
+    IN25QDriver* driver, std::size_t address, gsl::span<uint8_t> buffer, bool& valid, std::array<uint8_t, TagSize>& tag)
+{
+    valid = false;
+
+    auto r = driver->ReadMemory(address, buffer);
+    if (r != OSResult::Success)
+    {
+        return r;
+    }
+
+    r = driver->ReadMemory(address + buffer.size(), tag);
+    if (r != OSResult::Success)
+    {
+        return r;
+    }
+
+    Reader reader(tag);
+    valid = reader.ReadDoubleWordLE() == CalculateTag(buffer);
+
+    return OSResult::Success;
+}
+
 OperationResult RedundantN25QDriver::EraseChip()
 {
     auto d1Wait = _n25qDrivers[0]->BeginEraseChip();
@@ -1,10 +1,13 @@
 #ifndef LIBS_DRIVERS_SPI_INCLUDE_SPI_EFM_H_
 #define LIBS_DRIVERS_SPI_INCLUDE_SPI_EFM_H_
 
+#include <array>
 #include <cstdint>
+#include <em_dma.h>
 #include <gsl/span>
 
 #include "base/os.h"
+#include "efm_support/api.h"
 #include "gpio/gpio.h"
 #include "spi.h"
 
@@ -23,6 +26,9 @@ namespace drivers
          * @brief SPI interface using EFM SPI peripheral
          *
          * This class represent EFM peripheral, to use it with specific device (slave) see @ref EFMSPISlaveInterface
+         *
+         * Transfers longer than single DMA cycle (@ref efm::dma::MaxCycleLength bytes) are executed as chained (scatter-gather)
+         * DMA transfers of up to @ref MaxTransferSize bytes, so e.g. whole flash chunk is transferred without re-arming DMA channels.
          */
         class EFMSPIInterface final
         {
@@ -56,6 +62,12 @@ namespace drivers
             */
             void Unlock();
 
+            /** @brief Maximum number of DMA tasks in single chained transfer */
+            static constexpr std::size_t MaxTransferTasks = 4;
+
+            /** @brief Maximum number of bytes transferred without re-arming DMA */
+            static constexpr std::ptrdiff_t MaxTransferSize = MaxTransferTasks * efm::dma::MaxCycleLength;
+
           private:
             /**
              * @brief DMA callback called when transfer is finished. Always executes in ISR mode
@@ -77,6 +89,10 @@ namespace drivers
             unsigned int _txChannel;
             /** @brief Input data channel */
             unsigned int _rxChannel;
+            /** @brief Task descriptors of chained output transfer */
+            std::array<DMA_DESCRIPTOR_TypeDef, MaxTransferTasks> _txTasks;
+            /** @brief Task descriptors of chained input transfer */
+            std::array<DMA_DESCRIPTOR_TypeDef, MaxTransferTasks> _rxTasks;
             /** @brief Event group with transfer finished flags */
             EventGroup _transferGroup;
             /** @brief Lock used to synchronize periperhal access */
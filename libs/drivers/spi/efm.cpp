@@ -15,6 +15,9 @@ using std::uint32_t;
 
 using namespace drivers::spi;
 
+constexpr std::size_t EFMSPIInterface::MaxTransferTasks;
+constexpr std::ptrdiff_t EFMSPIInterface::MaxTransferSize;
+
 static void* RXPort = const_cast<uint32_t*>(&io_map::SPI::Peripheral->RXDATA);
 static void* TXPort = const_cast<uint32_t*>(&io_map::SPI::Peripheral->TXDATA);
 
@@ -50,9 +53,9 @@ OSResult EFMSPIInterface::Write(gsl::span<const std::uint8_t> buffer)
 {
     efm::usart::Command(io_map::SPI::Peripheral, USART_CMD_RXBLOCKEN);
 
-    for (decltype(buffer.size()) offset = 0; offset < buffer.size(); offset += 1024)
+    for (decltype(buffer.size()) offset = 0; offset < buffer.size(); offset += MaxTransferSize)
     {
-        auto part = buffer.subspan(offset, std::min(1024, buffer.size() - offset));
+        auto part = buffer.subspan(offset, std::min(MaxTransferSize, buffer.size() - offset));
 
         this->_transferGroup.Clear(TransferFinished);
 
@@ -61,15 +64,31 @@ OSResult EFMSPIInterface::Write(gsl::span<const std::uint8_t> buffer)
 
         efm::usart::IntClear(io_map::SPI::Peripheral, efm::usart::IntGet(io_map::SPI::Peripheral));
 
-        efm::dma::MemoryPeripheral(this->_txChannel,
-            efm::DMASignal<efm::DMASignalUSART::TXBL>(io_map::SPI::Peripheral),
-            TXPort,
-            const_cast<uint8_t*>(part.data()),
-            true,
-            part.size(),
-            dmadrvDataSize1,
-            OnTransferFinished,
-            this);
+        if (part.size() <= efm::dma::MaxCycleLength)
+        {
+            efm::dma::MemoryPeripheral(this->_txChannel,
+                efm::DMASignal<efm::DMASignalUSART::TXBL>(io_map::SPI::Peripheral),
+                TXPort,
+                const_cast<uint8_t*>(part.data()),
+                true,
+                part.size(),
+                dmadrvDataSize1,
+                OnTransferFinished,
+                this);
+        }
+        else
+        {
+            efm::dma::MemoryPeripheralChained(this->_txChannel,
+                efm::DMASignal<efm::DMASignalUSART::TXBL>(io_map::SPI::Peripheral),
+                TXPort,
+                const_cast<uint8_t*>(part.data()),
+                true,
+                part.size(),
+                dmadrvDataSize1,
+                this->_txTasks,
+                OnTransferFinished,
+                this);
+        }
 
         auto result = this->_transferGroup.WaitAll(TransferTXFinished, true, io_map::SPI::DMATransferTimeout);
 
@@ -89,9 +108,9 @@ OSResult EFMSPIInterface::Write(gsl::span<const std::uint8_t> buffer)
 
 OSResult EFMSPIInterface::Read(gsl::span<std::uint8_t> buffer)
 {
-    for (decltype(buffer.size()) offset = 0; offset < buffer.size(); offset += 1024)
+    for (decltype(buffer.size()) offset = 0; offset < buffer.size(); offset += MaxTransferSize)
     {
-        auto part = buffer.subspan(offset, std::min(1024, buffer.size() - offset));
+        auto part = buffer.subspan(offset, std::min(MaxTransferSize, buffer.size() - offset));
 
         this->_transferGroup.Clear(TransferFinished);
 
@@ -100,25 +119,52 @@ OSResult EFMSPIInterface::Read(gsl::span<std::uint8_t> buffer)
 
         efm::usart::IntClear(io_map::SPI::Peripheral, efm::usart::IntGet(io_map::SPI::Peripheral));
 
-        efm::dma::PeripheralMemory(this->_rxChannel,
-            efm::DMASignal<efm::DMASignalUSART::RXDATAV>(io_map::SPI::Peripheral),
-            part.data(),
-            RXPort,
-            true,
-            part.size(),
-            dmadrvDataSize1,
-            OnTransferFinished,
-            this);
-
-        efm::dma::MemoryPeripheral(this->_txChannel,
-            efm::DMASignal<efm::DMASignalUSART::TXBL>(io_map::SPI::Peripheral),
-            TXPort,
-            part.data(),
-            true,
-            part.size(),
-            dmadrvDataSize1,
-            OnTransferFinished,
-            this);
+        if (part.size() <= efm::dma::MaxCycleLength)
+        {
+            efm::dma::PeripheralMemory(this->_rxChannel,
+                efm::DMASignal<efm::DMASignalUSART::RXDATAV>(io_map::SPI::Peripheral),
+                part.data(),
+                RXPort,
+                true,
+                part.size(),
+                dmadrvDataSize1,
+                OnTransferFinished,
+                this);
+
+            efm::dma::MemoryPeripheral(this->_txChannel,
+                efm::DMASignal<efm::DMASignalUSART::TXBL>(io_map::SPI::Peripheral),
+                TXPort,
+                part.data(),
+                true,
+                part.size(),
+                dmadrvDataSize1,
+                OnTransferFinished,
+                this);
+        }
+        else
+        {
+            efm::dma::PeripheralMemoryChained(this->_rxChannel,
+                efm::DMASignal<efm::DMASignalUSART::RXDATAV>(io_map::SPI::Peripheral),
+                part.data(),
+                RXPort,
+                true,
+                part.size(),
+                dmadrvDataSize1,
+                this->_rxTasks,
+                OnTransferFinished,
+                this);
+
+            efm::dma::MemoryPeripheralChained(this->_txChannel,
+                efm::DMASignal<efm::DMASignalUSART::TXBL>(io_map::SPI::Peripheral),
+                TXPort,
+                part.data(),
+                true,
+                part.size(),
+                dmadrvDataSize1,
+                this->_txTasks,
+                OnTransferFinished,
+                this);
+        }
 
         auto result = this->_transferGroup.WaitAll(TransferFinished, true, io_map::SPI::DMATransferTimeout);
 
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <em_cmu.h>
 #include <em_usart.h>
+#include <gsl/span>
 #include "dmadrv.h"
 
 namespace efm
@@ -265,6 +266,119 @@ namespace efm
             DMADRV_DataSize_t size,
             DMADRV_Callback_t callback,
             void* cbUserParam);
+
+        /** @brief Maximum number of items transferred in single DMA cycle */
+        constexpr int MaxCycleLength = 1024;
+
+        /***************************************************************************/ /**
+          * @brief
+          *  Start a peripheral to memory DMA transfer longer than single DMA cycle.
+          *
+          * Transfer is split into tasks of at most @ref MaxCycleLength items which are executed
+          * by DMA controller in peripheral scatter-gather mode, so the whole transfer is performed
+          * without re-arming the channel. Callback is called once, after the last task.
+          *
+          * @param[in] channelId
+          *  The channel Id assigned by DMADRV.
+          *
+          * @param[in] peripheralSignal
+          *  Selects which peripheral/peripheralsignal to use.
+          *
+          * @param[in] dst
+          *  Destination memory address.
+          *
+          * @param[in] src
+          *  Source memory (peripheral register) address.
+          *
+          * @param[in] dstInc
+          *  Set to true to enable destination address increment.
+          *
+          * @param[in] len
+          *  Number if items (of @a size size) to transfer.
+          *
+          * @param[in] size
+          *  Item size, byte, halfword or word.
+          *
+          * @param[in] tasks
+          *  Task descriptors (at least @a len / @ref MaxCycleLength rounded up),
+          *  must stay valid until transfer is finished.
+          *
+          * @param[in] callback
+          *  Function to call on dma completion, use NULL if not needed.
+          *
+          * @param[in] cbUserParam
+          *  Optional user parameter to feed to the callback function.
+          *
+          * @return
+          *   ECODE_EMDRV_DMADRV_OK on success. On failure an appropriate
+          *   DMADRV Ecode_t is returned.
+          *
+          * @ingroup efm_support
+          ******************************************************************************/
+        Ecode_t PeripheralMemoryChained(unsigned int channelId,
+            DMADRV_PeripheralSignal_t peripheralSignal,
+            void* dst,
+            void* src,
+            bool dstInc,
+            int len,
+            DMADRV_DataSize_t size,
+            gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+            DMADRV_Callback_t callback,
+            void* cbUserParam);
+
+        /***************************************************************************/ /**
+          * @brief
+          *  Start a memory to peripheral DMA transfer longer than single DMA cycle.
+          *
+          * See @ref PeripheralMemoryChained for details.
+          *
+          * @param[in] channelId
+          *  The channel Id assigned by DMADRV.
+          *
+          * @param[in] peripheralSignal
+          *  Selects which peripheral/peripheralsignal to use.
+          *
+          * @param[in] dst
+          *  Destination (peripheral register) memory address.
+          *
+          * @param[in] src
+          *  Source memory address.
+          *
+          * @param[in] srcInc
+          *  Set to true to enable source address increment.
+          *
+          * @param[in] len
+          *  Number if items (of @a size size) to transfer.
+          *
+          * @param[in] size
+          *  Item size, byte, halfword or word.
+          *
+          * @param[in] tasks
+          *  Task descriptors (at least @a len / @ref MaxCycleLength rounded up),
+          *  must stay valid until transfer is finished.
+          *
+          * @param[in] callback
+          *  Function to call on dma completion, use NULL if not needed.
+          *
+          * @param[in] cbUserParam
+          *  Optional user parameter to feed to the callback function.
+          *
+          * @return
+          *   ECODE_EMDRV_DMADRV_OK on success. On failure an appropriate
+          *   DMADRV Ecode_t is returned.
+          *
+          * @ingroup efm_support
+          ******************************************************************************/
+        Ecode_t MemoryPeripheralChained(unsigned int channelId,
+            DMADRV_PeripheralSignal_t peripheralSignal,
+            void* dst,
+            void* src,
+            bool srcInc,
+            int len,
+            DMADRV_DataSize_t size,
+            gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+            DMADRV_Callback_t callback,
+            void* cbUserParam);
     }
 
     namespace mcu
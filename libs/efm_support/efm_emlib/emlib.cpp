@@ -1,7 +1,109 @@
+#include <algorithm>
+#include <array>
 #include <em_device.h>
+#include <em_dma.h>
 #include <em_rmu.h>
 #include "efm_support/api.h"
 
+namespace
+{
+    /** @brief Completion callback of chained transfer */
+    struct ChainedTransfer
+    {
+        /** @brief Callback descriptor used by DMA interrupt handler */
+        DMA_CB_TypeDef Callback;
+        /** @brief User callback */
+        DMADRV_Callback_t UserCallback;
+        /** @brief User callback parameter */
+        void* UserParam;
+    };
+
+    /** @brief Chained transfers (one per channel) */
+    std::array<ChainedTransfer, DMA_CHAN_COUNT> ChainedTransfers;
+
+    void OnChainedTransferFinished(unsigned int channel, bool primary, void* user)
+    {
+        static_cast<void>(primary);
+
+        auto transfer = static_cast<ChainedTransfer*>(user);
+
+        if (transfer->UserCallback != nullptr)
+        {
+            transfer->UserCallback(channel, 1, transfer->UserParam);
+        }
+    }
+
+    Ecode_t StartChainedTransfer(unsigned int channelId,
+        DMADRV_PeripheralSignal_t peripheralSignal,
+        std::uint8_t* dst,
+        bool dstInc,
+        std::uint8_t* src,
+        bool srcInc,
+        int len,
+        DMADRV_DataSize_t size,
+        gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+        DMADRV_Callback_t callback,
+        void* cbUserParam)
+    {
+        const int tasksCount = (len + efm::dma::MaxCycleLength - 1) / efm::dma::MaxCycleLength;
+
+        if (channelId >= DMA_CHAN_COUNT || len <= 0 || tasksCount > tasks.size())
+        {
+            return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+        }
+
+        auto& transfer = ChainedTransfers[channelId];
+        transfer.Callback.cbFunc = OnChainedTransferFinished;
+        transfer.Callback.userPtr = &transfer;
+        transfer.Callback.primary = 0;
+        transfer.UserCallback = callback;
+        transfer.UserParam = cbUserParam;
+
+        DMA_CfgChannel_TypeDef channelConfig;
+        channelConfig.highPri = false;
+        channelConfig.enableInt = true;
+        channelConfig.select = peripheralSignal;
+        channelConfig.cb = &transfer.Callback;
+        DMA_CfgChannel(channelId, &channelConfig);
+
+        const int itemSize = 1 << size;
+
+        for (int i = 0; i < tasksCount; i++)
+        {
+            const int taskLength = std::min(efm::dma::MaxCycleLength, len - i * efm::dma::MaxCycleLength);
+
+            DMA_CfgDescrSGAlt_TypeDef task;
+            task.src = src;
+            task.dst = dst;
+            task.srcInc = srcInc ? static_cast<DMA_DataInc_TypeDef>(size) : dmaDataIncNone;
+            task.dstInc = dstInc ? static_cast<DMA_DataInc_TypeDef>(size) : dmaDataIncNone;
+            task.size = static_cast<DMA_DataSize_TypeDef>(size);
+            task.arbRate = dmaArbitrate1;
+            task.nMinus1 = taskLength - 1;
+            task.hprot = 0;
+            task.peripheral = true;
+
+            DMA_CfgDescrScatterGather(tasks.data(), i, &task);
+
+            if (srcInc)
+            {
+                src += taskLength * itemSize;
+            }
+
+            if (dstInc)
+            {
+                dst += taskLength * itemSize;
+            }
+        }
+
+        DMA->IFC = 1 << channelId;
+
+        DMA_ActivateScatterGather(channelId, false, tasks.data(), tasksCount);
+
+        return ECODE_EMDRV_DMADRV_OK;
+    }
+}
+
 namespace efm
 {
     namespace cmu
@@ -77,6 +179,54 @@ namespace efm
         {
             return DMADRV_MemoryPeripheral(channelId, peripheralSignal, dst, src, srcInc, len, size, callback, cbUserParam);
         }
+
+        Ecode_t PeripheralMemoryChained(unsigned int channelId,
+            DMADRV_PeripheralSignal_t peripheralSignal,
+            void* dst,
+            void* src,
+            bool dstInc,
+            int len,
+            DMADRV_DataSize_t size,
+            gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+            DMADRV_Callback_t callback,
+            void* cbUserParam)
+        {
+            return StartChainedTransfer(channelId,
+                peripheralSignal,
+                static_cast<std::uint8_t*>(dst),
+                dstInc,
+                static_cast<std::uint8_t*>(src),
+                false,
+                len,
+                size,
+                tasks,
+                callback,
+                cbUserParam);
+        }
+
+        Ecode_t MemoryPeripheralChained(unsigned int channelId,
+            DMADRV_PeripheralSignal_t peripheralSignal,
+            void* dst,
+            void* src,
+            bool srcInc,
+            int len,
+            DMADRV_DataSize_t size,
+            gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+            DMADRV_Callback_t callback,
+            void* cbUserParam)
+        {
+            return StartChainedTransfer(channelId,
+                peripheralSignal,
+                static_cast<std::uint8_t*>(dst),
+                false,
+                static_cast<std::uint8_t*>(src),
+                srcInc,
+                len,
+                size,
+                tasks,
+                callback,
+                cbUserParam);
+        }
     }
 
     namespace mcu
@@ -1443,6 +1443,111 @@ int yaffs_pwrite(int fd, const void* buf, unsigned int nbyte, Y_LOFF_T offset)
     return yaffsfs_do_write(fd, buf, nbyte, 1, offset);
 }
 
+/*
+ * Copies whole content of source file to destination file, one chunk at a time.
+ * Data is moved through device temporary buffer in chunk aligned pieces, so
+ * every destination chunk is written once and no caller buffer is needed.
+ * File positions of both handles are not changed.
+ */
+int yaffs_copy_data(int srcHandle, int destHandle)
+{
+    struct yaffsfs_FileDes* srcFd = NULL;
+    struct yaffsfs_FileDes* destFd = NULL;
+    struct yaffs_obj* srcObj = NULL;
+    struct yaffs_obj* destObj = NULL;
+    struct yaffs_dev* dev = NULL;
+    u8* buffer = NULL;
+    Y_LOFF_T pos = 0;
+    Y_LOFF_T maxRead = 0;
+    int chunkSize = 0;
+    int nToRead = 0;
+    int nRead = 0;
+    int nWritten = 0;
+    int totalWritten = 0;
+
+    yaffsfs_Lock();
+    srcFd = yaffsfs_HandleToFileDes(srcHandle);
+    destFd = yaffsfs_HandleToFileDes(destHandle);
+    srcObj = yaffsfs_HandleToObject(srcHandle);
+    destObj = yaffsfs_HandleToObject(destHandle);
+
+    if (!srcFd || !srcObj || !destFd || !destObj)
+    {
+        /* bad handle */
+        yaffsfs_SetError(-EBADF);
+        totalWritten = -1;
+    }
+    else if (!srcFd->reading || !destFd->writing)
+    {
+        yaffsfs_SetError(-EINVAL);
+        totalWritten = -1;
+    }
+    else if (destObj->my_dev->read_only)
+    {
+        yaffsfs_SetError(-EROFS);
+        totalWritten = -1;
+    }
+    else
+    {
+        yaffsfs_GetHandle(srcHandle);
+        yaffsfs_GetHandle(destHandle);
+
+        dev = srcObj->my_dev;
+        chunkSize = dev->data_bytes_per_chunk;
+
+        while (totalWritten >= 0)
+        {
+            /* Tricky bit...
+             * Need to reverify objects in case the device was
+             * unmounted in another thread.
+             */
+            srcObj = yaffsfs_HandleToObject(srcHandle);
+            destObj = yaffsfs_HandleToObject(destHandle);
+            if (!srcObj || !destObj || destObj->my_dev->read_only)
+                break;
+
+            maxRead = yaffs_get_obj_length(srcObj) - pos;
+            if (maxRead <= 0)
+                break;
+
+            nToRead = (maxRead < chunkSize) ? (int)maxRead : chunkSize;
+
+            buffer = yaffs_get_temp_buffer(dev);
+
+            nRead = yaffs_file_rd(srcObj, buffer, pos, nToRead);
+            nWritten = (nRead > 0) ? yaffs_wr_file(destObj, buffer, pos, nRead, 0) : 0;
+
+            yaffs_release_temp_buffer(dev, buffer);
+
+            if (nRead <= 0)
+                break;
+
+            if (nWritten != nRead)
+            {
+                yaffsfs_SetError(-ENOSPC);
+                totalWritten = -1;
+                break;
+            }
+
+            totalWritten += nWritten;
+            pos += nWritten;
+
+            if (nRead < chunkSize)
+                break;
+
+            yaffsfs_Unlock();
+            yaffsfs_Lock();
+        }
+
+        yaffsfs_PutHandle(destHandle);
+        yaffsfs_PutHandle(srcHandle);
+    }
+
+    yaffsfs_Unlock();
+
+    return totalWritten;
+}
+
 int yaffs_truncate_reldir(struct yaffs_obj* reldir, const YCHAR* path, Y_LOFF_T new_size)
 {
     struct yaffs_obj* obj = NULL;
@@ -3727,6 +3832,28 @@ struct yaffs_dirent* yaffs_readdir(yaffs_DIR* dirp)
     return ret;
 }
 
+/* Reads next entry and stats object it refers to without looking it up by name */
+struct yaffs_dirent* yaffs_readdir_with_stat(yaffs_DIR* dirp, struct yaffs_stat* buf)
+{
+    struct yaffsfs_DirSearchContext* dsc;
+    struct yaffs_obj* obj = NULL;
+    struct yaffs_dirent* ret;
+
+    yaffsfs_Lock();
+
+    dsc = (struct yaffsfs_DirSearchContext*)dirp;
+    if (dsc && dsc->inUse)
+        obj = dsc->nextReturn;
+
+    ret = yaffsfs_readdir_no_lock(dirp);
+
+    if (ret && yaffsfs_DoStat(obj, buf) < 0)
+        memset(buf, 0, sizeof(*buf));
+
+    yaffsfs_Unlock();
+    return ret;
+}
+
 static void yaffsfs_rewinddir_no_lock(yaffs_DIR* dirp)
 {
     struct yaffsfs_DirSearchContext* dsc;
@@ -96,6 +96,7 @@ int yaffs_write(int fd, const void* buf, unsigned int nbyte);
 
 int yaffs_pread(int fd, void* buf, unsigned int nbyte, Y_LOFF_T offset);
 int yaffs_pwrite(int fd, const void* buf, unsigned int nbyte, Y_LOFF_T offset);
+int yaffs_copy_data(int srcHandle, int destHandle);
 
 Y_LOFF_T yaffs_lseek(int fd, Y_LOFF_T offset, int whence);
 
@@ -138,6 +139,7 @@ int yaffs_rmdir(const YCHAR* path);
 
 yaffs_DIR* yaffs_opendir(const YCHAR* dirname);
 struct yaffs_dirent* yaffs_readdir(yaffs_DIR* dirp);
+struct yaffs_dirent* yaffs_readdir_with_stat(yaffs_DIR* dirp, struct yaffs_stat* buf);
 void yaffs_rewinddir(yaffs_DIR* dirp);
 int yaffs_closedir(yaffs_DIR* dirp);
 
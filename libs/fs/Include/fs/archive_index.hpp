@@ -0,0 +1,135 @@
+#ifndef LIBS_FS_INCLUDE_FS_ARCHIVE_INDEX_HPP_
+#define LIBS_FS_INCLUDE_FS_ARCHIVE_INDEX_HPP_
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "base/os.h"
+#include "fs.h"
+
+namespace services
+{
+    namespace fs
+    {
+        /**
+         * @addtogroup fs
+         * @{
+         */
+
+        /**
+         * @brief Sparse index of archive written by @ref ArchiveWriter.
+         *
+         * Index is made of two files paired with archive files: current index describes current archive file and
+         * previous index describes previous one. Every @ref Interval entry slot of archive file (slot is entry
+         * alignment) gets index entry with caller supplied key (e.g. mission time) and offset of archive entry.
+         * Index entries are kept sorted by offset, lookups assume that keys are non-decreasing as well.
+         *
+         * Index entry layout:
+         *  - 64-bit LE - Key
+         *  - 32-bit LE - Offset of archive entry
+         *
+         * Index entries are collected in small RAM buffer and written when it is full and on every flush of
+         * archive. Index written ahead of archive entries lost on reset is repaired when archive file is reopened.
+         * Readers must still tolerate index entries pointing past end of archive file (entries buffered in RAM).
+         *
+         * Index is driven by @ref ArchiveWriter and relies on its lock.
+         */
+        class ArchiveIndex final : private NotCopyable, private NotMoveable
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param[in] fs File system
+             * @param[in] currentPath Path to index of current archive file
+             * @param[in] previousPath Path to index of previous archive file
+             * @param[in] interval Number of archive entry slots per index entry (greater than 0)
+             */
+            ArchiveIndex(IFileSystem& fs, const char* currentPath, const char* previousPath, std::uint16_t interval);
+
+            /**
+             * @brief Returns number of archive entry slots per index entry
+             * @return Index interval
+             */
+            std::uint16_t Interval() const;
+
+            /**
+             * @brief Opens current index and drops its entries that point at or past end of archive file
+             * @param[in] archiveSize Size of current archive file
+             * @return true on success
+             */
+            bool Open(FileSize archiveSize);
+
+            /**
+             * @brief Adds index entry
+             * @param[in] key Key of archive entry
+             * @param[in] offset Offset of archive entry
+             */
+            void Add(std::uint64_t key, FileSize offset);
+
+            /**
+             * @brief Writes buffered index entries
+             * @return Operation result
+             */
+            OSResult Flush();
+
+            /**
+             * @brief Writes buffered index entries, closes current index and renames it to previous one
+             *
+             * Failures are only logged, stale entries left in current index are dropped by next @ref Open.
+             */
+            void Archive();
+
+            /**
+             * @brief Writes buffered index entries and closes current index
+             * @return Operation result
+             */
+            OSResult Close();
+
+            /**
+             * @brief Looks up archive offset from which entries with keys not less than given one should be searched
+             * @param[in] fs File system
+             * @param[in] path Path to index file
+             * @param[in] key Searched key
+             * @return Offset of last indexed archive entry with key less than searched one, 0 if there is no such entry
+             * or index cannot be read
+             *
+             * Index is searched with binary search, single index entry is read per step.
+             */
+            static FileSize Find(IFileSystem& fs, const char* path, std::uint64_t key);
+
+            /** @brief Size of single index entry */
+            static constexpr std::uint8_t EntrySize = 12;
+
+            /** @brief Number of index entries buffered in RAM */
+            static constexpr std::uint8_t BufferedEntries = 8;
+
+          private:
+            /** @brief File system */
+            IFileSystem& _fs;
+            /** @brief Path to index of current archive file */
+            const char* const _currentPath;
+            /** @brief Path to index of previous archive file */
+            const char* const _previousPath;
+            /** @brief Number of archive entry slots per index entry */
+            const std::uint16_t _interval;
+            /** @brief Current index file */
+            File _file;
+            /** @brief Size of current index file */
+            FileSize _length;
+            /** @brief Number of buffered index entries */
+            std::uint8_t _pending;
+            /** @brief Buffer for index entries */
+            std::array<std::uint8_t, BufferedEntries * EntrySize> _buffer;
+        };
+
+        inline std::uint16_t ArchiveIndex::Interval() const
+        {
+            return this->_interval;
+        }
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_FS_INCLUDE_FS_ARCHIVE_INDEX_HPP_ */
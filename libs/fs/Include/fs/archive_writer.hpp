@@ -0,0 +1,174 @@
+#ifndef LIBS_FS_INCLUDE_FS_ARCHIVE_WRITER_HPP_
+#define LIBS_FS_INCLUDE_FS_ARCHIVE_WRITER_HPP_
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <gsl/span>
+#include "archive_index.hpp"
+#include "base/os.h"
+#include "fs.h"
+#include "yaffs.h"
+
+namespace services
+{
+    namespace fs
+    {
+        /**
+         * @addtogroup fs
+         * @{
+         */
+
+        /**
+         * @brief Append-only writer of archive made of two files: current and previous one.
+         *
+         * Current file is opened on first append and stays open. Entries are placed at offsets aligned to entry
+         * alignment (gaps are filled with zeros) and accumulated in caller supplied RAM buffer which holds a window
+         * of file contents aligned to multiple of its size. When the buffer matches data part of the file system
+         * chunk, filled window is written as exactly one chunk instead of rewriting the last chunk of file on every
+         * entry.
+         *
+         * Buffered entries are written to file:
+         * - when window is filled,
+         * - when the oldest of them waits for flush delay (checked on append),
+         * - on explicit @ref Flush (e.g. file system sync attached via @ref IYaffsDeviceOperations::AttachWriter),
+         * - before rotation and on @ref Close.
+         *
+         * Once current file reaches maximal size it is closed and renamed to previous file (replacing it) and next
+         * entry starts new current file.
+         *
+         * Optional @ref ArchiveIndex attached with @ref AttachIndex gets key of every entry placed in indexed slot.
+         * It is flushed after archive, rotated together with it and repaired when current file is reopened.
+         */
+        class ArchiveWriter final : public IBufferedWriter, private NotCopyable, private NotMoveable
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param[in] fs File system
+             * @param[in] currentPath Path to current file
+             * @param[in] previousPath Path to previous file
+             * @param[in] maxFileSize Size of current file that triggers rotation
+             * @param[in] entryAlignment Number of bytes to which entries are aligned
+             * @param[in] flushDelay Maximal time entry is kept in RAM before it is written to file
+             * @param[in] buffer Buffer used for window of file contents
+             */
+            ArchiveWriter(IFileSystem& fs,
+                const char* currentPath,
+                const char* previousPath,
+                FileSize maxFileSize,
+                FileSize entryAlignment,
+                std::chrono::milliseconds flushDelay,
+                gsl::span<std::uint8_t> buffer);
+
+            /**
+             * @brief Creates synchronization primitives
+             * @return Operation result
+             */
+            OSResult Initialize();
+
+            /**
+             * @brief Attaches index maintained together with archive
+             * @param[in] index Archive index
+             * @remark This method must be called before first append.
+             */
+            void AttachIndex(ArchiveIndex& index);
+
+            /**
+             * @brief Appends entry to archive
+             * @param[in] entry Entry contents, not longer than buffer
+             * @param[in] key Key of entry saved in attached index
+             * @return true if entry is stored (possibly only in RAM), false otherwise
+             */
+            bool Append(gsl::span<const std::uint8_t> entry, std::uint64_t key = 0);
+
+            virtual OSResult Flush() override;
+
+            /**
+             * @brief Writes buffered entries and closes current file
+             * @return Operation result
+             *
+             * Next append reopens current file.
+             */
+            OSResult Close();
+
+            /**
+             * @brief Returns number of writes issued to file
+             * @return Number of writes
+             */
+            std::uint32_t Writes() const;
+
+          private:
+            /**
+             * @brief Opens current file and places window at its end
+             * @param[in] mode Open mode
+             * @return true on success
+             */
+            bool Open(FileOpen mode);
+
+            /**
+             * @brief Renames current file (and its index) to previous one and creates new current file
+             * @return true on success
+             */
+            bool Rotate();
+
+            /**
+             * @brief Writes part of window that is not in file yet (caller must hold lock)
+             * @return Operation result
+             */
+            OSResult FlushWindow();
+
+            /**
+             * @brief Returns current file size including buffered entries
+             * @return File size
+             */
+            FileSize Length() const;
+
+            /** @brief File system */
+            IFileSystem& _fs;
+            /** @brief Path to current file */
+            const char* const _currentPath;
+            /** @brief Path to previous file */
+            const char* const _previousPath;
+            /** @brief Size of current file that triggers rotation */
+            const FileSize _maxFileSize;
+            /** @brief Number of bytes to which entries are aligned */
+            const FileSize _entryAlignment;
+            /** @brief Maximal time entry is kept in RAM */
+            const std::chrono::milliseconds _flushDelay;
+            /** @brief Window buffer */
+            gsl::span<std::uint8_t> _window;
+            /** @brief Current file */
+            File _file;
+            /** @brief Position of window in file */
+            FileSize _windowOffset;
+            /** @brief Number of valid bytes in window */
+            FileSize _filled;
+            /** @brief Number of bytes at the beginning of window that are already in file */
+            FileSize _flushed;
+            /** @brief Uptime at which oldest buffered entry was appended */
+            std::chrono::milliseconds _pendingSince;
+            /** @brief Number of writes issued to file */
+            std::uint32_t _writes;
+            /** @brief Lock serializing appends with flushes requested by other tasks */
+            OSSemaphoreHandle _lock;
+            /** @brief Attached archive index */
+            ArchiveIndex* _index;
+        };
+
+        inline std::uint32_t ArchiveWriter::Writes() const
+        {
+            return this->_writes;
+        }
+
+        inline FileSize ArchiveWriter::Length() const
+        {
+            return this->_windowOffset + this->_filled;
+        }
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_FS_INCLUDE_FS_ARCHIVE_WRITER_HPP_ */
@@ -30,6 +30,14 @@ namespace services
         /** @brief Type that represents file size. */
         using FileSize = std::int32_t;
 
+        /**
+         * @brief Number of file data bytes stored in single chunk of the flight file system.
+         *
+         * Buffers of this size aligned to it touch exactly one chunk per flash access.
+         * Flight storage verifies at compile time that its device layout matches this value.
+         */
+        constexpr std::uint16_t ChunkDataSize = 2032;
+
         /**
          * @brief General I/O operation result
          */
@@ -124,6 +132,31 @@ namespace services
             End      //!< End of file
         };
 
+        /**
+         * @brief Type of directory entry
+         */
+        enum class DirectoryEntryType
+        {
+            File,      //!< Regular file
+            Directory, //!< Directory
+            Other      //!< Symbolic link or special file
+        };
+
+        /**
+         * @brief Directory entry together with its attributes
+         */
+        struct DirectoryEntry
+        {
+            /** @brief Entry name, valid until next read from the same directory */
+            const char* Name;
+            /** @brief Size in bytes */
+            FileSize Size;
+            /** @brief Time of last modification as provided by file system time source */
+            std::uint32_t ModificationTime;
+            /** @brief Entry type */
+            DirectoryEntryType Type;
+        };
+
         /**
          * @brief Structure exposing file system API
          */
@@ -150,6 +183,9 @@ namespace services
              *
              * If moved file does not exist this function will return failure. If the target file exists
              * it will be overwritten be the moved file.
+             *
+             * File data is not copied, so this function should be used instead of @ref Copy whenever
+             * source file is deleted right after copying (e.g. file rotation or archiving).
              * @param[in] from Path to file to be moved.
              * @param[in] to Path to new file location.
              * @return Operation status. @see FSFileOpenResult for details.
@@ -191,6 +227,30 @@ namespace services
              */
             virtual IOResult Read(FileHandle file, gsl::span<std::uint8_t> buffer) = 0;
 
+            /**
+             * @brief Writes data at given position in file
+             * @param[in] file File handle
+             * @param[in] offset Position in file
+             * @param[in] buffer Data buffer
+             * @return Operation status. @see FSIOResult for details.
+             *
+             * File position used by @ref Read and @ref Write is not changed. Files opened with append flag
+             * are always written at the end.
+             */
+            virtual IOResult WriteAt(FileHandle file, FileSize offset, gsl::span<const std::uint8_t> buffer) = 0;
+
+            /**
+             * @brief Reads data from given position in file
+             * @param[in] file File handle
+             * @param[in] offset Position in file
+             * @param[out] buffer Data buffer
+             * @return Operation status. @see FSIOResult for details.
+             *
+             * File position used by @ref Read and @ref Write is not changed, so single handle can be shared by
+             * concurrent readers.
+             */
+            virtual IOResult ReadAt(FileHandle file, FileSize offset, gsl::span<std::uint8_t> buffer) = 0;
+
             /**
              * @brief Closes file
              * @param[in] file File handle
@@ -212,6 +272,17 @@ namespace services
              */
             virtual char* ReadDirectory(DirectoryHandle directory) = 0;
 
+            /**
+             * @brief Reads next entry in directory together with its attributes.
+             * @param[in] directory Directory handle
+             * @param[out] entry Entry name and attributes
+             * @return true if entry was read, false if no more entries found.
+             *
+             * Attributes are taken from directory entry itself, so this is much cheaper than
+             * calling @ref GetFileSize for each name returned by @ref ReadDirectory.
+             */
+            virtual bool ReadDirectoryWithStat(DirectoryHandle directory, DirectoryEntry& entry) = 0;
+
             /**
              * @brief Closes directory
              * @param[in] directory Directory handle
@@ -334,6 +405,22 @@ namespace services
              */
             IOResult Write(gsl::span<const uint8_t> buffer);
 
+            /**
+             * @brief Reads from given position in file without changing file position
+             * @param offset Position in file
+             * @param buffer Buffer
+             * @return Operation result
+             */
+            IOResult ReadAt(FileSize offset, gsl::span<uint8_t> buffer);
+
+            /**
+             * @brief Writes at given position in file without changing file position
+             * @param offset Position in file
+             * @param buffer Buffer
+             * @return Operation result
+             */
+            IOResult WriteAt(FileSize offset, gsl::span<const uint8_t> buffer);
+
             /**
              * @brief Truncates file to desired size
              * @param size Desired size
@@ -7,6 +7,7 @@ namespace services
     {
         struct IFileSystem;
         class YaffsFileSystem;
+        struct IYaffsDeviceOperations;
     }
 }
 #endif /* LIBS_FS_INCLUDE_FS_FWD_HPP_ */
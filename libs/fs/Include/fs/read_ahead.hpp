@@ -0,0 +1,126 @@
+#ifndef LIBS_FS_INCLUDE_FS_READ_AHEAD_HPP_
+#define LIBS_FS_INCLUDE_FS_READ_AHEAD_HPP_
+
+#pragma once
+
+#include <cstdint>
+#include <gsl/span>
+#include "fs.h"
+
+namespace services
+{
+    namespace fs
+    {
+        /**
+         * @addtogroup fs
+         * @{
+         */
+
+        /**
+         * @brief Read-ahead source of file contents for mostly sequential readers.
+         *
+         * Object keeps a window of file contents in caller supplied RAM buffer. Window is aligned to multiple of its
+         * size, so when the buffer matches data part of the file system chunk every refill reads exactly one chunk.
+         *
+         * Requests are classified by looking at the end of the previous one:
+         * - request starting exactly where previous one ended is sequential: it is served from the window which is
+         *   refilled when needed,
+         * - any other request (backward jump, skip) is served from the window if it is already there, otherwise it
+         *   reads requested range directly from the file and leaves window intact. Refilling window for sparse
+         *   requests would read more flash than direct reads do.
+         *
+         * Object assumes that file is not modified while it is used.
+         */
+        class ReadAheadFile final
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param[in] file Opened file
+             * @param[in] window Buffer used for read-ahead window. Empty buffer disables read-ahead.
+             */
+            ReadAheadFile(File& file, gsl::span<std::uint8_t> window);
+
+            /**
+             * @brief Reads file contents
+             * @param[in] offset Position in file
+             * @param[out] buffer Buffer for file contents
+             * @return Operation result. On success result contains part of buffer that has been filled (shorter than buffer
+             * only at the end of file).
+             */
+            IOResult Read(FileSize offset, gsl::span<std::uint8_t> buffer);
+
+            /**
+             * @brief Returns number of window refills
+             * @return Number of window refills
+             */
+            std::uint32_t Refills() const;
+
+            /**
+             * @brief Returns number of requests read directly from file
+             * @return Number of direct reads
+             */
+            std::uint32_t DirectReads() const;
+
+          private:
+            /**
+             * @brief Checks whether request starting at given position continues sequential access
+             * @param[in] offset Position in file
+             * @return True if access is sequential
+             */
+            bool IsSequential(FileSize offset) const;
+
+            /**
+             * @brief Checks whether window contains given position
+             * @param[in] offset Position in file
+             * @return True if position is in window
+             */
+            bool InWindow(FileSize offset) const;
+
+            /**
+             * @brief Fills window with file contents surrounding given position
+             * @param[in] offset Position in file
+             * @return Operation status
+             */
+            OSResult Refill(FileSize offset);
+
+            /** @brief File */
+            File& _file;
+
+            /** @brief Read-ahead window buffer */
+            gsl::span<std::uint8_t> _window;
+
+            /** @brief Position of window in file */
+            FileSize _windowOffset;
+
+            /** @brief Number of valid bytes in window */
+            FileSize _windowLength;
+
+            /** @brief Position just after previous request */
+            FileSize _nextOffset;
+
+            /** @brief File size detected by short window refill, negative if not known yet */
+            FileSize _endOfFile;
+
+            /** @brief Number of window refills */
+            std::uint32_t _refills;
+
+            /** @brief Number of direct reads */
+            std::uint32_t _directReads;
+        };
+
+        inline std::uint32_t ReadAheadFile::Refills() const
+        {
+            return this->_refills;
+        }
+
+        inline std::uint32_t ReadAheadFile::DirectReads() const
+        {
+            return this->_directReads;
+        }
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_FS_INCLUDE_FS_READ_AHEAD_HPP_ */
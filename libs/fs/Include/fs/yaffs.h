@@ -1,6 +1,7 @@
 #ifndef LIBS_FS_INCLUDE_FS_YAFFS_H_
 #define LIBS_FS_INCLUDE_FS_YAFFS_H_
 
+#include <chrono>
 #include "fs.h"
 
 namespace services
@@ -16,6 +17,97 @@ namespace services
          * @{
          */
 
+        /**
+         * @brief Statistics of chunk cache placed between YAFFS and memory driver
+         */
+        struct ChunkCacheStatistics
+        {
+            /** @brief Number of chunk reads served from cache */
+            std::uint32_t Hits;
+            /** @brief Number of chunk reads that required memory access */
+            std::uint32_t Misses;
+            /** @brief Number of cached chunks replaced by other chunks */
+            std::uint32_t Evictions;
+        };
+
+        /**
+         * @brief Chunk cache of YAFFS device
+         */
+        struct IYaffsDeviceCache
+        {
+            /**
+             * @brief Writes all chunks with deferred write to memory
+             * @return Operation result
+             */
+            virtual OSResult Flush() = 0;
+
+            /**
+             * @brief Returns cache statistics
+             * @return Cache statistics
+             */
+            virtual ChunkCacheStatistics Statistics() const = 0;
+        };
+
+        /**
+         * @brief Statistics of background block eraser placed between YAFFS and memory driver
+         */
+        struct EraseStatistics
+        {
+            /** @brief Number of blocks waiting for erase */
+            std::uint16_t Pending;
+            /** @brief Number of blocks erased in background */
+            std::uint32_t BackgroundErases;
+            /** @brief Number of blocks erased synchronously because YAFFS accessed them before background erase */
+            std::uint32_t ForcedErases;
+            /** @brief Number of failed erases */
+            std::uint32_t Failures;
+            /** @brief Longest time YAFFS waited for erase */
+            std::chrono::milliseconds LongestStall;
+            /** @brief Total time YAFFS waited for erase */
+            std::chrono::milliseconds TotalStall;
+        };
+
+        /**
+         * @brief Background block eraser of YAFFS device
+         */
+        struct IYaffsDeviceEraser
+        {
+            /**
+             * @brief Returns eraser statistics
+             * @return Eraser statistics
+             */
+            virtual EraseStatistics Statistics() const = 0;
+
+            /**
+             * @brief Erases all queued blocks
+             * @return Operation result
+             */
+            virtual OSResult Drain() = 0;
+        };
+
+        /**
+         * @brief Writer keeping part of file contents in RAM until it is flushed
+         */
+        struct IBufferedWriter
+        {
+            /**
+             * @brief Writes buffered contents to file
+             * @return Operation result
+             */
+            virtual OSResult Flush() = 0;
+        };
+
+        /**
+         * @brief Statistics of last device mount
+         */
+        struct MountStatistics
+        {
+            /** @brief Time spent in mount */
+            std::chrono::milliseconds Duration;
+            /** @brief true if device state was restored from checkpoint, false if whole memory was scanned */
+            bool FromCheckpoint;
+        };
+
         /**
          * @brief API for mounting YAFFS device
          */
@@ -36,9 +128,69 @@ namespace services
             virtual OSResult ClearDevice(yaffs_dev* device) = 0;
 
             /**
-             * @brief Syncs file system (speeds up next mount)
+             * @brief Syncs file system (speeds up next mount) and flushes attached writer and chunk cache
+             *
+             * Checkpoint is not written while attached eraser has queued blocks.
              */
             virtual void Sync() = 0;
+
+            /**
+             * @brief Writes checkpoint of all mounted devices, so next mount does not have to scan whole memory
+             * @return Operation result
+             *
+             * Intended to be called right before planned reset. Attached writer is flushed and blocks queued in attached
+             * eraser are erased first, so checkpoint describes actual memory content. Any later file system modification
+             * invalidates checkpoint.
+             */
+            virtual OSResult Checkpoint() = 0;
+
+            /**
+             * @brief Returns statistics of last mount performed by @ref AddDeviceAndMount
+             * @return Mount statistics
+             */
+            virtual MountStatistics GetMountStatistics() = 0;
+
+            /**
+             * @brief Attaches chunk cache of mounted device
+             * @param[in] cache Chunk cache
+             *
+             * Attached cache is flushed on each @ref Sync and its statistics are reported by @ref GetCacheStatistics.
+             */
+            virtual void AttachCache(IYaffsDeviceCache& cache) = 0;
+
+            /**
+             * @brief Returns statistics of attached chunk cache
+             * @return Cache statistics (all zeros if no cache is attached)
+             */
+            virtual ChunkCacheStatistics GetCacheStatistics() = 0;
+
+            /**
+             * @brief Attaches background eraser of mounted device
+             * @param[in] eraser Block eraser
+             *
+             * Statistics of attached eraser are reported by @ref GetEraseStatistics.
+             */
+            virtual void AttachEraser(IYaffsDeviceEraser& eraser) = 0;
+
+            /**
+             * @brief Returns statistics of attached background eraser
+             * @return Eraser statistics (all zeros if no eraser is attached)
+             */
+            virtual EraseStatistics GetEraseStatistics() = 0;
+
+            /**
+             * @brief Attaches writer buffering file contents in RAM
+             * @param[in] writer Buffered writer
+             *
+             * Attached writer is flushed at the beginning of each @ref Sync and @ref Checkpoint.
+             */
+            virtual void AttachWriter(IBufferedWriter& writer) = 0;
+
+            /**
+             * @brief Writes contents buffered by attached writer, so they can be read back from file
+             * @return Operation result (success if no writer is attached)
+             */
+            virtual OSResult FlushWriter() = 0;
         };
 
         /**
@@ -59,9 +211,12 @@ namespace services
             virtual OSResult TruncateFile(FileHandle file, FileSize length) override;
             virtual IOResult Write(FileHandle file, gsl::span<const std::uint8_t> buffer) override;
             virtual IOResult Read(FileHandle file, gsl::span<std::uint8_t> buffer) override;
+            virtual IOResult WriteAt(FileHandle file, FileSize offset, gsl::span<const std::uint8_t> buffer) override;
+            virtual IOResult ReadAt(FileHandle file, FileSize offset, gsl::span<std::uint8_t> buffer) override;
             virtual OSResult Close(FileHandle file) override;
             virtual DirectoryOpenResult OpenDirectory(const char* dirname) override;
             virtual char* ReadDirectory(DirectoryHandle directory) override;
+            virtual bool ReadDirectoryWithStat(DirectoryHandle directory, DirectoryEntry& entry) override;
             virtual OSResult CloseDirectory(DirectoryHandle directory) override;
             virtual bool IsDirectory(const char* path) override;
             virtual OSResult Format(const char* mountPoint) override;
@@ -77,7 +232,46 @@ namespace services
 
             virtual void Sync() override;
 
+            virtual OSResult Checkpoint() override;
+
+            virtual MountStatistics GetMountStatistics() override;
+
+            virtual void AttachCache(IYaffsDeviceCache& cache) override;
+
+            virtual ChunkCacheStatistics GetCacheStatistics() override;
+
+            virtual void AttachEraser(IYaffsDeviceEraser& eraser) override;
+
+            virtual EraseStatistics GetEraseStatistics() override;
+
+            virtual void AttachWriter(IBufferedWriter& writer) override;
+
+            virtual OSResult FlushWriter() override;
+
             virtual OSResult AddDeviceAndMount(yaffs_dev* device) override;
+
+          private:
+            /**
+             * @brief Flushes Yaffs cache of device and writes its checkpoint (caller must hold Yaffs lock)
+             * @param[in] device Yaffs device
+             * @return true if device has valid checkpoint
+             */
+            bool SyncDevice(yaffs_dev* device);
+
+            /**
+             * @brief Writes chunks with deferred write held by attached chunk cache
+             * @return Operation result
+             */
+            OSResult FlushCache();
+
+            /** @brief Attached chunk cache */
+            IYaffsDeviceCache* _cache = nullptr;
+            /** @brief Attached background eraser */
+            IYaffsDeviceEraser* _eraser = nullptr;
+            /** @brief Attached buffered writer */
+            IBufferedWriter* _writer = nullptr;
+            /** @brief Statistics of last mount */
+            MountStatistics _mountStatistics{std::chrono::milliseconds::zero(), false};
         };
     }
 }
@@ -0,0 +1,31 @@
+#ifndef LIBS_FS_INCLUDE_FS_YAFFS_POOLS_HPP_
+#define LIBS_FS_INCLUDE_FS_YAFFS_POOLS_HPP_
+
+#pragma once
+
+#include "base/pool_allocator.hpp"
+
+namespace services
+{
+    namespace fs
+    {
+        /**
+         * @addtogroup fs
+         * @{
+         */
+
+        /**
+         * @brief Block pools serving Yaffs memory requests
+         *
+         * Size classes match structures Yaffs allocates repeatedly: tnode and object batches, chunk-sized buffers
+         * (temporary, checkpoint and block info buffers) and short strings. Yaffs OS glue allocates from these pools
+         * first and uses heap only when matching class is exhausted. Pools are disabled until they are given arena
+         * of @ref memory::PoolAllocator::ArenaSize bytes.
+         */
+        extern memory::PoolAllocator& YaffsPools;
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_FS_INCLUDE_FS_YAFFS_POOLS_HPP_ */
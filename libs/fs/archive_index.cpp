@@ -0,0 +1,186 @@
+#include "archive_index.hpp"
+#include "base/reader.h"
+#include "base/writer.h"
+#include "logger/logger.h"
+
+using namespace services::fs;
+
+constexpr std::uint8_t ArchiveIndex::EntrySize;
+constexpr std::uint8_t ArchiveIndex::BufferedEntries;
+
+/**
+ * @brief Reads single index entry
+ * @param[in] file Index file
+ * @param[in] position Position of index entry in index file
+ * @param[out] key Key of archive entry
+ * @param[out] offset Offset of archive entry
+ * @return true on success
+ */
+static bool ReadEntry(File& file, FileSize position, std::uint64_t& key, FileSize& offset)
+{
+    std::array<std::uint8_t, ArchiveIndex::EntrySize> entry;
+
+    const auto result = file.ReadAt(position, entry);
+    if (!result || result.Result.size() != static_cast<std::ptrdiff_t>(entry.size()))
+    {
+        return false;
+    }
+
+    Reader reader(entry);
+    key = reader.ReadQuadWordLE();
+    offset = reader.ReadDoubleWordLE();
+
+    return reader.Status();
+}
+
+ArchiveIndex::ArchiveIndex(IFileSystem& fs, const char* currentPath, const char* previousPath, std::uint16_t interval)
+    : _fs(fs),                     //
+      _currentPath(currentPath),   //
+      _previousPath(previousPath), //
+      _interval(interval),         //
+      _length(0),                  //
+      _pending(0)
+{
+}
+
+bool ArchiveIndex::Open(FileSize archiveSize)
+{
+    this->_pending = 0;
+
+    this->_file = File(this->_fs, this->_currentPath, FileOpen::OpenAlways, FileAccess::ReadWrite);
+    if (!this->_file)
+    {
+        LOGF(LOG_LEVEL_ERROR, "Unable to open archive index: '%s'.", this->_currentPath);
+        return false;
+    }
+
+    const auto size = this->_file.Size();
+    auto length = size - size % EntrySize;
+
+    // entries are sorted by offset, so the ones describing lost archive entries are at the end
+    while (length > 0)
+    {
+        std::uint64_t key;
+        FileSize offset;
+        if (!ReadEntry(this->_file, length - EntrySize, key, offset) || offset < archiveSize)
+        {
+            break;
+        }
+
+        length -= EntrySize;
+    }
+
+    if (length != size && OS_RESULT_FAILED(this->_file.Truncate(length)))
+    {
+        LOGF(LOG_LEVEL_ERROR, "Unable to truncate archive index: '%s'.", this->_currentPath);
+        this->_file.Close();
+        return false;
+    }
+
+    this->_length = length;
+
+    return true;
+}
+
+void ArchiveIndex::Add(std::uint64_t key, FileSize offset)
+{
+    if (!this->_file)
+    {
+        return;
+    }
+
+    if (this->_pending == BufferedEntries && OS_RESULT_FAILED(Flush()))
+    {
+        return;
+    }
+
+    Writer writer(gsl::make_span(this->_buffer).subspan(this->_pending * EntrySize, EntrySize));
+    writer.WriteQuadWordLE(key);
+    writer.WriteDoubleWordLE(offset);
+
+    this->_pending++;
+}
+
+OSResult ArchiveIndex::Flush()
+{
+    if (this->_pending == 0)
+    {
+        return OSResult::Success;
+    }
+
+    const auto result = this->_file.WriteAt(this->_length, gsl::make_span(this->_buffer).subspan(0, this->_pending * EntrySize));
+    if (!result)
+    {
+        LOGF(LOG_LEVEL_ERROR, "Unable to write archive index: '%s'. Status: %d", this->_currentPath, num(result.Status));
+        return result.Status;
+    }
+
+    this->_length += this->_pending * EntrySize;
+    this->_pending = 0;
+
+    return OSResult::Success;
+}
+
+void ArchiveIndex::Archive()
+{
+    Flush();
+
+    this->_file.Close();
+    this->_pending = 0;
+
+    if (OS_RESULT_FAILED(this->_fs.Move(this->_currentPath, this->_previousPath)))
+    {
+        LOGF(LOG_LEVEL_ERROR, "Unable to archive index: '%s' as '%s'.", this->_currentPath, this->_previousPath);
+    }
+}
+
+OSResult ArchiveIndex::Close()
+{
+    const auto result = Flush();
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    this->_file.Close();
+
+    return OSResult::Success;
+}
+
+FileSize ArchiveIndex::Find(IFileSystem& fs, const char* path, std::uint64_t key)
+{
+    File file(fs, path, FileOpen::Existing, FileAccess::ReadOnly);
+    if (!file)
+    {
+        return 0;
+    }
+
+    // first entry with key not less than searched one is in [low, high)
+    FileSize low = 0;
+    FileSize high = file.Size() / EntrySize;
+    FileSize found = 0;
+
+    while (low < high)
+    {
+        const auto middle = low + (high - low) / 2;
+
+        std::uint64_t entryKey;
+        FileSize offset;
+        if (!ReadEntry(file, middle * EntrySize, entryKey, offset))
+        {
+            return 0;
+        }
+
+        if (entryKey < key)
+        {
+            found = offset;
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return found;
+}
@@ -0,0 +1,240 @@
+#include "archive_writer.hpp"
+#include <algorithm>
+#include "logger/logger.h"
+
+using namespace services::fs;
+using namespace std::chrono_literals;
+
+ArchiveWriter::ArchiveWriter(IFileSystem& fs,
+    const char* currentPath,
+    const char* previousPath,
+    FileSize maxFileSize,
+    FileSize entryAlignment,
+    std::chrono::milliseconds flushDelay,
+    gsl::span<std::uint8_t> buffer)
+    : _fs(fs),                         //
+      _currentPath(currentPath),       //
+      _previousPath(previousPath),     //
+      _maxFileSize(maxFileSize),       //
+      _entryAlignment(entryAlignment), //
+      _flushDelay(flushDelay),         //
+      _window(buffer),                 //
+      _windowOffset(0),                //
+      _filled(0),                      //
+      _flushed(0),                     //
+      _pendingSince(0ms),              //
+      _writes(0),                      //
+      _lock(nullptr),                  //
+      _index(nullptr)
+{
+}
+
+OSResult ArchiveWriter::Initialize()
+{
+    this->_lock = System::CreateBinarySemaphore();
+    if (this->_lock == nullptr)
+    {
+        return OSResult::NotEnoughMemory;
+    }
+
+    System::GiveSemaphore(this->_lock);
+
+    return OSResult::Success;
+}
+
+void ArchiveWriter::AttachIndex(ArchiveIndex& index)
+{
+    this->_index = &index;
+}
+
+bool ArchiveWriter::Append(gsl::span<const std::uint8_t> entry, std::uint64_t key)
+{
+    const auto windowSize = static_cast<FileSize>(this->_window.size());
+
+    // entry with alignment gap crosses at most one window boundary, so failed crossing can be undone
+    if (entry.size() + this->_entryAlignment > windowSize)
+    {
+        LOGF(LOG_LEVEL_ERROR, "Entry of %d bytes does not fit archive buffer", static_cast<int>(entry.size()));
+        return false;
+    }
+
+    Lock lock(this->_lock, InfiniteTimeout);
+
+    if (!this->_file && !Open(FileOpen::OpenAlways))
+    {
+        return false;
+    }
+
+    if (Length() >= this->_maxFileSize && !Rotate())
+    {
+        return false;
+    }
+
+    const auto remainder = Length() % this->_entryAlignment;
+    auto gap = (remainder == 0) ? 0 : this->_entryAlignment - remainder;
+
+    if (this->_filled == this->_flushed)
+    {
+        this->_pendingSince = System::GetUptime();
+    }
+
+    const auto filled = this->_filled;
+    const auto offset = Length() + gap;
+
+    while (gap > 0 || !entry.empty())
+    {
+        if (this->_filled == windowSize)
+        {
+            if (OS_RESULT_FAILED(FlushWindow()))
+            {
+                std::fill(this->_window.begin() + filled, this->_window.end(), 0);
+                this->_filled = filled;
+                return false;
+            }
+
+            std::fill(this->_window.begin(), this->_window.end(), 0);
+            this->_windowOffset += windowSize;
+            this->_filled = 0;
+            this->_flushed = 0;
+        }
+
+        const auto space = windowSize - this->_filled;
+
+        // window past valid bytes is always zeroed, so gap is just skipped
+        if (gap > 0)
+        {
+            const auto skipped = std::min(gap, space);
+            this->_filled += skipped;
+            gap -= skipped;
+            continue;
+        }
+
+        const auto part = entry.subspan(0, std::min(static_cast<FileSize>(entry.size()), space));
+        std::copy(part.begin(), part.end(), this->_window.begin() + this->_filled);
+        this->_filled += static_cast<FileSize>(part.size());
+        entry = entry.subspan(part.size());
+    }
+
+    if (this->_index != nullptr && (offset / this->_entryAlignment) % this->_index->Interval() == 0)
+    {
+        this->_index->Add(key, offset);
+    }
+
+    // failed write is retried by next flush, entry is safe in RAM until then
+    if (this->_filled != this->_flushed && System::GetUptime() - this->_pendingSince >= this->_flushDelay)
+    {
+        FlushWindow();
+    }
+
+    return true;
+}
+
+OSResult ArchiveWriter::Flush()
+{
+    Lock lock(this->_lock, InfiniteTimeout);
+
+    const auto result = FlushWindow();
+
+    // index is never written ahead of flushed archive entries
+    if (OS_RESULT_SUCCEEDED(result) && this->_index != nullptr)
+    {
+        return this->_index->Flush();
+    }
+
+    return result;
+}
+
+OSResult ArchiveWriter::Close()
+{
+    Lock lock(this->_lock, InfiniteTimeout);
+
+    const auto result = FlushWindow();
+    if (OS_RESULT_FAILED(result))
+    {
+        return result;
+    }
+
+    this->_file.Close();
+    this->_windowOffset = 0;
+    this->_filled = 0;
+    this->_flushed = 0;
+
+    if (this->_index != nullptr)
+    {
+        return this->_index->Close();
+    }
+
+    return OSResult::Success;
+}
+
+bool ArchiveWriter::Open(FileOpen mode)
+{
+    this->_file = File(this->_fs, this->_currentPath, mode, FileAccess::WriteOnly);
+    if (!this->_file)
+    {
+        LOGF(LOG_LEVEL_ERROR, "Unable to open archive file: '%s'.", this->_currentPath);
+        return false;
+    }
+
+    const auto size = this->_file.Size();
+    const auto windowSize = static_cast<FileSize>(this->_window.size());
+
+    std::fill(this->_window.begin(), this->_window.end(), 0);
+    this->_windowOffset = size - size % windowSize;
+    this->_filled = size % windowSize;
+    this->_flushed = this->_filled;
+
+    // index failure does not stop archiving, entries are just not indexed
+    if (this->_index != nullptr)
+    {
+        this->_index->Open(size);
+    }
+
+    return true;
+}
+
+bool ArchiveWriter::Rotate()
+{
+    if (OS_RESULT_FAILED(FlushWindow()))
+    {
+        return false;
+    }
+
+    this->_file.Close();
+
+    const auto status = this->_fs.Move(this->_currentPath, this->_previousPath);
+    if (OS_RESULT_FAILED(status))
+    {
+        LOGF(LOG_LEVEL_ERROR, "Unable to archive file: '%s' as '%s'.", this->_currentPath, this->_previousPath);
+        return false;
+    }
+
+    if (this->_index != nullptr)
+    {
+        this->_index->Archive();
+    }
+
+    return Open(FileOpen::CreateAlways);
+}
+
+OSResult ArchiveWriter::FlushWindow()
+{
+    if (this->_filled == this->_flushed)
+    {
+        return OSResult::Success;
+    }
+
+    const auto result = this->_file.WriteAt(
+        this->_windowOffset + this->_flushed, this->_window.subspan(this->_flushed, this->_filled - this->_flushed));
+    this->_writes++;
+
+    if (!result)
+    {
+        LOGF(LOG_LEVEL_ERROR, "Unable to write archive file: '%s'. Status: %d", this->_currentPath, num(result.Status));
+        return result.Status;
+    }
+
+    this->_flushed = this->_filled;
+
+    return OSResult::Success;
+}
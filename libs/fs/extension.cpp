@@ -90,6 +90,26 @@ IOResult File::Write(gsl::span<const uint8_t> buffer)
     return this->_fs->Write(this->_handle, buffer);
 }
 
+IOResult File::ReadAt(FileSize offset, gsl::span<uint8_t> buffer)
+{
+    if (!*this)
+    {
+        return IOResult(OSResult::InvalidOperation, gsl::span<const uint8_t>());
+    }
+
+    return this->_fs->ReadAt(this->_handle, offset, buffer);
+}
+
+IOResult File::WriteAt(FileSize offset, gsl::span<const uint8_t> buffer)
+{
+    if (!*this)
+    {
+        return IOResult(OSResult::InvalidOperation, gsl::span<const uint8_t>());
+    }
+
+    return this->_fs->WriteAt(this->_handle, offset, buffer);
+}
+
 OSResult File::Truncate(FileSize size)
 {
     if (!*this)
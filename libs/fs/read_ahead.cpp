@@ -0,0 +1,104 @@
+#include "read_ahead.hpp"
+#include <algorithm>
+
+using namespace services::fs;
+
+ReadAheadFile::ReadAheadFile(File& file, gsl::span<std::uint8_t> window)
+    : _file(file),      //
+      _window(window),  //
+      _windowOffset(0), //
+      _windowLength(0), //
+      _nextOffset(0),   //
+      _endOfFile(-1),   //
+      _refills(0),      //
+      _directReads(0)
+{
+}
+
+IOResult ReadAheadFile::Read(FileSize offset, gsl::span<std::uint8_t> buffer)
+{
+    const auto length = static_cast<FileSize>(buffer.size());
+    const auto sequential = IsSequential(offset);
+
+    FileSize served = 0;
+    while (served < length)
+    {
+        const auto position = offset + served;
+        if (this->_endOfFile >= 0 && position >= this->_endOfFile)
+        {
+            break;
+        }
+
+        if (!InWindow(position))
+        {
+            if (!sequential)
+            {
+                break;
+            }
+
+            const auto status = Refill(position);
+            if (OS_RESULT_FAILED(status))
+            {
+                return IOResult(status, gsl::span<const std::uint8_t>());
+            }
+
+            continue;
+        }
+
+        const auto start = position - this->_windowOffset;
+        const auto count = std::min(length - served, this->_windowLength - start);
+        std::copy_n(this->_window.begin() + start, count, buffer.begin() + served);
+        served += count;
+    }
+
+    const auto endOfFile = this->_endOfFile >= 0 && offset + served >= this->_endOfFile;
+    if (served < length && !endOfFile)
+    {
+        this->_directReads++;
+
+        const auto result = this->_file.ReadAt(offset + served, buffer.subspan(served));
+        if (OS_RESULT_FAILED(result.Status))
+        {
+            return result;
+        }
+
+        served += static_cast<FileSize>(result.Result.size());
+    }
+
+    this->_nextOffset = offset + served;
+    return IOResult(OSResult::Success, buffer.subspan(0, served));
+}
+
+bool ReadAheadFile::IsSequential(FileSize offset) const
+{
+    return !this->_window.empty() && offset == this->_nextOffset;
+}
+
+bool ReadAheadFile::InWindow(FileSize offset) const
+{
+    return offset >= this->_windowOffset && offset < this->_windowOffset + this->_windowLength;
+}
+
+OSResult ReadAheadFile::Refill(FileSize offset)
+{
+    const auto windowSize = static_cast<FileSize>(this->_window.size());
+    const auto windowOffset = offset - offset % windowSize;
+
+    this->_windowLength = 0;
+    this->_refills++;
+
+    const auto result = this->_file.ReadAt(windowOffset, this->_window);
+    if (OS_RESULT_FAILED(result.Status))
+    {
+        return result.Status;
+    }
+
+    this->_windowOffset = windowOffset;
+    this->_windowLength = static_cast<FileSize>(result.Result.size());
+    if (this->_windowLength < windowSize)
+    {
+        this->_endOfFile = windowOffset + this->_windowLength;
+    }
+
+    return OSResult::Success;
+}
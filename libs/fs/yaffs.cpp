@@ -32,6 +32,35 @@ char* YaffsFileSystem::ReadDirectory(DirectoryHandle directory)
     }
 }
 
+bool YaffsFileSystem::ReadDirectoryWithStat(DirectoryHandle directory, DirectoryEntry& entry)
+{
+    struct yaffs_stat stat;
+    struct yaffs_dirent* dirent = yaffs_readdir_with_stat((yaffs_DIR*)directory, &stat);
+    if (dirent == NULL)
+    {
+        return false;
+    }
+
+    entry.Name = dirent->d_name;
+    entry.Size = stat.st_size;
+    entry.ModificationTime = stat.yst_mtime;
+
+    switch (stat.st_mode & S_IFMT)
+    {
+        case S_IFREG:
+            entry.Type = DirectoryEntryType::File;
+            break;
+        case S_IFDIR:
+            entry.Type = DirectoryEntryType::Directory;
+            break;
+        default:
+            entry.Type = DirectoryEntryType::Other;
+            break;
+    }
+
+    return true;
+}
+
 FileOpenResult YaffsFileSystem::Open(const char* path, FileOpen openFlag, FileAccess accessMode)
 {
     const int status = yaffs_open(path, num(openFlag) | num(accessMode), S_IRWXU);
@@ -66,31 +95,13 @@ OSResult YaffsFileSystem::Copy(const char* from, const char* to)
         return YaffsTranslateError(destFile);
     }
 
-    const int bufferSize = 1024;
-    std::uint8_t buffer[bufferSize];
-
-    while (true)
+    // copying whole chunks avoids read-modify-write of destination chunks partially filled by smaller pieces
+    const int copyStatus = yaffs_copy_data(srcFile, destFile);
+    if (copyStatus == -1)
     {
-        const int bytesRead = yaffs_read(srcFile, buffer, bufferSize);
-        if (bytesRead == -1)
-        {
-            yaffs_close(destFile);
-            yaffs_close(srcFile);
-            return YaffsTranslateError(destFile);
-        }
-
-        const int bytesWritten = yaffs_write(destFile, buffer, bytesRead);
-        if (bytesWritten == -1)
-        {
-            yaffs_close(destFile);
-            yaffs_close(srcFile);
-            return YaffsTranslateError(destFile);
-        }
-
-        if (bytesRead < bufferSize)
-        {
-            break;
-        }
+        yaffs_close(destFile);
+        yaffs_close(srcFile);
+        return YaffsTranslateError(copyStatus);
     }
 
     const int destCloseStatus = yaffs_close(destFile);
@@ -133,6 +144,30 @@ IOResult YaffsFileSystem::Read(FileHandle file, gsl::span<std::uint8_t> buffer)
     return IOResult(YaffsTranslateError(status), gsl::span<const uint8_t>());
 }
 
+IOResult YaffsFileSystem::WriteAt(FileHandle file, FileSize offset, gsl::span<const std::uint8_t> buffer)
+{
+    const int status = yaffs_pwrite(file, buffer.data(), buffer.size(), offset);
+
+    if (status >= 0)
+    {
+        return IOResult(OSResult::Success, buffer.subspan(0, status));
+    }
+
+    return IOResult(YaffsTranslateError(status), gsl::span<const uint8_t>());
+}
+
+IOResult YaffsFileSystem::ReadAt(FileHandle file, FileSize offset, gsl::span<std::uint8_t> buffer)
+{
+    const int status = yaffs_pread(file, buffer.data(), buffer.size(), offset);
+
+    if (status >= 0)
+    {
+        return IOResult(OSResult::Success, buffer.subspan(0, status));
+    }
+
+    return IOResult(YaffsTranslateError(status), gsl::span<const uint8_t>());
+}
+
 OSResult YaffsFileSystem::Close(FileHandle file)
 {
     return YaffsTranslateError(yaffs_close(file));
@@ -276,20 +311,177 @@ OSResult YaffsFileSystem::ClearDevice(yaffs_dev* device)
     return RemoveDirectoryContents(root);
 }
 
+bool YaffsFileSystem::SyncDevice(yaffs_dev* device)
+{
+    if (!device->is_mounted || device->read_only)
+    {
+        return false;
+    }
+
+    yaffs_flush_whole_cache(device, 0);
+
+    // queued blocks are free for Yaffs but still hold old data, checkpoint would describe them as erased after reset
+    if (this->_eraser != nullptr && this->_eraser->Statistics().Pending > 0)
+    {
+        return false;
+    }
+
+    yaffs_checkpoint_save(device);
+
+    return device->is_checkpointed != 0;
+}
+
+OSResult YaffsFileSystem::FlushCache()
+{
+    if (this->_cache == nullptr)
+    {
+        return OSResult::Success;
+    }
+
+    yaffsfs_Lock();
+    auto result = this->_cache->Flush();
+    yaffsfs_Unlock();
+
+    if (OS_RESULT_FAILED(result))
+    {
+        LOGF(LOG_LEVEL_ERROR, "Chunk cache flush failed: %d", num(result));
+    }
+
+    return result;
+}
+
+OSResult YaffsFileSystem::FlushWriter()
+{
+    if (this->_writer == nullptr)
+    {
+        return OSResult::Success;
+    }
+
+    // writer goes through file system API, so Yaffs lock must not be held here
+    auto result = this->_writer->Flush();
+
+    if (OS_RESULT_FAILED(result))
+    {
+        LOGF(LOG_LEVEL_ERROR, "Buffered writer flush failed: %d", num(result));
+    }
+
+    return result;
+}
+
 void YaffsFileSystem::Sync()
 {
+    FlushWriter();
+
     yaffs_dev_rewind();
 
     yaffs_dev* dev = nullptr;
     while ((dev = yaffs_next_dev()) != nullptr)
     {
         LOGF(LOG_LEVEL_DEBUG, "Syncing %s", dev->param.name);
-        yaffs_sync_reldev(dev);
+
+        yaffsfs_Lock();
+        auto checkpointed = SyncDevice(dev);
+        yaffsfs_Unlock();
+
+        if (!checkpointed)
+        {
+            LOGF(LOG_LEVEL_DEBUG, "Checkpoint of %s not written", dev->param.name);
+        }
     }
 
+    FlushCache();
+
     LOG(LOG_LEVEL_DEBUG, "All devices synced");
 }
 
+OSResult YaffsFileSystem::Checkpoint()
+{
+    auto result = FlushWriter();
+
+    if (this->_eraser != nullptr)
+    {
+        auto drainResult = this->_eraser->Drain();
+        if (OS_RESULT_FAILED(drainResult))
+        {
+            LOGF(LOG_LEVEL_ERROR, "Unable to erase queued blocks before checkpoint: %d", num(drainResult));
+            return drainResult;
+        }
+    }
+
+    yaffs_dev_rewind();
+
+    yaffs_dev* dev = nullptr;
+    while ((dev = yaffs_next_dev()) != nullptr)
+    {
+        yaffsfs_Lock();
+        auto checkpointed = SyncDevice(dev);
+        yaffsfs_Unlock();
+
+        if (checkpointed)
+        {
+            LOGF(LOG_LEVEL_INFO, "Checkpoint of %s written", dev->param.name);
+        }
+        else if (dev->is_mounted)
+        {
+            LOGF(LOG_LEVEL_WARNING, "Checkpoint of %s not written, next mount will scan memory", dev->param.name);
+            result = OSResult::IOError;
+        }
+    }
+
+    auto flushResult = FlushCache();
+    if (OS_RESULT_FAILED(flushResult))
+    {
+        result = flushResult;
+    }
+
+    return result;
+}
+
+MountStatistics YaffsFileSystem::GetMountStatistics()
+{
+    return this->_mountStatistics;
+}
+
+void YaffsFileSystem::AttachCache(IYaffsDeviceCache& cache)
+{
+    this->_cache = &cache;
+}
+
+ChunkCacheStatistics YaffsFileSystem::GetCacheStatistics()
+{
+    if (this->_cache == nullptr)
+    {
+        return ChunkCacheStatistics{0, 0, 0};
+    }
+
+    yaffsfs_Lock();
+    auto statistics = this->_cache->Statistics();
+    yaffsfs_Unlock();
+
+    return statistics;
+}
+
+void YaffsFileSystem::AttachEraser(IYaffsDeviceEraser& eraser)
+{
+    this->_eraser = &eraser;
+}
+
+void YaffsFileSystem::AttachWriter(IBufferedWriter& writer)
+{
+    this->_writer = &writer;
+}
+
+EraseStatistics YaffsFileSystem::GetEraseStatistics()
+{
+    if (this->_eraser == nullptr)
+    {
+        return EraseStatistics{0, 0, 0, 0, std::chrono::milliseconds::zero(), std::chrono::milliseconds::zero()};
+    }
+
+    // eraser synchronizes statistics on its own, taking Yaffs lock would wait for pending device operation
+    return this->_eraser->Statistics();
+}
+
 void YaffsFileSystem::Initialize()
 {
     YaffsGlueInit();
@@ -354,12 +546,22 @@ std::uint32_t YaffsFileSystem::GetFreeSpace(const char* devicePath)
 
 OSResult YaffsFileSystem::AddDeviceAndMount(yaffs_dev* device)
 {
+    const auto start = System::GetUptime();
+
     yaffs_add_device(device);
     int result = yaffs_mount(device->param.name);
 
+    // checkpoint is validated by Yaffs during mount, whole memory is scanned if it is missing or corrupted
+    this->_mountStatistics.Duration = System::GetUptime() - start;
+    this->_mountStatistics.FromCheckpoint = result == 0 && device->is_checkpointed != 0;
+
     if (result == 0)
     {
-        LOGF(LOG_LEVEL_DEBUG, "Mounted %s", device->param.name);
+        LOGF(LOG_LEVEL_DEBUG,
+            "Mounted %s in %ld ms (%s)",
+            device->param.name,
+            static_cast<long>(this->_mountStatistics.Duration.count()),
+            this->_mountStatistics.FromCheckpoint ? "checkpoint" : "scan");
         return OSResult::Success;
     }
     else
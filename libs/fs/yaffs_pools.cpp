@@ -0,0 +1,38 @@
+#include "yaffs_pools.hpp"
+#include <array>
+#include "utils.h"
+#include "yaffs_guts.h"
+
+using memory::PoolClass;
+using memory::StaticPoolAllocator;
+
+/** @brief Size of tnodes batch (tnode is never larger than structure on devices with less than 64k chunks) */
+static constexpr std::size_t TnodeBatchSize = YAFFS_ALLOCATION_NTNODES * sizeof(struct yaffs_tnode);
+
+/** @brief Size of objects batch */
+static constexpr std::size_t ObjectBatchSize = YAFFS_ALLOCATION_NOBJECTS * sizeof(struct yaffs_obj);
+
+/** @brief Size of Yaffs chunk on N25Q flash */
+static constexpr std::size_t ChunkSize = 2_KB;
+
+/**
+ * @brief Yaffs size classes
+ *
+ * Capacities cover working set of 16MB N25Q volume with 64KB blocks (sizes in comments are for 32-bit target).
+ */
+static const std::array<PoolClass, 5> Classes{{
+    // tnode and object list headers, allocator state, short names and paths
+    {32, 32},
+    // names, paths, checkpoint block list, garbage collector cleanup list
+    {128, 16},
+    // tnode batches (320 B), each tnode maps 16 chunks
+    {TnodeBatchSize, 24},
+    // object batches (1360 B), chunk bitmap, block summary tags
+    {ObjectBatchSize, 10},
+    // temporary buffers, checkpoint buffer, block info, block index used by scan
+    {ChunkSize, 10},
+}};
+
+static StaticPoolAllocator<5> Pools(Classes);
+
+memory::PoolAllocator& services::fs::YaffsPools = Pools;
@@ -3,6 +3,7 @@
 
 #include <tuple>
 #include "experiments/experiments.h"
+#include "fs/fwd.hpp"
 #include "mission/base.hpp"
 #include "power/fwd.hpp"
 #include "state/struct.h"
@@ -46,16 +47,21 @@ namespace mission
          *  * >= 23h since boot
          *  * No scrubbing in progress
          *  * No experiment in progress
+         *
+         * File system checkpoint is written before power cycle, so file system is mounted quickly after restart.
          */
         class PeriodicPowerCycleTask : public Action, public RequireNotifyWhenTimeChanges
         {
           public:
             /**
              * @brief Ctor
-             * @param args Tuple with dependencies: power control, scrubbing status, experiment controller
+             * @param args Tuple with dependencies: power control, scrubbing status, experiment controller,
+             * file system device operations
              */
-            PeriodicPowerCycleTask(
-                std::tuple<services::power::IPowerControl&, IScrubbingStatus&, ::experiments::IExperimentController&> args);
+            PeriodicPowerCycleTask(std::tuple<services::power::IPowerControl&,
+                IScrubbingStatus&,
+                ::experiments::IExperimentController&,
+                services::fs::IYaffsDeviceOperations&> args);
 
             /**
              * @brief Returns action description
@@ -91,6 +97,8 @@ namespace mission
             IScrubbingStatus& _scrubbingStatus;
             /** @brief Experiments controller */
             ::experiments::IExperimentController& _experiments;
+            /** @brief File system device operations */
+            services::fs::IYaffsDeviceOperations& _deviceOperations;
 
             /** @brief Boot time (timestamp at first action condition evaluation) */
             Option<std::chrono::milliseconds> _bootTime;
@@ -1,4 +1,5 @@
 #include "power_cycle.hpp"
+#include "fs/yaffs.h"
 #include "power/power.h"
 
 using namespace std::chrono_literals;
@@ -7,9 +8,14 @@ namespace mission
 {
     namespace power
     {
-        PeriodicPowerCycleTask::PeriodicPowerCycleTask(
-            std::tuple<services::power::IPowerControl&, IScrubbingStatus&, experiments::IExperimentController&> args)
-            : _power(std::get<0>(args)), _scrubbingStatus(std::get<1>(args)), _experiments(std::get<2>(args))
+        PeriodicPowerCycleTask::PeriodicPowerCycleTask(std::tuple<services::power::IPowerControl&,
+            IScrubbingStatus&,
+            experiments::IExperimentController&,
+            services::fs::IYaffsDeviceOperations&> args)
+            : _power(std::get<0>(args)),            //
+              _scrubbingStatus(std::get<1>(args)),  //
+              _experiments(std::get<2>(args)),      //
+              _deviceOperations(std::get<3>(args))
         {
         }
 
@@ -78,6 +84,12 @@ namespace mission
             auto This = static_cast<PeriodicPowerCycleTask*>(param);
 
             LOG(LOG_LEVEL_WARNING, "[power_cycle] Triggering periodic power cycle");
+
+            if (OS_RESULT_FAILED(This->_deviceOperations.Checkpoint()))
+            {
+                LOG(LOG_LEVEL_WARNING, "[power_cycle] File system checkpoint failed");
+            }
+
             This->_power.PowerCycle();
         }
 
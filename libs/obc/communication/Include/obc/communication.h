@@ -9,6 +9,7 @@
 #include "i2c/i2c.h"
 #include "mission/comm.hpp"
 #include "mission/time.hpp"
+#include "obc/bitrate/adaptive_bitrate.hpp"
 #include "obc/experiments.hpp"
 #include "obc/fdir.hpp"
 #include "obc/telecommands/adcs.hpp"
@@ -30,9 +31,14 @@
 #include "obc/telecommands/program_upload.hpp"
 #include "obc/telecommands/sail.hpp"
 #include "obc/telecommands/state.hpp"
+#include "obc/telecommands/statistics.hpp"
 #include "obc/telecommands/suns.hpp"
+#include "obc/telecommands/telemetry.hpp"
 #include "obc/telecommands/time.hpp"
 #include "program_flash/fwd.hpp"
+#include "telecommunication/DownlinkScheduler.hpp"
+#include "telecommunication/TelecommandCancellation.hpp"
+#include "telecommunication/TelecommandExecutor.hpp"
 #include "telecommunication/telecommand_handling.h"
 #include "telecommunication/uplink.h"
 #include "time/ICurrentTime.hpp"
@@ -65,6 +71,10 @@ namespace obc
          */
         gsl::span<telecommunication::uplink::IHandleTeleCommand*> Get();
 
+        /** @brief Index mapping telecommand codes to positions in list returned by @ref Get */
+        static constexpr telecommunication::uplink::TelecommandIndex Index =
+            telecommunication::uplink::BuildTelecommandIndex<Telecommands::Code...>();
+
       private:
         /**
          * @brief Initialize pointers - single step
@@ -127,6 +137,8 @@ namespace obc
         return this->_pointers;
     }
 
+    template <typename... Telecommands> constexpr telecommunication::uplink::TelecommandIndex TelecommandsHolder<Telecommands...>::Index;
+
     /** @brief Typedef with all supported telecommands */
     using Telecommands = TelecommandsHolder< //
         obc::telecommands::PingTelecommand,
@@ -170,7 +182,16 @@ namespace obc
         obc::telecommands::SetBuiltinDetumblingBlockMaskTelecommand,
         obc::telecommands::SetAdcsModeTelecommand,
         obc::telecommands::StopSailDeployment,
-        obc::telecommands::ReadMemoryTelecommand>;
+        obc::telecommands::ReadMemoryTelecommand,
+        obc::telecommands::GetTelecommandStatisticsTelecommand,
+        obc::telecommands::SelectiveDownloadFileTelecommand,
+        obc::telecommands::FecDownloadFileTelecommand,
+        obc::telecommands::DownloadTelemetryRangeTelecommand,
+        obc::telecommands::GetLinkStatisticsTelecommand,
+        obc::telecommands::ExpectPassTelecommand,
+        obc::telecommands::AbortTransferTelecommand,
+        obc::telecommands::SetMinimumTurnaroundTelecommand,
+        obc::telecommands::GetTurnaroundStatisticsTelecommand>;
 
     /**
      * @brief OBC <-> Earth communication
@@ -186,6 +207,7 @@ namespace obc
          * @param[in] idleStateController Idle state controller
          * @param[in] stateContainer Container for OBC state
          * @param[in] fs File system
+         * @param[in] deviceOperations File system device operations
          * @param[in] experiments Experiments
          * @param[in] bootTable Boot table
          * @param[in] bootSettings Boot settings
@@ -209,6 +231,7 @@ namespace obc
             mission::IIdleStateController& idleStateController,
             IHasState<SystemState>& stateContainer,
             services::fs::IFileSystem& fs,
+            services::fs::IYaffsDeviceOperations& deviceOperations,
             obc::OBCExperiments& experiments,
             program_flash::BootTable& bootTable,
             boot::BootSettings& bootSettings,
@@ -241,11 +264,26 @@ namespace obc
         /** @brief Uplink protocol decoder */
         telecommunication::uplink::UplinkProtocol UplinkProtocolDecoder;
 
+        /** @brief Per telecommand execution statistics */
+        telecommunication::uplink::TelecommandStatistics TelecommandStats;
+
+        /** @brief Cancellation of long running telecommands */
+        telecommunication::uplink::TelecommandCancellation Cancellation;
+
         /** @brief Object aggregating supported telecommands */
         Telecommands SupportedTelecommands;
 
         /** @brief Incoming telecommand handler */
         telecommunication::uplink::IncomingTelecommandHandler TelecommandHandler;
+
+        /** @brief Flow controlled downlink scheduler used for sending telecommand responses */
+        telecommunication::downlink::DownlinkScheduler Downlink;
+
+        /** @brief Link quality driven downlink bit rate controller */
+        AdaptiveBitrateController BitrateController;
+
+        /** @brief Asynchronous executor of the received telecommands */
+        telecommunication::uplink::TelecommandExecutor Executor;
     };
 
     /** @} */
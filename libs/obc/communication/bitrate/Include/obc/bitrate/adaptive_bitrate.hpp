@@ -0,0 +1,251 @@
+#ifndef LIBS_OBC_COMMUNICATION_BITRATE_INCLUDE_OBC_BITRATE_ADAPTIVE_BITRATE_HPP_
+#define LIBS_OBC_COMMUNICATION_BITRATE_INCLUDE_OBC_BITRATE_ADAPTIVE_BITRATE_HPP_
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include "comm/IHandleFrame.hpp"
+#include "comm/comm.hpp"
+#include "telecommunication/DownlinkScheduler.hpp"
+
+namespace obc
+{
+    /**
+     * @ingroup obc_communication
+     * @{
+     */
+
+    /**
+     * @brief Link quality driven downlink bit rate adaptation policy.
+     *
+     * Policy is fed with RSSI and Doppler offset measured by receiver for every uplink frame. RSSI is smoothed with
+     * exponential moving average and its trend (per second) is tracked. Link margin is estimated as smoothed RSSI
+     * decreased by the expected drop within @ref TrendLookahead when the signal is fading.
+     *
+     * Bit rate is changed by single step at a time:
+     * - downgrade happens immediately when estimated signal falls below the threshold of current bit rate
+     *   by more than @ref Hysteresis,
+     * - upgrade requires @ref RequiredObservations consecutive observations above threshold of higher bit rate,
+     *   at least @ref MinimumDwell since last change and satellite not receding (negative Doppler offset
+     *   exceeding @ref RecedingDopplerOffset means that the high elevation part of the pass is over).
+     *
+     * When no uplink frame arrives for @ref SilenceTimeout the pass is considered finished and bit rate falls back
+     * to 1200bps. Explicitly forced bit rate is kept until the end of the pass.
+     *
+     * This class is not thread safe.
+     */
+    class BitrateAdaptation final
+    {
+      public:
+        /** @brief Number of observations above threshold required to switch to higher bit rate */
+        static constexpr std::uint8_t RequiredObservations = 3;
+
+        /** @brief Minimal time between bit rate changes that is required to switch to higher bit rate */
+        static constexpr std::chrono::milliseconds MinimumDwell{10000};
+
+        /** @brief Time without uplink frames after which bit rate falls back to 1200bps */
+        static constexpr std::chrono::milliseconds SilenceTimeout{60000};
+
+        /** @brief Time for which RSSI trend is extrapolated */
+        static constexpr std::chrono::seconds TrendLookahead{10};
+
+        /** @brief Minimal time between samples used to calculate RSSI trend */
+        static constexpr std::chrono::milliseconds TrendInterval{1000};
+
+        /** @brief Hysteresis applied before switching to lower bit rate (in 0.01dBm) */
+        static constexpr std::int32_t Hysteresis = 200;
+
+        /** @brief Doppler offset (in Hz) below which satellite is considered receding */
+        static constexpr std::int32_t RecedingDopplerOffset = -1000;
+
+        /**
+         * @brief ctor.
+         */
+        BitrateAdaptation();
+
+        /**
+         * @brief Processes link quality measured for single uplink frame.
+         * @param[in] now Current time
+         * @param[in] rssi Raw RSSI reported by receiver
+         * @param[in] doppler Raw Doppler offset reported by receiver
+         */
+        void Observe(std::chrono::milliseconds now, std::uint16_t rssi, std::uint16_t doppler);
+
+        /**
+         * @brief Returns bit rate that should be used for downlink.
+         * @param[in] now Current time
+         * @return Selected bit rate
+         */
+        devices::comm::Bitrate Select(std::chrono::milliseconds now);
+
+        /**
+         * @brief Sets bit rate explicitly suspending adaptation until the end of the pass.
+         * @param[in] now Current time
+         * @param[in] bitrate Requested bit rate
+         */
+        void Force(std::chrono::milliseconds now, devices::comm::Bitrate bitrate);
+
+        /**
+         * @brief Returns currently selected bit rate.
+         * @return Bit rate
+         */
+        devices::comm::Bitrate Current() const;
+
+        /**
+         * @brief Returns smoothed RSSI.
+         * @return Smoothed RSSI in 0.01dBm
+         */
+        std::int32_t SignalLevel() const;
+
+        /**
+         * @brief Returns RSSI trend.
+         * @return RSSI change in 0.01dB per second
+         */
+        std::int32_t SignalTrend() const;
+
+        /**
+         * @brief Converts raw RSSI reported by receiver.
+         * @param[in] rssi Raw RSSI
+         * @return RSSI in 0.01dBm
+         */
+        static constexpr std::int32_t RssiToCentiDbm(std::uint16_t rssi);
+
+        /**
+         * @brief Converts raw Doppler offset reported by receiver.
+         * @param[in] doppler Raw Doppler offset
+         * @return Doppler offset in Hz
+         */
+        static constexpr std::int32_t DopplerToHz(std::uint16_t doppler);
+
+        /**
+         * @brief Returns minimal smoothed RSSI that allows switching to given bit rate.
+         * @param[in] bitrate Bit rate
+         * @return Threshold in 0.01dBm
+         */
+        static std::int32_t UpgradeThreshold(devices::comm::Bitrate bitrate);
+
+      private:
+        /** @brief Resets adaptation state at the end of the pass */
+        void Reset(std::chrono::milliseconds now);
+
+        /**
+         * @brief Updates RSSI filter and trend.
+         * @param[in] now Current time
+         * @param[in] rssi RSSI in 0.01dBm
+         */
+        void UpdateSignal(std::chrono::milliseconds now, std::int32_t rssi);
+
+        /**
+         * @brief Evaluates bit rate change after new observation.
+         * @param[in] now Current time
+         * @param[in] doppler Doppler offset in Hz
+         */
+        void Evaluate(std::chrono::milliseconds now, std::int32_t doppler);
+
+        /** @brief Index of currently selected bit rate (see @ref telecommunication::downlink::BitrateIndex) */
+        std::uint8_t _current;
+
+        /** @brief Flag indicating that pass is in progress */
+        bool _active;
+
+        /** @brief Flag indicating that smoothed RSSI holds valid value */
+        bool _hasSignal;
+
+        /** @brief Flag indicating that bit rate has been forced */
+        bool _forced;
+
+        /** @brief Number of consecutive observations qualifying for upgrade */
+        std::uint8_t _qualifying;
+
+        /** @brief Time of the last uplink activity */
+        std::chrono::milliseconds _lastActivity;
+
+        /** @brief Time of the last bit rate change */
+        std::chrono::milliseconds _lastChange;
+
+        /** @brief Smoothed RSSI in 0.01dBm */
+        std::int32_t _level;
+
+        /** @brief RSSI trend in 0.01dB per second */
+        std::int32_t _trend;
+
+        /** @brief Smoothed RSSI at the time of the last trend update */
+        std::int32_t _trendLevel;
+
+        /** @brief Time of the last trend update */
+        std::chrono::milliseconds _trendTime;
+    };
+
+    constexpr std::int32_t BitrateAdaptation::RssiToCentiDbm(std::uint16_t rssi)
+    {
+        return 3 * static_cast<std::int32_t>(rssi) - 15200;
+    }
+
+    constexpr std::int32_t BitrateAdaptation::DopplerToHz(std::uint16_t doppler)
+    {
+        return (static_cast<std::int32_t>(doppler) * 13352) / 1000 - 22300;
+    }
+
+    inline std::int32_t BitrateAdaptation::SignalLevel() const
+    {
+        return this->_level;
+    }
+
+    inline std::int32_t BitrateAdaptation::SignalTrend() const
+    {
+        return this->_trend;
+    }
+
+    /**
+     * @brief Downlink bit rate controller.
+     *
+     * Controller is placed between comm driver and downlink scheduler: it observes link quality of every received
+     * frame before passing it further and serves as a bit rate selector for @ref telecommunication::downlink::DownlinkScheduler.
+     *
+     * All methods are safe to be called from different tasks.
+     */
+    class AdaptiveBitrateController final : public devices::comm::IHandleFrame, public telecommunication::downlink::IDownlinkBitrateSelector
+    {
+      public:
+        /**
+         * @brief ctor.
+         */
+        AdaptiveBitrateController();
+
+        /**
+         * @brief Sets the handler that should process frames received via this object.
+         * @param[in] handler Reference to the frame handler.
+         */
+        void SetFrameHandler(devices::comm::IHandleFrame& handler);
+
+        virtual void HandleFrame(devices::comm::ITransmitter& transmitter, devices::comm::Frame& frame) override;
+
+        virtual devices::comm::Bitrate SelectBitrate(devices::comm::Bitrate current) override;
+
+        virtual void BitrateForced(devices::comm::Bitrate bitrate) override;
+
+        /**
+         * @brief Returns currently selected bit rate.
+         * @return Bit rate
+         */
+        devices::comm::Bitrate Current() const;
+
+      private:
+        /** @brief Adaptation policy */
+        BitrateAdaptation _adaptation;
+
+        /** @brief Handler of the received frames */
+        devices::comm::IHandleFrame* _frameHandler;
+    };
+
+    inline void AdaptiveBitrateController::SetFrameHandler(devices::comm::IHandleFrame& handler)
+    {
+        this->_frameHandler = &handler;
+    }
+
+    /** @} */
+}
+
+#endif /* LIBS_OBC_COMMUNICATION_BITRATE_INCLUDE_OBC_BITRATE_ADAPTIVE_BITRATE_HPP_ */
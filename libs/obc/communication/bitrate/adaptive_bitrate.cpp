@@ -0,0 +1,200 @@
+#include "adaptive_bitrate.hpp"
+#include <algorithm>
+#include <limits>
+#include "base/os.h"
+#include "comm/Frame.hpp"
+
+using devices::comm::Bitrate;
+using telecommunication::downlink::BitrateCount;
+using telecommunication::downlink::BitrateIndex;
+
+namespace obc
+{
+    /** @brief Bit rates ordered from the lowest one */
+    static constexpr std::array<Bitrate, BitrateCount> Bitrates{
+        Bitrate::Comm1200bps, Bitrate::Comm2400bps, Bitrate::Comm4800bps, Bitrate::Comm9600bps};
+
+    /** @brief Minimal smoothed RSSI (in 0.01dBm) required to use given bit rate, each step doubles required signal power */
+    static constexpr std::array<std::int32_t, BitrateCount> Thresholds{std::numeric_limits<std::int32_t>::min(), -11200, -10900, -10600};
+
+    constexpr std::uint8_t BitrateAdaptation::RequiredObservations;
+    constexpr std::chrono::milliseconds BitrateAdaptation::MinimumDwell;
+    constexpr std::chrono::milliseconds BitrateAdaptation::SilenceTimeout;
+    constexpr std::chrono::seconds BitrateAdaptation::TrendLookahead;
+    constexpr std::chrono::milliseconds BitrateAdaptation::TrendInterval;
+    constexpr std::int32_t BitrateAdaptation::Hysteresis;
+    constexpr std::int32_t BitrateAdaptation::RecedingDopplerOffset;
+
+    BitrateAdaptation::BitrateAdaptation()
+        : _current(0),                //
+          _active(false),             //
+          _hasSignal(false),          //
+          _forced(false),             //
+          _qualifying(0),             //
+          _lastActivity(0),           //
+          _lastChange(-MinimumDwell), //
+          _level(0),                  //
+          _trend(0),                  //
+          _trendLevel(0),             //
+          _trendTime(0)
+    {
+    }
+
+    void BitrateAdaptation::Observe(std::chrono::milliseconds now, std::uint16_t rssi, std::uint16_t doppler)
+    {
+        if (this->_active && now - this->_lastActivity >= SilenceTimeout)
+        {
+            Reset(now);
+        }
+
+        UpdateSignal(now, RssiToCentiDbm(rssi));
+
+        this->_active = true;
+        this->_lastActivity = now;
+
+        if (!this->_forced)
+        {
+            Evaluate(now, DopplerToHz(doppler));
+        }
+    }
+
+    Bitrate BitrateAdaptation::Select(std::chrono::milliseconds now)
+    {
+        if (this->_active && now - this->_lastActivity >= SilenceTimeout)
+        {
+            Reset(now);
+        }
+
+        return Bitrates[this->_current];
+    }
+
+    void BitrateAdaptation::Force(std::chrono::milliseconds now, Bitrate bitrate)
+    {
+        this->_current = BitrateIndex(bitrate);
+        this->_forced = true;
+        this->_active = true;
+        this->_qualifying = 0;
+        this->_lastActivity = now;
+        this->_lastChange = now;
+    }
+
+    Bitrate BitrateAdaptation::Current() const
+    {
+        return Bitrates[this->_current];
+    }
+
+    std::int32_t BitrateAdaptation::UpgradeThreshold(Bitrate bitrate)
+    {
+        return Thresholds[BitrateIndex(bitrate)];
+    }
+
+    void BitrateAdaptation::Reset(std::chrono::milliseconds now)
+    {
+        this->_current = 0;
+        this->_active = false;
+        this->_hasSignal = false;
+        this->_forced = false;
+        this->_qualifying = 0;
+        this->_lastChange = now;
+        this->_level = 0;
+        this->_trend = 0;
+    }
+
+    void BitrateAdaptation::UpdateSignal(std::chrono::milliseconds now, std::int32_t rssi)
+    {
+        if (!this->_hasSignal)
+        {
+            this->_hasSignal = true;
+            this->_level = rssi;
+            this->_trend = 0;
+            this->_trendLevel = rssi;
+            this->_trendTime = now;
+            return;
+        }
+
+        this->_level += (rssi - this->_level) / 4;
+
+        const auto elapsed = now - this->_trendTime;
+        if (elapsed >= TrendInterval)
+        {
+            const auto slope = (this->_level - this->_trendLevel) * 1000 / static_cast<std::int32_t>(elapsed.count());
+            this->_trend += (slope - this->_trend) / 2;
+            this->_trendLevel = this->_level;
+            this->_trendTime = now;
+        }
+    }
+
+    void BitrateAdaptation::Evaluate(std::chrono::milliseconds now, std::int32_t doppler)
+    {
+        const auto estimated = this->_level + std::min(this->_trend, 0) * static_cast<std::int32_t>(TrendLookahead.count());
+
+        if (this->_current > 0 && estimated < Thresholds[this->_current] - Hysteresis)
+        {
+            this->_current--;
+            this->_lastChange = now;
+            this->_qualifying = 0;
+            return;
+        }
+
+        const bool canUpgrade = this->_current < BitrateCount - 1 //
+            && estimated >= Thresholds[this->_current + 1]         //
+            && doppler > RecedingDopplerOffset                     //
+            && now - this->_lastChange >= MinimumDwell;
+
+        if (!canUpgrade)
+        {
+            this->_qualifying = 0;
+            return;
+        }
+
+        this->_qualifying++;
+        if (this->_qualifying >= RequiredObservations)
+        {
+            this->_current++;
+            this->_lastChange = now;
+            this->_qualifying = 0;
+        }
+    }
+
+    AdaptiveBitrateController::AdaptiveBitrateController() : _frameHandler(nullptr)
+    {
+    }
+
+    void AdaptiveBitrateController::HandleFrame(devices::comm::ITransmitter& transmitter, devices::comm::Frame& frame)
+    {
+        if (frame.IsRssiValid() && frame.IsDopplerValid())
+        {
+            const auto now = System::GetUptime();
+
+            CriticalSection cs;
+            this->_adaptation.Observe(now, frame.Rssi(), frame.Doppler());
+        }
+
+        if (this->_frameHandler != nullptr)
+        {
+            this->_frameHandler->HandleFrame(transmitter, frame);
+        }
+    }
+
+    Bitrate AdaptiveBitrateController::SelectBitrate(Bitrate /*current*/)
+    {
+        const auto now = System::GetUptime();
+
+        CriticalSection cs;
+        return this->_adaptation.Select(now);
+    }
+
+    void AdaptiveBitrateController::BitrateForced(Bitrate bitrate)
+    {
+        const auto now = System::GetUptime();
+
+        CriticalSection cs;
+        this->_adaptation.Force(now, bitrate);
+    }
+
+    Bitrate AdaptiveBitrateController::Current() const
+    {
+        CriticalSection cs;
+        return this->_adaptation.Current();
+    }
+}
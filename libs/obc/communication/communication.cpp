@@ -12,6 +12,21 @@ using telecommunication::uplink::IHandleTeleCommand;
 using namespace obc;
 using namespace obc::telecommands;
 
+/** @brief Codes of short control telecommands that should not wait for long running ones */
+static constexpr std::uint8_t FastLaneTelecommands[] = {
+    PingTelecommand::Code,
+    AbortExperiment::Code,
+    StopSailDeployment::Code,
+    EnterIdleStateTelecommand::Code,
+    SendBeaconTelecommand::Code,
+    ResetTransmitterTelecommand::Code,
+    SetBitrateTelecommand::Code,
+    DisableOverheatSubmodeTelecommand::Code,
+    ExpectPassTelecommand::Code,
+    AbortTransferTelecommand::Code,
+    SetMinimumTurnaroundTelecommand::Code,
+};
+
 OBCCommunication::OBCCommunication(obc::FDIR& fdir,
     devices::comm::CommObject& commDriver,
     services::time::ICurrentTime& currentTime,
@@ -19,6 +34,7 @@ OBCCommunication::OBCCommunication(obc::FDIR& fdir,
     mission::IIdleStateController& idleStateController,
     IHasState<SystemState>& stateContainer,
     services::fs::IFileSystem& fs,
+    services::fs::IYaffsDeviceOperations& deviceOperations,
     obc::OBCExperiments& experiments,
     program_flash::BootTable& bootTable,
     boot::BootSettings& bootSettings,
@@ -36,9 +52,11 @@ OBCCommunication::OBCCommunication(obc::FDIR& fdir,
     adcs::IAdcsCoordinator& adcsCoordinator)
     : Comm(commDriver),                                                                                                               //
       UplinkProtocolDecoder(settings::CommSecurityCode),                                                                              //
+      TelecommandStats(),                                                                                                             //
+      Cancellation(),                                                                                                                 //
       SupportedTelecommands(                                                                                                          //
           PingTelecommand(),                                                                                                          //
-          DownloadFileTelecommand(fs),                                                                                                //
+          DownloadFileTelecommand(fs, Cancellation),                                                                                  //
           EnterIdleStateTelecommand(currentTime, idleStateController),                                                                //
           RemoveFileTelecommand(fs),                                                                                                  //
           SetTimeCorrectionConfigTelecommand(stateContainer),                                                                         //
@@ -55,7 +73,7 @@ OBCCommunication::OBCCommunication(obc::FDIR& fdir,
           SetBootSlotsTelecommand(bootSettings),                                                                                      //
           SendBeaconTelecommand(telemetry),                                                                                           //
           SetAntennaDeploymentMaskTelecommand(stateContainer),                                                                        //
-          PowerCycle(powerControl),                                                                                                   //
+          PowerCycle(powerControl, deviceOperations),                                                                                 //
           SetErrorCounterConfig(fdir),                                                                                                //
           OpenSail(openSail),                                                                                                         //
           GetErrorCountersConfigTelecommand(fdir.ErrorCounting(), fdir),                                                              //
@@ -84,15 +102,31 @@ OBCCommunication::OBCCommunication(obc::FDIR& fdir,
           SetBuiltinDetumblingBlockMaskTelecommand(stateContainer, adcsCoordinator),                               //
           SetAdcsModeTelecommand(adcsCoordinator),                                                                 //
           StopSailDeployment(stateContainer),
-          obc::telecommands::ReadMemoryTelecommand() //
-          ),                                         //
-      TelecommandHandler(UplinkProtocolDecoder, SupportedTelecommands.Get())
+          obc::telecommands::ReadMemoryTelecommand(),                                                              //
+          GetTelecommandStatisticsTelecommand(TelecommandStats),                                                   //
+          SelectiveDownloadFileTelecommand(fs, Cancellation),                                                      //
+          FecDownloadFileTelecommand(fs, Cancellation),                                                            //
+          DownloadTelemetryRangeTelecommand(fs, deviceOperations, ::telemetry::TelemetryArchive, Cancellation),    //
+          GetLinkStatisticsTelecommand(commDriver, commDriver, Executor, Downlink),                                //
+          ExpectPassTelecommand(commDriver),                                                                       //
+          AbortTransferTelecommand(Cancellation),                                                                  //
+          SetMinimumTurnaroundTelecommand(commDriver),                                                             //
+          GetTurnaroundStatisticsTelecommand(commDriver)                                                           //
+          ),                                                                                                       //
+      TelecommandHandler(UplinkProtocolDecoder, SupportedTelecommands.Get(), SupportedTelecommands.Index, TelecommandStats),          //
+      Downlink(commDriver),                                                                                                           //
+      Executor(FastLaneTelecommands, TelecommandStats)
 {
 }
 
 void OBCCommunication::InitializeRunlevel1()
 {
-    this->Comm.SetFrameHandler(this->TelecommandHandler);
+    this->TelecommandHandler.SetExecutor(this->Executor);
+    this->Downlink.SetFrameHandler(this->TelecommandHandler);
+    this->Downlink.SetBitrateSelector(this->BitrateController);
+    this->BitrateController.SetFrameHandler(this->Downlink);
+    this->Comm.SetFrameHandler(this->BitrateController);
+    this->Comm.SetReceiveMode(devices::comm::ReceiveMode::Adaptive);
     if (!this->Comm.RestartHardware())
     {
         LOG(LOG_LEVEL_ERROR, "Unable to restart COMM hardware");
@@ -101,6 +135,16 @@ void OBCCommunication::InitializeRunlevel1()
 
 void OBCCommunication::InitializeRunlevel2()
 {
+    if (OS_RESULT_FAILED(this->Downlink.Initialize()))
+    {
+        LOG(LOG_LEVEL_ERROR, "Unable to initialize downlink scheduler");
+    }
+
+    if (OS_RESULT_FAILED(this->Executor.Initialize()))
+    {
+        LOG(LOG_LEVEL_ERROR, "Unable to initialize telecommand executor");
+    }
+
     if (!this->Comm.StartTask())
     {
         LOG(LOG_LEVEL_ERROR, "Unable to start comm task");
@@ -128,6 +128,77 @@ namespace obc
              */
             virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
         };
+
+        /**
+         * @brief Announce communication window
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Receiver is polled with the minimal interval until the announced window ends, even when no further
+         * uplink frames arrive (e.g. while ground station listens to long download).
+         *
+         * Command code: 0x2C
+         *
+         * Parameters:
+         *  - 8-bit - Correlation id that will be used in response
+         *  - 16-bit - Time in seconds, how long the communication window lasts
+         */
+        class ExpectPassTelecommand final : public telecommunication::uplink::Telecommand<0x2C>
+        {
+          public:
+            /**
+             * @brief ctor.
+             * @param[in] polling Receiver polling scheduler
+             */
+            ExpectPassTelecommand(devices::comm::IReceiverPolling& polling);
+
+            /**
+             * @brief Method called when telecommand is received.
+             * @param[in] transmitter Reference to object that can be used to send response back
+             * @param[in] parameters Parameters contained in telecommand frame
+             */
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Receiver polling scheduler */
+            devices::comm::IReceiverPolling& _polling;
+        };
+
+        /**
+         * @brief Set minimum turnaround of comm hardware command
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Overrides time waited between command write and the first response read, so the turnaround profile
+         * can be tuned from measured statistics (see @ref GetTurnaroundStatisticsTelecommand).
+         *
+         * Command code: 0x2F
+         *
+         * Parameters:
+         *  - 8-bit - Correlation id that will be used in response
+         *  - 8-bit - Profiled command (devices::comm::ResponseCommand)
+         *  - 8-bit - Minimum turnaround in milliseconds
+         */
+        class SetMinimumTurnaroundTelecommand final : public telecommunication::uplink::Telecommand<0x2F>
+        {
+          public:
+            /**
+             * @brief ctor.
+             * @param[in] diagnostics Comm driver diagnostics
+             */
+            SetMinimumTurnaroundTelecommand(devices::comm::ICommDiagnostics& diagnostics);
+
+            /**
+             * @brief Method called when telecommand is received.
+             * @param[in] transmitter Reference to object that can be used to send response back
+             * @param[in] parameters Parameters contained in telecommand frame
+             */
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Comm driver diagnostics */
+            devices::comm::ICommDiagnostics& _diagnostics;
+        };
     }
 }
 
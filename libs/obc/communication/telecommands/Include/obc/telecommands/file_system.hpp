@@ -1,7 +1,10 @@
 #ifndef LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_FILE_SYSTEM_HPP_
 #define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_FILE_SYSTEM_HPP_
 
+#include "base/erasure.hpp"
 #include "fs/fs.h"
+#include "fs/read_ahead.hpp"
+#include "telecommunication/TelecommandCancellation.hpp"
 #include "telecommunication/downlink.h"
 #include "telecommunication/telecommand_handling.h"
 
@@ -12,6 +15,10 @@ namespace obc
         /**
          * @brief Generic mechanism for sending file part-by-part
          * @ingroup telecommands
+         *
+         * File contents are read via @ref services::fs::ReadAheadFile, so consecutive parts are served from single
+         * file system chunk kept in RAM. Read-ahead window is shared by all senders, sender created while the window
+         * is in use reads file parts directly.
          */
         class FileSender final
         {
@@ -22,8 +29,18 @@ namespace obc
              * @param correlationId Operation correlation id
              * @param transmitter Transmitter
              * @param fs File system
+             * @param compress Compress each part before sending it
+             */
+            FileSender(const char* path,
+                uint8_t correlationId,
+                devices::comm::ITransmitter& transmitter,
+                services::fs::IFileSystem& fs,
+                bool compress);
+
+            /**
+             * @brief Dtor
              */
-            FileSender(const char* path, uint8_t correlationId, devices::comm::ITransmitter& transmitter, services::fs::IFileSystem& fs);
+            ~FileSender();
 
             /**
              * @brief Checks if requested operation is valid
@@ -38,6 +55,20 @@ namespace obc
              */
             bool SendPart(std::uint32_t seq);
 
+            /**
+             * @brief Reads single part of file
+             * @param seq Sequence number indicating which part of file should be read
+             * @param buffer Buffer for file part (at least @ref MaxFileDataSize bytes long)
+             * @return Part of buffer filled with file contents. Empty span if part cannot be read.
+             */
+            gsl::span<std::uint8_t> ReadPart(std::uint32_t seq, gsl::span<std::uint8_t> buffer);
+
+            /**
+             * @brief Returns number of chunks file is split into
+             * @return Number of chunks
+             */
+            std::uint32_t ChunksCount() const;
+
             /**
              * @brief Calculates max chunk number for file of given size
              * @param fileSize File size
@@ -45,9 +76,26 @@ namespace obc
              */
             static std::uint32_t MaxChunkNumber(std::uint32_t fileSize);
 
-          private:
+            /**
+             * @brief Extracts compression flag from path length field
+             * @param pathLength Path length field from telecommand
+             * @return true if compressed transfer has been requested
+             */
+            static constexpr bool IsCompressionRequested(std::uint8_t pathLength)
+            {
+                return (pathLength & CompressionFlag) != 0;
+            }
+
+            /** @brief Flag in path length field requesting compressed transfer */
+            static constexpr std::uint8_t CompressionFlag = 1 << 7;
+
             /** @brief Maximum size of file data in a payload */
             static constexpr uint8_t MaxFileDataSize = telecommunication::downlink::DownlinkFrame::MaxPayloadSize - 2;
+
+            /** @brief Size of read-ahead window - data part of single file system chunk */
+            static constexpr std::uint16_t ReadAheadSize = services::fs::ChunkDataSize;
+
+          private:
             /** @brief File to send */
             services::fs::File _file;
             /** @brief Operation correlation id */
@@ -58,6 +106,12 @@ namespace obc
             services::fs::FileSize _fileSize;
             /** @brief Last sequence number available for file */
             std::uint32_t _lastSeq;
+            /** @brief Compress each part before sending it */
+            bool _compress;
+            /** @brief Read-ahead window buffer, empty if shared window is in use */
+            gsl::span<std::uint8_t> _window;
+            /** @brief Source of file contents */
+            services::fs::ReadAheadFile _source;
         };
 
         /**
@@ -69,10 +123,17 @@ namespace obc
          *
          * Parameters:
          *  - 8-bit - Operation correlation id that will be used in response
-         *  - 8-bit - Path length
+         *  - 8-bit - Path length (bit 7 set requests compressed transfer)
          *  - String - path to file
          *  - 8-bit - Byte '0'
          *  - Array of 32-bit LE - Sequence numbers of parts that will be send
+         *
+         * In compressed transfer every part is compressed independently (see @ref lzss) and sent with
+         * @ref ErrorCode::SuccessCompressed status. Parts that do not shrink are sent as-is with @ref ErrorCode::Success status.
+         * Sequence numbers refer to the same file ranges in both modes.
+         *
+         * Transfer cancelled with @ref AbortTransferTelecommand ends with error frame with @ref ErrorCode::Aborted status and
+         * sequence number of first part that was not sent.
          */
         class DownloadFileTelecommand final : public telecommunication::uplink::Telecommand<0xAB>
         {
@@ -86,20 +147,169 @@ namespace obc
                 FileNotFound = 0x01,
                 MalformedRequest = 0x02,
                 InvalidPath = 0x03,
-                TooBigSeq = 0x04
+                TooBigSeq = 0x04,
+                SendFailed = 0x05,
+                SuccessCompressed = 0x06,
+                Aborted = 0x07
             };
 
             /**
              * @brief Ctor
              * @param fs File system
+             * @param cancellation Cancellation of long running telecommands
              */
-            DownloadFileTelecommand(services::fs::IFileSystem& fs);
+            DownloadFileTelecommand(services::fs::IFileSystem& fs, const telecommunication::uplink::TelecommandCancellation& cancellation);
 
             virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
 
           private:
             /** @brief File system */
             services::fs::IFileSystem& _fs;
+            /** @brief Cancellation of long running telecommands */
+            const telecommunication::uplink::TelecommandCancellation& _cancellation;
+        };
+
+        /**
+         * @brief Download selected parts of file using compact chunk selection
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0xB3
+         *
+         * Parameters:
+         *  - 8-bit - Operation correlation id that will be used in response
+         *  - 8-bit - Path length (bit 7 set requests compressed transfer)
+         *  - String - path to file
+         *  - 8-bit - Byte '0'
+         *  - 32-bit LE - Start sequence number (initial cursor)
+         *  - Sequence of selectors, each one advancing cursor:
+         *    - Bitmap: 8-bit '1', 8-bit bitmap length N, N bytes of bitmap. Bit i (LSB first) of byte j selects
+         *      chunk cursor + 8 * j + i. Cursor is advanced by 8 * N.
+         *    - Range: 8-bit '2', 16-bit LE offset, 16-bit LE count. Selects count chunks starting at cursor + offset.
+         *      Cursor is advanced to the chunk following the range.
+         *
+         * Selected chunks are sent as regular @ref DownloadFileTelecommand responses. After all chunks are sent (or
+         * when transfer is stopped) completion frame is sent with following payload:
+         *  - 8-bit - Error code
+         *  - 32-bit LE - Number of sent chunks
+         *  - 32-bit LE - Resume sequence number (first chunk that was not handled)
+         *  - 32-bit LE - Number of chunks file is split into
+         *
+         * Resume sequence number can be used as start sequence number of next request if transfer has been interrupted
+         * (for example due to end of communication window or @ref AbortTransferTelecommand).
+         */
+        class SelectiveDownloadFileTelecommand final : public telecommunication::uplink::Telecommand<0xB3>
+        {
+          public:
+            /**
+             * @brief Chunk selector type
+             */
+            enum class Selector : std::uint8_t
+            {
+                Bitmap = 0x01, //!< Missing chunk bitmap
+                Range = 0x02,  //!< Run of consecutive chunks
+            };
+
+            /**
+             * @brief Ctor
+             * @param fs File system
+             * @param cancellation Cancellation of long running telecommands
+             */
+            SelectiveDownloadFileTelecommand(
+                services::fs::IFileSystem& fs, const telecommunication::uplink::TelecommandCancellation& cancellation);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief File system */
+            services::fs::IFileSystem& _fs;
+            /** @brief Cancellation of long running telecommands */
+            const telecommunication::uplink::TelecommandCancellation& _cancellation;
+        };
+
+        /**
+         * @brief Download file with forward erasure coding
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0xB4
+         *
+         * Parameters:
+         *  - 8-bit - Operation correlation id that will be used in response
+         *  - 8-bit - Path length
+         *  - String - path to file
+         *  - 8-bit - Byte '0'
+         *  - 8-bit - Group size K - number of file parts in single group (1 - @ref MaxGroupSize)
+         *  - 8-bit - Number of repair frames M sent after each group (0 - @ref MaxRepairFrames)
+         *  - Array of 32-bit LE - Group numbers. Group G consists of parts K * G to K * G + K - 1.
+         *
+         * Each part of requested group is sent as regular @ref DownloadFileTelecommand response. Then M repair frames
+         * (see @ref erasure) are sent with FileRepair APID and sequence number M * G + j, where j is repair frame index.
+         * Ground station can rebuild whole group from any K of its K + M frames. Parts beyond end of file (last group)
+         * and tail of last part are treated as zeros.
+         *
+         * Cancellation with @ref AbortTransferTelecommand takes effect before next group.
+         *
+         * After all groups are sent (or when transfer is stopped) completion frame is sent with following payload:
+         *  - 8-bit - Error code
+         *  - 32-bit LE - Number of sent frames (data and repair)
+         *  - 32-bit LE - Number of first group that was not handled
+         *  - 32-bit LE - Number of chunks file is split into
+         */
+        class FecDownloadFileTelecommand final : public telecommunication::uplink::Telecommand<0xB4>
+        {
+          public:
+            /** @brief Maximal number of file parts in single group */
+            static constexpr std::uint8_t MaxGroupSize = erasure::MaxDataBlocks;
+
+            /** @brief Maximal number of repair frames per group */
+            static constexpr std::uint8_t MaxRepairFrames = 4;
+
+            /**
+             * @brief Ctor
+             * @param fs File system
+             * @param cancellation Cancellation of long running telecommands
+             */
+            FecDownloadFileTelecommand(
+                services::fs::IFileSystem& fs, const telecommunication::uplink::TelecommandCancellation& cancellation);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief File system */
+            services::fs::IFileSystem& _fs;
+            /** @brief Cancellation of long running telecommands */
+            const telecommunication::uplink::TelecommandCancellation& _cancellation;
+        };
+
+        /**
+         * @brief Abort file and telemetry downloads that are in progress
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0x2E
+         *
+         * Parameters:
+         *  - 8-bit - Operation correlation id that will be used in response
+         *
+         * Downloads stop before sending their next frame and report @ref DownloadFileTelecommand::ErrorCode::Aborted
+         * (or its telemetry range counterpart) together with the resume position. Downloads that start after this
+         * telecommand are not affected.
+         */
+        class AbortTransferTelecommand final : public telecommunication::uplink::Telecommand<0x2E>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param cancellation Cancellation of long running telecommands
+             */
+            AbortTransferTelecommand(telecommunication::uplink::TelecommandCancellation& cancellation);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Cancellation of long running telecommands */
+            telecommunication::uplink::TelecommandCancellation& _cancellation;
         };
 
         /**
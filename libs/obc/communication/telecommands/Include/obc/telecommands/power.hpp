@@ -1,6 +1,7 @@
 #ifndef LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_POWER_HPP_
 #define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_POWER_HPP_
 
+#include "fs/fwd.hpp"
 #include "power/fwd.hpp"
 #include "telecommunication/telecommand_handling.h"
 
@@ -15,6 +16,8 @@ namespace obc
          * Parameters:
          *  - 8-bit - correlation id
          *
+         * File system checkpoint is written before power cycle, so file system is mounted quickly after restart.
+         *
          * Response:
          *  - Operation failure frame with code 0x1 - invalid frame
          *  - Operation success frame with code 0x0 - telecommand accepted, power cycle will be executed
@@ -26,14 +29,18 @@ namespace obc
             /**
              * @brief Ctor
              * @param powerControl Power control
+             * @param deviceOperations File system device operations
              */
-            PowerCycle(services::power::IPowerControl& powerControl);
+            PowerCycle(services::power::IPowerControl& powerControl, services::fs::IYaffsDeviceOperations& deviceOperations);
 
             virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
 
           private:
             /** @brief Power control */
             services::power::IPowerControl& _powerControl;
+
+            /** @brief File system device operations */
+            services::fs::IYaffsDeviceOperations& _deviceOperations;
         };
     }
 }
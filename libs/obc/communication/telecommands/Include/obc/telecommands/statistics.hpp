@@ -0,0 +1,144 @@
+#ifndef LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_STATISTICS_HPP_
+#define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_STATISTICS_HPP_
+
+#include "comm/comm.hpp"
+#include "telecommunication/DownlinkScheduler.hpp"
+#include "telecommunication/TelecommandExecutor.hpp"
+#include "telecommunication/telecommand_handling.h"
+
+namespace obc
+{
+    namespace telecommands
+    {
+        /**
+         * @brief Telecommand for downloading per telecommand execution statistics
+         * @telecommand
+         * @ingroup telecommands
+         *
+         * Parameters:
+         * - Correlation ID (8-bit)
+         * - First telecommand code to report (8-bit)
+         *
+         * Response contains status byte followed by entries for every telecommand code (starting from requested one)
+         * that has non-zero statistics, as long as they fit into single frame:
+         * - Telecommand code (8-bit)
+         * - Invocations (16-bit)
+         * - Failures (16-bit)
+         * - Worst execution time in milliseconds (16-bit)
+         */
+        class GetTelecommandStatisticsTelecommand : public telecommunication::uplink::Telecommand<0x2A>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param[in] statistics Telecommand statistics
+             */
+            GetTelecommandStatisticsTelecommand(telecommunication::uplink::TelecommandStatistics& statistics);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Telecommand statistics */
+            telecommunication::uplink::TelecommandStatistics& _statistics;
+        };
+
+        /**
+         * @brief Telecommand for downloading communication link statistics
+         * @telecommand
+         * @ingroup telecommands
+         *
+         * Command code: 0x2B
+         *
+         * Parameters:
+         * - Correlation ID (8-bit)
+         *
+         * Response contains status byte followed by (all times in milliseconds, saturated at 0xFFFF):
+         * - Receiver polls (32-bit)
+         * - Receiver polls that found frames (32-bit)
+         * - Current polling interval (16-bit)
+         * - Last polling latency (16-bit)
+         * - Maximal polling latency (16-bit)
+         * - Average polling latency (16-bit)
+         * - Telecommand executor fast lane followed by normal lane statistics:
+         *   - Executed telecommands (32-bit)
+         *   - Telecommands rejected due to full queue (32-bit)
+         *   - Current queue depth (8-bit)
+         *   - Maximal queue depth (8-bit)
+         *   - Last wait for execution (16-bit)
+         *   - Maximal wait for execution (16-bit)
+         * - COMM hardware transactions served from telemetry cache (32-bit)
+         * - Downlink scheduler statistics:
+         *   - Frames accepted by transmitter (32-bit)
+         *   - Send attempts rejected by transmitter (32-bit)
+         *   - Dropped frames (32-bit)
+         *   - Frames that could not be enqueued (32-bit)
+         *   - Responses sent inside packed frames (32-bit)
+         *   - Free transmitter buffer slots (8-bit)
+         *   - Frames accepted by transmitter at 1200, 2400, 4800 and 9600 bps (4x 32-bit)
+         */
+        class GetLinkStatisticsTelecommand : public telecommunication::uplink::Telecommand<0x2B>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param[in] polling Receiver polling scheduler
+             * @param[in] diagnostics Comm driver diagnostics
+             * @param[in] executor Telecommand executor
+             * @param[in] downlink Downlink scheduler
+             */
+            GetLinkStatisticsTelecommand(devices::comm::IReceiverPolling& polling,
+                devices::comm::ICommDiagnostics& diagnostics,
+                const telecommunication::uplink::TelecommandExecutor& executor,
+                const telecommunication::downlink::DownlinkScheduler& downlink);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Receiver polling scheduler */
+            devices::comm::IReceiverPolling& _polling;
+            /** @brief Comm driver diagnostics */
+            devices::comm::ICommDiagnostics& _diagnostics;
+            /** @brief Telecommand executor */
+            const telecommunication::uplink::TelecommandExecutor& _executor;
+            /** @brief Downlink scheduler */
+            const telecommunication::downlink::DownlinkScheduler& _downlink;
+        };
+
+        /**
+         * @brief Telecommand for downloading turnaround statistics of single comm hardware command
+         * @telecommand
+         * @ingroup telecommands
+         *
+         * Command code: 0x30
+         *
+         * Parameters:
+         * - Correlation ID (8-bit)
+         * - Profiled command (8-bit, devices::comm::ResponseCommand)
+         *
+         * Response contains status byte followed by (all times in milliseconds, saturated at 0xFFFF):
+         * - Current minimum turnaround (16-bit)
+         * - Successful exchanges (32-bit)
+         * - Not acknowledged response reads (32-bit)
+         * - Failed exchanges (32-bit)
+         * - Longest measured turnaround (16-bit)
+         * - Turnaround histogram: 0, 1, 2, 3-4, 5-8 and 9 and more milliseconds (6x 32-bit)
+         */
+        class GetTurnaroundStatisticsTelecommand : public telecommunication::uplink::Telecommand<0x30>
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param[in] diagnostics Comm driver diagnostics
+             */
+            GetTurnaroundStatisticsTelecommand(devices::comm::ICommDiagnostics& diagnostics);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief Comm driver diagnostics */
+            devices::comm::ICommDiagnostics& _diagnostics;
+        };
+    }
+}
+
+#endif /* LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_STATISTICS_HPP_ */
@@ -0,0 +1,96 @@
+#ifndef LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_TELEMETRY_HPP_
+#define LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_TELEMETRY_HPP_
+
+#include <cstdint>
+#include "fs/fs.h"
+#include "fs/fwd.hpp"
+#include "telecommunication/TelecommandCancellation.hpp"
+#include "telecommunication/telecommand_handling.h"
+#include "telemetry/archive.hpp"
+
+namespace obc
+{
+    namespace telecommands
+    {
+        /**
+         * @brief Download telemetry records saved in given mission time window
+         * @ingroup telecommands
+         * @telecommand
+         *
+         * Command code: 0xB5
+         *
+         * Parameters:
+         *  - 8-bit - Operation correlation id that will be used in response
+         *  - 64-bit LE - Mission time (in milliseconds) of beginning of window
+         *  - 64-bit LE - Mission time (in milliseconds) of end of window (inclusive)
+         *  - 16-bit LE - Optional stride, only every n-th record from window is sent (0 and 1 select all records)
+         *  - 16-bit LE - Optional maximal number of sent records (0 selects @ref DefaultRecordsLimit)
+         *
+         * Telemetry buffered in RAM by archive writer is flushed first, so the most recent records can be sent too.
+         * Previous and current telemetry archive files are searched (in this order). Position of first candidate
+         * record in each file is looked up with binary search over its sparse index, then records are read one by one
+         * until record newer than end of window is found. Mission time of saved records is assumed to be
+         * non-decreasing.
+         *
+         * Every selected record is sent in separate frame with TelemetryRange APID and sequence number equal to number
+         * of records sent so far:
+         *  - 8-bit - Error code (@ref ErrorCode::Success)
+         *  - Serialized telemetry record
+         *
+         * After all records are sent (or when transfer is stopped) completion frame is sent with TelemetryRangeCompleted
+         * APID and following payload:
+         *  - 8-bit - Error code
+         *  - 32-bit LE - Number of sent records
+         *  - 64-bit LE - Mission time of last sent record (0 if no record has been sent)
+         *
+         * Transfer stops with @ref ErrorCode::LimitReached when the next record from window would exceed the records limit.
+         * Interrupted or limited transfer (e.g. with AbortTransferTelecommand) can be resumed with window starting right
+         * after mission time of last sent record.
+         */
+        class DownloadTelemetryRangeTelecommand final : public telecommunication::uplink::Telecommand<0xB5>
+        {
+          public:
+            /**
+             * @brief Error codes for downloading telemetry range
+             */
+            enum class ErrorCode : std::uint8_t
+            {
+                Success = 0x00,
+                MalformedRequest = 0x01,
+                ReadFailed = 0x02,
+                SendFailed = 0x03,
+                Aborted = 0x04,
+                LimitReached = 0x05,
+            };
+
+            /** @brief Maximal number of records sent in single transfer if not specified in request */
+            static constexpr std::uint16_t DefaultRecordsLimit = 100;
+
+            /**
+             * @brief Ctor
+             * @param[in] fs File system
+             * @param[in] deviceOperations File system device operations used to flush buffered telemetry
+             * @param[in] files Telemetry archive files
+             * @param[in] cancellation Cancellation of long running telecommands
+             */
+            DownloadTelemetryRangeTelecommand(services::fs::IFileSystem& fs,
+                services::fs::IYaffsDeviceOperations& deviceOperations,
+                const telemetry::ArchiveFiles& files,
+                const telecommunication::uplink::TelecommandCancellation& cancellation);
+
+            virtual void Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters) override;
+
+          private:
+            /** @brief File system */
+            services::fs::IFileSystem& _fs;
+            /** @brief File system device operations */
+            services::fs::IYaffsDeviceOperations& _deviceOperations;
+            /** @brief Telemetry archive files */
+            const telemetry::ArchiveFiles _files;
+            /** @brief Cancellation of long running telecommands */
+            const telecommunication::uplink::TelecommandCancellation& _cancellation;
+        };
+    }
+}
+
+#endif /* LIBS_OBC_COMMUNICATION_TELECOMMANDS_INCLUDE_OBC_TELECOMMANDS_TELEMETRY_HPP_ */
@@ -136,5 +136,65 @@ namespace obc
             response.PayloadWriter().WriteByte(0);
             transmitter.SendFrame(response.Frame());
         }
+
+        ExpectPassTelecommand::ExpectPassTelecommand(devices::comm::IReceiverPolling& polling) : _polling(polling)
+        {
+        }
+
+        void ExpectPassTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+
+            auto correlationId = r.ReadByte();
+            auto duration = std::chrono::seconds(r.ReadWordLE());
+
+            CorrelatedDownlinkFrame response(DownlinkAPID::Comm, 0, correlationId);
+
+            if (!r.Status())
+            {
+                LOG(LOG_LEVEL_ERROR, "Malformed request");
+                response.PayloadWriter().WriteByte(-1);
+                transmitter.SendFrame(response.Frame());
+                return;
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Expecting communication window for %d seconds", static_cast<int>(duration.count()));
+
+            this->_polling.ExpectPass(System::GetUptime() + duration);
+
+            response.PayloadWriter().WriteByte(0);
+            transmitter.SendFrame(response.Frame());
+        }
+
+        SetMinimumTurnaroundTelecommand::SetMinimumTurnaroundTelecommand(devices::comm::ICommDiagnostics& diagnostics)
+            : _diagnostics(diagnostics)
+        {
+        }
+
+        void SetMinimumTurnaroundTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+
+            auto correlationId = r.ReadByte();
+            auto command = r.ReadByte();
+            auto turnaround = std::chrono::milliseconds(r.ReadByte());
+
+            CorrelatedDownlinkFrame response(DownlinkAPID::Comm, 0, correlationId);
+
+            if (!r.Status() || command >= num(ResponseCommand::Count))
+            {
+                LOG(LOG_LEVEL_ERROR, "Malformed request");
+                response.PayloadWriter().WriteByte(-1);
+                transmitter.SendFrame(response.Frame());
+                return;
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Setting minimum turnaround of command %d to %dms", command, static_cast<int>(turnaround.count()));
+
+            this->_diagnostics.SetMinimumTurnaround(static_cast<ResponseCommand>(command), turnaround);
+
+            response.PayloadWriter().WriteByte(0);
+            transmitter.SendFrame(response.Frame());
+        }
     }
 }
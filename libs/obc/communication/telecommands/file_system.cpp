@@ -1,6 +1,9 @@
 #include "file_system.hpp"
+#include <array>
+#include <atomic>
 #include <cmath>
 #include <cstring>
+#include "base/lzss.hpp"
 #include "base/reader.h"
 #include "comm/ITransmitter.hpp"
 #include "fs/fs.h"
@@ -11,16 +14,44 @@
 using telecommunication::downlink::CorrelatedDownlinkFrame;
 using telecommunication::downlink::DownlinkAPID;
 using services::fs::File;
-using services::fs::SeekOrigin;
 
 namespace obc
 {
     namespace telecommands
     {
-        FileSender::FileSender(
-            const char* path, uint8_t correlationId, devices::comm::ITransmitter& transmitter, services::fs::IFileSystem& fs)
+        constexpr std::uint8_t FileSender::CompressionFlag;
+        constexpr std::uint8_t FileSender::MaxFileDataSize;
+        constexpr std::uint16_t FileSender::ReadAheadSize;
+        constexpr std::uint8_t FecDownloadFileTelecommand::MaxGroupSize;
+        constexpr std::uint8_t FecDownloadFileTelecommand::MaxRepairFrames;
+
+        /** @brief Read-ahead window shared by all file senders */
+        alignas(4) static std::array<std::uint8_t, FileSender::ReadAheadSize> ReadAheadWindow;
+
+        /** @brief Flag indicating that @ref ReadAheadWindow is used by one of the senders */
+        static std::atomic_flag ReadAheadWindowInUse = ATOMIC_FLAG_INIT;
+
+        /**
+         * @brief Takes shared read-ahead window
+         * @return Window buffer or empty span if window is already in use
+         */
+        static gsl::span<std::uint8_t> AcquireReadAheadWindow()
+        {
+            if (ReadAheadWindowInUse.test_and_set())
+            {
+                return {};
+            }
+
+            return ReadAheadWindow;
+        }
+
+        FileSender::FileSender(const char* path,
+            uint8_t correlationId,
+            devices::comm::ITransmitter& transmitter,
+            services::fs::IFileSystem& fs,
+            bool compress)
             : _file(fs, path, services::fs::FileOpen::Existing, services::fs::FileAccess::ReadOnly), _correlationId(correlationId),
-              _transmitter(transmitter)
+              _transmitter(transmitter), _compress(compress), _window(AcquireReadAheadWindow()), _source(_file, _window)
         {
             if (this->IsValid())
             {
@@ -30,6 +61,14 @@ namespace obc
             }
         }
 
+        FileSender::~FileSender()
+        {
+            if (!this->_window.empty())
+            {
+                ReadAheadWindowInUse.clear();
+            }
+        }
+
         std::uint32_t FileSender::MaxChunkNumber(std::uint32_t fileSize)
         {
             return (fileSize + MaxFileDataSize - 1) / MaxFileDataSize;
@@ -49,32 +88,87 @@ namespace obc
 
             CorrelatedDownlinkFrame response(DownlinkAPID::FileSend, seq, _correlationId);
 
-            if (OS_RESULT_FAILED(this->_file.Seek(SeekOrigin::Begin, seq * MaxFileDataSize)))
+            const auto offset = static_cast<services::fs::FileSize>(seq * MaxFileDataSize);
+            auto segmentSize = std::min<std::size_t>(MaxFileDataSize, this->_fileSize - seq * MaxFileDataSize);
+
+            if (!this->_compress)
+            {
+                response.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::Success));
+
+                auto buf = response.PayloadWriter().Reserve(segmentSize);
+
+                if (OS_RESULT_FAILED(this->_source.Read(offset, buf).Status))
+                {
+                    return false;
+                }
+
+                return this->_transmitter.SendFrame(response.Frame());
+            }
+
+            std::array<std::uint8_t, MaxFileDataSize> raw;
+            std::array<std::uint8_t, MaxFileDataSize - 1> compressed;
+
+            auto segment = gsl::make_span(raw).subspan(0, segmentSize);
+            if (OS_RESULT_FAILED(this->_source.Read(offset, segment).Status))
             {
                 return false;
             }
 
-            response.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::Success));
+            auto packed = segment.empty() ? segment : lzss::Compress(segment, gsl::make_span(compressed).subspan(0, segment.size() - 1));
+
+            if (packed.empty())
+            {
+                response.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::Success));
+                response.PayloadWriter().WriteArray(segment);
+            }
+            else
+            {
+                response.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::SuccessCompressed));
+                response.PayloadWriter().WriteArray(packed);
+            }
+
+            return this->_transmitter.SendFrame(response.Frame());
+        }
+
+        gsl::span<std::uint8_t> FileSender::ReadPart(std::uint32_t seq, gsl::span<std::uint8_t> buffer)
+        {
+            if (seq >= this->_lastSeq)
+            {
+                return {};
+            }
 
             auto segmentSize = std::min<std::size_t>(MaxFileDataSize, this->_fileSize - seq * MaxFileDataSize);
 
-            auto buf = response.PayloadWriter().Reserve(segmentSize);
+            auto result = this->_source.Read(static_cast<services::fs::FileSize>(seq * MaxFileDataSize), buffer.subspan(0, segmentSize));
+
+            if (OS_RESULT_FAILED(result.Status))
+            {
+                return {};
+            }
 
-            this->_file.Read(buf);
+            return buffer.subspan(0, result.Result.size());
+        }
 
-            return this->_transmitter.SendFrame(response.Frame());
+        std::uint32_t FileSender::ChunksCount() const
+        {
+            return this->_lastSeq;
         }
 
-        DownloadFileTelecommand::DownloadFileTelecommand(services::fs::IFileSystem& fs) : _fs(fs)
+        DownloadFileTelecommand::DownloadFileTelecommand(
+            services::fs::IFileSystem& fs, const telecommunication::uplink::TelecommandCancellation& cancellation)
+            : _fs(fs), _cancellation(cancellation)
         {
         }
 
         void DownloadFileTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
         {
+            const auto token = this->_cancellation.Begin();
+
             Reader r(parameters);
 
             auto correlationId = r.ReadByte();
-            auto pathLength = r.ReadByte();
+            auto pathLengthAndFlags = r.ReadByte();
+            auto pathLength = pathLengthAndFlags & ~FileSender::CompressionFlag;
             auto pathSpan = r.ReadArray(pathLength);
             auto path = reinterpret_cast<const char*>(pathSpan.data());
             auto terminationByte = r.ReadByte();
@@ -105,7 +199,7 @@ namespace obc
 
             LOGF(LOG_LEVEL_INFO, "Sending file %s", path);
 
-            FileSender sender(path, correlationId, transmitter, this->_fs);
+            FileSender sender(path, correlationId, transmitter, this->_fs, FileSender::IsCompressionRequested(pathLengthAndFlags));
 
             if (!sender.IsValid())
             {
@@ -127,6 +221,18 @@ namespace obc
                 {
                     break;
                 }
+
+                if (this->_cancellation.IsCancelled(token))
+                {
+                    LOGF(LOG_LEVEL_INFO, "Sending file %s aborted at seq %ld", path, seq);
+                    CorrelatedDownlinkFrame errorResponse(DownlinkAPID::FileSend, seq, correlationId);
+                    errorResponse.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::Aborted));
+                    errorResponse.PayloadWriter().WriteArray(pathSpan);
+
+                    transmitter.SendFrame(errorResponse.Frame());
+                    break;
+                }
+
                 LOGF(LOG_LEVEL_DEBUG, "Sending seq %ld", seq);
 
                 if (!sender.SendPart(seq))
@@ -140,6 +246,431 @@ namespace obc
             }
         }
 
+        /**
+         * @brief Helper class tracking progress of selective download
+         */
+        class SelectiveTransfer final
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param sender File sender
+             * @param cursor Start sequence number
+             * @param cancellation Cancellation of long running telecommands
+             */
+            SelectiveTransfer(
+                FileSender& sender, std::uint32_t cursor, const telecommunication::uplink::TelecommandCancellation& cancellation)
+                : Status(DownloadFileTelecommand::ErrorCode::Success), Sent(0), Cursor(cursor), _sender(sender),
+                  _cancellation(cancellation), _token(cancellation.Begin())
+            {
+            }
+
+            /**
+             * @brief Sends single chunk
+             * @param seq Sequence number of chunk
+             * @return true if transfer can be continued
+             */
+            bool Send(std::uint32_t seq)
+            {
+                if (seq >= this->_sender.ChunksCount())
+                {
+                    return this->Stop(DownloadFileTelecommand::ErrorCode::TooBigSeq, seq);
+                }
+
+                if (this->_cancellation.IsCancelled(this->_token))
+                {
+                    return this->Stop(DownloadFileTelecommand::ErrorCode::Aborted, seq);
+                }
+
+                if (!this->_sender.SendPart(seq))
+                {
+                    return this->Stop(DownloadFileTelecommand::ErrorCode::SendFailed, seq);
+                }
+
+                this->Sent++;
+                return true;
+            }
+
+            /**
+             * @brief Stops transfer
+             * @param status Transfer status
+             * @param resume Sequence number from which transfer should be resumed
+             * @return Always false
+             */
+            bool Stop(DownloadFileTelecommand::ErrorCode status, std::uint32_t resume)
+            {
+                this->Status = status;
+                this->Cursor = resume;
+                return false;
+            }
+
+            /** @brief Transfer status */
+            DownloadFileTelecommand::ErrorCode Status;
+            /** @brief Number of sent chunks */
+            std::uint32_t Sent;
+            /** @brief Current cursor position */
+            std::uint32_t Cursor;
+
+          private:
+            /** @brief File sender */
+            FileSender& _sender;
+            /** @brief Cancellation of long running telecommands */
+            const telecommunication::uplink::TelecommandCancellation& _cancellation;
+            /** @brief Cancellation token taken at transfer start */
+            const telecommunication::uplink::TelecommandCancellation::Token _token;
+        };
+
+        /**
+         * @brief Sends chunks selected by bitmap
+         * @param transfer Transfer state
+         * @param bitmap Bitmap of selected chunks
+         * @return true if transfer can be continued
+         */
+        static bool SendBitmap(SelectiveTransfer& transfer, gsl::span<const std::uint8_t> bitmap)
+        {
+            const auto base = transfer.Cursor;
+
+            for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(bitmap.size()); i++)
+            {
+                for (std::uint32_t bit = 0; bit < 8; bit++)
+                {
+                    if ((bitmap[i] & (1 << bit)) != 0 && !transfer.Send(base + 8 * i + bit))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            transfer.Cursor = base + 8 * bitmap.size();
+            return true;
+        }
+
+        /**
+         * @brief Sends chunks selected by range
+         * @param transfer Transfer state
+         * @param offset Offset of first chunk relative to cursor
+         * @param count Number of chunks
+         * @return true if transfer can be continued
+         */
+        static bool SendRange(SelectiveTransfer& transfer, std::uint16_t offset, std::uint16_t count)
+        {
+            const auto first = transfer.Cursor + offset;
+
+            for (std::uint32_t seq = first; seq < first + count; seq++)
+            {
+                if (!transfer.Send(seq))
+                {
+                    return false;
+                }
+            }
+
+            transfer.Cursor = first + count;
+            return true;
+        }
+
+        SelectiveDownloadFileTelecommand::SelectiveDownloadFileTelecommand(
+            services::fs::IFileSystem& fs, const telecommunication::uplink::TelecommandCancellation& cancellation)
+            : _fs(fs), _cancellation(cancellation)
+        {
+        }
+
+        void SelectiveDownloadFileTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+
+            auto correlationId = r.ReadByte();
+            auto pathLengthAndFlags = r.ReadByte();
+            auto pathLength = pathLengthAndFlags & ~FileSender::CompressionFlag;
+            auto pathSpan = r.ReadArray(pathLength);
+            auto path = reinterpret_cast<const char*>(pathSpan.data());
+            auto terminationByte = r.ReadByte();
+            auto startSeq = r.ReadDoubleWordLE();
+
+            if (!r.Status() || terminationByte != 0)
+            {
+                LOG(LOG_LEVEL_ERROR, "Malformed request");
+                CorrelatedDownlinkFrame errorResponse(DownlinkAPID::FileSend, 0, correlationId);
+                errorResponse.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::MalformedRequest));
+                errorResponse.PayloadWriter().WriteByte(0);
+
+                transmitter.SendFrame(errorResponse.Frame());
+
+                return;
+            }
+
+            if (_fs.IsDirectory(path))
+            {
+                LOGF(LOG_LEVEL_ERROR, "Trying to retrieve directory %s", path);
+                CorrelatedDownlinkFrame errorResponse(DownlinkAPID::FileSend, 0, correlationId);
+                errorResponse.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::InvalidPath));
+                errorResponse.PayloadWriter().WriteByte(0);
+
+                transmitter.SendFrame(errorResponse.Frame());
+
+                return;
+            }
+
+            FileSender sender(path, correlationId, transmitter, this->_fs, FileSender::IsCompressionRequested(pathLengthAndFlags));
+
+            if (!sender.IsValid())
+            {
+                LOG(LOG_LEVEL_ERROR, "Unable to open requested file");
+                CorrelatedDownlinkFrame errorResponse(DownlinkAPID::FileSend, 0, correlationId);
+                errorResponse.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::FileNotFound));
+                errorResponse.PayloadWriter().WriteArray(pathSpan);
+
+                transmitter.SendFrame(errorResponse.Frame());
+
+                return;
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Sending selected parts of file %s from seq %ld", path, startSeq);
+
+            SelectiveTransfer transfer(sender, startSeq, this->_cancellation);
+
+            bool proceed = true;
+
+            while (proceed && r.RemainingSize() > 0)
+            {
+                auto selector = static_cast<Selector>(r.ReadByte());
+
+                if (selector == Selector::Bitmap)
+                {
+                    auto length = r.ReadByte();
+                    auto bitmap = r.ReadArray(length);
+
+                    proceed = r.Status() ? SendBitmap(transfer, bitmap)
+                                         : transfer.Stop(DownloadFileTelecommand::ErrorCode::MalformedRequest, transfer.Cursor);
+                }
+                else if (selector == Selector::Range)
+                {
+                    auto offset = r.ReadWordLE();
+                    auto count = r.ReadWordLE();
+
+                    proceed = r.Status() ? SendRange(transfer, offset, count)
+                                         : transfer.Stop(DownloadFileTelecommand::ErrorCode::MalformedRequest, transfer.Cursor);
+                }
+                else
+                {
+                    proceed = transfer.Stop(DownloadFileTelecommand::ErrorCode::MalformedRequest, transfer.Cursor);
+                }
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Sent %ld parts of file %s, resume at %ld", transfer.Sent, path, transfer.Cursor);
+
+            CorrelatedDownlinkFrame completion(DownlinkAPID::FileSendCompleted, 0, correlationId);
+            auto& writer = completion.PayloadWriter();
+            writer.WriteByte(num(transfer.Status));
+            writer.WriteDoubleWordLE(transfer.Sent);
+            writer.WriteDoubleWordLE(transfer.Cursor);
+            writer.WriteDoubleWordLE(sender.ChunksCount());
+
+            transmitter.SendFrame(completion.Frame());
+        }
+
+        /**
+         * @brief Sends single group of file parts followed by its repair frames
+         * @param sender File sender
+         * @param transmitter Transmitter
+         * @param correlationId Operation correlation id
+         * @param group Group number
+         * @param groupSize Number of file parts in group
+         * @param repairCount Number of repair frames
+         * @param sent Counter of sent frames
+         * @return Operation status
+         */
+        static DownloadFileTelecommand::ErrorCode SendGroup(FileSender& sender,
+            devices::comm::ITransmitter& transmitter,
+            std::uint8_t correlationId,
+            std::uint32_t group,
+            std::uint8_t groupSize,
+            std::uint8_t repairCount,
+            std::uint32_t& sent)
+        {
+            const auto first = group * groupSize;
+
+            if (first >= sender.ChunksCount())
+            {
+                return DownloadFileTelecommand::ErrorCode::TooBigSeq;
+            }
+
+            const auto end = std::min(first + groupSize, sender.ChunksCount());
+
+            std::array<std::uint8_t, FileSender::MaxFileDataSize> part;
+            std::array<std::uint8_t, FecDownloadFileTelecommand::MaxRepairFrames * FileSender::MaxFileDataSize> repairBuffer;
+
+            auto repairs = gsl::make_span(repairBuffer).subspan(0, repairCount * FileSender::MaxFileDataSize);
+            std::fill(repairs.begin(), repairs.end(), 0);
+
+            for (auto seq = first; seq < end; seq++)
+            {
+                auto data = sender.ReadPart(seq, part);
+
+                if (data.empty())
+                {
+                    return DownloadFileTelecommand::ErrorCode::SendFailed;
+                }
+
+                erasure::Encode(repairs, FileSender::MaxFileDataSize, static_cast<std::uint8_t>(seq - first), data);
+
+                CorrelatedDownlinkFrame response(DownlinkAPID::FileSend, seq, correlationId);
+                response.PayloadWriter().WriteByte(num(DownloadFileTelecommand::ErrorCode::Success));
+                response.PayloadWriter().WriteArray(data);
+
+                if (!transmitter.SendFrame(response.Frame()))
+                {
+                    return DownloadFileTelecommand::ErrorCode::SendFailed;
+                }
+
+                sent++;
+            }
+
+            for (std::uint8_t j = 0; j < repairCount; j++)
+            {
+                CorrelatedDownlinkFrame response(DownlinkAPID::FileRepair, group * repairCount + j, correlationId);
+                response.PayloadWriter().WriteByte(num(DownloadFileTelecommand::ErrorCode::Success));
+                response.PayloadWriter().WriteArray(repairs.subspan(j * FileSender::MaxFileDataSize, FileSender::MaxFileDataSize));
+
+                if (!transmitter.SendFrame(response.Frame()))
+                {
+                    return DownloadFileTelecommand::ErrorCode::SendFailed;
+                }
+
+                sent++;
+            }
+
+            return DownloadFileTelecommand::ErrorCode::Success;
+        }
+
+        FecDownloadFileTelecommand::FecDownloadFileTelecommand(
+            services::fs::IFileSystem& fs, const telecommunication::uplink::TelecommandCancellation& cancellation)
+            : _fs(fs), _cancellation(cancellation)
+        {
+        }
+
+        void FecDownloadFileTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            const auto token = this->_cancellation.Begin();
+
+            Reader r(parameters);
+
+            auto correlationId = r.ReadByte();
+            auto pathLength = r.ReadByte();
+            auto pathSpan = r.ReadArray(pathLength);
+            auto path = reinterpret_cast<const char*>(pathSpan.data());
+            auto terminationByte = r.ReadByte();
+            auto groupSize = r.ReadByte();
+            auto repairCount = r.ReadByte();
+
+            if (!r.Status() || terminationByte != 0 || groupSize == 0 || groupSize > MaxGroupSize || repairCount > MaxRepairFrames)
+            {
+                LOG(LOG_LEVEL_ERROR, "Malformed request");
+                CorrelatedDownlinkFrame errorResponse(DownlinkAPID::FileSend, 0, correlationId);
+                errorResponse.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::MalformedRequest));
+                errorResponse.PayloadWriter().WriteByte(0);
+
+                transmitter.SendFrame(errorResponse.Frame());
+
+                return;
+            }
+
+            if (_fs.IsDirectory(path))
+            {
+                LOGF(LOG_LEVEL_ERROR, "Trying to retrieve directory %s", path);
+                CorrelatedDownlinkFrame errorResponse(DownlinkAPID::FileSend, 0, correlationId);
+                errorResponse.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::InvalidPath));
+                errorResponse.PayloadWriter().WriteByte(0);
+
+                transmitter.SendFrame(errorResponse.Frame());
+
+                return;
+            }
+
+            FileSender sender(path, correlationId, transmitter, this->_fs, false);
+
+            if (!sender.IsValid())
+            {
+                LOG(LOG_LEVEL_ERROR, "Unable to open requested file");
+                CorrelatedDownlinkFrame errorResponse(DownlinkAPID::FileSend, 0, correlationId);
+                errorResponse.PayloadWriter().WriteByte(static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::FileNotFound));
+                errorResponse.PayloadWriter().WriteArray(pathSpan);
+
+                transmitter.SendFrame(errorResponse.Frame());
+
+                return;
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Sending file %s with %d repair frames per %d parts", path, repairCount, groupSize);
+
+            auto status = DownloadFileTelecommand::ErrorCode::Success;
+            std::uint32_t sent = 0;
+            std::uint32_t resume = 0;
+
+            while (status == DownloadFileTelecommand::ErrorCode::Success)
+            {
+                auto group = r.ReadDoubleWordLE();
+
+                if (!r.Status())
+                {
+                    break;
+                }
+
+                resume = group;
+
+                if (this->_cancellation.IsCancelled(token))
+                {
+                    status = DownloadFileTelecommand::ErrorCode::Aborted;
+                    break;
+                }
+
+                status = SendGroup(sender, transmitter, correlationId, group, groupSize, repairCount, sent);
+
+                if (status == DownloadFileTelecommand::ErrorCode::Success)
+                {
+                    resume = group + 1;
+                }
+            }
+
+            LOGF(LOG_LEVEL_INFO, "Sent %ld frames of file %s, resume at group %ld", sent, path, resume);
+
+            CorrelatedDownlinkFrame completion(DownlinkAPID::FileSendCompleted, 0, correlationId);
+            auto& writer = completion.PayloadWriter();
+            writer.WriteByte(num(status));
+            writer.WriteDoubleWordLE(sent);
+            writer.WriteDoubleWordLE(resume);
+            writer.WriteDoubleWordLE(sender.ChunksCount());
+
+            transmitter.SendFrame(completion.Frame());
+        }
+
+        AbortTransferTelecommand::AbortTransferTelecommand(telecommunication::uplink::TelecommandCancellation& cancellation)
+            : _cancellation(cancellation)
+        {
+        }
+
+        void AbortTransferTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+
+            auto correlationId = r.ReadByte();
+
+            CorrelatedDownlinkFrame response(DownlinkAPID::Operation, 0, correlationId);
+
+            if (!r.Status())
+            {
+                LOG(LOG_LEVEL_ERROR, "Malformed request");
+                response.PayloadWriter().WriteByte(num(telecommunication::downlink::DownlinkGenericResponse::MalformedRequest));
+                transmitter.SendFrame(response.Frame());
+                return;
+            }
+
+            LOG(LOG_LEVEL_INFO, "Aborting downloads");
+            this->_cancellation.Cancel();
+
+            response.PayloadWriter().WriteByte(num(telecommunication::downlink::DownlinkGenericResponse::Success));
+            transmitter.SendFrame(response.Frame());
+        }
+
         RemoveFileTelecommand::RemoveFileTelecommand(services::fs::IFileSystem& fs) : _fs(fs)
         {
         }
@@ -221,7 +752,8 @@ namespace obc
 
             bool moreFiles = true;
 
-            const char* name = this->_fs.ReadDirectory(dir.Result);
+            services::fs::DirectoryEntry entry;
+            bool hasEntry = this->_fs.ReadDirectoryWithStat(dir.Result, entry);
 
             std::uint32_t seq = 0;
 
@@ -233,27 +765,21 @@ namespace obc
 
                 while (true)
                 {
-                    if (name == nullptr)
+                    if (!hasEntry)
                     {
                         moreFiles = false;
                         break;
                     }
 
+                    const char* name = entry.Name;
+                    std::uint32_t size = entry.Size;
                     auto nameLen = strnlen(name, 90);
 
-                    if (name == LostFileName)
-                    {
-                        writer.WriteArray(gsl::make_span(reinterpret_cast<const uint8_t*>(name), nameLen));
-                        writer.WriteByte(0);
-                        writer.WriteDoubleWordLE(0);
-                        name = this->_fs.ReadDirectory(dir.Result);
-                        continue;
-                    }
-
                     if (name[nameLen] != '\0')
                     {
                         name = LostFileName;
                         nameLen = strlen(name);
+                        size = 0;
                     }
 
                     if (writer.RemainingSize() < static_cast<std::int32_t>(nameLen + 5))
@@ -261,16 +787,9 @@ namespace obc
 
                     writer.WriteArray(gsl::make_span(reinterpret_cast<const uint8_t*>(name), nameLen));
                     writer.WriteByte(0);
-                    if (name == LostFileName)
-                    {
-                        writer.WriteDoubleWordLE(0);
-                    }
-                    else
-                    {
-                        writer.WriteDoubleWordLE(this->_fs.GetFileSize(path, name));
-                    }
+                    writer.WriteDoubleWordLE(size);
 
-                    name = this->_fs.ReadDirectory(dir.Result);
+                    hasEntry = this->_fs.ReadDirectoryWithStat(dir.Result, entry);
                 }
 
                 transmitter.SendFrame(response.Frame());
@@ -3,6 +3,8 @@
 #include "base/os.h"
 #include "base/reader.h"
 #include "comm/ITransmitter.hpp"
+#include "fs/yaffs.h"
+#include "logger/logger.h"
 #include "power/power.h"
 #include "telecommunication/downlink.h"
 #include "telecommunication/telecommand_handling.h"
@@ -15,7 +17,8 @@ namespace obc
 {
     namespace telecommands
     {
-        PowerCycle::PowerCycle(services::power::IPowerControl& powerControl) : _powerControl(powerControl)
+        PowerCycle::PowerCycle(services::power::IPowerControl& powerControl, services::fs::IYaffsDeviceOperations& deviceOperations)
+            : _powerControl(powerControl), _deviceOperations(deviceOperations)
         {
         }
 
@@ -43,6 +46,12 @@ namespace obc
             }
 
             System::SleepTask(5s);
+
+            if (OS_RESULT_FAILED(this->_deviceOperations.Checkpoint()))
+            {
+                LOG(LOG_LEVEL_WARNING, "[power][tc] File system checkpoint failed, power cycling anyway");
+            }
+
             this->_powerControl.PowerCycle();
 
             {
@@ -0,0 +1,176 @@
+#include "statistics.hpp"
+#include <algorithm>
+#include "base/reader.h"
+#include "comm/ITransmitter.hpp"
+#include "telecommunication/downlink.h"
+
+namespace obc
+{
+    namespace telecommands
+    {
+        using devices::comm::ResponseCommand;
+        using telecommunication::downlink::CorrelatedDownlinkFrame;
+        using telecommunication::downlink::DownlinkAPID;
+        using telecommunication::downlink::DownlinkGenericResponse;
+        using telecommunication::uplink::ExecutionLane;
+        using telecommunication::uplink::TelecommandCodeCount;
+        using telecommunication::uplink::TelecommandStatisticsEntry;
+
+        /** @brief Size of single statistics entry in response frame */
+        static constexpr std::int32_t EntrySize = 7;
+
+        /**
+         * @brief Writes time as 16-bit number of milliseconds
+         * @param[in] writer Response writer
+         * @param[in] value Time to write, saturated at 0xFFFF ms
+         */
+        static void WriteMilliseconds(Writer& writer, std::chrono::milliseconds value)
+        {
+            const auto milliseconds = std::min<std::chrono::milliseconds::rep>(value.count(), 0xFFFF);
+            writer.WriteWordLE(static_cast<std::uint16_t>(milliseconds));
+        }
+
+        GetTelecommandStatisticsTelecommand::GetTelecommandStatisticsTelecommand(telecommunication::uplink::TelecommandStatistics& statistics)
+            : _statistics(statistics)
+        {
+        }
+
+        void GetTelecommandStatisticsTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+            auto correlationId = r.ReadByte();
+            auto firstCode = r.ReadByte();
+
+            CorrelatedDownlinkFrame frame(DownlinkAPID::TelecommandStatistics, 0, correlationId);
+            auto& writer = frame.PayloadWriter();
+
+            if (!r.Status())
+            {
+                writer.WriteByte(num(DownlinkGenericResponse::MalformedRequest));
+                transmitter.SendFrame(frame.Frame());
+                return;
+            }
+
+            writer.WriteByte(num(DownlinkGenericResponse::Success));
+
+            for (std::size_t code = firstCode; code < TelecommandCodeCount && writer.RemainingSize() >= EntrySize; code++)
+            {
+                const TelecommandStatisticsEntry entry = this->_statistics.Get(static_cast<std::uint8_t>(code));
+
+                if (entry.Invocations == 0 && entry.Failures == 0)
+                {
+                    continue;
+                }
+
+                writer.WriteByte(static_cast<std::uint8_t>(code));
+                writer.WriteWordLE(entry.Invocations);
+                writer.WriteWordLE(entry.Failures);
+                writer.WriteWordLE(entry.WorstExecutionTime);
+            }
+
+            transmitter.SendFrame(frame.Frame());
+        }
+
+        GetLinkStatisticsTelecommand::GetLinkStatisticsTelecommand(devices::comm::IReceiverPolling& polling,
+            devices::comm::ICommDiagnostics& diagnostics,
+            const telecommunication::uplink::TelecommandExecutor& executor,
+            const telecommunication::downlink::DownlinkScheduler& downlink)
+            : _polling(polling), _diagnostics(diagnostics), _executor(executor), _downlink(downlink)
+        {
+        }
+
+        void GetLinkStatisticsTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+            auto correlationId = r.ReadByte();
+
+            CorrelatedDownlinkFrame frame(DownlinkAPID::LinkStatistics, 0, correlationId);
+            auto& writer = frame.PayloadWriter();
+
+            if (!r.Status())
+            {
+                writer.WriteByte(num(DownlinkGenericResponse::MalformedRequest));
+                transmitter.SendFrame(frame.Frame());
+                return;
+            }
+
+            writer.WriteByte(num(DownlinkGenericResponse::Success));
+
+            const auto polling = this->_polling.GetPollingStatistics();
+            writer.WriteDoubleWordLE(polling.Polls);
+            writer.WriteDoubleWordLE(polling.FramePolls);
+            WriteMilliseconds(writer, polling.CurrentInterval);
+            WriteMilliseconds(writer, polling.LastLatency);
+            WriteMilliseconds(writer, polling.MaxLatency);
+            WriteMilliseconds(writer, polling.AverageLatency);
+
+            for (auto lane : {ExecutionLane::Fast, ExecutionLane::Normal})
+            {
+                const auto executor = this->_executor.Statistics(lane);
+                writer.WriteDoubleWordLE(executor.Executed);
+                writer.WriteDoubleWordLE(executor.Rejected);
+                writer.WriteByte(executor.Depth);
+                writer.WriteByte(executor.MaxDepth);
+                WriteMilliseconds(writer, executor.LastWait);
+                WriteMilliseconds(writer, executor.MaxWait);
+            }
+
+            writer.WriteDoubleWordLE(this->_diagnostics.GetAvoidedTransactions());
+
+            const auto downlink = this->_downlink.Statistics();
+            writer.WriteDoubleWordLE(downlink.Sent);
+            writer.WriteDoubleWordLE(downlink.Rejected);
+            writer.WriteDoubleWordLE(downlink.Dropped);
+            writer.WriteDoubleWordLE(downlink.Overflows);
+            writer.WriteDoubleWordLE(downlink.Packed);
+            writer.WriteByte(downlink.FreeSlots);
+
+            for (auto sent : downlink.SentPerBitrate)
+            {
+                writer.WriteDoubleWordLE(sent);
+            }
+
+            transmitter.SendFrame(frame.Frame());
+        }
+
+        GetTurnaroundStatisticsTelecommand::GetTurnaroundStatisticsTelecommand(devices::comm::ICommDiagnostics& diagnostics)
+            : _diagnostics(diagnostics)
+        {
+        }
+
+        void GetTurnaroundStatisticsTelecommand::Handle(devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+            auto correlationId = r.ReadByte();
+            auto command = r.ReadByte();
+
+            CorrelatedDownlinkFrame frame(DownlinkAPID::TurnaroundStatistics, 0, correlationId);
+            auto& writer = frame.PayloadWriter();
+
+            if (!r.Status() || command >= num(ResponseCommand::Count))
+            {
+                writer.WriteByte(num(DownlinkGenericResponse::MalformedRequest));
+                transmitter.SendFrame(frame.Frame());
+                return;
+            }
+
+            writer.WriteByte(num(DownlinkGenericResponse::Success));
+
+            const auto profiled = static_cast<ResponseCommand>(command);
+            WriteMilliseconds(writer, this->_diagnostics.GetMinimumTurnaround(profiled));
+
+            const auto statistics = this->_diagnostics.GetTurnaroundStatistics(profiled);
+            writer.WriteDoubleWordLE(statistics.Exchanges);
+            writer.WriteDoubleWordLE(statistics.Nacks);
+            writer.WriteDoubleWordLE(statistics.Failures);
+            WriteMilliseconds(writer, statistics.Longest);
+
+            for (auto bucket : statistics.Histogram)
+            {
+                writer.WriteDoubleWordLE(bucket);
+            }
+
+            transmitter.SendFrame(frame.Frame());
+        }
+    }
+}
@@ -0,0 +1,244 @@
+#include "telemetry.hpp"
+#include <algorithm>
+#include <array>
+#include "base/reader.h"
+#include "comm/ITransmitter.hpp"
+#include "fs/archive_index.hpp"
+#include "fs/yaffs.h"
+#include "logger/logger.h"
+#include "telecommunication/downlink.h"
+
+using telecommunication::downlink::CorrelatedDownlinkFrame;
+using telecommunication::downlink::DownlinkAPID;
+using services::fs::ArchiveIndex;
+using services::fs::File;
+
+namespace obc
+{
+    namespace telecommands
+    {
+        static_assert(telemetry::ArchiveRecordSize + 1 <= CorrelatedDownlinkFrame::MaxPayloadSize, "Telemetry record does not fit frame");
+
+        /**
+         * @brief Helper class tracking progress of telemetry range download
+         */
+        class RangeTransfer final
+        {
+          public:
+            /**
+             * @brief Ctor
+             * @param transmitter Transmitter
+             * @param correlationId Operation correlation id
+             * @param from Mission time of beginning of window
+             * @param to Mission time of end of window (inclusive)
+             * @param stride Number of records in window per sent record
+             * @param limit Maximal number of sent records
+             * @param cancellation Cancellation of long running telecommands
+             */
+            RangeTransfer(devices::comm::ITransmitter& transmitter,
+                std::uint8_t correlationId,
+                std::uint64_t from,
+                std::uint64_t to,
+                std::uint16_t stride,
+                std::uint16_t limit,
+                const telecommunication::uplink::TelecommandCancellation& cancellation)
+                : Status(DownloadTelemetryRangeTelecommand::ErrorCode::Success), Sent(0), LastTime(0), From(from),
+                  _transmitter(transmitter), _correlationId(correlationId), _to(to), _stride(std::max<std::uint16_t>(stride, 1)),
+                  _limit(limit), _matched(0), _cancellation(cancellation), _token(cancellation.Begin())
+            {
+            }
+
+            /**
+             * @brief Handles single record
+             * @param record Serialized telemetry record
+             * @return true if transfer can be continued
+             */
+            bool Handle(gsl::span<const std::uint8_t> record)
+            {
+                Reader r(record);
+                r.Skip(telemetry::ArchiveRecordTimeOffset);
+                const auto time = r.ReadQuadWordLE();
+
+                if (time < this->From)
+                {
+                    return true;
+                }
+
+                if (time > this->_to)
+                {
+                    return false;
+                }
+
+                if (this->_matched++ % this->_stride != 0)
+                {
+                    return true;
+                }
+
+                if (this->_cancellation.IsCancelled(this->_token))
+                {
+                    return this->Stop(DownloadTelemetryRangeTelecommand::ErrorCode::Aborted);
+                }
+
+                if (this->Sent == this->_limit)
+                {
+                    return this->Stop(DownloadTelemetryRangeTelecommand::ErrorCode::LimitReached);
+                }
+
+                CorrelatedDownlinkFrame response(DownlinkAPID::TelemetryRange, this->Sent, this->_correlationId);
+                response.PayloadWriter().WriteByte(num(DownloadTelemetryRangeTelecommand::ErrorCode::Success));
+                response.PayloadWriter().WriteArray(record);
+
+                if (!this->_transmitter.SendFrame(response.Frame()))
+                {
+                    return this->Stop(DownloadTelemetryRangeTelecommand::ErrorCode::SendFailed);
+                }
+
+                this->Sent++;
+                this->LastTime = time;
+                return true;
+            }
+
+            /**
+             * @brief Stops transfer
+             * @param status Transfer status
+             * @return Always false
+             */
+            bool Stop(DownloadTelemetryRangeTelecommand::ErrorCode status)
+            {
+                this->Status = status;
+                return false;
+            }
+
+            /** @brief Transfer status */
+            DownloadTelemetryRangeTelecommand::ErrorCode Status;
+            /** @brief Number of sent records */
+            std::uint32_t Sent;
+            /** @brief Mission time of last sent record */
+            std::uint64_t LastTime;
+            /** @brief Mission time of beginning of window */
+            const std::uint64_t From;
+
+          private:
+            /** @brief Transmitter */
+            devices::comm::ITransmitter& _transmitter;
+            /** @brief Operation correlation id */
+            const std::uint8_t _correlationId;
+            /** @brief Mission time of end of window */
+            const std::uint64_t _to;
+            /** @brief Number of records in window per sent record */
+            const std::uint16_t _stride;
+            /** @brief Maximal number of sent records */
+            const std::uint16_t _limit;
+            /** @brief Number of records in window seen so far */
+            std::uint32_t _matched;
+            /** @brief Cancellation of long running telecommands */
+            const telecommunication::uplink::TelecommandCancellation& _cancellation;
+            /** @brief Cancellation token taken at transfer start */
+            const telecommunication::uplink::TelecommandCancellation::Token _token;
+        };
+
+        /**
+         * @brief Sends records from window saved in single archive file
+         * @param fs File system
+         * @param path Path to archive file
+         * @param indexPath Path to index of archive file
+         * @param transfer Transfer state
+         * @return true if transfer can be continued with next archive file
+         */
+        static bool SendRecords(services::fs::IFileSystem& fs, const char* path, const char* indexPath, RangeTransfer& transfer)
+        {
+            File file(fs, path, services::fs::FileOpen::Existing, services::fs::FileAccess::ReadOnly);
+            if (!file)
+            {
+                return true;
+            }
+
+            const auto size = file.Size();
+            auto offset = ArchiveIndex::Find(fs, indexPath, transfer.From);
+            offset -= offset % telemetry::ArchiveRecordAlignment;
+
+            LOGF(LOG_LEVEL_INFO, "Searching telemetry in %s from offset %ld", path, offset);
+
+            std::array<std::uint8_t, telemetry::ArchiveRecordSize> record;
+
+            for (; offset + telemetry::ArchiveRecordSize <= size; offset += telemetry::ArchiveRecordAlignment)
+            {
+                const auto result = file.ReadAt(offset, record);
+                if (!result || result.Result.size() != static_cast<std::ptrdiff_t>(record.size()))
+                {
+                    return transfer.Stop(DownloadTelemetryRangeTelecommand::ErrorCode::ReadFailed);
+                }
+
+                if (!transfer.Handle(record))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        constexpr std::uint16_t DownloadTelemetryRangeTelecommand::DefaultRecordsLimit;
+
+        DownloadTelemetryRangeTelecommand::DownloadTelemetryRangeTelecommand(services::fs::IFileSystem& fs,
+            services::fs::IYaffsDeviceOperations& deviceOperations,
+            const telemetry::ArchiveFiles& files,
+            const telecommunication::uplink::TelecommandCancellation& cancellation)
+            : _fs(fs), _deviceOperations(deviceOperations), _files(files), _cancellation(cancellation)
+        {
+        }
+
+        void DownloadTelemetryRangeTelecommand::Handle(
+            devices::comm::ITransmitter& transmitter, gsl::span<const std::uint8_t> parameters)
+        {
+            Reader r(parameters);
+
+            auto correlationId = r.ReadByte();
+            auto from = r.ReadQuadWordLE();
+            auto to = r.ReadQuadWordLE();
+            std::uint16_t stride = (r.RemainingSize() > 0) ? r.ReadWordLE() : 1;
+            std::uint16_t limit = (r.RemainingSize() > 0) ? r.ReadWordLE() : 0;
+            if (limit == 0)
+            {
+                limit = DefaultRecordsLimit;
+            }
+
+            RangeTransfer transfer(transmitter, correlationId, from, to, stride, limit, this->_cancellation);
+
+            if (!r.Status() || from > to)
+            {
+                LOG(LOG_LEVEL_ERROR, "Malformed request");
+                transfer.Stop(ErrorCode::MalformedRequest);
+            }
+            else
+            {
+                LOGF(LOG_LEVEL_INFO,
+                    "Sending telemetry from %lu ms to %lu ms",
+                    static_cast<std::uint32_t>(from),
+                    static_cast<std::uint32_t>(to));
+
+                // records kept in RAM by archive writer would be missing from files
+                const auto flushResult = this->_deviceOperations.FlushWriter();
+                if (OS_RESULT_FAILED(flushResult))
+                {
+                    LOGF(LOG_LEVEL_WARNING, "Unable to flush buffered telemetry: %d", num(flushResult));
+                }
+
+                if (SendRecords(this->_fs, this->_files.previous, this->_files.previousIndex, transfer))
+                {
+                    SendRecords(this->_fs, this->_files.current, this->_files.currentIndex, transfer);
+                }
+
+                LOGF(LOG_LEVEL_INFO, "Sent %ld telemetry records", transfer.Sent);
+            }
+
+            CorrelatedDownlinkFrame completion(DownlinkAPID::TelemetryRangeCompleted, 0, correlationId);
+            auto& writer = completion.PayloadWriter();
+            writer.WriteByte(num(transfer.Status));
+            writer.WriteDoubleWordLE(transfer.Sent);
+            writer.WriteQuadWordLE(transfer.LastTime);
+
+            transmitter.SendFrame(completion.Frame());
+        }
+    }
+}
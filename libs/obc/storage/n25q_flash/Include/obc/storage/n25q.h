@@ -71,6 +71,18 @@ namespace obc
              */
             inline devices::n25q::RedundantN25QDriver& GetTopDriver();
 
+            /**
+             * @brief Integrity method of file system chunks
+             *
+             * Integrity method determines on-flash chunk layout (and @ref services::fs::ChunkDataSize), so file system
+             * formatted with one method cannot be mounted with the other. Switching method requires migration: files
+             * have to be downloaded or dropped and all chips erased before first mount with the new method.
+             */
+            static constexpr devices::n25q::ChunkIntegrity Integrity = devices::n25q::ChunkIntegrity::Redundancy;
+
+            static_assert(devices::n25q::DataBytesPerChunk(2_KB, Integrity) == services::fs::ChunkDataSize,
+                "File system chunk data size does not match flash layout");
+
           private:
             services::fs::IYaffsDeviceOperations& _deviceOperations;
 
@@ -80,6 +92,12 @@ namespace obc
 
             devices::n25q::RedundantN25QDriver _driver;
 
+            /** @brief Cache of recently used chunks */
+            devices::n25q::StaticChunkCache<4, 2_KB> _cache;
+
+            /** @brief Queue of sectors released by YAFFS erased in background */
+            devices::n25q::StaticBackgroundEraser<16> _eraser;
+
             devices::n25q::N25QYaffsDevice<devices::n25q::BlockMapping::Sector, 2_KB, 16_MB> Device;
         };
 
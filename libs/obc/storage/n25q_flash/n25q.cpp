@@ -1,6 +1,7 @@
 #include "n25q.h"
 #include "fs/fs.h"
 #include "gpio/gpio.h"
+#include "logger/logger.h"
 
 using obc::storage::N25QStorage;
 using devices::n25q::OperationResult;
@@ -25,7 +26,8 @@ N25QStorage::N25QStorage(                     //
           {errors, N25QDriver2::ErrorCounter::DeviceId, _spiSlaves[1]},        //
           {errors, N25QDriver3::ErrorCounter::DeviceId, _spiSlaves[2]}},       //
       _driver{errors, {&_n25qDrivers[0], &_n25qDrivers[1], &_n25qDrivers[2]}}, //
-      Device("/", _driver)                                                     //
+      _cache(devices::n25q::ChunkCacheMode::WriteThrough),                     //
+      Device("/", _driver, Integrity, &_cache, &_eraser)                       //
 {
 }
 
@@ -36,6 +38,13 @@ OSResult N25QStorage::Initialize()
         return OSResult::DeviceNotFound;
     }
 
+    auto result = this->_eraser.Initialize();
+    if (OS_RESULT_FAILED(result))
+    {
+        LOGF(LOG_LEVEL_ERROR, "[storage] Unable to start background eraser: %d", num(result));
+        return result;
+    }
+
     return this->Device.Mount(this->_deviceOperations);
 }
 
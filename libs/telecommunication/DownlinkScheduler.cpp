@@ -0,0 +1,376 @@
+#include "DownlinkScheduler.hpp"
+#include <algorithm>
+#include <cstring>
+#include "comm/Frame.hpp"
+#include "downlink.h"
+#include "logger/logger.h"
+
+using namespace std::chrono_literals;
+using devices::comm::Bitrate;
+using devices::comm::IBufferedTransmitter;
+using devices::comm::ITransmitter;
+
+namespace telecommunication
+{
+    namespace downlink
+    {
+        /** @brief Approximate number of bytes added to each frame by the transmitter (AX.25 header, CRC, flags) */
+        static constexpr std::uint16_t FrameOverhead = 20;
+
+        /** @brief Time to wait for free space in response queue */
+        static constexpr std::chrono::milliseconds ResponseEnqueueTimeout = 5s;
+
+        /** @brief Time to wait for free space in bulk data queue */
+        static constexpr std::chrono::milliseconds BulkEnqueueTimeout = 30s;
+
+        /** @brief Number of free slots value that indicates frame rejection */
+        static constexpr std::uint8_t FrameRejected = 0xFF;
+
+        constexpr std::uint8_t DownlinkScheduler::ResponseQueueLength;
+        constexpr std::uint8_t DownlinkScheduler::BulkQueueLength;
+        constexpr std::uint8_t DownlinkScheduler::MaxSendAttempts;
+        constexpr std::chrono::milliseconds DownlinkScheduler::PackingWindow;
+        constexpr std::chrono::milliseconds DownlinkScheduler::BitrateSelectionInterval;
+
+        std::uint8_t BitrateIndex(Bitrate bitrate)
+        {
+            switch (bitrate)
+            {
+                case Bitrate::Comm2400bps:
+                    return 1;
+                case Bitrate::Comm4800bps:
+                    return 2;
+                case Bitrate::Comm9600bps:
+                    return 3;
+                case Bitrate::Comm1200bps:
+                default:
+                    return 0;
+            }
+        }
+
+        DownlinkScheduler::DownlinkScheduler(IBufferedTransmitter& transmitter)
+            : _transmitter(transmitter),      //
+              _frameHandler(nullptr),         //
+              _bitrateSelector(nullptr),      //
+              _bitrate(Bitrate::Comm1200bps), //
+              _hasPending(false),             //
+              _sent(0),                       //
+              _rejected(0),                   //
+              _dropped(0),                    //
+              _overflows(0),                  //
+              _packed(0),                     //
+              _freeSlots(0),                  //
+              _sentPerBitrate{},              //
+              _task("Downlink", this, TaskEntry)
+        {
+        }
+
+        OSResult DownlinkScheduler::Initialize()
+        {
+            auto result = this->_beaconQueue.Create();
+            if (OS_RESULT_FAILED(result))
+            {
+                return result;
+            }
+
+            result = this->_responseQueue.Create();
+            if (OS_RESULT_FAILED(result))
+            {
+                return result;
+            }
+
+            result = this->_bulkQueue.Create();
+            if (OS_RESULT_FAILED(result))
+            {
+                return result;
+            }
+
+            result = this->_flags.Initialize();
+            if (OS_RESULT_FAILED(result))
+            {
+                return result;
+            }
+
+            return this->_task.Create();
+        }
+
+        bool DownlinkScheduler::SendFrame(gsl::span<const std::uint8_t> frame)
+        {
+            const auto priority = Classify(frame);
+            const auto timeout = priority == DownlinkPriority::Bulk ? BulkEnqueueTimeout : ResponseEnqueueTimeout;
+            return Enqueue(frame, priority, timeout);
+        }
+
+        bool DownlinkScheduler::Enqueue(gsl::span<const std::uint8_t> frame, DownlinkPriority priority, std::chrono::milliseconds timeout)
+        {
+            if (frame.size() > devices::comm::MaxDownlinkFrameSize)
+            {
+                LOGF(LOG_LEVEL_ERROR, "[downlink] Frame is too long: %d", static_cast<int>(frame.size()));
+                return false;
+            }
+
+            QueuedFrame element;
+            element.Size = static_cast<std::uint8_t>(frame.size());
+            std::copy(frame.begin(), frame.end(), element.Data.begin());
+
+            auto result = OSResult::Success;
+            switch (priority)
+            {
+                case DownlinkPriority::Beacon:
+                    this->_beaconQueue.Overwrite(element);
+                    break;
+
+                case DownlinkPriority::Response:
+                    result = this->_responseQueue.Push(element, timeout);
+                    break;
+
+                case DownlinkPriority::Bulk:
+                default:
+                    result = this->_bulkQueue.Push(element, timeout);
+                    break;
+            }
+
+            if (OS_RESULT_FAILED(result))
+            {
+                LOGF(LOG_LEVEL_ERROR, "[downlink] Unable to enqueue frame (priority %d)", num(priority));
+                this->_overflows++;
+                return false;
+            }
+
+            this->_flags.Set(FrameQueued);
+            return true;
+        }
+
+        bool DownlinkScheduler::GetTransmitterTelemetry(devices::comm::TransmitterTelemetry& telemetry)
+        {
+            return this->_transmitter.GetTransmitterTelemetry(telemetry);
+        }
+
+        bool DownlinkScheduler::SetTransmitterStateWhenIdle(devices::comm::IdleState requestedState)
+        {
+            return this->_transmitter.SetTransmitterStateWhenIdle(requestedState);
+        }
+
+        bool DownlinkScheduler::SetTransmitterBitRate(Bitrate bitrate)
+        {
+            const auto status = this->_transmitter.SetTransmitterBitRate(bitrate);
+            if (status)
+            {
+                this->_bitrate = bitrate;
+                if (this->_bitrateSelector != nullptr)
+                {
+                    this->_bitrateSelector->BitrateForced(bitrate);
+                }
+            }
+
+            return status;
+        }
+
+        bool DownlinkScheduler::ResetTransmitter()
+        {
+            return this->_transmitter.ResetTransmitter();
+        }
+
+        void DownlinkScheduler::HandleFrame(ITransmitter& /*transmitter*/, devices::comm::Frame& frame)
+        {
+            if (this->_frameHandler != nullptr)
+            {
+                this->_frameHandler->HandleFrame(*this, frame);
+            }
+        }
+
+        bool DownlinkScheduler::TransmitNext(std::chrono::milliseconds timeout)
+        {
+            QueuedFrame frame;
+            if (!Dequeue(frame))
+            {
+                this->_flags.WaitAny(FrameQueued, true, timeout);
+                if (!Dequeue(frame))
+                {
+                    SelectBitrate();
+                    return false;
+                }
+            }
+
+            const gsl::span<const std::uint8_t> contents(frame.Data.data(), frame.Size);
+            if (Classify(contents) == DownlinkPriority::Response && PackedDownlinkFrame::CanPack(contents))
+            {
+                Pack(frame);
+            }
+
+            SelectBitrate();
+            Transmit(frame);
+            return true;
+        }
+
+        DownlinkSchedulerStatistics DownlinkScheduler::Statistics() const
+        {
+            DownlinkSchedulerStatistics statistics;
+            statistics.Sent = this->_sent;
+            statistics.Rejected = this->_rejected;
+            statistics.Dropped = this->_dropped;
+            statistics.Overflows = this->_overflows;
+            statistics.Packed = this->_packed;
+            statistics.FreeSlots = this->_freeSlots;
+            for (std::uint8_t i = 0; i < BitrateCount; i++)
+            {
+                statistics.SentPerBitrate[i] = this->_sentPerBitrate[i];
+            }
+
+            return statistics;
+        }
+
+        std::chrono::milliseconds DownlinkScheduler::FrameAirtime(Bitrate bitrate)
+        {
+            const std::uint32_t bits = (devices::comm::MaxDownlinkFrameSize + FrameOverhead) * 8;
+            const std::uint32_t bitsPerSecond = num(bitrate) * 1200;
+            return std::chrono::milliseconds((bits * 1000 + bitsPerSecond - 1) / bitsPerSecond);
+        }
+
+        bool DownlinkScheduler::Dequeue(QueuedFrame& frame)
+        {
+            if (OS_RESULT_SUCCEEDED(this->_beaconQueue.Pop(frame, 0ms)))
+            {
+                return true;
+            }
+
+            if (this->_hasPending)
+            {
+                frame = this->_pending;
+                this->_hasPending = false;
+                return true;
+            }
+
+            return OS_RESULT_SUCCEEDED(this->_responseQueue.Pop(frame, 0ms)) //
+                || OS_RESULT_SUCCEEDED(this->_bulkQueue.Pop(frame, 0ms));
+        }
+
+        void DownlinkScheduler::Pack(QueuedFrame& frame)
+        {
+            PackedDownlinkFrame packed;
+            packed.Append(gsl::make_span(frame.Data.data(), frame.Size));
+
+            const auto deadline = System::GetUptime() + PackingWindow;
+
+            while (!this->_hasPending)
+            {
+                const auto now = System::GetUptime();
+                const auto timeout = now < deadline ? deadline - now : 0ms;
+
+                if (OS_RESULT_FAILED(this->_responseQueue.Pop(this->_pending, timeout)))
+                {
+                    break;
+                }
+
+                this->_hasPending = !packed.Append(gsl::make_span(this->_pending.Data.data(), this->_pending.Size));
+            }
+
+            if (packed.Count() < 2)
+            {
+                return;
+            }
+
+            const auto contents = packed.Frame();
+            frame.Size = static_cast<std::uint8_t>(contents.size());
+            std::copy(contents.begin(), contents.end(), frame.Data.begin());
+
+            this->_packed += packed.Count();
+        }
+
+        void DownlinkScheduler::SelectBitrate()
+        {
+            if (this->_bitrateSelector == nullptr)
+            {
+                return;
+            }
+
+            const Bitrate current = this->_bitrate;
+            const auto requested = this->_bitrateSelector->SelectBitrate(current);
+            if (requested == current)
+            {
+                return;
+            }
+
+            if (!this->_transmitter.SetTransmitterBitRate(requested))
+            {
+                LOGF(LOG_LEVEL_ERROR, "[downlink] Unable to switch bit rate to %d", num(requested));
+                return;
+            }
+
+            LOGF(LOG_LEVEL_INFO, "[downlink] Bit rate switched from %d to %d", num(current), num(requested));
+            this->_bitrate = requested;
+        }
+
+        void DownlinkScheduler::Transmit(const QueuedFrame& frame)
+        {
+            const gsl::span<const std::uint8_t> contents(frame.Data.data(), frame.Size);
+
+            for (std::uint8_t attempt = 0; attempt < MaxSendAttempts; attempt++)
+            {
+                std::uint8_t freeSlots = FrameRejected;
+                const auto status = this->_transmitter.SendFrame(contents, freeSlots);
+                if (status)
+                {
+                    this->_sent++;
+                    this->_sentPerBitrate[BitrateIndex(this->_bitrate)]++;
+                    this->_freeSlots = freeSlots;
+                    if (freeSlots == 0)
+                    {
+                        System::SleepTask(FrameAirtime(this->_bitrate));
+                    }
+
+                    return;
+                }
+
+                if (freeSlots != FrameRejected)
+                {
+                    break;
+                }
+
+                this->_rejected++;
+                this->_freeSlots = 0;
+                System::SleepTask(FrameAirtime(this->_bitrate));
+            }
+
+            LOG(LOG_LEVEL_ERROR, "[downlink] Dropping frame");
+            this->_dropped++;
+        }
+
+        DownlinkPriority DownlinkScheduler::Classify(gsl::span<const std::uint8_t> frame)
+        {
+            if (frame.empty())
+            {
+                return DownlinkPriority::Response;
+            }
+
+            if (frame[0] == BeaconMarker)
+            {
+                return DownlinkPriority::Beacon;
+            }
+
+            switch (static_cast<DownlinkAPID>(frame[0] & 0x3F))
+            {
+                case DownlinkAPID::FileSend:
+                case DownlinkAPID::FileSendCompleted:
+                case DownlinkAPID::TelemetryRange:
+                case DownlinkAPID::TelemetryRangeCompleted:
+                case DownlinkAPID::FileRepair:
+                case DownlinkAPID::MemoryContent:
+                case DownlinkAPID::PeriodicMessage:
+                    return DownlinkPriority::Bulk;
+
+                default:
+                    return DownlinkPriority::Response;
+            }
+        }
+
+        void DownlinkScheduler::TaskEntry(DownlinkScheduler* scheduler)
+        {
+            for (;;)
+            {
+                const auto timeout = scheduler->_bitrateSelector == nullptr ? InfiniteTimeout : BitrateSelectionInterval;
+                scheduler->TransmitNext(timeout);
+            }
+        }
+    }
+}
@@ -0,0 +1,26 @@
+#include "TelecommandCancellation.hpp"
+
+namespace telecommunication
+{
+    namespace uplink
+    {
+        TelecommandCancellation::TelecommandCancellation() : _requests(0)
+        {
+        }
+
+        TelecommandCancellation::Token TelecommandCancellation::Begin() const
+        {
+            return this->_requests.load();
+        }
+
+        bool TelecommandCancellation::IsCancelled(Token token) const
+        {
+            return this->_requests.load() != token;
+        }
+
+        void TelecommandCancellation::Cancel()
+        {
+            this->_requests++;
+        }
+    }
+}
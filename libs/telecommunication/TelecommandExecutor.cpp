@@ -0,0 +1,142 @@
+#include "TelecommandExecutor.hpp"
+#include <algorithm>
+#include "logger/logger.h"
+
+using namespace std::chrono_literals;
+using devices::comm::ITransmitter;
+
+namespace telecommunication
+{
+    namespace uplink
+    {
+        constexpr std::uint8_t TelecommandExecutor::FastLaneQueueLength;
+        constexpr std::uint8_t TelecommandExecutor::NormalLaneQueueLength;
+
+        TelecommandExecutor::TelecommandExecutor(gsl::span<const std::uint8_t> fastLaneCodes, TelecommandStatistics& telecommandStatistics)
+            : _fastLaneCodes(fastLaneCodes),                           //
+              _telecommandStatistics(telecommandStatistics),           //
+              _statistics{},                                           //
+              _fastLaneTask("TC fast lane", this, FastLaneEntry),      //
+              _normalLaneTask("TC normal lane", this, NormalLaneEntry) //
+        {
+        }
+
+        OSResult TelecommandExecutor::Initialize()
+        {
+            auto result = this->_fastLaneQueue.Create();
+            if (OS_RESULT_FAILED(result))
+            {
+                return result;
+            }
+
+            result = this->_normalLaneQueue.Create();
+            if (OS_RESULT_FAILED(result))
+            {
+                return result;
+            }
+
+            result = this->_fastLaneTask.Create();
+            if (OS_RESULT_FAILED(result))
+            {
+                return result;
+            }
+
+            return this->_normalLaneTask.Create();
+        }
+
+        void TelecommandExecutor::Execute(ITransmitter& transmitter, IHandleTeleCommand& telecommand, gsl::span<const std::uint8_t> parameters)
+        {
+            const auto code = telecommand.CommandCode();
+            if (parameters.size() > devices::comm::MaxUplinkFrameSize)
+            {
+                LOGF(LOG_LEVEL_ERROR, "[tc] Parameters of telecommand 0x%X are too long", code);
+                this->_telecommandStatistics.RecordFailure(code);
+                return;
+            }
+
+            Job job;
+            job.Transmitter = &transmitter;
+            job.Telecommand = &telecommand;
+            job.EnqueuedAt = System::GetUptime();
+            job.Size = static_cast<std::uint8_t>(parameters.size());
+            std::copy(parameters.begin(), parameters.end(), job.Parameters.begin());
+
+            const auto lane = LaneFor(code);
+            auto& statistics = this->_statistics[num(lane)];
+
+            {
+                CriticalSection cs;
+                statistics.Depth++;
+            }
+
+            const auto result = (lane == ExecutionLane::Fast) ? this->_fastLaneQueue.Push(job, 0ms) : this->_normalLaneQueue.Push(job, 0ms);
+            if (OS_RESULT_FAILED(result))
+            {
+                LOGF(LOG_LEVEL_ERROR, "[tc] Telecommand 0x%X rejected, queue is full", code);
+                this->_telecommandStatistics.RecordFailure(code);
+
+                CriticalSection cs;
+                statistics.Depth--;
+                statistics.Rejected++;
+                return;
+            }
+
+            CriticalSection cs;
+            statistics.MaxDepth = std::max(statistics.MaxDepth, statistics.Depth);
+        }
+
+        bool TelecommandExecutor::ExecuteNext(ExecutionLane lane, std::chrono::milliseconds timeout)
+        {
+            Job job;
+            const auto result = (lane == ExecutionLane::Fast) ? this->_fastLaneQueue.Pop(job, timeout) : this->_normalLaneQueue.Pop(job, timeout);
+            if (OS_RESULT_FAILED(result))
+            {
+                return false;
+            }
+
+            const auto wait = System::GetUptime() - job.EnqueuedAt;
+
+            {
+                CriticalSection cs;
+                auto& statistics = this->_statistics[num(lane)];
+                statistics.Depth--;
+                statistics.LastWait = wait;
+                statistics.MaxWait = std::max(statistics.MaxWait, wait);
+            }
+
+            this->_telecommandStatistics.Execute(*job.Transmitter, *job.Telecommand, gsl::make_span(job.Parameters.data(), job.Size));
+
+            CriticalSection cs;
+            this->_statistics[num(lane)].Executed++;
+            return true;
+        }
+
+        ExecutionLaneStatistics TelecommandExecutor::Statistics(ExecutionLane lane) const
+        {
+            CriticalSection cs;
+            return this->_statistics[num(lane)];
+        }
+
+        ExecutionLane TelecommandExecutor::LaneFor(std::uint8_t commandCode) const
+        {
+            const auto fast = std::find(this->_fastLaneCodes.begin(), this->_fastLaneCodes.end(), commandCode);
+            return fast != this->_fastLaneCodes.end() ? ExecutionLane::Fast : ExecutionLane::Normal;
+        }
+
+        void TelecommandExecutor::FastLaneEntry(TelecommandExecutor* executor)
+        {
+            for (;;)
+            {
+                executor->ExecuteNext(ExecutionLane::Fast, InfiniteTimeout);
+            }
+        }
+
+        void TelecommandExecutor::NormalLaneEntry(TelecommandExecutor* executor)
+        {
+            for (;;)
+            {
+                executor->ExecuteNext(ExecutionLane::Normal, InfiniteTimeout);
+            }
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#include "TelecommandStatistics.hpp"
+#include <algorithm>
+#include <limits>
+#include "base/os.h"
+#include "telecommand_handling.h"
+
+namespace telecommunication
+{
+    namespace uplink
+    {
+        /**
+         * @brief Increments counter without overflowing it.
+         * @param[in,out] counter Counter to increment
+         */
+        static void SaturatingIncrement(std::uint16_t& counter)
+        {
+            if (counter != std::numeric_limits<std::uint16_t>::max())
+            {
+                counter++;
+            }
+        }
+
+        TelecommandStatistics::TelecommandStatistics() : _entries{}
+        {
+        }
+
+        void TelecommandStatistics::Execute(
+            devices::comm::ITransmitter& transmitter, IHandleTeleCommand& telecommand, gsl::span<const std::uint8_t> parameters)
+        {
+            const auto start = System::GetUptime();
+            telecommand.Handle(transmitter, parameters);
+            RecordExecution(telecommand.CommandCode(), System::GetUptime() - start);
+        }
+
+        void TelecommandStatistics::RecordExecution(std::uint8_t code, std::chrono::milliseconds executionTime)
+        {
+            const auto time = static_cast<std::uint16_t>(
+                std::min<std::chrono::milliseconds::rep>(executionTime.count(), std::numeric_limits<std::uint16_t>::max()));
+
+            CriticalSection cs;
+            auto& entry = this->_entries[code];
+            SaturatingIncrement(entry.Invocations);
+            entry.WorstExecutionTime = std::max(entry.WorstExecutionTime, time);
+        }
+
+        void TelecommandStatistics::RecordFailure(std::uint8_t code)
+        {
+            CriticalSection cs;
+            SaturatingIncrement(this->_entries[code].Failures);
+        }
+
+        TelecommandStatisticsEntry TelecommandStatistics::Get(std::uint8_t code) const
+        {
+            CriticalSection cs;
+            return this->_entries[code];
+        }
+
+        TelecommandIndex BuildTelecommandIndex(gsl::span<IHandleTeleCommand* const> telecommands)
+        {
+            TelecommandIndex index{};
+
+            for (auto i = 0; i < std::min<int>(telecommands.size(), TelecommandCodeCount - 1); i++)
+            {
+                auto& slot = index.Slots[telecommands[i]->CommandCode()];
+                if (slot == 0)
+                {
+                    slot = static_cast<std::uint8_t>(i + 1);
+                }
+            }
+
+            return index;
+        }
+    }
+}
@@ -26,5 +26,47 @@ namespace telecommunication
         {
             PayloadWriter().WriteByte(correlationId);
         }
+
+        constexpr std::uint8_t PackedDownlinkFrame::RecordHeaderSize;
+
+        PackedDownlinkFrame::PackedDownlinkFrame() : DownlinkFrame(DownlinkAPID::Packed, 0), _count(0)
+        {
+        }
+
+        bool PackedDownlinkFrame::CanPack(gsl::span<const std::uint8_t> frame)
+        {
+            if (frame.size() < HeaderSize || frame[0] == BeaconMarker)
+            {
+                return false;
+            }
+
+            const auto apid = static_cast<DownlinkAPID>(frame[0] & 0x3F);
+            const bool firstFrame = (frame[0] & 0xC0) == 0 && frame[1] == 0 && frame[2] == 0;
+
+            return firstFrame && apid != DownlinkAPID::Packed && frame.size() - HeaderSize <= MaxPayloadSize - RecordHeaderSize;
+        }
+
+        bool PackedDownlinkFrame::Append(gsl::span<const std::uint8_t> frame)
+        {
+            if (!CanPack(frame))
+            {
+                return false;
+            }
+
+            auto payload = frame.subspan(HeaderSize);
+
+            auto& writer = PayloadWriter();
+            if (writer.RemainingSize() < RecordHeaderSize + payload.size())
+            {
+                return false;
+            }
+
+            writer.WriteByte(frame[0] & 0x3F);
+            writer.WriteByte(static_cast<std::uint8_t>(payload.size()));
+            writer.WriteArray(payload);
+
+            this->_count++;
+            return true;
+        }
     }
 }
@@ -0,0 +1,330 @@
+#ifndef LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_DOWNLINK_SCHEDULER_HPP
+#define LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_DOWNLINK_SCHEDULER_HPP
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "base/os.h"
+#include "comm/IHandleFrame.hpp"
+#include "comm/ITransmitter.hpp"
+#include "comm/comm.hpp"
+#include "gsl/span"
+
+namespace telecommunication
+{
+    namespace downlink
+    {
+        /**
+         * @ingroup telecomm_handling
+         * @{
+         */
+
+        /**
+         * @brief Priority of the downlink frame. Frames with lower value are sent first.
+         */
+        enum class DownlinkPriority : std::uint8_t
+        {
+            Beacon = 0,   //!< Beacon frame, only the most recent one is kept
+            Response = 1, //!< Telecommand response
+            Bulk = 2,     //!< Bulk data (file contents, telemetry records, memory dumps, periodic messages)
+        };
+
+        /** @brief Number of supported transmitter bit rates */
+        static constexpr std::uint8_t BitrateCount = 4;
+
+        /**
+         * @brief Returns position of the bit rate in the per bit rate arrays (0 for 1200bps up to 3 for 9600bps).
+         * @param[in] bitrate Transmitter bit rate.
+         * @return Bit rate index.
+         */
+        std::uint8_t BitrateIndex(devices::comm::Bitrate bitrate);
+
+        /**
+         * @brief Interface of the object that selects downlink bit rate.
+         */
+        struct IDownlinkBitrateSelector
+        {
+            /**
+             * @brief Selects bit rate that should be used for the next frame.
+             * @param[in] current Bit rate currently used by the transmitter.
+             * @return Requested bit rate.
+             * @remark Called by the scheduler task before each frame and periodically when there is nothing to send.
+             */
+            virtual devices::comm::Bitrate SelectBitrate(devices::comm::Bitrate current) = 0;
+
+            /**
+             * @brief Notifies selector that bit rate has been set explicitly (e.g. by telecommand).
+             * @param[in] bitrate Requested bit rate.
+             */
+            virtual void BitrateForced(devices::comm::Bitrate bitrate) = 0;
+        };
+
+        /**
+         * @brief Downlink scheduler statistics.
+         */
+        struct DownlinkSchedulerStatistics
+        {
+            /** @brief Number of frames accepted by the transmitter */
+            std::uint32_t Sent;
+
+            /** @brief Number of send attempts rejected by the transmitter due to full buffer */
+            std::uint32_t Rejected;
+
+            /** @brief Number of frames dropped after exhausting all send attempts */
+            std::uint32_t Dropped;
+
+            /** @brief Number of frames that could not be enqueued */
+            std::uint32_t Overflows;
+
+            /** @brief Number of responses sent inside packed frames */
+            std::uint32_t Packed;
+
+            /** @brief Number of free slots in transmitter's buffer reported with the last sent frame */
+            std::uint8_t FreeSlots;
+
+            /** @brief Number of frames accepted by the transmitter at each bit rate (see @ref BitrateIndex) */
+            std::array<std::uint32_t, BitrateCount> SentPerBitrate;
+        };
+
+        /**
+         * @brief Flow controlled downlink frame scheduler.
+         *
+         * Frames sent via this object are put into RAM queues (one per @ref DownlinkPriority) and transmitted
+         * by the background task. The task feeds the transmitter only as fast as its hardware buffer permits:
+         * when transmitter reports no free slots left the task waits for the time needed to transmit single frame
+         * at current bit rate before sending another one. Frames rejected by the transmitter are retried instead
+         * of being lost.
+         *
+         * Short single frame responses are coalesced into @ref PackedDownlinkFrame containers: after taking response
+         * that can be packed, the task keeps collecting further responses until container is full or
+         * @ref PackingWindow elapses. Container with single response is sent as the original frame.
+         *
+         * This object also acts as a frame handler proxy, so responses to the received telecommands
+         * are sent via the scheduler.
+         *
+         * When @ref IDownlinkBitrateSelector is attached, bit rate changes requested by it are applied by the task
+         * between frames, so every frame is paced and accounted at the bit rate it has been sent with.
+         */
+        class DownlinkScheduler final : public devices::comm::ITransmitter, public devices::comm::IHandleFrame
+        {
+          public:
+            /**
+             * @brief ctor.
+             * @param[in] transmitter Underlying transmitter
+             */
+            DownlinkScheduler(devices::comm::IBufferedTransmitter& transmitter);
+
+            /**
+             * @brief Initializes frame queues and starts background task.
+             * @return Operation status.
+             */
+            OSResult Initialize();
+
+            /**
+             * @brief Sets the handler that should process frames received via this object.
+             * @param[in] handler Reference to the frame handler.
+             */
+            void SetFrameHandler(devices::comm::IHandleFrame& handler);
+
+            /**
+             * @brief Attaches object that selects bit rate used for subsequent frames.
+             * @param[in] selector Reference to the bit rate selector.
+             */
+            void SetBitrateSelector(IDownlinkBitrateSelector& selector);
+
+            /**
+             * @brief Enqueues frame for transmission with priority deduced from its APID.
+             * @param[in] frame Buffer containing frame contents.
+             * @return Operation status, true if frame has been enqueued.
+             */
+            virtual bool SendFrame(gsl::span<const std::uint8_t> frame) final override;
+
+            /**
+             * @brief Enqueues frame for transmission.
+             * @param[in] frame Buffer containing frame contents.
+             * @param[in] priority Frame priority.
+             * @param[in] timeout Time to wait for free space in queue.
+             * @return Operation status, true if frame has been enqueued.
+             */
+            bool Enqueue(gsl::span<const std::uint8_t> frame, DownlinkPriority priority, std::chrono::milliseconds timeout);
+
+            virtual bool GetTransmitterTelemetry(devices::comm::TransmitterTelemetry& telemetry) final override;
+
+            virtual bool SetTransmitterStateWhenIdle(devices::comm::IdleState requestedState) final override;
+
+            /**
+             * @brief Set the transmitter baud rate.
+             *
+             * @param[in] bitrate New transmitter baud rate.
+             * @return Operation status, true in case of success, false otherwise.
+             * @remark New bit rate is used for pacing subsequent frames. Attached bit rate selector is notified
+             * about explicit bit rate change.
+             */
+            virtual bool SetTransmitterBitRate(devices::comm::Bitrate bitrate) final override;
+
+            virtual bool ResetTransmitter() final override;
+
+            virtual void HandleFrame(devices::comm::ITransmitter& transmitter, devices::comm::Frame& frame) final override;
+
+            /**
+             * @brief Transmits the highest priority frame waiting in the queues.
+             * @param[in] timeout Time to wait for frame to transmit.
+             * @return True if any frame has been processed, false otherwise.
+             */
+            bool TransmitNext(std::chrono::milliseconds timeout);
+
+            /**
+             * @brief Returns scheduler statistics.
+             * @return Scheduler statistics.
+             */
+            DownlinkSchedulerStatistics Statistics() const;
+
+            /**
+             * @brief Returns time needed to transmit single frame of maximal length.
+             * @param[in] bitrate Transmitter bit rate.
+             * @return Frame transmission time.
+             */
+            static std::chrono::milliseconds FrameAirtime(devices::comm::Bitrate bitrate);
+
+            /** @brief Capacity of response queue */
+            static constexpr std::uint8_t ResponseQueueLength = 6;
+
+            /** @brief Capacity of bulk data queue */
+            static constexpr std::uint8_t BulkQueueLength = 10;
+
+            /** @brief Number of attempts to send single frame */
+            static constexpr std::uint8_t MaxSendAttempts = 5;
+
+            /** @brief Time for which responses are collected into single packed frame */
+            static constexpr std::chrono::milliseconds PackingWindow{100};
+
+            /** @brief Maximal time between bit rate selections when there is nothing to send */
+            static constexpr std::chrono::milliseconds BitrateSelectionInterval{10000};
+
+          private:
+            /** @brief Frame waiting for transmission */
+            struct QueuedFrame
+            {
+                /** @brief Frame length */
+                std::uint8_t Size;
+
+                /** @brief Frame contents */
+                std::array<std::uint8_t, devices::comm::MaxDownlinkFrameSize> Data;
+            };
+
+            /** @brief Flags used to wake up background task */
+            enum TaskFlag
+            {
+                FrameQueued = 1
+            };
+
+            /**
+             * @brief Background task entry point.
+             * @param[in] scheduler Scheduler object.
+             */
+            static void TaskEntry(DownlinkScheduler* scheduler);
+
+            /**
+             * @brief Takes the highest priority frame from queues.
+             * @param[out] frame Frame object that should be filled
+             * @return True if any frame has been taken.
+             */
+            bool Dequeue(QueuedFrame& frame);
+
+            /**
+             * @brief Packs subsequent responses together with given one.
+             * @param[inout] frame First response. Replaced with packed frame if any other response has been packed.
+             */
+            void Pack(QueuedFrame& frame);
+
+            /**
+             * @brief Applies bit rate requested by attached selector.
+             */
+            void SelectBitrate();
+
+            /**
+             * @brief Passes frame to transmitter retrying when frame is rejected.
+             * @param[in] frame Frame to send
+             */
+            void Transmit(const QueuedFrame& frame);
+
+            /**
+             * @brief Returns priority deduced from frame header.
+             * @param[in] frame Frame contents
+             * @return Frame priority
+             */
+            static DownlinkPriority Classify(gsl::span<const std::uint8_t> frame);
+
+            /** @brief Underlying transmitter */
+            devices::comm::IBufferedTransmitter& _transmitter;
+
+            /** @brief Handler of the received frames */
+            devices::comm::IHandleFrame* _frameHandler;
+
+            /** @brief Bit rate selector */
+            IDownlinkBitrateSelector* _bitrateSelector;
+
+            /** @brief Current transmitter bit rate */
+            std::atomic<devices::comm::Bitrate> _bitrate;
+
+            /** @brief Most recent beacon frame */
+            Queue<QueuedFrame, 1> _beaconQueue;
+
+            /** @brief Telecommand responses */
+            Queue<QueuedFrame, ResponseQueueLength> _responseQueue;
+
+            /** @brief Bulk data frames */
+            Queue<QueuedFrame, BulkQueueLength> _bulkQueue;
+
+            /** @brief Flags used to wake up background task */
+            EventGroup _flags;
+
+            /** @brief Response taken from queue that did not fit into packed frame */
+            QueuedFrame _pending;
+
+            /** @brief Indicates whether @ref _pending holds frame */
+            bool _hasPending;
+
+            /** @brief Number of frames accepted by the transmitter */
+            std::atomic<std::uint32_t> _sent;
+
+            /** @brief Number of send attempts rejected by the transmitter */
+            std::atomic<std::uint32_t> _rejected;
+
+            /** @brief Number of frames dropped after exhausting all send attempts */
+            std::atomic<std::uint32_t> _dropped;
+
+            /** @brief Number of frames that could not be enqueued */
+            std::atomic<std::uint32_t> _overflows;
+
+            /** @brief Number of responses sent inside packed frames */
+            std::atomic<std::uint32_t> _packed;
+
+            /** @brief Number of free slots reported with the last sent frame */
+            std::atomic<std::uint8_t> _freeSlots;
+
+            /** @brief Number of frames accepted by the transmitter at each bit rate */
+            std::array<std::atomic<std::uint32_t>, BitrateCount> _sentPerBitrate;
+
+            /** @brief Background task */
+            Task<DownlinkScheduler*, 2_KB, TaskPriority::P4> _task;
+        };
+
+        inline void DownlinkScheduler::SetFrameHandler(devices::comm::IHandleFrame& handler)
+        {
+            this->_frameHandler = &handler;
+        }
+
+        inline void DownlinkScheduler::SetBitrateSelector(IDownlinkBitrateSelector& selector)
+        {
+            this->_bitrateSelector = &selector;
+        }
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_DOWNLINK_SCHEDULER_HPP */
@@ -0,0 +1,65 @@
+#ifndef LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_CANCELLATION_HPP
+#define LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_CANCELLATION_HPP
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace telecommunication
+{
+    namespace uplink
+    {
+        /**
+         * @ingroup telecomm_handling
+         * @{
+         */
+
+        /**
+         * @brief Cancellation of long running telecommands.
+         *
+         * Long running telecommand (e.g. file download) takes token when it starts and checks it before sending
+         * every frame. Cancel request stops all telecommands that are running at the time of the request,
+         * telecommands started afterwards are not affected.
+         *
+         * All methods are safe to be called from different tasks.
+         */
+        class TelecommandCancellation final
+        {
+          public:
+            /** @brief Token identifying cancellation requests issued before telecommand start */
+            using Token = std::uint32_t;
+
+            /**
+             * @brief ctor.
+             */
+            TelecommandCancellation();
+
+            /**
+             * @brief Returns token that should be held by starting telecommand.
+             * @return Cancellation token
+             */
+            Token Begin() const;
+
+            /**
+             * @brief Checks if cancellation has been requested since the token was taken.
+             * @param[in] token Token taken at telecommand start
+             * @return true if telecommand should stop
+             */
+            bool IsCancelled(Token token) const;
+
+            /**
+             * @brief Requests cancellation of all running telecommands.
+             */
+            void Cancel();
+
+          private:
+            /** @brief Number of cancellation requests */
+            std::atomic<std::uint32_t> _requests;
+        };
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_CANCELLATION_HPP */
@@ -0,0 +1,170 @@
+#ifndef LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_EXECUTOR_HPP
+#define LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_EXECUTOR_HPP
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include "base/os.h"
+#include "comm/comm.hpp"
+#include "gsl/span"
+#include "telecommand_handling.h"
+
+namespace telecommunication
+{
+    namespace uplink
+    {
+        /**
+         * @ingroup telecomm_handling
+         * @{
+         */
+
+        /**
+         * @brief Execution lane of the telecommand.
+         */
+        enum class ExecutionLane : std::uint8_t
+        {
+            Fast = 0,   //!< Short control commands
+            Normal = 1, //!< All other commands, including long running bulk data transfers
+        };
+
+        /**
+         * @brief Statistics of the single execution lane.
+         */
+        struct ExecutionLaneStatistics
+        {
+            /** @brief Number of executed telecommands */
+            std::uint32_t Executed;
+
+            /** @brief Number of telecommands rejected due to full queue */
+            std::uint32_t Rejected;
+
+            /** @brief Number of telecommands currently waiting for execution */
+            std::uint8_t Depth;
+
+            /** @brief Maximal number of telecommands waiting for execution */
+            std::uint8_t MaxDepth;
+
+            /** @brief Time the last telecommand waited for execution */
+            std::chrono::milliseconds LastWait;
+
+            /** @brief Longest time a telecommand waited for execution */
+            std::chrono::milliseconds MaxWait;
+        };
+
+        /**
+         * @brief Asynchronous telecommand executor.
+         *
+         * Dispatched telecommands are copied into bounded queues and run by the worker tasks so that
+         * the comm task can return to receiving frames immediately. Telecommands whose codes are listed
+         * as fast lane ones are run by separate worker so they are not blocked by long running telecommands
+         * like file download. Telecommands in each lane are executed in the order of reception.
+         */
+        class TelecommandExecutor final : public IExecuteTelecommand
+        {
+          public:
+            /**
+             * @brief ctor.
+             * @param[in] fastLaneCodes Codes of telecommands that should be executed in fast lane.
+             * @param[in] telecommandStatistics Per telecommand execution statistics
+             */
+            TelecommandExecutor(gsl::span<const std::uint8_t> fastLaneCodes, TelecommandStatistics& telecommandStatistics);
+
+            /**
+             * @brief Initializes queues and starts worker tasks.
+             * @return Operation status.
+             */
+            OSResult Initialize();
+
+            virtual void Execute(devices::comm::ITransmitter& transmitter,
+                IHandleTeleCommand& telecommand,
+                gsl::span<const std::uint8_t> parameters) final override;
+
+            /**
+             * @brief Runs the oldest telecommand waiting in the requested lane.
+             * @param[in] lane Execution lane
+             * @param[in] timeout Time to wait for telecommand
+             * @return True if telecommand has been executed, false otherwise.
+             */
+            bool ExecuteNext(ExecutionLane lane, std::chrono::milliseconds timeout);
+
+            /**
+             * @brief Returns statistics of requested execution lane.
+             * @param[in] lane Execution lane
+             * @return Lane statistics.
+             */
+            ExecutionLaneStatistics Statistics(ExecutionLane lane) const;
+
+            /**
+             * @brief Returns execution lane for telecommand.
+             * @param[in] commandCode Telecommand code
+             * @return Execution lane
+             */
+            ExecutionLane LaneFor(std::uint8_t commandCode) const;
+
+            /** @brief Capacity of the fast lane queue */
+            static constexpr std::uint8_t FastLaneQueueLength = 4;
+
+            /** @brief Capacity of the normal lane queue */
+            static constexpr std::uint8_t NormalLaneQueueLength = 4;
+
+          private:
+            /** @brief Telecommand waiting for execution */
+            struct Job
+            {
+                /** @brief Transmitter used to send response */
+                devices::comm::ITransmitter* Transmitter;
+
+                /** @brief Telecommand handler */
+                IHandleTeleCommand* Telecommand;
+
+                /** @brief Uptime at which telecommand has been enqueued */
+                std::chrono::milliseconds EnqueuedAt;
+
+                /** @brief Parameters length */
+                std::uint8_t Size;
+
+                /** @brief Parameters buffer */
+                std::array<std::uint8_t, devices::comm::MaxUplinkFrameSize> Parameters;
+            };
+
+            /**
+             * @brief Fast lane worker entry point.
+             * @param[in] executor Executor object
+             */
+            static void FastLaneEntry(TelecommandExecutor* executor);
+
+            /**
+             * @brief Normal lane worker entry point.
+             * @param[in] executor Executor object
+             */
+            static void NormalLaneEntry(TelecommandExecutor* executor);
+
+            /** @brief Codes of fast lane telecommands */
+            gsl::span<const std::uint8_t> _fastLaneCodes;
+
+            /** @brief Per telecommand execution statistics */
+            TelecommandStatistics& _telecommandStatistics;
+
+            /** @brief Fast lane queue */
+            Queue<Job, FastLaneQueueLength> _fastLaneQueue;
+
+            /** @brief Normal lane queue */
+            Queue<Job, NormalLaneQueueLength> _normalLaneQueue;
+
+            /** @brief Lane statistics */
+            std::array<ExecutionLaneStatistics, 2> _statistics;
+
+            /** @brief Fast lane worker */
+            Task<TelecommandExecutor*, 4_KB, TaskPriority::P4> _fastLaneTask;
+
+            /** @brief Normal lane worker */
+            Task<TelecommandExecutor*, 6_KB, TaskPriority::P4> _normalLaneTask;
+        };
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_EXECUTOR_HPP */
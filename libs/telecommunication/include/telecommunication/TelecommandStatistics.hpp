@@ -0,0 +1,130 @@
+#ifndef LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_STATISTICS_HPP
+#define LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_STATISTICS_HPP
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include "comm/comm.hpp"
+#include "gsl/span"
+
+namespace telecommunication
+{
+    namespace uplink
+    {
+        struct IHandleTeleCommand;
+
+        /**
+         * @ingroup telecomm_handling
+         * @{
+         */
+
+        /** @brief Number of possible telecommand codes */
+        constexpr std::size_t TelecommandCodeCount = 256;
+
+        /**
+         * @brief Statistics of single telecommand
+         */
+        struct TelecommandStatisticsEntry
+        {
+            /** @brief Number of handler invocations (saturated) */
+            std::uint16_t Invocations;
+
+            /** @brief Number of times the telecommand could not be run (saturated) */
+            std::uint16_t Failures;
+
+            /** @brief Longest handler execution time in milliseconds (saturated) */
+            std::uint16_t WorstExecutionTime;
+        };
+
+        /**
+         * @brief Per telecommand code execution statistics.
+         *
+         * All methods are safe to be called from different tasks.
+         */
+        class TelecommandStatistics final
+        {
+          public:
+            /**
+             * @brief ctor.
+             */
+            TelecommandStatistics();
+
+            /**
+             * @brief Runs telecommand handler and records its execution time.
+             * @param[in] transmitter Reference to object that can be used to send response back
+             * @param[in] telecommand Telecommand handler
+             * @param[in] parameters Parameters contained in telecommand frame
+             */
+            void Execute(devices::comm::ITransmitter& transmitter, IHandleTeleCommand& telecommand, gsl::span<const std::uint8_t> parameters);
+
+            /**
+             * @brief Records single telecommand execution.
+             * @param[in] code Telecommand code
+             * @param[in] executionTime Handler execution time
+             */
+            void RecordExecution(std::uint8_t code, std::chrono::milliseconds executionTime);
+
+            /**
+             * @brief Records telecommand that could not be run.
+             * @param[in] code Telecommand code
+             */
+            void RecordFailure(std::uint8_t code);
+
+            /**
+             * @brief Returns statistics of single telecommand.
+             * @param[in] code Telecommand code
+             * @return Telecommand statistics
+             */
+            TelecommandStatisticsEntry Get(std::uint8_t code) const;
+
+          private:
+            /** @brief Statistics indexed by telecommand code */
+            std::array<TelecommandStatisticsEntry, TelecommandCodeCount> _entries;
+        };
+
+        /**
+         * @brief Dense index that maps telecommand code to the position of its handler.
+         *
+         * Slots contain one-based handler positions, zero denotes code without handler.
+         */
+        struct TelecommandIndex
+        {
+            /** @brief Handler positions indexed by telecommand code */
+            std::uint8_t Slots[TelecommandCodeCount];
+        };
+
+        /**
+         * @brief Builds telecommand index at compile time.
+         * @tparam Codes Telecommand codes in order of handlers
+         * @return Telecommand index
+         */
+        template <std::uint8_t... Codes> constexpr TelecommandIndex BuildTelecommandIndex()
+        {
+            static_assert(sizeof...(Codes) < TelecommandCodeCount, "Too many telecommands");
+
+            TelecommandIndex index{};
+            const std::uint8_t codes[] = {Codes..., 0};
+
+            for (std::size_t i = 0; i < sizeof...(Codes); i++)
+            {
+                index.Slots[codes[i]] = static_cast<std::uint8_t>(i + 1);
+            }
+
+            return index;
+        }
+
+        /**
+         * @brief Builds telecommand index at runtime.
+         * @param[in] telecommands Telecommand handlers
+         * @return Telecommand index
+         * @remark When codes are duplicated the first handler wins.
+         */
+        TelecommandIndex BuildTelecommandIndex(gsl::span<IHandleTeleCommand* const> telecommands);
+
+        /** @} */
+    }
+}
+
+#endif /* LIBS_TELECOMMUNICATION_INCLUDE_TELECOMMUNICATION_TELECOMMAND_STATISTICS_HPP */
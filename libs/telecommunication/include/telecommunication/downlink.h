@@ -63,6 +63,14 @@ namespace telecommunication
             MemoryContent = 0x21,              //!< Memory contents
             BeaconError = 0x22,                //!< Beacon Error
             DisableAntennaDeployment = 0x23,   //!< Disable automatic antenna deployment
+            TelecommandStatistics = 0x24,      //!< Per telecommand execution statistics
+            FileSendCompleted = 0x25,          //!< Completion of selective file download
+            FileRepair = 0x26,                 //!< Erasure coded repair frame of file download
+            Packed = 0x27,                     //!< Several short responses packed into single frame
+            TelemetryRange = 0x28,             //!< Telemetry record from requested time window
+            TelemetryRangeCompleted = 0x29,    //!< Completion of telemetry time window download
+            LinkStatistics = 0x2A,             //!< Statistics of the communication link
+            TurnaroundStatistics = 0x2B,       //!< Turnaround statistics of comm hardware command
             Telemetry = 0x3F,                  //!< TelemetryLong
             LastItem                           //!< LastItem
         };
@@ -184,6 +192,57 @@ namespace telecommunication
             static constexpr std::uint8_t MaxPayloadSize = DownlinkFrame::MaxPayloadSize - 1;
         };
 
+        /**
+         * @brief Container frame carrying several short responses
+         *
+         * Payload of container consists of records, each one describing single packed frame:
+         *  - 8-bit - APID of packed frame
+         *  - 8-bit - Length of packed frame payload
+         *  - Payload of packed frame
+         *
+         * Only frames with sequence number 0 (single frame responses) can be packed.
+         */
+        class PackedDownlinkFrame final : public DownlinkFrame
+        {
+          public:
+            /**
+             * @brief Initializes new empty @ref PackedDownlinkFrame instance
+             */
+            PackedDownlinkFrame();
+
+            /**
+             * @brief Checks whether frame can be put into container
+             * @param frame Complete downlink frame (with header)
+             * @return true if frame can be packed
+             */
+            static bool CanPack(gsl::span<const std::uint8_t> frame);
+
+            /**
+             * @brief Appends frame to container
+             * @param frame Complete downlink frame (with header)
+             * @return true if frame has been appended, false if it cannot be packed or there is no room left
+             */
+            bool Append(gsl::span<const std::uint8_t> frame);
+
+            /**
+             * @brief Returns number of packed frames
+             * @return Number of packed frames
+             */
+            std::uint8_t Count() const;
+
+            /** @brief Size of record header */
+            static constexpr std::uint8_t RecordHeaderSize = 2;
+
+          private:
+            /** @brief Number of packed frames */
+            std::uint8_t _count;
+        };
+
+        inline std::uint8_t PackedDownlinkFrame::Count() const
+        {
+            return this->_count;
+        }
+
         /** @} */
     }
 }
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <gsl/span>
+#include "TelecommandStatistics.hpp"
 #include "comm/IHandleFrame.hpp"
 
 namespace telecommunication
@@ -125,6 +126,23 @@ namespace telecommunication
             return TCode;
         }
 
+        /**
+         * @brief Interface for objects responsible for running telecommand handlers
+         */
+        struct IExecuteTelecommand
+        {
+            /**
+             * @brief Runs (or schedules running of) the telecommand handler.
+             * @param[in] transmitter Reference to object that can be used to send response back
+             * @param[in] telecommand Telecommand handler
+             * @param[in] parameters Parameters contained in telecommand frame
+             * @remark Parameters buffer is valid only during this call.
+             */
+            virtual void Execute(devices::comm::ITransmitter& transmitter,
+                IHandleTeleCommand& telecommand,
+                gsl::span<const std::uint8_t> parameters) = 0;
+        };
+
         /**
          * @brief Incoming frame handler that is capable of decoding them and dispatching telecommands
          */
@@ -135,8 +153,13 @@ namespace telecommunication
              * @brief Constructs \ref IncomingTelecommandHandler object
              * @param[in] decodeTelecommand Telecommand decoding implementation
              * @param[in] telecommands Array of pointers to telecommands
+             * @param[in] index Index mapping telecommand codes to positions in telecommands array
+             * @param[in] statistics Telecommand statistics
              */
-            IncomingTelecommandHandler(IDecodeTelecommand& decodeTelecommand, gsl::span<IHandleTeleCommand*> telecommands);
+            IncomingTelecommandHandler(IDecodeTelecommand& decodeTelecommand,
+                gsl::span<IHandleTeleCommand*> telecommands,
+                const TelecommandIndex& index,
+                TelecommandStatistics& statistics);
 
             /**
              * @brief Handles incoming frame and dispatches (if possible) telecommand
@@ -145,6 +168,13 @@ namespace telecommunication
              */
             virtual void HandleFrame(devices::comm::ITransmitter& transmitter, devices::comm::Frame& frame) override;
 
+            /**
+             * @brief Sets the object that should run dispatched telecommand handlers.
+             * @param[in] executor Telecommand executor
+             * @remark When no executor is set telecommand handlers are run inline.
+             */
+            void SetExecutor(IExecuteTelecommand& executor);
+
           private:
             /**
              * @brief Dispatches telecommand handler
@@ -159,6 +189,12 @@ namespace telecommunication
             IDecodeTelecommand& _decodeTelecommand;
             /** @brief Array of pointers to telecommands */
             gsl::span<IHandleTeleCommand*> _telecommands;
+            /** @brief Index mapping telecommand codes to positions in telecommands array */
+            const TelecommandIndex& _index;
+            /** @brief Telecommand statistics */
+            TelecommandStatistics& _statistics;
+            /** @brief Telecommand executor */
+            IExecuteTelecommand* _executor;
         };
     }
 }
@@ -1,7 +1,6 @@
 #include "telecommand_handling.h"
 #include <stdalign.h>
 #include <stdint.h>
-#include <algorithm>
 #include <array>
 #include "comm/Frame.hpp"
 #include "logger/logger.h"
@@ -17,12 +16,23 @@ using devices::comm::ITransmitter;
 
 using namespace telecommunication::uplink;
 
-IncomingTelecommandHandler::IncomingTelecommandHandler(IDecodeTelecommand& decodeTelecommand, span<IHandleTeleCommand*> telecommands)
+IncomingTelecommandHandler::IncomingTelecommandHandler(IDecodeTelecommand& decodeTelecommand,
+    span<IHandleTeleCommand*> telecommands,
+    const TelecommandIndex& index,
+    TelecommandStatistics& statistics)
     : _decodeTelecommand(decodeTelecommand), //
-      _telecommands(telecommands)
+      _telecommands(telecommands),           //
+      _index(index),                         //
+      _statistics(statistics),               //
+      _executor(nullptr)
 {
 }
 
+void IncomingTelecommandHandler::SetExecutor(IExecuteTelecommand& executor)
+{
+    this->_executor = &executor;
+}
+
 void IncomingTelecommandHandler::HandleFrame(ITransmitter& transmitter, Frame& frame)
 {
     auto decodeResult = this->_decodeTelecommand.Decode(frame.Payload());
@@ -38,17 +48,25 @@ void IncomingTelecommandHandler::HandleFrame(ITransmitter& transmitter, Frame& f
 
 void IncomingTelecommandHandler::DispatchCommandHandler(ITransmitter& transmitter, uint8_t commandCode, span<const uint8_t> parameters)
 {
-    auto command = std::find_if(this->_telecommands.begin(), this->_telecommands.end(), [commandCode](IHandleTeleCommand* p) {
-        return p->CommandCode() == commandCode;
-    });
+    const auto slot = this->_index.Slots[commandCode];
 
-    if (command == this->_telecommands.end())
+    if (slot == 0 || slot > this->_telecommands.size())
     {
+        this->_statistics.RecordFailure(commandCode);
         LOGF(LOG_LEVEL_ERROR, "No telecommand handler for code 0x%X", commandCode);
         return;
     }
 
-    (*command)->Handle(transmitter, parameters);
+    auto command = this->_telecommands[slot - 1];
+
+    if (this->_executor != nullptr)
+    {
+        this->_executor->Execute(transmitter, *command, parameters);
+    }
+    else
+    {
+        this->_statistics.Execute(transmitter, *command, parameters);
+    }
 }
 
 DecodeTelecommandResult::DecodeTelecommandResult(DecodeTelecommandFailureReason reason)
@@ -0,0 +1,47 @@
+#include "telemetry/FileSystemTelemetry.hpp"
+#include <algorithm>
+#include "base/BitWriter.hpp"
+
+namespace telemetry
+{
+    FileSystemTelemetry::FileSystemTelemetry()
+        : freeSpace(0), cacheHits(0), cacheMisses(0), cacheEvictions(0), pendingErases(0), longestEraseStall(0)
+    {
+    }
+
+    FileSystemTelemetry::FileSystemTelemetry(std::uint32_t freeSpace,
+        std::uint32_t cacheHits,
+        std::uint32_t cacheMisses,
+        std::uint32_t cacheEvictions,
+        std::uint16_t pendingErases,
+        std::chrono::milliseconds longestEraseStall) //
+        : freeSpace(freeSpace),
+          cacheHits(cacheHits),
+          cacheMisses(cacheMisses),
+          cacheEvictions(cacheEvictions),
+          pendingErases(pendingErases),
+          longestEraseStall(longestEraseStall)
+    {
+    }
+
+    std::uint8_t FileSystemTelemetry::CacheHitRate() const
+    {
+        const std::uint64_t reads = static_cast<std::uint64_t>(this->cacheHits) + this->cacheMisses;
+        if (reads == 0)
+        {
+            return 0;
+        }
+
+        return static_cast<std::uint8_t>(this->cacheHits * 100ull / reads);
+    }
+
+    void FileSystemTelemetry::Write(BitWriter& writer) const
+    {
+        writer.WriteDoubleWord(std::min<std::uint32_t>(this->freeSpace, 0xFFFFFF), 24);
+        writer.Write(CacheHitRate());
+        writer.WriteWord(std::min<std::uint16_t>(this->pendingErases, 15), 4);
+
+        const auto stall = std::min<std::chrono::milliseconds::rep>(this->longestEraseStall.count() / 250, 15);
+        writer.WriteWord(static_cast<std::uint16_t>(stall), 4);
+    }
+}
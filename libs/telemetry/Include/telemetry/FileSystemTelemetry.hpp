@@ -0,0 +1,155 @@
+#ifndef LIBS_TELEMETRY_INCLUDE_TELEMETRY_FILESYSTEMTELEMETRY_HPP_
+#define LIBS_TELEMETRY_INCLUDE_TELEMETRY_FILESYSTEMTELEMETRY_HPP_
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include "base/fwd.hpp"
+
+namespace telemetry
+{
+    /**
+     * @brief This type represents telemetry element related file system state.
+     * @telemetry_element
+     * @ingroup telemetry
+     *
+     * Chunk cache counters are accumulated since boot. Only hit rate (in percent) is serialized.
+     *
+     * Free space is serialized on 24 bits, which covers whole 16MB file system. Background erase queue depth
+     * (saturated at 15) and longest time file system waited for erase since boot (in 250ms units, saturated at 15)
+     * are serialized on 4 bits each.
+     */
+    class FileSystemTelemetry
+    {
+      public:
+        /** @brief ctor. */
+        FileSystemTelemetry();
+
+        /**
+         * @brief ctor.
+         * @param[in] freeSpace Free space in bytes
+         * @param[in] cacheHits Number of chunk reads served by cache
+         * @param[in] cacheMisses Number of chunk reads that required memory read
+         * @param[in] cacheEvictions Number of chunks replaced in cache
+         * @param[in] pendingErases Number of blocks waiting for background erase
+         * @param[in] longestEraseStall Longest time file system waited for erase
+         */
+        FileSystemTelemetry(std::uint32_t freeSpace,
+            std::uint32_t cacheHits,
+            std::uint32_t cacheMisses,
+            std::uint32_t cacheEvictions,
+            std::uint16_t pendingErases,
+            std::chrono::milliseconds longestEraseStall);
+
+        /**
+         * @brief Returns free space.
+         * @return Free space in bytes.
+         */
+        std::uint32_t FreeSpace() const;
+
+        /**
+         * @brief Returns number of chunk cache hits.
+         * @return Number of chunk reads served by cache.
+         */
+        std::uint32_t CacheHits() const;
+
+        /**
+         * @brief Returns number of chunk cache misses.
+         * @return Number of chunk reads that required memory read.
+         */
+        std::uint32_t CacheMisses() const;
+
+        /**
+         * @brief Returns number of chunk cache evictions.
+         * @return Number of chunks replaced in cache.
+         */
+        std::uint32_t CacheEvictions() const;
+
+        /**
+         * @brief Returns chunk cache hit rate.
+         * @return Percent of chunk reads served by cache (0 if there were no reads).
+         */
+        std::uint8_t CacheHitRate() const;
+
+        /**
+         * @brief Returns number of blocks waiting for background erase.
+         * @return Erase queue depth.
+         */
+        std::uint16_t PendingErases() const;
+
+        /**
+         * @brief Returns longest time file system waited for erase.
+         * @return Longest erase stall.
+         */
+        std::chrono::milliseconds LongestEraseStall() const;
+
+        /**
+         * @brief Write the object to passed buffer writer object.
+         * @param[in] writer Buffer writer object that should be used to write the serialized state.
+         */
+        void Write(BitWriter& writer) const;
+
+        /**
+         * @brief Returns size of the serialized state in bits.
+         * @return Size of the serialized state in bits.
+         */
+        static constexpr std::uint32_t BitSize();
+
+      private:
+        /** @brief Free space in bytes */
+        std::uint32_t freeSpace;
+
+        /** @brief Number of chunk reads served by cache */
+        std::uint32_t cacheHits;
+
+        /** @brief Number of chunk reads that required memory read */
+        std::uint32_t cacheMisses;
+
+        /** @brief Number of chunks replaced in cache */
+        std::uint32_t cacheEvictions;
+
+        /** @brief Number of blocks waiting for background erase */
+        std::uint16_t pendingErases;
+
+        /** @brief Longest time file system waited for erase */
+        std::chrono::milliseconds longestEraseStall;
+    };
+
+    inline std::uint32_t FileSystemTelemetry::FreeSpace() const
+    {
+        return this->freeSpace;
+    }
+
+    inline std::uint32_t FileSystemTelemetry::CacheHits() const
+    {
+        return this->cacheHits;
+    }
+
+    inline std::uint32_t FileSystemTelemetry::CacheMisses() const
+    {
+        return this->cacheMisses;
+    }
+
+    inline std::uint32_t FileSystemTelemetry::CacheEvictions() const
+    {
+        return this->cacheEvictions;
+    }
+
+    inline std::uint16_t FileSystemTelemetry::PendingErases() const
+    {
+        return this->pendingErases;
+    }
+
+    inline std::chrono::milliseconds FileSystemTelemetry::LongestEraseStall() const
+    {
+        return this->longestEraseStall;
+    }
+
+    constexpr std::uint32_t FileSystemTelemetry::BitSize()
+    {
+        return 24 + 8 + 4 + 4;
+    }
+}
+
+#endif /* LIBS_TELEMETRY_INCLUDE_TELEMETRY_FILESYSTEMTELEMETRY_HPP_ */
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include "base/fwd.hpp"
 
@@ -13,6 +14,10 @@ namespace telemetry
      * @telemetry_element
      * @ingroup telemetry
      * This type records some useful information regarding system startup.
+     *
+     * Boot counter is serialized on 24 bits (saturated). Duration of file system mount is serialized on 7 bits
+     * in 500ms units (saturated at 63.5s) preceded by flag indicating whether file system state was restored
+     * from checkpoint.
      */
     class SystemStartup
     {
@@ -32,8 +37,14 @@ namespace telemetry
          * @param[in] counter Current boot counter value.
          * @param[in] index Currently used boot index.
          * @param[in] reason Reason of last mcu reset.
+         * @param[in] mountDuration Duration of file system mount.
+         * @param[in] mountedFromCheckpoint true if file system state was restored from checkpoint.
          */
-        SystemStartup(std::uint32_t counter, std::uint8_t index, std::uint16_t reason);
+        SystemStartup(std::uint32_t counter,
+            std::uint8_t index,
+            std::uint16_t reason,
+            std::chrono::milliseconds mountDuration,
+            bool mountedFromCheckpoint);
 
         /**
          * @brief Returns current boot counter.
@@ -53,6 +64,18 @@ namespace telemetry
          */
         std::uint16_t BootReason() const noexcept;
 
+        /**
+         * @brief Returns duration of file system mount.
+         * @return Duration of file system mount.
+         */
+        std::chrono::milliseconds MountDuration() const noexcept;
+
+        /**
+         * @brief Returns flag indicating whether file system state was restored from checkpoint.
+         * @return true if file system was mounted from checkpoint, false if whole memory was scanned.
+         */
+        bool MountedFromCheckpoint() const noexcept;
+
         /**
          * @brief Write the system startup telemetry element to passed buffer writer object.
          * @param[in] writer Buffer writer object that should be used to write the serialized state.
@@ -80,6 +103,16 @@ namespace telemetry
          * @brief Current boot index.
          */
         std::uint8_t bootIndex;
+
+        /**
+         * @brief Duration of file system mount.
+         */
+        std::chrono::milliseconds mountDuration;
+
+        /**
+         * @brief File system state was restored from checkpoint.
+         */
+        bool mountedFromCheckpoint;
     };
 
     inline std::uint32_t SystemStartup::BootCounter() const noexcept
@@ -97,9 +130,19 @@ namespace telemetry
         return this->bootReason;
     }
 
+    inline std::chrono::milliseconds SystemStartup::MountDuration() const noexcept
+    {
+        return this->mountDuration;
+    }
+
+    inline bool SystemStartup::MountedFromCheckpoint() const noexcept
+    {
+        return this->mountedFromCheckpoint;
+    }
+
     constexpr std::uint32_t SystemStartup::BitSize()
     {
-        return 8 * (1 * sizeof(std::uint32_t) + sizeof(std::uint8_t) + sizeof(std::uint16_t));
+        return 24 + 8 * (sizeof(std::uint8_t) + sizeof(std::uint16_t)) + 1 + 7;
     }
 
     static_assert(SystemStartup::BitSize() == 56, "Invalid telemetry size");
@@ -0,0 +1,63 @@
+#ifndef LIBS_TELEMETRY_INCLUDE_TELEMETRY_ARCHIVE_HPP_
+#define LIBS_TELEMETRY_INCLUDE_TELEMETRY_ARCHIVE_HPP_
+
+#pragma once
+
+#include <cstdint>
+#include "state.hpp"
+
+namespace telemetry
+{
+    /**
+     * @brief Set of files that make up telemetry archive.
+     * @ingroup telemetry
+     *
+     * Archive files contain serialized @ref ManagedTelemetry records placed at offsets aligned to
+     * @ref ArchiveRecordAlignment. Index files contain sparse index of archive files (see services::fs::ArchiveIndex)
+     * keyed with mission time of indexed records.
+     */
+    struct ArchiveFiles
+    {
+        /** @brief Path to current archive file */
+        const char* current;
+        /** @brief Path to previous archive file */
+        const char* previous;
+        /** @brief Path to index of current archive file */
+        const char* currentIndex;
+        /** @brief Path to index of previous archive file */
+        const char* previousIndex;
+    };
+
+    /**
+     * @brief Files of on-board telemetry archive.
+     * @ingroup telemetry
+     */
+    constexpr ArchiveFiles TelemetryArchive{
+        "/telemetry.current", "/telemetry.previous", "/telemetry.current.idx", "/telemetry.previous.idx"};
+
+    /**
+     * @brief Number of bytes to which records in telemetry archive files are aligned.
+     * @ingroup telemetry
+     */
+    constexpr std::uint8_t ArchiveRecordAlignment = 230;
+
+    /**
+     * @brief Size of single record in telemetry archive file.
+     * @ingroup telemetry
+     */
+    constexpr std::uint8_t ArchiveRecordSize = ManagedTelemetry::TotalSerializedSize;
+
+    /**
+     * @brief Offset of mission time (64-bit LE number of milliseconds) in telemetry archive record.
+     * @ingroup telemetry
+     *
+     * Internal time is serialized right after system startup and program state elements.
+     */
+    constexpr std::uint8_t ArchiveRecordTimeOffset = (SystemStartup::BitSize() + ProgramState::BitSize()) / 8;
+
+    static_assert(ArchiveRecordSize <= ArchiveRecordAlignment, "Telemetry record does not fit archive slot");
+    static_assert((SystemStartup::BitSize() + ProgramState::BitSize()) % 8 == 0, "Mission time in telemetry record is not byte aligned");
+    static_assert(InternalTimeTelemetry::BitSize() == 64, "Invalid serialized size");
+}
+
+#endif /* LIBS_TELEMETRY_INCLUDE_TELEMETRY_ARCHIVE_HPP_ */
@@ -19,6 +19,7 @@ namespace telemetry
     class ExternalTimeTelemetry;
     class ImtqHousekeeping;
     class ImtqState;
+    class FileSystemTelemetry;
 
     struct TelemetryState;
 
@@ -26,7 +27,6 @@ namespace telemetry
 
     namespace details
     {
-        struct FileSystemTelemetryTag;
         struct GpioStateTag;
         struct McuTemperatureTag;
         struct ProgramStateTag;
@@ -43,13 +43,6 @@ namespace telemetry
         struct OSStateTag;
     }
 
-    /**
-     * @brief This type represents telemetry element related file system state.
-     * @telemetry_element
-     * @ingroup telemetry
-     */
-    typedef SimpleTelemetryElement<std::uint32_t, ::telemetry::details::FileSystemTelemetryTag> FileSystemTelemetry;
-
     /**
      * @brief This class represents the state that is observed by the mcu via its gpios.
      * @telemetry_element
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include "BasicTelemetry.hpp"
 #include "ErrorCounters.hpp"
 #include "Experiments.hpp"
+#include "FileSystemTelemetry.hpp"
 #include "ImtqTelemetry.hpp"
 #include "SystemStartup.hpp"
 #include "Telemetry.hpp"
@@ -22,6 +25,10 @@ namespace telemetry
     /**
      * @brief This type represents state of telemetry acquisition loop.
      * @ingroup telemetry
+     *
+     * Serialized telemetry is guarded by sequence counter (seqlock): the only writer (telemetry acquisition loop)
+     * makes the counter odd for the time of update, readers copy the buffer and retry when the counter was odd
+     * or has changed in the meantime. Readers never block the writer and never see partially updated telemetry.
      */
     struct TelemetryState
     {
@@ -31,27 +38,47 @@ namespace telemetry
          */
         bool Initialize();
 
+        /**
+         * @brief Replaces serialized telemetry with new one.
+         * @param[in] serialized Serialized telemetry.
+         * @remark This method may be called only from telemetry acquisition loop.
+         */
+        void PublishSerializedTelemetry(gsl::span<const std::uint8_t> serialized);
+
+        /**
+         * @brief Copies consistent snapshot of the last serialized telemetry.
+         * @param[out] target Buffer for serialized telemetry, at least @ref ManagedTelemetry::TotalSerializedSize bytes long.
+         * @return Operation status, false if consistent snapshot could not be taken in @ref MaxSnapshotAttempts attempts.
+         */
+        bool ReadSerializedTelemetry(gsl::span<std::uint8_t> target) const;
+
         /**
          * @brief Container for all telemetry elements currently collected by acquisition loop.
          */
         ManagedTelemetry telemetry;
 
         /**
-         * @brief Handle to semaphore that protects access to serialized telemetry.
+         * @brief Sequence counter of serialized telemetry. Odd value indicates update in progress.
          */
-        OSSemaphoreHandle bufferLock;
+        std::atomic<std::uint32_t> serializedTelemetryVersion{0};
 
         /**
          * @brief Buffer that contains serialized state of the last seen telemetry state.
          */
         std::array<std::uint8_t, ManagedTelemetry::TotalSerializedSize> lastSerializedTelemetry;
+
+        /** @brief Number of attempts to take consistent snapshot of serialized telemetry */
+        static constexpr std::uint8_t MaxSnapshotAttempts = 3;
+
+        /** @brief Time given to writer to finish update before next snapshot attempt */
+        static constexpr std::chrono::milliseconds SnapshotRetryDelay{5};
     };
 
     static_assert(ProgramState::BitSize() == 16, "Invalid serialized size");
     static_assert(FlashPrimarySlotsScrubbing::BitSize() == 3, "Invalid serialized size");
     static_assert(FlashSecondarySlotsScrubbing::BitSize() == 3, "Invalid serialized size");
     static_assert(RAMScrubbing::BitSize() == 32, "Invalid serialized size");
-    static_assert(FileSystemTelemetry::BitSize() == 32, "Invalid serialized size");
+    static_assert(FileSystemTelemetry::BitSize() == 40, "Invalid serialized size");
     static_assert(OSState::BitSize() == 22, "Invalid serialized size");
     static_assert(GpioState::BitSize() == 1, "Invalid serialized size");
     static_assert(McuTemperature::BitSize() == 12, "Invalid serialized size");
@@ -65,7 +92,7 @@ namespace telemetry
     static_assert(ImtqSelfTest::BitSize() == 64, "Invalid serialized size");
 
     static_assert(ManagedTelemetry::TotalSerializedSize <= 230, "Telemetry is too large");
-    static_assert(ManagedTelemetry::PayloadSize == 1832, "Invalid Telemetry Size");
+    static_assert(ManagedTelemetry::PayloadSize == 1840, "Invalid Telemetry Size");
 }
 
 #endif
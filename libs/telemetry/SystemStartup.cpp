@@ -1,23 +1,35 @@
 #include "telemetry/SystemStartup.hpp"
+#include <algorithm>
 #include "base/BitWriter.hpp"
 
 namespace telemetry
 {
-    SystemStartup::SystemStartup() : bootCounter(0), bootReason(0), bootIndex(0)
+    SystemStartup::SystemStartup()
+        : bootCounter(0), bootReason(0), bootIndex(0), mountDuration(std::chrono::milliseconds::zero()), mountedFromCheckpoint(false)
     {
     }
 
-    SystemStartup::SystemStartup(std::uint32_t counter, std::uint8_t index, std::uint16_t reason) //
+    SystemStartup::SystemStartup(std::uint32_t counter,
+        std::uint8_t index,
+        std::uint16_t reason,
+        std::chrono::milliseconds mountDuration,
+        bool mountedFromCheckpoint) //
         : bootCounter(counter),
           bootReason(reason),
-          bootIndex(index)
+          bootIndex(index),
+          mountDuration(mountDuration),
+          mountedFromCheckpoint(mountedFromCheckpoint)
     {
     }
 
     void SystemStartup::Write(BitWriter& writer) const
     {
-        writer.Write(this->bootCounter);
+        writer.WriteDoubleWord(std::min<std::uint32_t>(this->bootCounter, 0xFFFFFF), 24);
         writer.Write(this->bootIndex);
         writer.Write(this->bootReason);
+        writer.Write(this->mountedFromCheckpoint);
+
+        const auto duration = std::min<std::chrono::milliseconds::rep>(this->mountDuration.count() / 500, 127);
+        writer.WriteWord(static_cast<std::uint16_t>(duration), 7);
     }
 }
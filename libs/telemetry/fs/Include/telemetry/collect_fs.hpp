@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <tuple>
 #include "fs/fs.h"
+#include "fs/yaffs.h"
 #include "mission/base.hpp"
 #include "telemetry/state.hpp"
 
@@ -19,9 +21,9 @@ namespace telemetry
       public:
         /**
          * @brief ctor.
-         * @param[in] fs Reference to antenna driver that will provide this module with hardware telemetry
+         * @param[in] fs Tuple of file system that provides free space and device operations that provide chunk cache statistics
          */
-        FileSystemTelemetryAcquisition(services::fs::IFileSystem& fs);
+        FileSystemTelemetryAcquisition(std::tuple<services::fs::IFileSystem&, services::fs::IYaffsDeviceOperations&> fs);
 
         /**
          * @brief Builds update descriptor for this task.
@@ -48,6 +50,11 @@ namespace telemetry
          * @brief Reference to file system service provider.
          */
         services::fs::IFileSystem* provider;
+
+        /**
+         * @brief Reference to device operations that provide chunk cache statistics.
+         */
+        services::fs::IYaffsDeviceOperations* deviceOperations;
     };
 }
 
@@ -3,7 +3,10 @@
 
 namespace telemetry
 {
-    FileSystemTelemetryAcquisition::FileSystemTelemetryAcquisition(services::fs::IFileSystem& fs) : provider(&fs)
+    FileSystemTelemetryAcquisition::FileSystemTelemetryAcquisition(
+        std::tuple<services::fs::IFileSystem&, services::fs::IYaffsDeviceOperations&> fs) //
+        : provider(&std::get<0>(fs)),
+          deviceOperations(&std::get<1>(fs))
     {
     }
 
@@ -26,7 +29,10 @@ namespace telemetry
         }
         else
         {
-            state.telemetry.Set(FileSystemTelemetry(size));
+            const auto cache = this->deviceOperations->GetCacheStatistics();
+            const auto erase = this->deviceOperations->GetEraseStatistics();
+            state.telemetry.Set(
+                FileSystemTelemetry(size, cache.Hits, cache.Misses, cache.Evictions, erase.Pending, erase.LongestStall));
             return mission::UpdateResult::Ok;
         }
     }
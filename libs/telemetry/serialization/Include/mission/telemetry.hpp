@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <tuple>
+#include "fs/archive_index.hpp"
+#include "fs/archive_writer.hpp"
 #include "fs/fs.h"
+#include "fs/yaffs.h"
 #include "gsl/span"
 #include "mission/base.hpp"
+#include "telemetry/archive.hpp"
 #include "telemetry/state.hpp"
 
 namespace mission
@@ -37,6 +42,26 @@ namespace mission
          * @brief This value determines how often the telemetry should be saved.
          */
         std::chrono::milliseconds delay;
+
+        /**
+         * @brief Maximal time saved telemetry is kept in RAM before it is written to telemetry event file.
+         */
+        std::chrono::milliseconds flushDelay;
+
+        /**
+         * @brief Path to index of current telemetry event file. Index is not maintained if it is not set.
+         */
+        const char* currentIndexFileName;
+
+        /**
+         * @brief Path to index of previous telemetry event file.
+         */
+        const char* previousIndexFileName;
+
+        /**
+         * @brief Number of telemetry frames per single index entry.
+         */
+        std::uint16_t indexInterval;
     };
 
     /**
@@ -57,15 +82,30 @@ namespace mission
      *
      * The telemetry archivization process is done by removing \a previous \a telemetry \a file and
      * changing \a current \a telemetry \a file name to \a previous \a telemetry \a file name.
+     *
+     * \a Current \a telemetry \a file is kept open and saved frames are collected in RAM buffer matching data part
+     * of single file system chunk. Buffer is written to file when it is full, when the oldest frame in it waits for
+     * configured flush delay and on each file system sync (including checkpoint written before planned reset).
+     *
+     * When configured, sparse index of telemetry files is maintained: mission time of every n-th saved frame
+     * together with its offset in file (see services::fs::ArchiveIndex). Index files are rotated together with
+     * telemetry files, so ground can look up frames from given time window in both of them.
      */
     class TelemetryTask : public Action
     {
       public:
         /**
          * @brief ctor.
-         * @param[in] arguments Reference to file system provider & current task configuration.
+         * @param[in] arguments Reference to file system provider, file system sync API & current task configuration.
          */
-        TelemetryTask(std::tuple<services::fs::IFileSystem&, TelemetryConfiguration> arguments);
+        TelemetryTask(
+            std::tuple<services::fs::IFileSystem&, services::fs::IYaffsDeviceOperations&, TelemetryConfiguration> arguments);
+
+        /**
+         * @brief Initializes telemetry file writer (with index when configured) and attaches it to file system sync.
+         * @return Operation status, true on success, false otherwise.
+         */
+        bool Initialize();
 
         /**
          * @brief Builds action descriptor for this task.
@@ -86,13 +126,17 @@ namespace mission
          * @brief This procedure is responsible for appending the passed data frame to the current
          * telemetry event file.
          *
-         * @param[in] buffer Buffer with data frame that should be added to file.
-         * @return Operation status, true on success, false otherwise.
+         * @param[in] buffer Buffer with data frame that should be added to file. Mission time saved in index is taken
+         * from this frame.
+         * @return Operation status, true on success (frame may still be buffered in RAM), false otherwise.
          */
         bool SaveToFile(gsl::span<const std::uint8_t> buffer);
 
         /** @brief Number of bytes to which telemetry entries in file should be aligned */
-        static constexpr std::uint8_t AlignFileEntriesTo = 230;
+        static constexpr std::uint8_t AlignFileEntriesTo = telemetry::ArchiveRecordAlignment;
+
+        /** @brief Size of telemetry file write buffer (data part of single file system chunk) */
+        static constexpr std::size_t WriteBufferSize = services::fs::ChunkDataSize;
 
       private:
         /**
@@ -119,11 +163,25 @@ namespace mission
          */
         services::fs::IFileSystem& provider;
 
+        /**
+         * @brief File system sync API.
+         */
+        services::fs::IYaffsDeviceOperations& deviceOperations;
+
         /**
          * @bier Current configuration
          */
         TelemetryConfiguration configuration;
 
+        /** @brief Telemetry file write buffer */
+        std::array<std::uint8_t, WriteBufferSize> writeBuffer;
+
+        /** @brief Index of telemetry files */
+        services::fs::ArchiveIndex index;
+
+        /** @brief Telemetry file writer */
+        services::fs::ArchiveWriter archive;
+
         /**
          * Counts mission iterations.
          */
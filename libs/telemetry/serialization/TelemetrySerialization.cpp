@@ -39,11 +39,7 @@ namespace telemetry
             return mission::UpdateResult::Warning;
         }
 
-        Lock lock(state.bufferLock, 5s);
-        if (static_cast<bool>(lock))
-        {
-            std::memcpy(state.lastSerializedTelemetry.data(), buffer.data(), buffer.size());
-        }
+        state.PublishSerializedTelemetry(buffer);
 
         return mission::UpdateResult::Ok;
     }
@@ -1,22 +1,53 @@
 #include "mission/telemetry.hpp"
 #include <cassert>
 #include "base/BitWriter.hpp"
+#include "base/reader.h"
 #include "logger/logger.h"
 #include "telemetry/state.hpp"
 
 namespace mission
 {
     using namespace std::chrono_literals;
-    using services::fs::SeekOrigin;
 
-    TelemetryTask::TelemetryTask(std::tuple<services::fs::IFileSystem&, TelemetryConfiguration> arguments)
-        : provider(std::get<0>(arguments)),      //
-          configuration(std::get<1>(arguments)), //
-          delay(configuration.delay),            //
+    TelemetryTask::TelemetryTask(
+        std::tuple<services::fs::IFileSystem&, services::fs::IYaffsDeviceOperations&, TelemetryConfiguration> arguments)
+        : provider(std::get<0>(arguments)),         //
+          deviceOperations(std::get<1>(arguments)), //
+          configuration(std::get<2>(arguments)),    //
+          index(provider,
+              configuration.currentIndexFileName,
+              configuration.previousIndexFileName,
+              configuration.indexInterval), //
+          archive(provider,
+              configuration.currentFileName,
+              configuration.previousFileName,
+              configuration.maxFileSize,
+              AlignFileEntriesTo,
+              configuration.flushDelay,
+              writeBuffer),           //
+          delay(configuration.delay), //
           lastTelemetrySave(0ms)
     {
     }
 
+    bool TelemetryTask::Initialize()
+    {
+        const auto result = this->archive.Initialize();
+        if (OS_RESULT_FAILED(result))
+        {
+            LOGF(LOG_LEVEL_ERROR, "Unable to initialize telemetry file writer. Status: %d", num(result));
+            return false;
+        }
+
+        if (this->configuration.currentIndexFileName != nullptr && this->configuration.indexInterval > 0)
+        {
+            this->archive.AttachIndex(this->index);
+        }
+
+        this->deviceOperations.AttachWriter(this->archive);
+        return true;
+    }
+
     ActionDescriptor<telemetry::TelemetryState> TelemetryTask::BuildAction()
     {
         ActionDescriptor<telemetry::TelemetryState> descriptor;
@@ -47,17 +78,10 @@ namespace mission
     {
         decltype(telemetry::TelemetryState::lastSerializedTelemetry) content;
 
+        if (!stateObject.ReadSerializedTelemetry(content))
         {
-            Lock lock(stateObject.bufferLock, 5s);
-            if (static_cast<bool>(lock))
-            {
-                memcpy(content.data(), stateObject.lastSerializedTelemetry.data(), content.size());
-            }
-            else
-            {
-                LOG(LOG_LEVEL_WARNING, "Unable to acquire access to serialized telemetry. ");
-                return;
-            }
+            LOG(LOG_LEVEL_WARNING, "Unable to acquire access to serialized telemetry. ");
+            return;
         }
 
         if (SaveToFile(content))
@@ -67,60 +91,12 @@ namespace mission
         }
     }
 
-    static inline std::size_t CalculateBestOffset(std::size_t currentSize)
-    {
-        auto rem = currentSize % TelemetryTask::AlignFileEntriesTo;
-
-        if (rem == 0)
-        {
-            return currentSize;
-        }
-
-        return currentSize + (TelemetryTask::AlignFileEntriesTo - rem);
-    }
-
     bool TelemetryTask::SaveToFile(gsl::span<const std::uint8_t> buffer)
     {
-        services::fs::File file(this->provider, //
-            this->configuration.currentFileName,
-            services::fs::FileOpen::OpenAlways,
-            services::fs::FileAccess::WriteOnly);
-        if (!file)
-        {
-            LOGF(LOG_LEVEL_ERROR, "Unable to open telemetry file: '%s'.", this->configuration.currentFileName);
-            return false;
-        }
-
-        auto size = file.Size();
-        if (size >= this->configuration.maxFileSize)
-        {
-            file.Close();
-
-            const auto status = this->provider.Move(this->configuration.currentFileName, this->configuration.previousFileName);
-            if (OS_RESULT_FAILED(status))
-            {
-                LOGF(LOG_LEVEL_ERROR,
-                    "Unable to archive telemetry file: '%s' as '%s'.",
-                    this->configuration.currentFileName,
-                    this->configuration.previousFileName);
-                return false;
-            }
-
-            file = services::fs::File(this->provider,
-                this->configuration.currentFileName,
-                services::fs::FileOpen::CreateAlways,
-                services::fs::FileAccess::WriteOnly);
-            if (!file)
-            {
-                LOGF(LOG_LEVEL_ERROR, "Unable to open telemetry file: '%s'.", this->configuration.currentFileName);
-                return false;
-            }
-
-            size = file.Size();
-        }
-
-        file.Seek(SeekOrigin::Begin, CalculateBestOffset(size));
+        Reader reader(buffer);
+        reader.Skip(telemetry::ArchiveRecordTimeOffset);
+        const auto time = reader.ReadQuadWordLE();
 
-        return static_cast<bool>(file.Write(buffer));
+        return this->archive.Append(buffer, reader.Status() ? time : 0);
     }
 }
@@ -1,17 +1,51 @@
 #include "telemetry/state.hpp"
+#include <algorithm>
 #include "base/os.h"
 
 namespace telemetry
 {
+    constexpr std::uint8_t TelemetryState::MaxSnapshotAttempts;
+    constexpr std::chrono::milliseconds TelemetryState::SnapshotRetryDelay;
+
     bool TelemetryState::Initialize()
     {
-        this->bufferLock = System::CreateBinarySemaphore(0x20);
-        auto status = this->bufferLock != nullptr;
-        if (status)
+        this->serializedTelemetryVersion = 0;
+        return true;
+    }
+
+    void TelemetryState::PublishSerializedTelemetry(gsl::span<const std::uint8_t> serialized)
+    {
+        const auto version = this->serializedTelemetryVersion.load();
+        const auto size = std::min<std::size_t>(serialized.size(), this->lastSerializedTelemetry.size());
+
+        this->serializedTelemetryVersion = version + 1;
+        std::copy_n(serialized.begin(), size, this->lastSerializedTelemetry.begin());
+        this->serializedTelemetryVersion = version + 2;
+    }
+
+    bool TelemetryState::ReadSerializedTelemetry(gsl::span<std::uint8_t> target) const
+    {
+        if (target.size() < static_cast<std::ptrdiff_t>(this->lastSerializedTelemetry.size()))
+        {
+            return false;
+        }
+
+        for (std::uint8_t attempt = 0; attempt < MaxSnapshotAttempts; attempt++)
         {
-            status = OS_RESULT_SUCCEEDED(System::GiveSemaphore(this->bufferLock));
+            const auto before = this->serializedTelemetryVersion.load();
+            if ((before & 1) == 0)
+            {
+                std::copy(this->lastSerializedTelemetry.begin(), this->lastSerializedTelemetry.end(), target.begin());
+
+                if (this->serializedTelemetryVersion.load() == before)
+                {
+                    return true;
+                }
+            }
+
+            System::SleepTask(SnapshotRetryDelay);
         }
 
-        return status;
+        return false;
     }
 }
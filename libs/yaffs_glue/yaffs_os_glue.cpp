@@ -6,6 +6,7 @@
 #include <yaffsfs.h>
 
 #include "base/os.h"
+#include "fs/yaffs_pools.hpp"
 #include "logger/logger.h"
 #include "system.h"
 #include "yaffs_trace.h"
@@ -48,7 +49,13 @@ int yaffsfs_GetLastError(void)
 
 void* yaffsfs_malloc(size_t size)
 {
-    void* ptr = System::Alloc(size);
+    void* ptr = services::fs::YaffsPools.Allocate(size);
+    if (ptr != nullptr)
+    {
+        return ptr;
+    }
+
+    ptr = System::Alloc(size);
 
     if (!ptr)
     {
@@ -59,7 +66,10 @@ void* yaffsfs_malloc(size_t size)
 }
 void yaffsfs_free(void* ptr)
 {
-    System::Free(ptr);
+    if (!services::fs::YaffsPools.Free(ptr))
+    {
+        System::Free(ptr);
+    }
 }
 
 int yaffsfs_CheckMemRegion(const void* addr, size_t size, int write_request)
@@ -97,4 +107,12 @@ void YaffsGlueInit(void)
 {
     yaffsLock = System::CreateBinarySemaphore();
     System::GiveSemaphore(yaffsLock);
+
+    auto arenaSize = services::fs::YaffsPools.ArenaSize();
+    auto arena = static_cast<std::uint8_t*>(System::Alloc(arenaSize));
+
+    if (arena == nullptr || !services::fs::YaffsPools.Initialize(gsl::make_span(arena, arenaSize)))
+    {
+        LOGF(LOG_LEVEL_ERROR, "[yaffs] Unable to allocate %d bytes for memory pools", static_cast<int>(arenaSize));
+    }
 }
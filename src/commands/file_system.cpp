@@ -9,6 +9,7 @@
 #include "base/reader.h"
 #include "base/writer.h"
 #include "fs/yaffs.h"
+#include "fs/yaffs_pools.hpp"
 #include "obc.h"
 #include "obc_access.hpp"
 #include "system.h"
@@ -22,6 +23,7 @@ using services::fs::DirectoryOpenResult;
 using services::fs::FileOpen;
 using services::fs::FileAccess;
 using services::fs::DirectoryHandle;
+using services::fs::DirectoryEntry;
 
 void FSListFiles(uint16_t argc, char* argv[])
 {
@@ -40,21 +42,21 @@ void FSListFiles(uint16_t argc, char* argv[])
         return;
     }
 
-    char* entry;
+    DirectoryEntry entry;
     DirectoryHandle dir = result.Result;
-    while ((entry = GetFileSystem().ReadDirectory(dir)) != NULL)
+    while (GetFileSystem().ReadDirectoryWithStat(dir, entry))
     {
-        auto l = strnlen(entry, 80);
+        auto l = strnlen(entry.Name, 80);
 
-        if (entry[l + 1] != '\0')
+        if (entry.Name[l + 1] != '\0')
         {
             GetTerminal().Puts("[lost file]");
         }
         else
         {
-            GetTerminal().Puts(entry);
+            GetTerminal().Puts(entry.Name);
             GetTerminal().Puts("\t");
-            GetTerminal().Printf("%ld", GetFileSystem().GetFileSize(argv[0], entry));
+            GetTerminal().Printf("%ld", entry.Size);
         }
         GetTerminal().NewLine();
     }
@@ -240,6 +242,28 @@ void SyncFS(uint16_t argc, char* argv[])
     GetFileSystem().Sync();
 }
 
+void FSPools(uint16_t argc, char* argv[])
+{
+    UNUSED(argc, argv);
+
+    auto& pools = services::fs::YaffsPools;
+
+    GetTerminal().Puts("Block\tCap\tUsed\tPeak\tOverflows\n");
+
+    for (std::size_t i = 0; i < pools.Classes(); i++)
+    {
+        auto statistics = pools.Statistics(i);
+
+        GetTerminal().Printf( //
+            "%5d\t%3d\t%4d\t%4d\t%9ld\n",
+            static_cast<int>(statistics.BlockSize),
+            statistics.Capacity,
+            statistics.InUse,
+            statistics.HighWaterMark,
+            statistics.Overflows);
+    }
+}
+
 void RemoveFile(uint16_t /*argc*/, char* argv[])
 {
     const char* path = argv[0];
@@ -36,6 +36,9 @@ void ResetHandler(uint16_t argc, char* argv[])
 {
     UNREFERENCED_PARAMETER(argc);
     UNREFERENCED_PARAMETER(argv);
+
+    GetFileSystem().Checkpoint();
+
     NVIC_SystemReset();
 }
 
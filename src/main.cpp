@@ -63,7 +63,7 @@ telemetry::ObcTelemetryAcquisition TelemetryAcquisition(Main.Hardware.CommDriver
     Main.Hardware.MCUTemperature,
     Mission,
     0,
-    Main.fs,
+    std::tie(Main.fs, Main.fs),
     Main.timeProvider,
     Main.Hardware.rtc,
     Main.BootTable,
@@ -72,7 +72,16 @@ telemetry::ObcTelemetryAcquisition TelemetryAcquisition(Main.Hardware.CommDriver
     Main.Hardware.imtqTelemetryCollector,
     0,
     0,
-    std::make_tuple(std::ref(Main.fs), mission::TelemetryConfiguration{"/telemetry.current", "/telemetry.previous", 512_KB, 30s}));
+    std::make_tuple(std::ref(Main.fs),
+        std::ref(Main.fs),
+        mission::TelemetryConfiguration{telemetry::TelemetryArchive.current,
+            telemetry::TelemetryArchive.previous,
+            512_KB,
+            30s,
+            30s,
+            telemetry::TelemetryArchive.currentIndex,
+            telemetry::TelemetryArchive.previousIndex,
+            16}));
 
 static void PerformMemoryRecovery();
 
@@ -91,7 +100,10 @@ mission::ObcMission Mission(&PerformMemoryRecovery, //
     Main.Hardware.EPS,
     std::make_pair(std::ref(Main.Experiments.ExperimentsController), std::ref(Main.timeProvider)),
     GetCommHardwareObserver(),
-    std::make_tuple(std::ref(Main.PowerControlInterface), std::ref(Main.Scrubbing), std::ref(Main.Experiments.ExperimentsController)),
+    std::make_tuple(std::ref(Main.PowerControlInterface),
+        std::ref(Main.Scrubbing),
+        std::ref(Main.Experiments.ExperimentsController),
+        std::ref(Main.fs)),
     Main.PowerControlInterface);
 
 const int __attribute__((used)) uxTopUsedPriority = configMAX_PRIORITIES;
@@ -32,17 +32,17 @@ static void ProcessState(OBC* obc)
     }
 }
 
-static void AuditSystemStartup(uint32_t bootCounter)
+static void AuditSystemStartup(uint32_t bootCounter, const services::fs::MountStatistics& mount)
 {
     const auto bootReason = efm::mcu::GetBootReason();
     auto& telemetry = TelemetryAcquisition.GetState().telemetry;
     if (boot::IsBootInformationAvailable())
     {
-        telemetry.Set(telemetry::SystemStartup(bootCounter, boot::Index, bootReason));
+        telemetry.Set(telemetry::SystemStartup(bootCounter, boot::Index, bootReason, mount.Duration, mount.FromCheckpoint));
     }
     else
     {
-        telemetry.Set(telemetry::SystemStartup(bootCounter, 0xff, bootReason));
+        telemetry.Set(telemetry::SystemStartup(bootCounter, 0xff, bootReason, mount.Duration, mount.FromCheckpoint));
     }
 
     efm::mcu::ResetBootReason();
@@ -103,6 +103,7 @@ OBC::OBC()
           Mission,
           Mission,
           fs,
+          fs,
           Experiments,
           BootTable,
           BootSettings,
@@ -164,7 +165,7 @@ OSResult OBC::InitializeRunlevel1()
     this->Experiments.InitializeRunlevel1();
 
     ProcessState(this);
-    AuditSystemStartup(this->BootSettings.BootCounter());
+    AuditSystemStartup(this->BootSettings.BootCounter(), this->fs.GetMountStatistics());
 
     state::TimeState timeState;
     if (!persistentState.Get(timeState))
@@ -18,6 +18,7 @@ static const TerminalCommandDescription commands[] = {
     {"mkdir", MakeDirectory},
     {"erase", EraseFlash},
     {"sync_fs", SyncFS},
+    {"fs_pools", FSPools},
     {"i2c", I2CTestCommandHandler},
     {"antenna_deploy", AntennaDeploy},
     {"antenna_cancel", AntennaCancelDeployment},
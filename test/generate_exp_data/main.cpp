@@ -79,6 +79,26 @@ class PosixFileSystem : public IFileSystem
         }
     }
 
+    virtual IOResult WriteAt(FileHandle file, FileSize offset, gsl::span<const std::uint8_t> buffer) override
+    {
+        auto position = lseek(file, 0, SEEK_CUR);
+        lseek(file, offset, SEEK_SET);
+        auto r = Write(file, buffer);
+        lseek(file, position, SEEK_SET);
+
+        return r;
+    }
+
+    virtual IOResult ReadAt(FileHandle file, FileSize offset, gsl::span<std::uint8_t> buffer) override
+    {
+        auto position = lseek(file, 0, SEEK_CUR);
+        lseek(file, offset, SEEK_SET);
+        auto r = Read(file, buffer);
+        lseek(file, position, SEEK_SET);
+
+        return r;
+    }
+
     virtual OSResult Close(FileHandle file) override
     {
         return static_cast<OSResult>(close(file));
@@ -94,6 +114,11 @@ class PosixFileSystem : public IFileSystem
         return nullptr;
     }
 
+    virtual bool ReadDirectoryWithStat(DirectoryHandle /*directory*/, DirectoryEntry& /*entry*/) override
+    {
+        return false;
+    }
+
     virtual OSResult CloseDirectory(DirectoryHandle /*directory*/) override
     {
         return OSResult::NotSupported;
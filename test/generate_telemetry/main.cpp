@@ -10,6 +10,7 @@
 #include "telemetry/BasicTelemetry.hpp"
 #include "telemetry/ErrorCounters.hpp"
 #include "telemetry/Experiments.hpp"
+#include "telemetry/FileSystemTelemetry.hpp"
 #include "telemetry/ImtqTelemetry.hpp"
 #include "telemetry/SystemStartup.hpp"
 #include "telemetry/Telemetry.hpp"
@@ -164,7 +165,7 @@ ControllerBTelemetry GetControllerB()
 
 void FillTelemetry(ManagedTelemetry& telemetry)
 {
-    telemetry.Set(SystemStartup(0xDEADBEEF, 0b111, 0x5));
+    telemetry.Set(SystemStartup(0xADBEEF, 0b111, 0x5, 1500ms, true));
     telemetry.Set(ProgramState(0x1122));
     telemetry.Set(InternalTimeTelemetry(1234s));
     telemetry.Set(ExternalTimeTelemetry(4321s));
@@ -173,7 +174,7 @@ void FillTelemetry(ManagedTelemetry& telemetry)
     telemetry.Set(FlashSecondarySlotsScrubbing(0b010));
     telemetry.Set(RAMScrubbing(11223344));
     telemetry.Set(OSState(123456));
-    telemetry.Set(FileSystemTelemetry(44332211));
+    telemetry.Set(FileSystemTelemetry(4433221, 3, 1, 0, 2, 300ms));
     telemetry.Set(GetAntennaTelemetry());
     telemetry.Set(ExperimentTelemetry(10, StartResult::Failure, IterationResult::LoopImmediately));
     telemetry.Set(GyroscopeTelemetry(350, -4023, 352, 353));
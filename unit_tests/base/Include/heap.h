@@ -6,6 +6,7 @@
 EXTERNC_BEGIN
 
 size_t xPortGetFreeHeapSize(void);
+size_t xPortGetFreeBlocksCount(size_t* pxLargestFreeBlock);
 void prvHeapInit(void);
 void* pvPortMalloc(size_t xWantedSize);
 void vPortFree(void* pv);
@@ -35,10 +35,15 @@ class FsMock : public services::fs::IFileSystem
     MOCK_METHOD2(TruncateFile, OSResult(services::fs::FileHandle file, services::fs::FileSize length));
     MOCK_METHOD2(Write, services::fs::IOResult(services::fs::FileHandle file, gsl::span<const std::uint8_t> buffer));
     MOCK_METHOD2(Read, services::fs::IOResult(services::fs::FileHandle file, gsl::span<std::uint8_t> buffer));
+    MOCK_METHOD3(WriteAt,
+        services::fs::IOResult(services::fs::FileHandle file, services::fs::FileSize offset, gsl::span<const std::uint8_t> buffer));
+    MOCK_METHOD3(ReadAt,
+        services::fs::IOResult(services::fs::FileHandle file, services::fs::FileSize offset, gsl::span<std::uint8_t> buffer));
     MOCK_METHOD1(Close, OSResult(services::fs::FileHandle file));
 
     MOCK_METHOD1(OpenDirectory, services::fs::DirectoryOpenResult(const char*));
     MOCK_METHOD1(ReadDirectory, char*(services::fs::DirectoryHandle));
+    MOCK_METHOD2(ReadDirectoryWithStat, bool(services::fs::DirectoryHandle, services::fs::DirectoryEntry&));
     MOCK_METHOD1(CloseDirectory, OSResult(services::fs::DirectoryHandle));
     MOCK_METHOD1(IsDirectory, bool(const char*));
     MOCK_METHOD1(Format, OSResult(const char*));
@@ -0,0 +1,24 @@
+#ifndef UNIT_TESTS_MOCK_YAFFS_DEVICE_OPERATIONS_MOCK_HPP_
+#define UNIT_TESTS_MOCK_YAFFS_DEVICE_OPERATIONS_MOCK_HPP_
+
+#pragma once
+
+#include "gmock/gmock.h"
+#include "fs/yaffs.h"
+
+struct YaffsDeviceOperationsMock : services::fs::IYaffsDeviceOperations
+{
+    MOCK_METHOD1(AddDeviceAndMount, OSResult(yaffs_dev* device));
+    MOCK_METHOD1(ClearDevice, OSResult(yaffs_dev* device));
+    MOCK_METHOD0(Sync, void());
+    MOCK_METHOD0(Checkpoint, OSResult());
+    MOCK_METHOD0(GetMountStatistics, services::fs::MountStatistics());
+    MOCK_METHOD1(AttachCache, void(services::fs::IYaffsDeviceCache& cache));
+    MOCK_METHOD0(GetCacheStatistics, services::fs::ChunkCacheStatistics());
+    MOCK_METHOD1(AttachEraser, void(services::fs::IYaffsDeviceEraser& eraser));
+    MOCK_METHOD0(GetEraseStatistics, services::fs::EraseStatistics());
+    MOCK_METHOD1(AttachWriter, void(services::fs::IBufferedWriter& writer));
+    MOCK_METHOD0(FlushWriter, OSResult());
+};
+
+#endif /* UNIT_TESTS_MOCK_YAFFS_DEVICE_OPERATIONS_MOCK_HPP_ */
@@ -24,6 +24,18 @@ struct TransmitterMock : public devices::comm::ITransmitter
     void ExpectDownlinkFrame(telecommunication::downlink::DownlinkAPID apid, std::uint8_t correlationId, std::uint8_t errorCode);
 };
 
+struct BufferedTransmitterMock : public devices::comm::IBufferedTransmitter
+{
+    BufferedTransmitterMock();
+    ~BufferedTransmitterMock();
+    MOCK_METHOD1(SendFrame, bool(gsl::span<const std::uint8_t>));
+    MOCK_METHOD2(SendFrame, bool(gsl::span<const std::uint8_t>, std::uint8_t&));
+    MOCK_METHOD1(GetTransmitterTelemetry, bool(devices::comm::TransmitterTelemetry&));
+    MOCK_METHOD1(SetTransmitterStateWhenIdle, bool(devices::comm::IdleState));
+    MOCK_METHOD1(SetTransmitterBitRate, bool(devices::comm::Bitrate));
+    MOCK_METHOD0(ResetTransmitter, bool());
+};
+
 struct BeaconControllerMock : public devices::comm::IBeaconController
 {
     BeaconControllerMock();
@@ -46,6 +58,24 @@ struct CommHardwareObserverMock : public devices::comm::ICommHardwareObserver
     MOCK_METHOD0(WaitForComLoop, void());
 };
 
+struct ReceiverPollingMock : public devices::comm::IReceiverPolling
+{
+    ReceiverPollingMock();
+    ~ReceiverPollingMock();
+    MOCK_METHOD1(ExpectPass, void(std::chrono::milliseconds until));
+    MOCK_METHOD0(GetPollingStatistics, devices::comm::PollingStatistics());
+};
+
+struct CommDiagnosticsMock : public devices::comm::ICommDiagnostics
+{
+    CommDiagnosticsMock();
+    ~CommDiagnosticsMock();
+    MOCK_METHOD0(GetAvoidedTransactions, std::uint32_t());
+    MOCK_METHOD1(GetTurnaroundStatistics, devices::comm::TurnaroundStatistics(devices::comm::ResponseCommand command));
+    MOCK_METHOD1(GetMinimumTurnaround, std::chrono::milliseconds(devices::comm::ResponseCommand command));
+    MOCK_METHOD2(SetMinimumTurnaround, void(devices::comm::ResponseCommand command, std::chrono::milliseconds turnaround));
+};
+
 MATCHER_P3(IsDownlinkFrame, apidMatcher, seqMatcher, payloadMatcher, "")
 {
     if (arg.size() < 3)
@@ -4,6 +4,7 @@
 #include <dmadrv.h>
 #include <em_cmu.h>
 #include <em_usart.h>
+#include <gsl/span>
 #include <utility>
 #include "gmock/gmock.h"
 
@@ -70,6 +71,28 @@ struct IDMA
         DMADRV_DataSize_t size,
         DMADRV_Callback_t callback,
         void* cbUserParam) = 0;
+
+    virtual Ecode_t PeripheralMemoryChained(unsigned int channelId,
+        DMADRV_PeripheralSignal_t peripheralSignal,
+        void* dst,
+        void* src,
+        bool dstInc,
+        int len,
+        DMADRV_DataSize_t size,
+        gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+        DMADRV_Callback_t callback,
+        void* cbUserParam) = 0;
+
+    virtual Ecode_t MemoryPeripheralChained(unsigned int channelId,
+        DMADRV_PeripheralSignal_t peripheralSignal,
+        void* dst,
+        void* src,
+        bool srcInc,
+        int len,
+        DMADRV_DataSize_t size,
+        gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+        DMADRV_Callback_t callback,
+        void* cbUserParam) = 0;
 };
 
 struct DMAMock : public IDMA
@@ -97,6 +120,30 @@ struct DMAMock : public IDMA
             DMADRV_DataSize_t size,
             DMADRV_Callback_t callback,
             void* cbUserParam));
+
+    MOCK_METHOD10(PeripheralMemoryChained,
+        Ecode_t(unsigned int channelId,
+            DMADRV_PeripheralSignal_t peripheralSignal,
+            void* dst,
+            void* src,
+            bool dstInc,
+            int len,
+            DMADRV_DataSize_t size,
+            gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+            DMADRV_Callback_t callback,
+            void* cbUserParam));
+
+    MOCK_METHOD10(MemoryPeripheralChained,
+        Ecode_t(unsigned int channelId,
+            DMADRV_PeripheralSignal_t peripheralSignal,
+            void* dst,
+            void* src,
+            bool srcInc,
+            int len,
+            DMADRV_DataSize_t size,
+            gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+            DMADRV_Callback_t callback,
+            void* cbUserParam));
 };
 
 template <typename Mock> class ProxyReset
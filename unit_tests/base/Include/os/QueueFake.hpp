@@ -0,0 +1,49 @@
+#ifndef UNIT_TESTS_OS_QUEUE_FAKE_HPP
+#define UNIT_TESTS_OS_QUEUE_FAKE_HPP
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "OsMock.hpp"
+
+/**
+ * @brief In-memory implementation of OS queues for OSMock.
+ *
+ * Elements are copied into and out of the queues like in real OS, so that classes that use @ref Queue
+ * can be tested without mocking every single queue operation.
+ */
+class QueueFake
+{
+  public:
+    /**
+     * @brief Installs queue operations on OS mock object
+     * @param[in] os OS mock object
+     */
+    void Install(OSMock& os);
+
+  private:
+    /** @brief Single queue */
+    struct FakeQueue
+    {
+        /** @brief Maximal number of elements */
+        std::size_t Capacity;
+        /** @brief Size of single element */
+        std::size_t ElementSize;
+        /** @brief Queued elements */
+        std::deque<std::vector<std::uint8_t>> Elements;
+    };
+
+    /**
+     * @brief Returns queue associated with handle
+     * @param[in] handle Queue handle
+     * @return Queue
+     */
+    FakeQueue& Get(OSQueueHandle handle);
+
+    /** @brief Created queues */
+    std::deque<FakeQueue> _queues;
+};
+
+#endif /* UNIT_TESTS_OS_QUEUE_FAKE_HPP */
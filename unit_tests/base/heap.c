@@ -258,6 +258,32 @@ size_t xPortGetMinimumEverFreeHeapSize(void)
 }
 /*-----------------------------------------------------------*/
 
+size_t xPortGetFreeBlocksCount(size_t* pxLargestFreeBlock)
+{
+    size_t xCount = 0;
+    size_t xLargest = 0;
+
+    if (pxEnd != NULL)
+    {
+        for (BlockLink_t* pxBlock = xStart.pxNextFreeBlock; pxBlock != pxEnd; pxBlock = pxBlock->pxNextFreeBlock)
+        {
+            xCount++;
+            if (pxBlock->xBlockSize > xLargest)
+            {
+                xLargest = pxBlock->xBlockSize;
+            }
+        }
+    }
+
+    if (pxLargestFreeBlock != NULL)
+    {
+        *pxLargestFreeBlock = xLargest;
+    }
+
+    return xCount;
+}
+/*-----------------------------------------------------------*/
+
 void vPortInitialiseBlocks(void)
 {
     /* This just exists to keep the linker quiet. */
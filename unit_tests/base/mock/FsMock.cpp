@@ -1,5 +1,6 @@
 #include "FsMock.hpp"
 #include <algorithm>
+#include <iterator>
 #include <utility>
 
 using testing::Invoke;
@@ -66,7 +67,10 @@ FsMock::FsMock() : _nextHandle(100), _nextDirHandle(200)
             return MakeFSIOResult(OSResult::InvalidFileHandle);
         }
 
-        gsl::span<std::uint8_t>::iterator end = std::copy(f->second.Position, f->second.Position + buffer.size(), buffer.begin());
+        auto& content = this->_files[f->second.File];
+        auto available = std::min<std::ptrdiff_t>(buffer.size(), content.end() - f->second.Position);
+
+        gsl::span<std::uint8_t>::iterator end = std::copy(f->second.Position, f->second.Position + available, buffer.begin());
 
         f->second.Position += (end - buffer.begin());
 
@@ -89,6 +93,48 @@ FsMock::FsMock() : _nextHandle(100), _nextDirHandle(200)
         return MakeFSIOResult(gsl::span<const std::uint8_t>(buffer.data(), length));
     }));
 
+    ON_CALL(*this, ReadAt(_, _, _)).WillByDefault(Invoke([this](FileHandle handle, FileSize offset, gsl::span<std::uint8_t> buffer) {
+        auto f = this->_opened.find(handle);
+
+        if (f == this->_opened.end())
+        {
+            return MakeFSIOResult(OSResult::InvalidFileHandle);
+        }
+
+        auto& content = this->_files[f->second.File];
+        if (offset > content.size())
+        {
+            return MakeFSIOResult(gsl::span<const std::uint8_t>());
+        }
+
+        auto available = std::min<std::ptrdiff_t>(buffer.size(), content.size() - offset);
+
+        std::copy(content.begin() + offset, content.begin() + offset + available, buffer.begin());
+
+        return MakeFSIOResult(buffer.subspan(0, available));
+    }));
+
+    ON_CALL(*this, WriteAt(_, _, _)).WillByDefault(Invoke([this](FileHandle handle, FileSize offset, gsl::span<const std::uint8_t> buffer) {
+        auto f = this->_opened.find(handle);
+
+        if (f == this->_opened.end())
+        {
+            return MakeFSIOResult(OSResult::InvalidFileHandle);
+        }
+
+        auto& content = this->_files[f->second.File];
+        if (offset > content.size())
+        {
+            return MakeFSIOResult(OSResult::OutOfRange);
+        }
+
+        auto length = std::min<std::ptrdiff_t>(buffer.size(), content.size() - offset);
+
+        std::copy(buffer.begin(), buffer.begin() + length, content.begin() + offset);
+
+        return MakeFSIOResult(buffer.subspan(0, length));
+    }));
+
     ON_CALL(*this, Seek(_, _, _)).WillByDefault(Invoke([this](FileHandle handle, SeekOrigin origin, FileSize offset) {
         auto f = this->_opened.find(handle);
 
@@ -195,6 +241,24 @@ FsMock::FsMock() : _nextHandle(100), _nextDirHandle(200)
 
         return nullptr;
     }));
+    ON_CALL(*this, ReadDirectoryWithStat(_, _)).WillByDefault(Invoke([this](DirectoryHandle handle, DirectoryEntry& entry) {
+        auto name = this->ReadDirectory(handle);
+
+        if (name == nullptr)
+        {
+            return false;
+        }
+
+        auto& d = this->_openedDirs[handle];
+        auto& file = *std::prev(d.Position);
+
+        entry.Name = name;
+        entry.Size = file.second.size();
+        entry.ModificationTime = 0;
+        entry.Type = DirectoryEntryType::File;
+
+        return true;
+    }));
     ON_CALL(*this, CloseDirectory(_)).WillByDefault(Invoke([this](DirectoryHandle /*handle*/) { return OSResult::Success; }));
 }
 
@@ -16,6 +16,14 @@ void TransmitterMock::ExpectDownlinkFrame(DownlinkAPID apid, std::uint8_t correl
     EXPECT_CALL(*this, SendFrame(IsDownlinkFrame(apid, 0, testing::ElementsAre(correlationId, errorCode))));
 }
 
+BufferedTransmitterMock::BufferedTransmitterMock()
+{
+}
+
+BufferedTransmitterMock::~BufferedTransmitterMock()
+{
+}
+
 BeaconControllerMock::BeaconControllerMock()
 {
 }
@@ -39,3 +47,19 @@ CommHardwareObserverMock::CommHardwareObserverMock()
 CommHardwareObserverMock::~CommHardwareObserverMock()
 {
 }
+
+ReceiverPollingMock::ReceiverPollingMock()
+{
+}
+
+ReceiverPollingMock::~ReceiverPollingMock()
+{
+}
+
+CommDiagnosticsMock::CommDiagnosticsMock()
+{
+}
+
+CommDiagnosticsMock::~CommDiagnosticsMock()
+{
+}
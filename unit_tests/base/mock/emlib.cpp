@@ -117,6 +117,62 @@ namespace efm
 
             return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
         }
+
+        Ecode_t PeripheralMemoryChained(unsigned int channelId,
+            DMADRV_PeripheralSignal_t peripheralSignal,
+            void* dst,
+            void* src,
+            bool dstInc,
+            int len,
+            DMADRV_DataSize_t size,
+            gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+            DMADRV_Callback_t callback,
+            void* cbUserParam)
+        {
+            if (dmaProxy != nullptr)
+            {
+                return dmaProxy->PeripheralMemoryChained(channelId,
+                    peripheralSignal,
+                    dst,
+                    src,
+                    dstInc,
+                    len,
+                    size,
+                    tasks,
+                    callback,
+                    cbUserParam);
+            }
+
+            return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
+        }
+
+        Ecode_t MemoryPeripheralChained(unsigned int channelId,
+            DMADRV_PeripheralSignal_t peripheralSignal,
+            void* dst,
+            void* src,
+            bool srcInc,
+            int len,
+            DMADRV_DataSize_t size,
+            gsl::span<DMA_DESCRIPTOR_TypeDef> tasks,
+            DMADRV_Callback_t callback,
+            void* cbUserParam)
+        {
+            if (dmaProxy != nullptr)
+            {
+                return dmaProxy->MemoryPeripheralChained(channelId,
+                    peripheralSignal,
+                    dst,
+                    src,
+                    srcInc,
+                    len,
+                    size,
+                    tasks,
+                    callback,
+                    cbUserParam);
+            }
+
+            return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
+        }
     }
 }
 
@@ -0,0 +1,50 @@
+#include "os/QueueFake.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+void QueueFake::Install(OSMock& os)
+{
+    ON_CALL(os, CreateQueue(_, _)).WillByDefault(Invoke([this](std::size_t capacity, std::size_t elementSize) {
+        this->_queues.push_back(FakeQueue{capacity, elementSize, {}});
+        return reinterpret_cast<OSQueueHandle>(this->_queues.size());
+    }));
+
+    ON_CALL(os, QueueSend(_, _, _)).WillByDefault(Invoke([this](OSQueueHandle handle, const void* element, auto /*timeout*/) {
+        auto& queue = Get(handle);
+        if (queue.Elements.size() >= queue.Capacity)
+        {
+            return false;
+        }
+
+        auto ptr = static_cast<const std::uint8_t*>(element);
+        queue.Elements.emplace_back(ptr, ptr + queue.ElementSize);
+        return true;
+    }));
+
+    ON_CALL(os, QueueOverwrite(_, _)).WillByDefault(Invoke([this](OSQueueHandle handle, const void* element) {
+        auto& queue = Get(handle);
+        auto ptr = static_cast<const std::uint8_t*>(element);
+        queue.Elements.clear();
+        queue.Elements.emplace_back(ptr, ptr + queue.ElementSize);
+    }));
+
+    ON_CALL(os, QueueReceive(_, _, _)).WillByDefault(Invoke([this](OSQueueHandle handle, void* element, auto /*timeout*/) {
+        auto& queue = Get(handle);
+        if (queue.Elements.empty())
+        {
+            return false;
+        }
+
+        std::copy(queue.Elements.front().begin(), queue.Elements.front().end(), static_cast<std::uint8_t*>(element));
+        queue.Elements.pop_front();
+        return true;
+    }));
+
+    ON_CALL(os, QueueReset(_)).WillByDefault(Invoke([this](OSQueueHandle handle) { Get(handle).Elements.clear(); }));
+}
+
+QueueFake::FakeQueue& QueueFake::Get(OSQueueHandle handle)
+{
+    return this->_queues[reinterpret_cast<std::size_t>(handle) - 1];
+}
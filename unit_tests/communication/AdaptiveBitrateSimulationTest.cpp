@@ -0,0 +1,218 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "gsl/span"
+#include "obc/bitrate/adaptive_bitrate.hpp"
+#include "telecommunication/DownlinkScheduler.hpp"
+
+using testing::Eq;
+using testing::Ge;
+using testing::Gt;
+
+using devices::comm::Bitrate;
+using obc::BitrateAdaptation;
+using telecommunication::downlink::BitrateCount;
+using telecommunication::downlink::BitrateIndex;
+using telecommunication::downlink::DownlinkScheduler;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    /*
+     * Reference pass traces: uplink frames received every 10 seconds from horizon to horizon by the 550km orbit
+     * satellite. RSSI follows slant range path loss with low elevation losses and slow fading.
+     */
+
+    /** @brief Interval between subsequent trace samples (uplink frames) */
+    constexpr std::chrono::milliseconds TraceSamplingPeriod = 10s;
+
+    /** @brief Payload carried by single downlink frame */
+    constexpr std::uint32_t FramePayload = 232;
+
+    /** @brief Minimal downlink signal level (in 0.1dBm) required by ground station to decode frame at each bit rate */
+    constexpr std::array<std::int32_t, BitrateCount> Sensitivity{-1170, -1140, -1110, -1080};
+
+    /** @brief Uplink RSSI (in 0.1dBm) of the pass with 12 deg maximal elevation */
+    const std::int16_t LowPassRssi[] = {
+        -1134, -1122, -1130, -1116, -1121, -1144, -1159, -1140, -1114, -1097, -1127, -1100, -1103, -1105, -1096, -1093, -1093,
+        -1101, -1096, -1086, -1087, -1074, -1062, -1072, -1096, -1079, -1101, -1110, -1110, -1085, -1081, -1108, -1107, -1117,
+        -1099, -1099, -1103, -1085, -1084, -1085, -1091, -1104, -1124, -1113, -1116, -1139, -1125, -1120, -1115, -1106, -1112,
+        -1138, -1138, -1122, -1128, -1134, -1140, -1149, -1143};
+
+    /** @brief Uplink Doppler offset (in Hz) of the pass with 12 deg maximal elevation */
+    const std::int16_t LowPassDoppler[] = {
+        7963, 7858, 7744, 7623, 7492, 7352, 7202, 7042, 6870, 6686, 6489, 6279, 6055, 5816, 5562, 5292, 5006, 4703, 4384, 4049,
+        3697, 3330, 2948, 2552, 2144, 1724, 1296, 860, 420, -22, -464, -904, -1339, -1767, -2185, -2592, -2987, -3368, -3733,
+        -4083, -4417, -4734, -5035, -5319, -5588, -5840, -6078, -6300, -6509, -6705, -6887, -7058, -7218, -7367, -7506, -7635,
+        -7756, -7869, -7973};
+
+    /** @brief Uplink RSSI (in 0.1dBm) of the pass with 35 deg maximal elevation */
+    const std::int16_t MediumPassRssi[] = {
+        -1147, -1133, -1123, -1141, -1144, -1143, -1156, -1152, -1146, -1138, -1137, -1123, -1110, -1094, -1097, -1083, -1064,
+        -1066, -1082, -1106, -1089, -1090, -1069, -1046, -1023, -1028, -1027, -1018, -994, -1004, -1031, -1040, -1058, -1048,
+        -1034, -1025, -1026, -1007, -1009, -1018, -1004, -1015, -1034, -1028, -1022, -1044, -1058, -1080, -1084, -1108, -1074,
+        -1081, -1087, -1081, -1087, -1106, -1117, -1106, -1106, -1117, -1132, -1118, -1101, -1099, -1087, -1105, -1129, -1139,
+        -1149, -1141, -1125};
+
+    /** @brief Uplink Doppler offset (in Hz) of the pass with 35 deg maximal elevation */
+    const std::int16_t MediumPassDoppler[] = {
+        9745, 9723, 9699, 9671, 9639, 9604, 9565, 9520, 9470, 9415, 9352, 9283, 9204, 9117, 9018, 8908, 8783, 8643, 8485, 8307,
+        8105, 7876, 7618, 7324, 6992, 6617, 6192, 5715, 5181, 4588, 3935, 3223, 2459, 1651, 812, -43, -897, -1734, -2538, -3297,
+        -4003, -4650, -5237, -5766, -6237, -6656, -7027, -7355, -7645, -7901, -8126, -8326, -8502, -8658, -8796, -8919, -9029,
+        -9126, -9213, -9290, -9359, -9421, -9476, -9525, -9569, -9608, -9643, -9674, -9701, -9725, -9747};
+
+    /** @brief Uplink RSSI (in 0.1dBm) of the pass with 80 deg maximal elevation */
+    const std::int16_t HighPassRssi[] = {
+        -1125, -1128, -1101, -1100, -1099, -1116, -1117, -1110, -1100, -1096, -1120, -1101, -1107, -1110, -1097, -1090, -1072,
+        -1064, -1039, -1033, -1012, -1016, -1025, -1041, -1016, -1014, -1028, -1016, -1031, -1021, -1011, -1011, -1002, -982, -983,
+        -972, -966, -968, -999, -988, -983, -989, -990, -999, -1006, -1011, -1012, -1023, -1044, -1051, -1071, -1073, -1079, -1072,
+        -1058, -1068, -1083, -1088, -1096, -1093, -1103, -1105, -1099, -1101, -1133, -1156, -1136, -1141, -1140, -1130, -1128,
+        -1153, -1151};
+
+    /** @brief Uplink Doppler offset (in Hz) of the pass with 80 deg maximal elevation */
+    const std::int16_t HighPassDoppler[] = {
+        10123, 10121, 10118, 10113, 10106, 10098, 10088, 10075, 10060, 10042, 10020, 9995, 9966, 9932, 9893, 9847, 9794, 9732,
+        9660, 9576, 9478, 9362, 9224, 9061, 8867, 8633, 8351, 8009, 7594, 7087, 6471, 5727, 4837, 3793, 2604, 1299, -69, -1433,
+        -2729, -3904, -4932, -5807, -6538, -7142, -7639, -8046, -8382, -8658, -8888, -9079, -9239, -9374, -9488, -9585, -9668,
+        -9739, -9800, -9852, -9897, -9936, -9969, -9998, -10022, -10043, -10061, -10076, -10089, -10099, -10107, -10113, -10118,
+        -10121, -10123};
+
+    /** @brief Single pass trace */
+    struct PassTrace
+    {
+        /** @brief Pass name */
+        const char* Name;
+
+        /** @brief Uplink RSSI samples */
+        gsl::span<const std::int16_t> Rssi;
+
+        /** @brief Uplink Doppler offset samples */
+        gsl::span<const std::int16_t> Doppler;
+    };
+
+    /** @brief Result of single pass simulation */
+    struct SimulationResult
+    {
+        /** @brief Number of frames decoded by ground station */
+        std::uint32_t Delivered;
+
+        /** @brief Number of frames sent at each bit rate */
+        std::array<std::uint32_t, BitrateCount> Sent;
+    };
+
+    std::uint16_t RawRssi(std::int32_t deciDbm)
+    {
+        return static_cast<std::uint16_t>((deciDbm * 10 + 15200 + 1) / 3);
+    }
+
+    std::uint16_t RawDoppler(std::int32_t hz)
+    {
+        return static_cast<std::uint16_t>(((hz + 22300) * 1000 + 13352 / 2) / 13352);
+    }
+
+    class AdaptiveBitrateSimulationTest : public testing::TestWithParam<PassTrace>
+    {
+      protected:
+        /**
+         * @brief Simulates continuous bulk downlink during the pass
+         * @param[in] trace Pass trace
+         * @param[in] fixed Bit rate used when adaptation is not used
+         * @param[in] adaptation Adaptation policy, nullptr for fixed bit rate
+         * @return Simulation result
+         */
+        static SimulationResult Simulate(const PassTrace& trace, Bitrate fixed, BitrateAdaptation* adaptation);
+
+        /**
+         * @brief Returns downlink signal level interpolated between trace samples
+         * @param[in] trace Pass trace
+         * @param[in] at Time since beginning of the pass
+         * @return Signal level in 0.1dBm
+         */
+        static std::int32_t SignalAt(const PassTrace& trace, std::chrono::milliseconds at);
+    };
+
+    std::int32_t AdaptiveBitrateSimulationTest::SignalAt(const PassTrace& trace, std::chrono::milliseconds at)
+    {
+        const auto index = static_cast<std::size_t>(at / TraceSamplingPeriod);
+        if (index + 1 >= static_cast<std::size_t>(trace.Rssi.size()))
+        {
+            return trace.Rssi[trace.Rssi.size() - 1];
+        }
+
+        const auto offset = static_cast<std::int32_t>((at % TraceSamplingPeriod).count());
+        const std::int32_t from = trace.Rssi[index];
+        const std::int32_t to = trace.Rssi[index + 1];
+        return from + (to - from) * offset / static_cast<std::int32_t>(TraceSamplingPeriod.count());
+    }
+
+    SimulationResult AdaptiveBitrateSimulationTest::Simulate(const PassTrace& trace, Bitrate fixed, BitrateAdaptation* adaptation)
+    {
+        SimulationResult result{0, {}};
+
+        const auto samples = static_cast<std::size_t>(trace.Rssi.size());
+        const auto end = TraceSamplingPeriod * static_cast<std::int32_t>(samples - 1);
+
+        std::size_t sample = 0;
+        for (auto now = 0ms; now < end;)
+        {
+            for (; sample < samples && TraceSamplingPeriod * static_cast<std::int32_t>(sample) <= now; sample++)
+            {
+                if (adaptation != nullptr)
+                {
+                    adaptation->Observe(TraceSamplingPeriod * static_cast<std::int32_t>(sample),
+                        RawRssi(trace.Rssi[sample]),
+                        RawDoppler(trace.Doppler[sample]));
+                }
+            }
+
+            const auto bitrate = adaptation != nullptr ? adaptation->Select(now) : fixed;
+            const auto airtime = DownlinkScheduler::FrameAirtime(bitrate);
+            const auto index = BitrateIndex(bitrate);
+
+            result.Sent[index]++;
+            if (SignalAt(trace, now + airtime / 2) >= Sensitivity[index])
+            {
+                result.Delivered++;
+            }
+
+            now += airtime;
+        }
+
+        return result;
+    }
+
+    TEST_P(AdaptiveBitrateSimulationTest, ShouldDeliverMoreDataThanFixedBitrate)
+    {
+        const auto trace = GetParam();
+        ASSERT_THAT(trace.Rssi.size(), Eq(trace.Doppler.size()));
+
+        BitrateAdaptation adaptation;
+
+        const auto slow = Simulate(trace, Bitrate::Comm1200bps, nullptr);
+        const auto fast = Simulate(trace, Bitrate::Comm9600bps, nullptr);
+        const auto adaptive = Simulate(trace, Bitrate::Comm1200bps, &adaptation);
+
+        std::printf("[ BENCH    ] %-10s 1200bps: %6u B, 9600bps: %6u B, adaptive: %6u B (frames at 1200/2400/4800/9600: %u/%u/%u/%u)\n",
+            trace.Name,
+            static_cast<unsigned>(slow.Delivered * FramePayload),
+            static_cast<unsigned>(fast.Delivered * FramePayload),
+            static_cast<unsigned>(adaptive.Delivered * FramePayload),
+            static_cast<unsigned>(adaptive.Sent[0]),
+            static_cast<unsigned>(adaptive.Sent[1]),
+            static_cast<unsigned>(adaptive.Sent[2]),
+            static_cast<unsigned>(adaptive.Sent[3]));
+
+        ASSERT_THAT(adaptive.Delivered, Gt(slow.Delivered));
+        ASSERT_THAT(adaptive.Delivered, Ge(fast.Delivered));
+    }
+
+    INSTANTIATE_TEST_CASE_P(AdaptiveBitrateSimulationTest,
+        AdaptiveBitrateSimulationTest,
+        testing::Values(PassTrace{"LowPass", LowPassRssi, LowPassDoppler},
+            PassTrace{"MediumPass", MediumPassRssi, MediumPassDoppler},
+            PassTrace{"HighPass", HighPassRssi, HighPassDoppler}), );
+}
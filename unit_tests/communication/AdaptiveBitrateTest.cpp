@@ -0,0 +1,284 @@
+#include <chrono>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "comm/Frame.hpp"
+#include "mock/comm.hpp"
+#include "obc/bitrate/adaptive_bitrate.hpp"
+
+using testing::_;
+using testing::Eq;
+using testing::NiceMock;
+using testing::Ref;
+using testing::Return;
+
+using devices::comm::Bitrate;
+using devices::comm::Frame;
+using devices::comm::ITransmitter;
+using obc::AdaptiveBitrateController;
+using obc::BitrateAdaptation;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    /**
+     * @brief Converts RSSI to raw value reported by receiver
+     * @param[in] dBm RSSI in dBm
+     * @return Raw RSSI
+     */
+    std::uint16_t RawRssi(double dBm)
+    {
+        return static_cast<std::uint16_t>((dBm + 152) / 0.03 + 0.5);
+    }
+
+    /**
+     * @brief Converts Doppler offset to raw value reported by receiver
+     * @param[in] hz Doppler offset in Hz
+     * @return Raw Doppler offset
+     */
+    std::uint16_t RawDoppler(double hz)
+    {
+        return static_cast<std::uint16_t>((hz + 22300) / 13.352 + 0.5);
+    }
+
+    struct FrameHandlerMock : devices::comm::IHandleFrame
+    {
+        MOCK_METHOD2(HandleFrame, void(ITransmitter&, Frame&));
+    };
+
+    class BitrateAdaptationTest : public testing::Test
+    {
+      protected:
+        void Observe(std::chrono::milliseconds at, double dBm, double dopplerHz = 0);
+
+        void ObserveSteady(std::chrono::milliseconds from, std::chrono::milliseconds to, double dBm, double dopplerHz = 0);
+
+        BitrateAdaptation adaptation;
+    };
+
+    void BitrateAdaptationTest::Observe(std::chrono::milliseconds at, double dBm, double dopplerHz)
+    {
+        adaptation.Observe(at, RawRssi(dBm), RawDoppler(dopplerHz));
+    }
+
+    void BitrateAdaptationTest::ObserveSteady(std::chrono::milliseconds from, std::chrono::milliseconds to, double dBm, double dopplerHz)
+    {
+        for (auto at = from; at <= to; at += 1s)
+        {
+            Observe(at, dBm, dopplerHz);
+        }
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldConvertReceiverMeasurements)
+    {
+        ASSERT_THAT(BitrateAdaptation::RssiToCentiDbm(0), Eq(-15200));
+        ASSERT_THAT(BitrateAdaptation::RssiToCentiDbm(1600), Eq(-10400));
+        ASSERT_THAT(BitrateAdaptation::DopplerToHz(0), Eq(-22300));
+        ASSERT_THAT(BitrateAdaptation::DopplerToHz(2000), Eq(4404));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldStartAtLowestBitrate)
+    {
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm1200bps));
+        ASSERT_THAT(adaptation.Select(0ms), Eq(Bitrate::Comm1200bps));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldUpgradeAfterRequiredNumberOfGoodObservations)
+    {
+        Observe(0s, -100);
+        Observe(1s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm1200bps));
+
+        Observe(2s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm2400bps));
+        ASSERT_THAT(adaptation.Select(2s), Eq(Bitrate::Comm2400bps));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldStepUpSingleBitrateAfterMinimumDwell)
+    {
+        ObserveSteady(0s, 2s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm2400bps));
+
+        ObserveSteady(3s, 13s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm2400bps));
+
+        ObserveSteady(14s, 14s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm4800bps));
+
+        ObserveSteady(15s, 25s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm4800bps));
+
+        ObserveSteady(26s, 26s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm9600bps));
+
+        ObserveSteady(27s, 60s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm9600bps));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldStopAtBitrateSupportedBySignalLevel)
+    {
+        ObserveSteady(0s, 60s, -110);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm2400bps));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldRestartCountingObservationsAfterWeakOne)
+    {
+        Observe(0s, -111);
+        Observe(1s, -111);
+        Observe(2s, -125);
+        Observe(3s, -111);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm1200bps));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldKeepBitrateWithinHysteresis)
+    {
+        ObserveSteady(0s, 2s, -111);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm2400bps));
+
+        for (auto at = 20s; at <= 400s; at += 20s)
+        {
+            Observe(at, -113.5);
+        }
+
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm2400bps));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldDowngradeImmediatelyWhenSignalDrops)
+    {
+        ObserveSteady(0s, 26s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm9600bps));
+
+        Observe(27s, -120);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm4800bps));
+
+        Observe(28s, -120);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm2400bps));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldNotUpgradeWhenSignalIsFading)
+    {
+        double level = -95;
+        for (auto at = 0s; at <= 30s; at += 1s)
+        {
+            Observe(at, level);
+            level -= 1.0;
+        }
+
+        ASSERT_THAT(adaptation.SignalTrend(), testing::Lt(-50));
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm1200bps));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldNotUpgradeWhenSatelliteIsReceding)
+    {
+        ObserveSteady(0s, 30s, -100, -3000);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm1200bps));
+
+        ObserveSteady(31s, 33s, -100, 3000);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm2400bps));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldFallBackToLowestBitrateAfterSilence)
+    {
+        ObserveSteady(0s, 26s, -100);
+        ASSERT_THAT(adaptation.Select(26s), Eq(Bitrate::Comm9600bps));
+
+        ASSERT_THAT(adaptation.Select(26s + BitrateAdaptation::SilenceTimeout - 1ms), Eq(Bitrate::Comm9600bps));
+        ASSERT_THAT(adaptation.Select(26s + BitrateAdaptation::SilenceTimeout), Eq(Bitrate::Comm1200bps));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldStartNewPassFromScratch)
+    {
+        ObserveSteady(0s, 26s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm9600bps));
+
+        Observe(200s, -125);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm1200bps));
+        ASSERT_THAT(adaptation.SignalLevel(), Eq(BitrateAdaptation::RssiToCentiDbm(RawRssi(-125))));
+    }
+
+    TEST_F(BitrateAdaptationTest, ShouldKeepForcedBitrateUntilEndOfPass)
+    {
+        ObserveSteady(0s, 5s, -100);
+        adaptation.Force(5s, Bitrate::Comm1200bps);
+
+        ObserveSteady(6s, 60s, -100);
+        ASSERT_THAT(adaptation.Select(60s), Eq(Bitrate::Comm1200bps));
+
+        adaptation.Force(61s, Bitrate::Comm9600bps);
+        ObserveSteady(62s, 70s, -125);
+        ASSERT_THAT(adaptation.Select(70s), Eq(Bitrate::Comm9600bps));
+
+        ASSERT_THAT(adaptation.Select(70s + BitrateAdaptation::SilenceTimeout), Eq(Bitrate::Comm1200bps));
+
+        ObserveSteady(200s, 202s, -100);
+        ASSERT_THAT(adaptation.Current(), Eq(Bitrate::Comm2400bps));
+    }
+
+    class AdaptiveBitrateControllerTest : public testing::Test
+    {
+      protected:
+        AdaptiveBitrateControllerTest();
+
+        NiceMock<OSMock> os;
+        OSReset osReset;
+
+        NiceMock<FrameHandlerMock> handler;
+        TransmitterMock transmitter;
+
+        AdaptiveBitrateController controller;
+    };
+
+    AdaptiveBitrateControllerTest::AdaptiveBitrateControllerTest()
+    {
+        this->osReset = InstallProxy(&os);
+        controller.SetFrameHandler(handler);
+    }
+
+    TEST_F(AdaptiveBitrateControllerTest, ShouldPassFramesToHandler)
+    {
+        Frame frame(RawDoppler(0), RawRssi(-100), 0, gsl::span<std::uint8_t>());
+
+        EXPECT_CALL(handler, HandleFrame(Ref(transmitter), Ref(frame)));
+
+        controller.HandleFrame(transmitter, frame);
+    }
+
+    TEST_F(AdaptiveBitrateControllerTest, ShouldSelectBitrateBasedOnReceivedFrames)
+    {
+        Frame frame(RawDoppler(0), RawRssi(-100), 0, gsl::span<std::uint8_t>());
+
+        EXPECT_CALL(os, GetUptime()).WillOnce(Return(1s)).WillOnce(Return(2s)).WillOnce(Return(3s)).WillOnce(Return(4s));
+
+        controller.HandleFrame(transmitter, frame);
+        controller.HandleFrame(transmitter, frame);
+        controller.HandleFrame(transmitter, frame);
+
+        ASSERT_THAT(controller.SelectBitrate(Bitrate::Comm1200bps), Eq(Bitrate::Comm2400bps));
+        ASSERT_THAT(controller.Current(), Eq(Bitrate::Comm2400bps));
+    }
+
+    TEST_F(AdaptiveBitrateControllerTest, ShouldIgnoreFramesWithInvalidMeasurements)
+    {
+        Frame frame(RawDoppler(0), 0xF000, 0, gsl::span<std::uint8_t>());
+
+        EXPECT_CALL(os, GetUptime()).WillRepeatedly(Return(1s));
+        EXPECT_CALL(handler, HandleFrame(_, _)).Times(3);
+
+        controller.HandleFrame(transmitter, frame);
+        controller.HandleFrame(transmitter, frame);
+        controller.HandleFrame(transmitter, frame);
+
+        ASSERT_THAT(controller.Current(), Eq(Bitrate::Comm1200bps));
+    }
+
+    TEST_F(AdaptiveBitrateControllerTest, ShouldKeepForcedBitrate)
+    {
+        EXPECT_CALL(os, GetUptime()).WillRepeatedly(Return(1s));
+
+        controller.BitrateForced(Bitrate::Comm4800bps);
+
+        ASSERT_THAT(controller.SelectBitrate(Bitrate::Comm4800bps), Eq(Bitrate::Comm4800bps));
+    }
+}
@@ -0,0 +1,435 @@
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "comm/Frame.hpp"
+#include "mock/comm.hpp"
+#include "os/QueueFake.hpp"
+#include "telecommunication/DownlinkScheduler.hpp"
+#include "telecommunication/downlink.h"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Eq;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+using testing::InSequence;
+using testing::NiceMock;
+using testing::Return;
+using testing::DoAll;
+using testing::SetArgReferee;
+using testing::StrictMock;
+
+using devices::comm::Bitrate;
+using devices::comm::ITransmitter;
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::DownlinkPriority;
+using telecommunication::downlink::DownlinkScheduler;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    struct FrameHandlerMock : devices::comm::IHandleFrame
+    {
+        MOCK_METHOD2(HandleFrame, void(ITransmitter&, devices::comm::Frame&));
+    };
+
+    struct BitrateSelectorMock : telecommunication::downlink::IDownlinkBitrateSelector
+    {
+        MOCK_METHOD1(SelectBitrate, Bitrate(Bitrate));
+        MOCK_METHOD1(BitrateForced, void(Bitrate));
+    };
+
+    class DownlinkSchedulerTest : public testing::Test
+    {
+      protected:
+        DownlinkSchedulerTest();
+
+        NiceMock<OSMock> os;
+        OSReset osReset;
+
+        StrictMock<BufferedTransmitterMock> transmitter;
+
+        DownlinkScheduler scheduler;
+
+        QueueFake queues;
+    };
+
+    DownlinkSchedulerTest::DownlinkSchedulerTest() : scheduler(transmitter)
+    {
+        this->osReset = InstallProxy(&os);
+
+        queues.Install(os);
+
+        ON_CALL(os, CreateEventGroup()).WillByDefault(Return(reinterpret_cast<OSEventGroupHandle>(1)));
+        ON_CALL(os, CreateTask(_, _, _, _, _, _)).WillByDefault(Return(OSResult::Success));
+
+        EXPECT_THAT(scheduler.Initialize(), Eq(OSResult::Success));
+    }
+
+    MATCHER_P(FrameStartsWith, value, "")
+    {
+        return arg.size() > 0 && arg[0] == value;
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldNotTransmitWhenQueuesAreEmpty)
+    {
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(false));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldEnqueueFrameInsteadOfSendingIt)
+    {
+        const std::uint8_t frame[] = {num(DownlinkAPID::Pong), 0, 0, 1, 2, 3};
+
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+
+        EXPECT_CALL(transmitter, SendFrame(ElementsAre(num(DownlinkAPID::Pong), 0, 0, 1, 2, 3), _))
+            .WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(false));
+
+        const auto stats = scheduler.Statistics();
+        ASSERT_THAT(stats.Sent, Eq(1u));
+        ASSERT_THAT(stats.FreeSlots, Eq(10));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldSendFramesInPriorityOrder)
+    {
+        const std::uint8_t bulk[] = {num(DownlinkAPID::FileSend), 0, 0};
+        const std::uint8_t response[] = {num(DownlinkAPID::Operation), 0, 0};
+        const std::uint8_t beacon[] = {telecommunication::downlink::BeaconMarker, 0, 0};
+
+        ASSERT_THAT(scheduler.SendFrame(bulk), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(response), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(beacon), Eq(true));
+
+        {
+            InSequence s;
+            EXPECT_CALL(transmitter, SendFrame(FrameStartsWith(telecommunication::downlink::BeaconMarker), _))
+                .WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+            EXPECT_CALL(transmitter, SendFrame(FrameStartsWith(num(DownlinkAPID::Operation)), _))
+                .WillOnce(DoAll(SetArgReferee<1>(9), Return(true)));
+            EXPECT_CALL(transmitter, SendFrame(FrameStartsWith(num(DownlinkAPID::FileSend)), _))
+                .WillOnce(DoAll(SetArgReferee<1>(8), Return(true)));
+        }
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(false));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldSendResponseBeforeQueuedTelemetryRange)
+    {
+        const std::uint8_t record[] = {num(DownlinkAPID::TelemetryRange), 0, 0};
+        const std::uint8_t completed[] = {num(DownlinkAPID::TelemetryRangeCompleted), 0, 0};
+        const std::uint8_t response[] = {num(DownlinkAPID::Pong), 0, 0};
+
+        ASSERT_THAT(scheduler.SendFrame(record), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(record), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(completed), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(response), Eq(true));
+
+        {
+            InSequence s;
+            EXPECT_CALL(transmitter, SendFrame(FrameStartsWith(num(DownlinkAPID::Pong)), _))
+                .WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+            EXPECT_CALL(transmitter, SendFrame(FrameStartsWith(num(DownlinkAPID::TelemetryRange)), _))
+                .Times(2)
+                .WillRepeatedly(DoAll(SetArgReferee<1>(10), Return(true)));
+            EXPECT_CALL(transmitter, SendFrame(FrameStartsWith(num(DownlinkAPID::TelemetryRangeCompleted)), _))
+                .WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+        }
+
+        for (auto i = 0; i < 4; i++)
+        {
+            ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        }
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(false));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldKeepOnlyLatestBeacon)
+    {
+        const std::uint8_t beacon1[] = {telecommunication::downlink::BeaconMarker, 1};
+        const std::uint8_t beacon2[] = {telecommunication::downlink::BeaconMarker, 2};
+
+        ASSERT_THAT(scheduler.SendFrame(beacon1), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(beacon2), Eq(true));
+
+        EXPECT_CALL(transmitter, SendFrame(ElementsAre(telecommunication::downlink::BeaconMarker, 2), _))
+            .WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(false));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldReportOverflowWhenQueueIsFull)
+    {
+        const std::uint8_t frame[] = {num(DownlinkAPID::FileSend), 0, 0};
+
+        for (auto i = 0; i < DownlinkScheduler::BulkQueueLength; i++)
+        {
+            ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+        }
+
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(false));
+        ASSERT_THAT(scheduler.Statistics().Overflows, Eq(1u));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldWaitForFreeSlotWhenTransmitterBufferIsFull)
+    {
+        const std::uint8_t frame[] = {num(DownlinkAPID::FileSend), 0, 0};
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+
+        EXPECT_CALL(transmitter, SendFrame(_, _)).WillOnce(DoAll(SetArgReferee<1>(0), Return(true)));
+        EXPECT_CALL(os, Sleep(DownlinkScheduler::FrameAirtime(Bitrate::Comm1200bps)));
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldNotWaitWhenTransmitterHasFreeSlots)
+    {
+        const std::uint8_t frame[] = {num(DownlinkAPID::FileSend), 0, 0};
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+
+        EXPECT_CALL(transmitter, SendFrame(_, _)).WillOnce(DoAll(SetArgReferee<1>(1), Return(true)));
+        EXPECT_CALL(os, Sleep(_)).Times(0);
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldRetryRejectedFrame)
+    {
+        const std::uint8_t frame[] = {num(DownlinkAPID::FileSend), 0, 0};
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+
+        {
+            InSequence s;
+            EXPECT_CALL(transmitter, SendFrame(_, _)).WillOnce(DoAll(SetArgReferee<1>(0xFF), Return(false)));
+            EXPECT_CALL(os, Sleep(DownlinkScheduler::FrameAirtime(Bitrate::Comm1200bps)));
+            EXPECT_CALL(transmitter, SendFrame(_, _)).WillOnce(DoAll(SetArgReferee<1>(3), Return(true)));
+        }
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+
+        const auto stats = scheduler.Statistics();
+        ASSERT_THAT(stats.Sent, Eq(1u));
+        ASSERT_THAT(stats.Rejected, Eq(1u));
+        ASSERT_THAT(stats.Dropped, Eq(0u));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldDropFrameAfterAllAttemptsFail)
+    {
+        const std::uint8_t frame[] = {num(DownlinkAPID::FileSend), 0, 0};
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+
+        EXPECT_CALL(transmitter, SendFrame(_, _))
+            .Times(DownlinkScheduler::MaxSendAttempts)
+            .WillRepeatedly(DoAll(SetArgReferee<1>(0xFF), Return(false)));
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+
+        const auto stats = scheduler.Statistics();
+        ASSERT_THAT(stats.Sent, Eq(0u));
+        ASSERT_THAT(stats.Rejected, Eq(static_cast<std::uint32_t>(DownlinkScheduler::MaxSendAttempts)));
+        ASSERT_THAT(stats.Dropped, Eq(1u));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldPaceFramesAccordingToBitrate)
+    {
+        EXPECT_CALL(transmitter, SetTransmitterBitRate(Bitrate::Comm9600bps)).WillOnce(Return(true));
+        ASSERT_THAT(scheduler.SetTransmitterBitRate(Bitrate::Comm9600bps), Eq(true));
+
+        const std::uint8_t frame[] = {num(DownlinkAPID::FileSend), 0, 0};
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+
+        EXPECT_CALL(transmitter, SendFrame(_, _)).WillOnce(DoAll(SetArgReferee<1>(0), Return(true)));
+        EXPECT_CALL(os, Sleep(DownlinkScheduler::FrameAirtime(Bitrate::Comm9600bps)));
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldCountSentFramesPerBitrate)
+    {
+        const std::uint8_t frame[] = {num(DownlinkAPID::FileSend), 0, 0};
+        EXPECT_CALL(transmitter, SendFrame(_, _)).WillRepeatedly(DoAll(SetArgReferee<1>(1), Return(true)));
+
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+
+        EXPECT_CALL(transmitter, SetTransmitterBitRate(Bitrate::Comm4800bps)).WillOnce(Return(true));
+        ASSERT_THAT(scheduler.SetTransmitterBitRate(Bitrate::Comm4800bps), Eq(true));
+
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+
+        ASSERT_THAT(scheduler.Statistics().SentPerBitrate, ElementsAre(1u, 0u, 2u, 0u));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldApplyBitrateRequestedBySelectorBeforeSendingFrame)
+    {
+        BitrateSelectorMock selector;
+        scheduler.SetBitrateSelector(selector);
+
+        const std::uint8_t frame[] = {num(DownlinkAPID::FileSend), 0, 0};
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+
+        {
+            InSequence s;
+            EXPECT_CALL(selector, SelectBitrate(Bitrate::Comm1200bps)).WillOnce(Return(Bitrate::Comm9600bps));
+            EXPECT_CALL(transmitter, SetTransmitterBitRate(Bitrate::Comm9600bps)).WillOnce(Return(true));
+            EXPECT_CALL(transmitter, SendFrame(_, _)).WillOnce(DoAll(SetArgReferee<1>(0), Return(true)));
+            EXPECT_CALL(os, Sleep(DownlinkScheduler::FrameAirtime(Bitrate::Comm9600bps)));
+        }
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.Statistics().SentPerBitrate, ElementsAre(0u, 0u, 0u, 1u));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldApplyBitrateRequestedBySelectorWhenThereIsNothingToSend)
+    {
+        BitrateSelectorMock selector;
+        scheduler.SetBitrateSelector(selector);
+
+        EXPECT_CALL(selector, SelectBitrate(Bitrate::Comm2400bps)).WillOnce(Return(Bitrate::Comm1200bps));
+        EXPECT_CALL(transmitter, SetTransmitterBitRate(Bitrate::Comm2400bps)).WillOnce(Return(true));
+        EXPECT_CALL(selector, BitrateForced(Bitrate::Comm2400bps));
+        ASSERT_THAT(scheduler.SetTransmitterBitRate(Bitrate::Comm2400bps), Eq(true));
+
+        EXPECT_CALL(transmitter, SetTransmitterBitRate(Bitrate::Comm1200bps)).WillOnce(Return(true));
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(false));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldKeepPacingAtPreviousBitrateWhenSwitchFails)
+    {
+        BitrateSelectorMock selector;
+        scheduler.SetBitrateSelector(selector);
+
+        const std::uint8_t frame[] = {num(DownlinkAPID::FileSend), 0, 0};
+        ASSERT_THAT(scheduler.SendFrame(frame), Eq(true));
+
+        EXPECT_CALL(selector, SelectBitrate(Bitrate::Comm1200bps)).WillOnce(Return(Bitrate::Comm4800bps));
+        EXPECT_CALL(transmitter, SetTransmitterBitRate(Bitrate::Comm4800bps)).WillOnce(Return(false));
+        EXPECT_CALL(transmitter, SendFrame(_, _)).WillOnce(DoAll(SetArgReferee<1>(0), Return(true)));
+        EXPECT_CALL(os, Sleep(DownlinkScheduler::FrameAirtime(Bitrate::Comm1200bps)));
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.Statistics().SentPerBitrate, ElementsAre(1u, 0u, 0u, 0u));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldCalculateFrameAirtime)
+    {
+        ASSERT_THAT(DownlinkScheduler::FrameAirtime(Bitrate::Comm1200bps), Eq(1700ms));
+        ASSERT_THAT(DownlinkScheduler::FrameAirtime(Bitrate::Comm9600bps), Eq(213ms));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldPackQueuedShortResponses)
+    {
+        const std::uint8_t bitrate[] = {num(DownlinkAPID::SetBitrate), 0, 0, 0x11, 0x00};
+        const std::uint8_t timeSet[] = {num(DownlinkAPID::TimeSet), 0, 0, 0x12, 0x00, 0x01};
+        const std::uint8_t periodicSet[] = {num(DownlinkAPID::PeriodicSet), 0, 0, 0x13};
+
+        ASSERT_THAT(scheduler.SendFrame(bitrate), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(timeSet), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(periodicSet), Eq(true));
+
+        EXPECT_CALL(transmitter,
+            SendFrame(ElementsAre(num(DownlinkAPID::Packed),
+                          0,
+                          0,
+                          num(DownlinkAPID::SetBitrate),
+                          2,
+                          0x11,
+                          0x00,
+                          num(DownlinkAPID::TimeSet),
+                          3,
+                          0x12,
+                          0x00,
+                          0x01,
+                          num(DownlinkAPID::PeriodicSet),
+                          1,
+                          0x13),
+                _))
+            .WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(false));
+
+        const auto stats = scheduler.Statistics();
+        ASSERT_THAT(stats.Sent, Eq(1u));
+        ASSERT_THAT(stats.Packed, Eq(3u));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldWaitForMoreResponsesWithinPackingWindow)
+    {
+        const std::uint8_t response[] = {num(DownlinkAPID::Operation), 0, 0, 1};
+        ASSERT_THAT(scheduler.SendFrame(response), Eq(true));
+
+        EXPECT_CALL(os, QueueReceive(_, _, _)).Times(AnyNumber());
+        EXPECT_CALL(os, QueueReceive(_, _, DownlinkScheduler::PackingWindow)).WillOnce(Return(false));
+        EXPECT_CALL(transmitter, SendFrame(ElementsAre(num(DownlinkAPID::Operation), 0, 0, 1), _))
+            .WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.Statistics().Packed, Eq(0u));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldSendResponseThatDoesNotFitInNextFrame)
+    {
+        std::uint8_t first[150] = {num(DownlinkAPID::Operation), 0, 0, 1};
+        std::uint8_t second[150] = {num(DownlinkAPID::Operation), 0, 0, 2};
+        const std::uint8_t third[] = {num(DownlinkAPID::TimeSet), 0, 0, 3};
+
+        ASSERT_THAT(scheduler.SendFrame(first), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(second), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(third), Eq(true));
+
+        {
+            InSequence s;
+            EXPECT_CALL(transmitter, SendFrame(ElementsAreArray(first), _)).WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+            EXPECT_CALL(transmitter, SendFrame(FrameStartsWith(num(DownlinkAPID::Packed)), _))
+                .WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+        }
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(false));
+        ASSERT_THAT(scheduler.Statistics().Packed, Eq(2u));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldNotPackMultiFrameResponses)
+    {
+        const std::uint8_t list1[] = {num(DownlinkAPID::FileList), 0, 0, 1};
+        const std::uint8_t list2[] = {num(DownlinkAPID::FileList) | 0x40, 0, 0, 2};
+
+        ASSERT_THAT(scheduler.SendFrame(list1), Eq(true));
+        ASSERT_THAT(scheduler.SendFrame(list2), Eq(true));
+
+        {
+            InSequence s;
+            EXPECT_CALL(transmitter, SendFrame(ElementsAreArray(list1), _)).WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+            EXPECT_CALL(transmitter, SendFrame(ElementsAreArray(list2), _)).WillOnce(DoAll(SetArgReferee<1>(10), Return(true)));
+        }
+
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.TransmitNext(0ms), Eq(true));
+        ASSERT_THAT(scheduler.Statistics().Packed, Eq(0u));
+    }
+
+    TEST_F(DownlinkSchedulerTest, ShouldPassItselfAsTransmitterToFrameHandler)
+    {
+        FrameHandlerMock handler;
+        scheduler.SetFrameHandler(handler);
+
+        devices::comm::Frame frame;
+        EXPECT_CALL(handler, HandleFrame(testing::Ref(scheduler), _));
+
+        scheduler.HandleFrame(transmitter, frame);
+    }
+}
@@ -20,6 +20,7 @@ using testing::Invoke;
 using testing::_;
 using testing::Eq;
 using testing::StrEq;
+using testing::Ref;
 
 using devices::comm::Frame;
 using devices::comm::ITransmitter;
@@ -37,18 +38,26 @@ namespace
         MOCK_CONST_METHOD0(CommandCode, uint8_t());
     };
 
+    struct TelecommandExecutorMock : public IExecuteTelecommand
+    {
+        MOCK_METHOD3(Execute, void(ITransmitter&, IHandleTeleCommand&, span<const uint8_t> parameters));
+    };
+
     class TeleCommandHandlingTest : public Test
     {
       public:
         TeleCommandHandlingTest();
 
       protected:
+        TelecommandStatistics statistics;
+        TelecommandIndex emptyIndex;
         IncomingTelecommandHandler handling;
         NiceMock<TeleCommandDepsMock> deps;
         TransmitterMock transmitter;
     };
 
-    TeleCommandHandlingTest::TeleCommandHandlingTest() : handling(deps, span<IHandleTeleCommand*, 0>())
+    TeleCommandHandlingTest::TeleCommandHandlingTest()
+        : emptyIndex(BuildTelecommandIndex<>()), handling(deps, span<IHandleTeleCommand*, 0>(), emptyIndex, statistics)
     {
     }
 
@@ -75,8 +84,89 @@ namespace
         EXPECT_CALL(someCommand, CommandCode()).WillRepeatedly(Return(static_cast<uint8_t>('A')));
 
         IHandleTeleCommand* commands[] = {&someCommand};
+        auto index = BuildTelecommandIndex(commands);
+
+        IncomingTelecommandHandler handler(deps, span<IHandleTeleCommand*>(commands), index, statistics);
+
+        handler.HandleFrame(this->transmitter, frame);
+
+        ASSERT_THAT(statistics.Get('A').Invocations, Eq(1));
+        ASSERT_THAT(statistics.Get('A').Failures, Eq(0));
+    }
+
+    TEST_F(TeleCommandHandlingTest, UnknownTelecommandShouldBeRecordedAsFailure)
+    {
+        std::uint8_t buffer[40] = "BCD";
+        Frame frame(0, 0, 0, buffer);
+
+        EXPECT_CALL(this->deps, Decode(_)).WillOnce(Invoke([](span<const uint8_t> frame) {
+            return DecodeTelecommandResult::Success(frame[0], frame.subspan(1, frame.length() - 1));
+        }));
+
+        NiceMock<TeleCommandHandlerMock> someCommand;
+        EXPECT_CALL(someCommand, Handle(_, _)).Times(0);
+        EXPECT_CALL(someCommand, CommandCode()).WillRepeatedly(Return(static_cast<uint8_t>('A')));
+
+        IHandleTeleCommand* commands[] = {&someCommand};
+        auto index = BuildTelecommandIndex(commands);
+
+        IncomingTelecommandHandler handler(deps, span<IHandleTeleCommand*>(commands), index, statistics);
+
+        handler.HandleFrame(this->transmitter, frame);
+
+        ASSERT_THAT(statistics.Get('B').Invocations, Eq(0));
+        ASSERT_THAT(statistics.Get('B').Failures, Eq(1));
+    }
+
+    TEST_F(TeleCommandHandlingTest, HandlerShouldBeFoundAmongManyTelecommands)
+    {
+        std::uint8_t buffer[40] = "\xF0" "ABCD";
+        Frame frame(0, 0, 0, buffer);
+
+        EXPECT_CALL(this->deps, Decode(_)).WillOnce(Invoke([](span<const uint8_t> frame) {
+            return DecodeTelecommandResult::Success(frame[0], frame.subspan(1, frame.length() - 1));
+        }));
+
+        NiceMock<TeleCommandHandlerMock> first;
+        NiceMock<TeleCommandHandlerMock> second;
+        NiceMock<TeleCommandHandlerMock> third;
+        ON_CALL(first, CommandCode()).WillByDefault(Return(0x01));
+        ON_CALL(second, CommandCode()).WillByDefault(Return(0xF0));
+        ON_CALL(third, CommandCode()).WillByDefault(Return(0x02));
+
+        EXPECT_CALL(first, Handle(_, _)).Times(0);
+        EXPECT_CALL(second, Handle(Ref(this->transmitter), _));
+        EXPECT_CALL(third, Handle(_, _)).Times(0);
+
+        IHandleTeleCommand* commands[] = {&first, &second, &third};
+        auto index = BuildTelecommandIndex(commands);
+
+        IncomingTelecommandHandler handler(deps, span<IHandleTeleCommand*>(commands), index, statistics);
+
+        handler.HandleFrame(this->transmitter, frame);
+    }
+
+    TEST_F(TeleCommandHandlingTest, HandlerShouldBePassedToExecutorWhenSet)
+    {
+        std::uint8_t buffer[40] = "ABCD";
+        Frame frame(0, 0, 0, buffer);
+
+        EXPECT_CALL(this->deps, Decode(_)).WillOnce(Invoke([](span<const uint8_t> frame) {
+            return DecodeTelecommandResult::Success(frame[0], frame.subspan(1, frame.length() - 1));
+        }));
+
+        NiceMock<TeleCommandHandlerMock> someCommand;
+        EXPECT_CALL(someCommand, Handle(_, _)).Times(0);
+        EXPECT_CALL(someCommand, CommandCode()).WillRepeatedly(Return(static_cast<uint8_t>('A')));
+
+        TelecommandExecutorMock executor;
+        EXPECT_CALL(executor, Execute(testing::Ref(this->transmitter), testing::Ref(someCommand), _));
+
+        IHandleTeleCommand* commands[] = {&someCommand};
+        auto index = BuildTelecommandIndex(commands);
 
-        IncomingTelecommandHandler handler(deps, span<IHandleTeleCommand*>(commands));
+        IncomingTelecommandHandler handler(deps, span<IHandleTeleCommand*>(commands), index, statistics);
+        handler.SetExecutor(executor);
 
         handler.HandleFrame(this->transmitter, frame);
     }
@@ -90,7 +180,9 @@ namespace
 
         IHandleTeleCommand* telecommands[] = {&someCommand};
 
-        IncomingTelecommandHandler handler(this->deps, span<IHandleTeleCommand*>(telecommands));
+        auto index = BuildTelecommandIndex(telecommands);
+
+        IncomingTelecommandHandler handler(this->deps, span<IHandleTeleCommand*>(telecommands), index, statistics);
 
         Frame frame;
 
@@ -0,0 +1,195 @@
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "mock/comm.hpp"
+#include "os/QueueFake.hpp"
+#include "telecommunication/TelecommandExecutor.hpp"
+
+using testing::_;
+using testing::Eq;
+using testing::ElementsAre;
+using testing::InSequence;
+using testing::NiceMock;
+using testing::Ref;
+using testing::Return;
+
+using devices::comm::ITransmitter;
+using telecommunication::uplink::ExecutionLane;
+using telecommunication::uplink::IHandleTeleCommand;
+using telecommunication::uplink::TelecommandExecutor;
+using telecommunication::uplink::TelecommandStatistics;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    struct TelecommandMock : public IHandleTeleCommand
+    {
+        MOCK_METHOD2(Handle, void(ITransmitter&, gsl::span<const std::uint8_t>));
+        MOCK_CONST_METHOD0(CommandCode, std::uint8_t());
+    };
+
+    static const std::uint8_t FastLaneCodes[] = {0x50, 0x0E};
+
+    class TelecommandExecutorTest : public testing::Test
+    {
+      protected:
+        TelecommandExecutorTest();
+
+        NiceMock<OSMock> os;
+        OSReset osReset;
+        QueueFake queues;
+
+        TransmitterMock transmitter;
+        NiceMock<TelecommandMock> fastCommand;
+        NiceMock<TelecommandMock> normalCommand;
+
+        TelecommandStatistics telecommandStatistics;
+        TelecommandExecutor executor;
+    };
+
+    TelecommandExecutorTest::TelecommandExecutorTest() : executor(FastLaneCodes, telecommandStatistics)
+    {
+        this->osReset = InstallProxy(&os);
+        queues.Install(os);
+
+        ON_CALL(os, CreateTask(_, _, _, _, _, _)).WillByDefault(Return(OSResult::Success));
+        ON_CALL(fastCommand, CommandCode()).WillByDefault(Return(0x0E));
+        ON_CALL(normalCommand, CommandCode()).WillByDefault(Return(0xAB));
+
+        EXPECT_THAT(executor.Initialize(), Eq(OSResult::Success));
+    }
+
+    TEST_F(TelecommandExecutorTest, ShouldAssignLanes)
+    {
+        ASSERT_THAT(executor.LaneFor(0x50), Eq(ExecutionLane::Fast));
+        ASSERT_THAT(executor.LaneFor(0x0E), Eq(ExecutionLane::Fast));
+        ASSERT_THAT(executor.LaneFor(0xAB), Eq(ExecutionLane::Normal));
+    }
+
+    TEST_F(TelecommandExecutorTest, ShouldNotRunTelecommandInline)
+    {
+        const std::uint8_t parameters[] = {1, 2, 3};
+
+        EXPECT_CALL(normalCommand, Handle(_, _)).Times(0);
+
+        executor.Execute(transmitter, normalCommand, parameters);
+
+        ASSERT_THAT(executor.Statistics(ExecutionLane::Normal).Depth, Eq(1));
+    }
+
+    TEST_F(TelecommandExecutorTest, ShouldRunQueuedTelecommandWithCopiedParameters)
+    {
+        std::uint8_t parameters[] = {1, 2, 3};
+
+        executor.Execute(transmitter, normalCommand, parameters);
+        parameters[0] = 0xFF;
+
+        EXPECT_CALL(normalCommand, Handle(Ref(transmitter), ElementsAre(1, 2, 3)));
+
+        ASSERT_THAT(executor.ExecuteNext(ExecutionLane::Normal, 0ms), Eq(true));
+        ASSERT_THAT(executor.ExecuteNext(ExecutionLane::Normal, 0ms), Eq(false));
+
+        const auto stats = executor.Statistics(ExecutionLane::Normal);
+        ASSERT_THAT(stats.Executed, Eq(1u));
+        ASSERT_THAT(stats.Depth, Eq(0));
+        ASSERT_THAT(stats.MaxDepth, Eq(1));
+    }
+
+    TEST_F(TelecommandExecutorTest, ShouldSeparateFastLane)
+    {
+        const std::uint8_t parameters[] = {1};
+
+        executor.Execute(transmitter, normalCommand, parameters);
+        executor.Execute(transmitter, fastCommand, parameters);
+
+        EXPECT_CALL(fastCommand, Handle(_, _)).Times(1);
+        EXPECT_CALL(normalCommand, Handle(_, _)).Times(0);
+
+        ASSERT_THAT(executor.ExecuteNext(ExecutionLane::Fast, 0ms), Eq(true));
+        ASSERT_THAT(executor.ExecuteNext(ExecutionLane::Fast, 0ms), Eq(false));
+
+        ASSERT_THAT(executor.Statistics(ExecutionLane::Fast).Executed, Eq(1u));
+        ASSERT_THAT(executor.Statistics(ExecutionLane::Normal).Depth, Eq(1));
+    }
+
+    TEST_F(TelecommandExecutorTest, ShouldPreserveOrderWithinLane)
+    {
+        const std::uint8_t first[] = {1};
+        const std::uint8_t second[] = {2};
+
+        executor.Execute(transmitter, normalCommand, first);
+        executor.Execute(transmitter, normalCommand, second);
+
+        {
+            InSequence s;
+            EXPECT_CALL(normalCommand, Handle(_, ElementsAre(1)));
+            EXPECT_CALL(normalCommand, Handle(_, ElementsAre(2)));
+        }
+
+        ASSERT_THAT(executor.ExecuteNext(ExecutionLane::Normal, 0ms), Eq(true));
+        ASSERT_THAT(executor.ExecuteNext(ExecutionLane::Normal, 0ms), Eq(true));
+    }
+
+    TEST_F(TelecommandExecutorTest, ShouldRejectTelecommandWhenQueueIsFull)
+    {
+        const std::uint8_t parameters[] = {1};
+
+        for (auto i = 0; i < TelecommandExecutor::NormalLaneQueueLength; i++)
+        {
+            executor.Execute(transmitter, normalCommand, parameters);
+        }
+
+        executor.Execute(transmitter, normalCommand, parameters);
+
+        const auto stats = executor.Statistics(ExecutionLane::Normal);
+        ASSERT_THAT(stats.Rejected, Eq(1u));
+        ASSERT_THAT(stats.Depth, Eq(TelecommandExecutor::NormalLaneQueueLength));
+        ASSERT_THAT(stats.MaxDepth, Eq(TelecommandExecutor::NormalLaneQueueLength));
+
+        ASSERT_THAT(telecommandStatistics.Get(0xAB).Failures, Eq(1));
+    }
+
+    TEST_F(TelecommandExecutorTest, ShouldRecordTelecommandExecutionTime)
+    {
+        const std::uint8_t parameters[] = {1};
+
+        EXPECT_CALL(os, GetUptime()).WillOnce(Return(10s)).WillOnce(Return(10s)).WillOnce(Return(10s)).WillOnce(Return(10250ms));
+
+        executor.Execute(transmitter, normalCommand, parameters);
+
+        ASSERT_THAT(executor.ExecuteNext(ExecutionLane::Normal, 0ms), Eq(true));
+
+        const auto entry = telecommandStatistics.Get(0xAB);
+        ASSERT_THAT(entry.Invocations, Eq(1));
+        ASSERT_THAT(entry.Failures, Eq(0));
+        ASSERT_THAT(entry.WorstExecutionTime, Eq(250));
+    }
+
+    TEST_F(TelecommandExecutorTest, ShouldTrackWaitTime)
+    {
+        const std::uint8_t parameters[] = {1};
+
+        // enqueue, enqueue, then for each run: dequeue, handler start, handler end
+        EXPECT_CALL(os, GetUptime())
+            .WillOnce(Return(10s))
+            .WillOnce(Return(10s))
+            .WillOnce(Return(12s))
+            .WillOnce(Return(12s))
+            .WillOnce(Return(12s))
+            .WillOnce(Return(13s))
+            .WillOnce(Return(13s))
+            .WillOnce(Return(13s));
+
+        executor.Execute(transmitter, normalCommand, parameters);
+        executor.Execute(transmitter, normalCommand, parameters);
+
+        ASSERT_THAT(executor.ExecuteNext(ExecutionLane::Normal, 0ms), Eq(true));
+        ASSERT_THAT(executor.ExecuteNext(ExecutionLane::Normal, 0ms), Eq(true));
+
+        const auto stats = executor.Statistics(ExecutionLane::Normal);
+        ASSERT_THAT(stats.LastWait, Eq(3s));
+        ASSERT_THAT(stats.MaxWait, Eq(3s));
+    }
+}
@@ -0,0 +1,132 @@
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "mock/comm.hpp"
+#include "telecommunication/telecommand_handling.h"
+
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+
+using devices::comm::ITransmitter;
+using telecommunication::uplink::BuildTelecommandIndex;
+using telecommunication::uplink::IHandleTeleCommand;
+using telecommunication::uplink::TelecommandIndex;
+using telecommunication::uplink::TelecommandStatistics;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    struct TelecommandMock : public IHandleTeleCommand
+    {
+        MOCK_METHOD2(Handle, void(ITransmitter&, gsl::span<const std::uint8_t>));
+        MOCK_CONST_METHOD0(CommandCode, std::uint8_t());
+    };
+
+    constexpr TelecommandIndex StaticIndex = BuildTelecommandIndex<0x10, 0x02, 0xFF>();
+
+    static_assert(StaticIndex.Slots[0x10] == 1, "Invalid slot for first telecommand");
+    static_assert(StaticIndex.Slots[0x02] == 2, "Invalid slot for second telecommand");
+    static_assert(StaticIndex.Slots[0xFF] == 3, "Invalid slot for last telecommand");
+    static_assert(StaticIndex.Slots[0x00] == 0, "Unused code should not have slot");
+    static_assert(StaticIndex.Slots[0x11] == 0, "Unused code should not have slot");
+
+    class TelecommandStatisticsTest : public testing::Test
+    {
+      protected:
+        TelecommandStatisticsTest();
+
+        NiceMock<OSMock> os;
+        OSReset osReset;
+
+        TransmitterMock transmitter;
+
+        TelecommandStatistics statistics;
+    };
+
+    TelecommandStatisticsTest::TelecommandStatisticsTest()
+    {
+        this->osReset = InstallProxy(&os);
+    }
+
+    TEST_F(TelecommandStatisticsTest, ShouldStartWithEmptyStatistics)
+    {
+        for (auto code = 0; code < 256; code++)
+        {
+            const auto entry = statistics.Get(code);
+            ASSERT_THAT(entry.Invocations, Eq(0));
+            ASSERT_THAT(entry.Failures, Eq(0));
+            ASSERT_THAT(entry.WorstExecutionTime, Eq(0));
+        }
+    }
+
+    TEST_F(TelecommandStatisticsTest, ShouldTrackWorstExecutionTime)
+    {
+        statistics.RecordExecution(0x12, 20ms);
+        statistics.RecordExecution(0x12, 150ms);
+        statistics.RecordExecution(0x12, 30ms);
+        statistics.RecordFailure(0x12);
+
+        const auto entry = statistics.Get(0x12);
+        ASSERT_THAT(entry.Invocations, Eq(3));
+        ASSERT_THAT(entry.Failures, Eq(1));
+        ASSERT_THAT(entry.WorstExecutionTime, Eq(150));
+
+        ASSERT_THAT(statistics.Get(0x13).Invocations, Eq(0));
+    }
+
+    TEST_F(TelecommandStatisticsTest, ShouldSaturateCounters)
+    {
+        for (auto i = 0; i < 0x10005; i++)
+        {
+            statistics.RecordExecution(0x12, 1ms);
+            statistics.RecordFailure(0x12);
+        }
+
+        statistics.RecordExecution(0x12, 100s);
+
+        const auto entry = statistics.Get(0x12);
+        ASSERT_THAT(entry.Invocations, Eq(0xFFFF));
+        ASSERT_THAT(entry.Failures, Eq(0xFFFF));
+        ASSERT_THAT(entry.WorstExecutionTime, Eq(0xFFFF));
+    }
+
+    TEST_F(TelecommandStatisticsTest, ShouldMeasureHandlerExecution)
+    {
+        NiceMock<TelecommandMock> telecommand;
+        ON_CALL(telecommand, CommandCode()).WillByDefault(Return(0x21));
+
+        const std::uint8_t parameters[] = {1, 2};
+
+        EXPECT_CALL(os, GetUptime()).WillOnce(Return(5s)).WillOnce(Return(5040ms));
+        EXPECT_CALL(telecommand, Handle(testing::Ref(transmitter), testing::ElementsAre(1, 2)));
+
+        statistics.Execute(transmitter, telecommand, parameters);
+
+        const auto entry = statistics.Get(0x21);
+        ASSERT_THAT(entry.Invocations, Eq(1));
+        ASSERT_THAT(entry.WorstExecutionTime, Eq(40));
+    }
+
+    TEST_F(TelecommandStatisticsTest, RuntimeIndexShouldPreferFirstHandlerForDuplicatedCode)
+    {
+        NiceMock<TelecommandMock> first;
+        NiceMock<TelecommandMock> second;
+        NiceMock<TelecommandMock> third;
+        ON_CALL(first, CommandCode()).WillByDefault(Return(0x05));
+        ON_CALL(second, CommandCode()).WillByDefault(Return(0x06));
+        ON_CALL(third, CommandCode()).WillByDefault(Return(0x05));
+
+        IHandleTeleCommand* telecommands[] = {&first, &second, &third};
+
+        const auto index = BuildTelecommandIndex(telecommands);
+
+        ASSERT_THAT(index.Slots[0x05], Eq(1));
+        ASSERT_THAT(index.Slots[0x06], Eq(2));
+        ASSERT_THAT(index.Slots[0x07], Eq(0));
+    }
+}
@@ -0,0 +1,49 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/file_system.hpp"
+#include "telecommunication/TelecommandCancellation.hpp"
+#include "telecommunication/downlink.h"
+
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::uplink::TelecommandCancellation;
+using testing::ElementsAre;
+using testing::Eq;
+
+namespace
+{
+    class AbortTransferTelecommandTest : public testing::Test
+    {
+      protected:
+        testing::NiceMock<TransmitterMock> _transmitter;
+
+        TelecommandCancellation _cancellation;
+
+        obc::telecommands::AbortTransferTelecommand _telecommand{_cancellation};
+    };
+
+    TEST_F(AbortTransferTelecommandTest, ShouldCancelRunningTransfers)
+    {
+        const auto running = _cancellation.Begin();
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(Eq(DownlinkAPID::Operation), Eq(0U), ElementsAre(0x11, 0))));
+
+        std::array<std::uint8_t, 1> frame{0x11};
+        _telecommand.Handle(_transmitter, frame);
+
+        ASSERT_THAT(_cancellation.IsCancelled(running), Eq(true));
+        ASSERT_THAT(_cancellation.IsCancelled(_cancellation.Begin()), Eq(false));
+    }
+
+    TEST_F(AbortTransferTelecommandTest, ShouldRespondWithErrorOnMalformedRequest)
+    {
+        const auto running = _cancellation.Begin();
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(Eq(DownlinkAPID::Operation), Eq(0U), ElementsAre(0x00, 0x01))));
+
+        _telecommand.Handle(_transmitter, gsl::span<const std::uint8_t>());
+
+        ASSERT_THAT(_cancellation.IsCancelled(running), Eq(false));
+    }
+}
@@ -1,14 +1,18 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <numeric>
+#include <vector>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
+#include "base/lzss.hpp"
 #include "base/reader.h"
 #include "base/writer.h"
 #include "fs/fs.h"
 #include "mock/FsMock.hpp"
 #include "mock/comm.hpp"
 #include "obc/telecommands/file_system.hpp"
+#include "telecommunication/TelecommandCancellation.hpp"
 #include "telecommunication/downlink.h"
 #include "telecommunication/telecommand_handling.h"
 #include "utils.hpp"
@@ -26,6 +30,7 @@ using testing::StrEq;
 using testing::Return;
 using testing::Matches;
 using testing::AllOf;
+using testing::Lt;
 using gsl::span;
 
 using services::fs::File;
@@ -41,12 +46,13 @@ namespace
     class DownloadFileTelecommandTest : public testing::Test
     {
       protected:
-        template <std::size_t Size> void SendRequest(uint8_t correlationId, const std::string& path, const std::array<uint16_t, Size> seqs)
+        template <std::size_t Size>
+        void SendRequest(uint8_t correlationId, const std::string& path, const std::array<uint16_t, Size> seqs, bool compressed = false)
         {
             Buffer<200> buffer;
             Writer w(buffer);
             w.WriteByte(correlationId);
-            w.WriteByte(path.length());
+            w.WriteByte(path.length() | (compressed ? obc::telecommands::FileSender::CompressionFlag : 0));
             w.WriteArray(gsl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(path.data()), path.length()));
             w.WriteByte(0);
 
@@ -61,7 +67,9 @@ namespace
         testing::NiceMock<TransmitterMock> _transmitter;
         testing::NiceMock<FsMock> _fs;
 
-        obc::telecommands::DownloadFileTelecommand _telecommand{_fs};
+        telecommunication::uplink::TelecommandCancellation _cancellation;
+
+        obc::telecommands::DownloadFileTelecommand _telecommand{_fs, _cancellation};
     };
 
     TEST_F(DownloadFileTelecommandTest, ShouldTransferRequestedPartsOfFile)
@@ -96,6 +104,50 @@ namespace
         this->SendRequest(0xFF, path, std::array<uint16_t, 2>{0x1, 0x0});
     }
 
+    TEST_F(DownloadFileTelecommandTest, ShouldStopWhenTransferIsAborted)
+    {
+        const std::string path{"/a/file"};
+
+        std::array<uint8_t, 8> expectedPayload;
+
+        expectedPayload[0] = static_cast<uint8_t>(DownloadFileTelecommand::ErrorCode::Aborted);
+        std::copy(path.begin(), path.end(), expectedPayload.begin() + 1);
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(Eq(DownlinkAPID::FileSend), Eq(0U), _))).WillOnce(Invoke([this](auto) {
+            this->_cancellation.Cancel();
+            return true;
+        }));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 1U, 0xFF, ElementsAreArray(expectedPayload))))
+            .WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(Eq(DownlinkAPID::FileSend), Eq(2U), _))).Times(0);
+
+        constexpr uint8_t maxFileDataSize = DownlinkFrame::MaxPayloadSize - 2;
+        Buffer<3 * maxFileDataSize> file;
+        std::fill(file.begin(), file.end(), 1);
+
+        this->_fs.AddFile(path.c_str(), file);
+
+        this->SendRequest(0xFF, path, std::array<uint16_t, 3>{0x0, 0x1, 0x2});
+    }
+
+    TEST_F(DownloadFileTelecommandTest, ShouldNotBeAffectedByAbortRequestedBeforeStart)
+    {
+        const std::string path{"/a/file"};
+
+        _cancellation.Cancel();
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(Eq(DownlinkAPID::FileSend), Eq(0U), SpanOfSize(22))))
+            .Times(2)
+            .WillRepeatedly(Return(true));
+
+        Buffer<20> file;
+        std::fill(file.begin(), file.end(), 1);
+
+        this->_fs.AddFile(path.c_str(), file);
+
+        this->SendRequest(1, path, std::array<uint16_t, 2>{0x0, 0x0});
+    }
+
     TEST_F(DownloadFileTelecommandTest, ShouldSendSmallerPartThanMaximumIfNoEnoughDataLength)
     {
         const std::string path{"/a/file"};
@@ -205,4 +257,54 @@ namespace
         w.WriteByte(0xFF);
         _telecommand.Handle(_transmitter, w.Capture());
     }
+
+    TEST_F(DownloadFileTelecommandTest, ShouldSendCompressedPartWhenRequested)
+    {
+        const std::string path{"/a/file"};
+
+        constexpr uint8_t maxFileDataSize = DownlinkFrame::MaxPayloadSize - 2;
+        Buffer<2 * maxFileDataSize> file;
+        std::fill(file.begin(), file.end(), 0xAA);
+        std::iota(file.begin() + maxFileDataSize, file.begin() + maxFileDataSize + 10, 0);
+
+        this->_fs.AddFile(path.c_str(), file);
+
+        std::vector<uint8_t> payload;
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(Eq(DownlinkAPID::FileSend), Eq(1U), _)))
+            .WillOnce(Invoke([&payload](gsl::span<const uint8_t> frame) {
+                payload.assign(frame.begin() + 3, frame.end());
+                return true;
+            }));
+
+        this->SendRequest(0xFF, path, std::array<uint16_t, 1>{0x1}, true);
+
+        ASSERT_THAT(payload.size(), Lt(30u));
+        ASSERT_THAT(payload[0], Eq(0xFF));
+        ASSERT_THAT(payload[1], Eq(num(DownloadFileTelecommand::ErrorCode::SuccessCompressed)));
+
+        Buffer<maxFileDataSize> decompressed;
+        auto unpacked = lzss::Decompress(gsl::make_span(payload).subspan(2), decompressed);
+
+        ASSERT_THAT(unpacked, ElementsAreArray(file.begin() + maxFileDataSize, file.end()));
+    }
+
+    TEST_F(DownloadFileTelecommandTest, ShouldSendRawPartWhenCompressionDoesNotHelp)
+    {
+        const std::string path{"/a/file"};
+
+        Buffer<20> file;
+        std::iota(file.begin(), file.end(), 0);
+
+        this->_fs.AddFile(path.c_str(), file);
+
+        std::array<uint8_t, 22> expectedPayload;
+        expectedPayload[0] = 0xFF;
+        expectedPayload[1] = num(DownloadFileTelecommand::ErrorCode::Success);
+        std::copy(file.begin(), file.end(), expectedPayload.begin() + 2);
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(Eq(DownlinkAPID::FileSend), Eq(0U), ElementsAreArray(expectedPayload))))
+            .WillOnce(Return(true));
+
+        this->SendRequest(0xFF, path, std::array<uint16_t, 1>{0x0}, true);
+    }
 }
@@ -0,0 +1,388 @@
+#include <algorithm>
+#include <array>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/writer.h"
+#include "mock/FsMock.hpp"
+#include "mock/YaffsDeviceOperationsMock.hpp"
+#include "mock/comm.hpp"
+#include "obc/telecommands/telemetry.hpp"
+#include "telecommunication/TelecommandCancellation.hpp"
+#include "telecommunication/downlink.h"
+
+using std::uint8_t;
+using testing::_;
+using testing::AnyNumber;
+using testing::ElementsAreArray;
+using testing::Expectation;
+using testing::InSequence;
+using testing::Invoke;
+using testing::Return;
+using testing::SizeIs;
+
+using obc::telecommands::DownloadTelemetryRangeTelecommand;
+using telecommunication::downlink::DownlinkAPID;
+
+namespace
+{
+    /** @brief Number of records in each archive file */
+    constexpr std::size_t RecordsPerFile = 10;
+
+    /** @brief Number of records per index entry */
+    constexpr std::size_t IndexInterval = 4;
+
+    /** @brief Number of index entries of each archive file */
+    constexpr std::size_t IndexEntries = (RecordsPerFile + IndexInterval - 1) / IndexInterval;
+
+    constexpr telemetry::ArchiveFiles Files{"/tlm.current", "/tlm.previous", "/tlm.current.idx", "/tlm.previous.idx"};
+
+    using ArchiveFile = std::array<uint8_t, RecordsPerFile * telemetry::ArchiveRecordAlignment>;
+    using IndexFile = std::array<uint8_t, IndexEntries * 12>;
+
+    class DownloadTelemetryRangeTelecommandTest : public testing::Test
+    {
+      protected:
+        DownloadTelemetryRangeTelecommandTest();
+
+        /**
+         * @brief Builds archive file and its index with records saved every second
+         * @param archive Archive file contents
+         * @param index Index file contents
+         * @param first Number of first record
+         */
+        static void BuildArchive(ArchiveFile& archive, IndexFile& index, uint8_t first);
+
+        /**
+         * @brief Sends telecommand
+         * @param from Beginning of window
+         * @param to End of window
+         * @param stride Stride, not sent when 0 and no limit is given
+         * @param limit Records limit, not sent when 0
+         */
+        void Send(std::uint64_t from, std::uint64_t to, std::uint16_t stride = 0, std::uint16_t limit = 0);
+
+        /**
+         * @brief Builds expected record frame payload
+         * @param record Record number
+         * @return Payload
+         */
+        static std::vector<uint8_t> RecordPayload(uint8_t record);
+
+        /**
+         * @brief Builds expected completion frame payload
+         * @param status Error code
+         * @param sent Number of sent records
+         * @param last Mission time of last sent record
+         * @return Payload
+         */
+        static std::vector<uint8_t> Completion(DownloadTelemetryRangeTelecommand::ErrorCode status, std::uint32_t sent, std::uint64_t last);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+        testing::NiceMock<FsMock> _fs;
+        testing::NiceMock<YaffsDeviceOperationsMock> _deviceOperations;
+
+        ArchiveFile _previous;
+        IndexFile _previousIndex;
+        ArchiveFile _current;
+        IndexFile _currentIndex;
+
+        telecommunication::uplink::TelecommandCancellation _cancellation;
+
+        DownloadTelemetryRangeTelecommand _telecommand{_fs, _deviceOperations, Files, _cancellation};
+    };
+
+    DownloadTelemetryRangeTelecommandTest::DownloadTelemetryRangeTelecommandTest()
+    {
+        BuildArchive(_previous, _previousIndex, 0);
+        BuildArchive(_current, _currentIndex, RecordsPerFile);
+
+        _fs.AddFile(Files.previous, _previous);
+        _fs.AddFile(Files.previousIndex, _previousIndex);
+        _fs.AddFile(Files.current, _current);
+        _fs.AddFile(Files.currentIndex, _currentIndex);
+
+        ON_CALL(_transmitter, SendFrame(_)).WillByDefault(Return(true));
+        ON_CALL(_deviceOperations, FlushWriter()).WillByDefault(Return(OSResult::Success));
+    }
+
+    void DownloadTelemetryRangeTelecommandTest::BuildArchive(ArchiveFile& archive, IndexFile& index, uint8_t first)
+    {
+        Writer indexWriter(index);
+
+        for (std::size_t i = 0; i < RecordsPerFile; i++)
+        {
+            const auto record = gsl::make_span(archive).subspan(i * telemetry::ArchiveRecordAlignment, telemetry::ArchiveRecordAlignment);
+            const uint8_t number = first + i;
+            const std::uint64_t time = number * 1000;
+
+            std::fill(record.begin(), record.end(), number);
+
+            Writer w(record.subspan(telemetry::ArchiveRecordTimeOffset));
+            w.WriteQuadWordLE(time);
+
+            if (i % IndexInterval == 0)
+            {
+                indexWriter.WriteQuadWordLE(time);
+                indexWriter.WriteDoubleWordLE(i * telemetry::ArchiveRecordAlignment);
+            }
+        }
+    }
+
+    void DownloadTelemetryRangeTelecommandTest::Send(std::uint64_t from, std::uint64_t to, std::uint16_t stride, std::uint16_t limit)
+    {
+        std::array<uint8_t, 22> buffer;
+        Writer w(buffer);
+        w.WriteByte(0x11);
+        w.WriteQuadWordLE(from);
+        w.WriteQuadWordLE(to);
+
+        if (stride != 0 || limit != 0)
+        {
+            w.WriteWordLE(stride);
+        }
+
+        if (limit != 0)
+        {
+            w.WriteWordLE(limit);
+        }
+
+        _telecommand.Handle(_transmitter, w.Capture());
+    }
+
+    std::vector<uint8_t> DownloadTelemetryRangeTelecommandTest::RecordPayload(uint8_t record)
+    {
+        std::vector<uint8_t> payload(1 + telemetry::ArchiveRecordSize, record);
+        payload[0] = num(DownloadTelemetryRangeTelecommand::ErrorCode::Success);
+
+        Writer w(gsl::make_span(payload).subspan(1 + telemetry::ArchiveRecordTimeOffset));
+        w.WriteQuadWordLE(record * 1000);
+
+        return payload;
+    }
+
+    std::vector<uint8_t> DownloadTelemetryRangeTelecommandTest::Completion(
+        DownloadTelemetryRangeTelecommand::ErrorCode status, std::uint32_t sent, std::uint64_t last)
+    {
+        std::vector<uint8_t> payload(13);
+        Writer w(payload);
+        w.WriteByte(num(status));
+        w.WriteDoubleWordLE(sent);
+        w.WriteQuadWordLE(last);
+
+        return payload;
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldSendRecordsFromWindow)
+    {
+        InSequence s;
+
+        for (uint8_t record = 3; record <= 6; record++)
+        {
+            EXPECT_CALL(_transmitter,
+                SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, record - 3U, 0x11, ElementsAreArray(RecordPayload(record)))))
+                .WillOnce(Return(true));
+        }
+
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::Success, 4, 6000)))));
+
+        Send(3000, 6000);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldSendRecordsFromBothFiles)
+    {
+        InSequence s;
+
+        for (uint8_t record = 8; record <= 12; record++)
+        {
+            EXPECT_CALL(_transmitter,
+                SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, record - 8U, 0x11, ElementsAreArray(RecordPayload(record)))))
+                .WillOnce(Return(true));
+        }
+
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::Success, 5, 12000)))));
+
+        Send(7500, 12000);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldDecimateRecordsWithStride)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, 0U, 0x11, ElementsAreArray(RecordPayload(2)))));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, 1U, 0x11, ElementsAreArray(RecordPayload(7)))));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, 2U, 0x11, ElementsAreArray(RecordPayload(12)))));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::Success, 3, 12000)))));
+
+        Send(2000, 16000, 5);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldStartReadingRecordsFromIndexedOffset)
+    {
+        // previous file: records 8 and 9 from last indexed one, current file: records 10 to 14 (end of window found)
+        EXPECT_CALL(_fs, ReadAt(_, _, SizeIs(12))).Times(AnyNumber());
+        EXPECT_CALL(_fs, ReadAt(_, _, SizeIs(telemetry::ArchiveRecordSize))).Times(7);
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, 0U, 0x11, ElementsAreArray(RecordPayload(13)))));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::Success, 1, 13000)))));
+
+        Send(12500, 13000);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldScanWholeFilesWithoutIndex)
+    {
+        testing::NiceMock<FsMock> fs;
+        fs.AddFile(Files.previous, _previous);
+        fs.AddFile(Files.current, _current);
+
+        DownloadTelemetryRangeTelecommand telecommand{fs, _deviceOperations, Files, _cancellation};
+
+        EXPECT_CALL(fs, ReadAt(_, _, SizeIs(telemetry::ArchiveRecordSize))).Times(RecordsPerFile + 5);
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, 0U, 0x11, ElementsAreArray(RecordPayload(13)))));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::Success, 1, 13000)))));
+
+        std::array<uint8_t, 17> parameters;
+        Writer w(parameters);
+        w.WriteByte(0x11);
+        w.WriteQuadWordLE(12500);
+        w.WriteQuadWordLE(13000);
+
+        telecommand.Handle(_transmitter, w.Capture());
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldStopWhenRecordCannotBeSent)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, 0U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, 1U, 0x11, _))).WillOnce(Return(false));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::SendFailed, 1, 1000)))));
+
+        Send(1000, 19000);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldStopWhenTransferIsAborted)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, 0U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, 1U, 0x11, _))).WillOnce(Invoke([this](auto) {
+            this->_cancellation.Cancel();
+            return true;
+        }));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, 2U, 0x11, _))).Times(0);
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::Aborted, 2, 2000)))));
+
+        Send(1000, 19000);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldFlushBufferedTelemetryBeforeSearch)
+    {
+        Expectation flush = EXPECT_CALL(_deviceOperations, FlushWriter()).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(_fs, Open(_, _, _)).Times(AnyNumber()).After(flush);
+
+        Send(3000, 6000);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldSendRecordsWhenFlushFails)
+    {
+        EXPECT_CALL(_deviceOperations, FlushWriter()).WillOnce(Return(OSResult::IOError));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, _, _, _))).Times(4);
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::Success, 4, 6000)))));
+
+        Send(3000, 6000);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldStopWhenRecordsLimitIsReached)
+    {
+        InSequence s;
+
+        for (uint8_t record = 8; record <= 10; record++)
+        {
+            EXPECT_CALL(_transmitter,
+                SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, record - 8U, 0x11, ElementsAreArray(RecordPayload(record)))))
+                .WillOnce(Return(true));
+        }
+
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::LimitReached, 3, 10000)))));
+
+        Send(8000, 19000, 1, 3);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldCompleteWhenLastRecordFitsLimit)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, _, _, _))).Times(3);
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::Success, 3, 10000)))));
+
+        Send(8000, 10000, 1, 3);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldSendOnlyCompletionWhenWindowIsEmpty)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, _, _, _))).Times(0);
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::Success, 0, 0)))));
+
+        Send(25000, 30000);
+    }
+
+    TEST_F(DownloadTelemetryRangeTelecommandTest, ShouldRejectMalformedRequest)
+    {
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRange, _, _, _))).Times(0);
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::TelemetryRangeCompleted,
+                0U,
+                0x11,
+                ElementsAreArray(Completion(DownloadTelemetryRangeTelecommand::ErrorCode::MalformedRequest, 0, 0)))))
+            .Times(2);
+
+        const uint8_t tooShort[] = {0x11, 1, 2, 3};
+        _telecommand.Handle(_transmitter, tooShort);
+
+        Send(5000, 4000);
+    }
+}
@@ -0,0 +1,64 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "mock/comm.hpp"
+#include "obc/telecommands/comm.hpp"
+#include "telecommunication/downlink.h"
+
+using telecommunication::downlink::DownlinkAPID;
+using testing::Eq;
+using testing::Return;
+using testing::_;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    class ExpectPassTelecommandTest : public testing::Test
+    {
+      protected:
+        ExpectPassTelecommandTest();
+
+        template <typename... T> void Run(T... params);
+
+        testing::NiceMock<OSMock> _os;
+        OSReset _osReset;
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+
+        testing::NiceMock<ReceiverPollingMock> _polling;
+
+        obc::telecommands::ExpectPassTelecommand _telecommand{_polling};
+    };
+
+    ExpectPassTelecommandTest::ExpectPassTelecommandTest()
+    {
+        this->_osReset = InstallProxy(&_os);
+    }
+
+    template <typename... T> void ExpectPassTelecommandTest::Run(T... params)
+    {
+        std::array<std::uint8_t, sizeof...(T)> buffer{static_cast<std::uint8_t>(params)...};
+
+        _telecommand.Handle(_transmitter, buffer);
+    }
+
+    TEST_F(ExpectPassTelecommandTest, ShouldExtendPollingWindow)
+    {
+        ON_CALL(_os, GetUptime()).WillByDefault(Return(100s));
+
+        EXPECT_CALL(_polling, ExpectPass(Eq(100s + 600s)));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Comm, 0, testing::ElementsAre(0x11, 0x00))));
+
+        Run(0x11, 0x58, 0x02);
+    }
+
+    TEST_F(ExpectPassTelecommandTest, ShouldRespondWithErrorOnMalformedRequest)
+    {
+        EXPECT_CALL(_polling, ExpectPass(_)).Times(0);
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Comm, 0, testing::ElementsAre(0x11, 0xFF))));
+
+        Run(0x11, 0x58);
+    }
+}
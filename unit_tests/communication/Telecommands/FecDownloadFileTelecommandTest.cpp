@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <array>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/erasure.hpp"
+#include "base/writer.h"
+#include "mock/FsMock.hpp"
+#include "mock/comm.hpp"
+#include "obc/telecommands/file_system.hpp"
+#include "telecommunication/TelecommandCancellation.hpp"
+#include "telecommunication/downlink.h"
+
+using std::uint8_t;
+using testing::_;
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+using testing::Eq;
+using testing::InSequence;
+using testing::Invoke;
+using testing::Return;
+
+using obc::telecommands::DownloadFileTelecommand;
+using obc::telecommands::FecDownloadFileTelecommand;
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::DownlinkFrame;
+
+namespace
+{
+    constexpr uint8_t MaxFileDataSize = DownlinkFrame::MaxPayloadSize - 2;
+
+    class FecDownloadFileTelecommandTest : public testing::Test
+    {
+      protected:
+        FecDownloadFileTelecommandTest();
+
+        void Send(uint8_t groupSize, uint8_t repairCount, std::initializer_list<std::uint32_t> groups);
+
+        void CaptureFrames();
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+        testing::NiceMock<FsMock> _fs;
+
+        std::array<uint8_t, 9 * MaxFileDataSize + 100> _file;
+
+        telecommunication::uplink::TelecommandCancellation _cancellation;
+
+        FecDownloadFileTelecommand _telecommand{_fs, _cancellation};
+
+        const std::string _path{"/a/file"};
+
+        std::map<std::pair<DownlinkAPID, std::uint32_t>, std::vector<uint8_t>> _frames;
+    };
+
+    FecDownloadFileTelecommandTest::FecDownloadFileTelecommandTest()
+    {
+        uint8_t seed = 3;
+        for (auto& b : _file)
+        {
+            seed = seed * 31 + 7;
+            b = seed;
+        }
+
+        this->_fs.AddFile(_path.c_str(), _file);
+
+        ON_CALL(_transmitter, SendFrame(_)).WillByDefault(Return(true));
+    }
+
+    void FecDownloadFileTelecommandTest::Send(uint8_t groupSize, uint8_t repairCount, std::initializer_list<std::uint32_t> groups)
+    {
+        std::array<uint8_t, 200> buffer;
+        Writer w(buffer);
+        w.WriteByte(0x11);
+        w.WriteByte(_path.length());
+        w.WriteArray(gsl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(_path.data()), _path.length()));
+        w.WriteByte(0);
+        w.WriteByte(groupSize);
+        w.WriteByte(repairCount);
+        for (auto group : groups)
+        {
+            w.WriteDoubleWordLE(group);
+        }
+
+        _telecommand.Handle(_transmitter, w.Capture());
+    }
+
+    void FecDownloadFileTelecommandTest::CaptureFrames()
+    {
+        ON_CALL(_transmitter, SendFrame(_)).WillByDefault(Invoke([this](gsl::span<const uint8_t> frame) {
+            auto header = frame[0] | (frame[1] << 8) | (frame[2] << 16);
+            auto apid = static_cast<DownlinkAPID>(header & 0x3F);
+            std::uint32_t seq = (header >> 6) & 0x3FFFF;
+
+            this->_frames[std::make_pair(apid, seq)].assign(frame.begin() + 5, frame.end());
+            return true;
+        }));
+    }
+
+    TEST_F(FecDownloadFileTelecommandTest, ShouldSendDataAndRepairFramesOfGroup)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 4U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 5U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 6U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 7U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileRepair, 2U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileRepair, 3U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::Success), 6, 0, 0, 0, 2, 0, 0, 0, 10, 0, 0, 0))));
+
+        Send(4, 2, {1});
+    }
+
+    TEST_F(FecDownloadFileTelecommandTest, DataFramesShouldContainFileParts)
+    {
+        CaptureFrames();
+
+        Send(4, 1, {0, 2});
+
+        for (std::uint32_t seq = 0; seq < 4; seq++)
+        {
+            ASSERT_THAT(_frames[std::make_pair(DownlinkAPID::FileSend, seq)],
+                ElementsAreArray(_file.begin() + seq * MaxFileDataSize, _file.begin() + (seq + 1) * MaxFileDataSize));
+        }
+
+        ASSERT_THAT(_frames[std::make_pair(DownlinkAPID::FileSend, 9U)], ElementsAreArray(_file.begin() + 9 * MaxFileDataSize, _file.end()));
+        ASSERT_THAT(_frames.count(std::make_pair(DownlinkAPID::FileSend, 4U)), Eq(0U));
+    }
+
+    TEST_F(FecDownloadFileTelecommandTest, RepairFramesShouldAllowRebuildingLostParts)
+    {
+        CaptureFrames();
+
+        Send(4, 2, {1});
+
+        const auto& repair0 = _frames[std::make_pair(DownlinkAPID::FileRepair, 2U)];
+        const auto& repair1 = _frames[std::make_pair(DownlinkAPID::FileRepair, 3U)];
+
+        ASSERT_THAT(repair0.size(), Eq(MaxFileDataSize));
+        ASSERT_THAT(repair1.size(), Eq(MaxFileDataSize));
+
+        // parts 5 and 6 are lost: strip known parts 4 and 7 and solve 2x2 system
+        std::vector<uint8_t> lost5(MaxFileDataSize);
+        std::vector<uint8_t> lost6(MaxFileDataSize);
+
+        const auto a = erasure::RepairCoefficient(0, 1);
+        const auto b = erasure::RepairCoefficient(0, 2);
+        const auto c = erasure::RepairCoefficient(1, 1);
+        const auto d = erasure::RepairCoefficient(1, 2);
+        const auto det = erasure::Inverse(erasure::Multiply(a, d) ^ erasure::Multiply(b, c));
+
+        for (std::size_t k = 0; k < MaxFileDataSize; k++)
+        {
+            uint8_t r0 = repair0[k];
+            uint8_t r1 = repair1[k];
+
+            for (uint8_t i : {0, 3})
+            {
+                auto known = _frames[std::make_pair(DownlinkAPID::FileSend, 4U + i)][k];
+                r0 ^= erasure::Multiply(erasure::RepairCoefficient(0, i), known);
+                r1 ^= erasure::Multiply(erasure::RepairCoefficient(1, i), known);
+            }
+
+            lost5[k] = erasure::Multiply(det, erasure::Multiply(d, r0) ^ erasure::Multiply(b, r1));
+            lost6[k] = erasure::Multiply(det, erasure::Multiply(c, r0) ^ erasure::Multiply(a, r1));
+        }
+
+        ASSERT_THAT(lost5, ElementsAreArray(_file.begin() + 5 * MaxFileDataSize, _file.begin() + 6 * MaxFileDataSize));
+        ASSERT_THAT(lost6, ElementsAreArray(_file.begin() + 6 * MaxFileDataSize, _file.begin() + 7 * MaxFileDataSize));
+    }
+
+    TEST_F(FecDownloadFileTelecommandTest, ShouldSendShortLastGroup)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 8U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 9U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileRepair, 2U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::Success), 3, 0, 0, 0, 3, 0, 0, 0, 10, 0, 0, 0))));
+
+        Send(4, 1, {2});
+    }
+
+    TEST_F(FecDownloadFileTelecommandTest, ShouldStopOnGroupBeyondFile)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 0U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 1U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::TooBigSeq), 2, 0, 0, 0, 5, 0, 0, 0, 10, 0, 0, 0))));
+
+        Send(2, 0, {0, 5, 1});
+    }
+
+    TEST_F(FecDownloadFileTelecommandTest, ShouldReportResumeGroupWhenSendingFails)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 2U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 3U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileRepair, 1U, 0x11, _))).WillOnce(Return(false));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::SendFailed), 2, 0, 0, 0, 1, 0, 0, 0, 10, 0, 0, 0))));
+
+        Send(2, 1, {1, 2});
+    }
+
+    TEST_F(FecDownloadFileTelecommandTest, ShouldReportResumeGroupWhenTransferIsAborted)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 2U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 3U, 0x11, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileRepair, 1U, 0x11, _))).WillOnce(Invoke([this](auto) {
+            this->_cancellation.Cancel();
+            return true;
+        }));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 4U, 0x11, _))).Times(0);
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::Aborted), 3, 0, 0, 0, 2, 0, 0, 0, 10, 0, 0, 0))));
+
+        Send(2, 1, {1, 2});
+    }
+
+    TEST_F(FecDownloadFileTelecommandTest, ShouldRejectInvalidGroupParameters)
+    {
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 0U, 0x11, ElementsAre(num(DownloadFileTelecommand::ErrorCode::MalformedRequest), 0))))
+            .Times(2);
+
+        Send(0, 1, {0});
+        Send(4, FecDownloadFileTelecommand::MaxRepairFrames + 1, {0});
+    }
+
+    TEST_F(FecDownloadFileTelecommandTest, ShouldRespondWithErrorWhenFileDoesNotExist)
+    {
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::FileNotFound), '/', 'b', '/', 'f', 'i', 'l', 'e'))));
+
+        const uint8_t request[] = {0x11, 7, '/', 'b', '/', 'f', 'i', 'l', 'e', 0, 4, 1, 0, 0, 0, 0};
+
+        _telecommand.Handle(_transmitter, request);
+    }
+}
@@ -0,0 +1,143 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "mock/comm.hpp"
+#include "obc/telecommands/statistics.hpp"
+#include "os/QueueFake.hpp"
+#include "telecommunication/downlink.h"
+
+using devices::comm::PollingStatistics;
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::DownlinkScheduler;
+using telecommunication::uplink::IHandleTeleCommand;
+using telecommunication::uplink::TelecommandExecutor;
+using telecommunication::uplink::TelecommandStatistics;
+using testing::_;
+using testing::DoAll;
+using testing::Return;
+using testing::SetArgReferee;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    struct TelecommandMock : public IHandleTeleCommand
+    {
+        MOCK_METHOD2(Handle, void(devices::comm::ITransmitter&, gsl::span<const std::uint8_t>));
+        MOCK_CONST_METHOD0(CommandCode, std::uint8_t());
+    };
+
+    static const std::uint8_t FastLaneCodes[] = {0x0E};
+
+    class GetLinkStatisticsTelecommandTest : public testing::Test
+    {
+      protected:
+        GetLinkStatisticsTelecommandTest();
+
+        template <typename... T> void Run(T... params);
+
+        testing::NiceMock<OSMock> _os;
+        OSReset _osReset;
+        QueueFake _queues;
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+
+        testing::NiceMock<ReceiverPollingMock> _polling;
+
+        testing::NiceMock<CommDiagnosticsMock> _diagnostics;
+
+        TelecommandStatistics _telecommandStatistics;
+        TelecommandExecutor _executor{FastLaneCodes, _telecommandStatistics};
+
+        testing::NiceMock<BufferedTransmitterMock> _downlinkTransmitter;
+        DownlinkScheduler _downlink{_downlinkTransmitter};
+
+        obc::telecommands::GetLinkStatisticsTelecommand _telecommand{_polling, _diagnostics, _executor, _downlink};
+    };
+
+    GetLinkStatisticsTelecommandTest::GetLinkStatisticsTelecommandTest()
+    {
+        this->_osReset = InstallProxy(&_os);
+        _queues.Install(_os);
+
+        ON_CALL(_os, CreateEventGroup()).WillByDefault(Return(reinterpret_cast<OSEventGroupHandle>(1)));
+        ON_CALL(_os, CreateTask(_, _, _, _, _, _)).WillByDefault(Return(OSResult::Success));
+
+        _executor.Initialize();
+        _downlink.Initialize();
+    }
+
+    template <typename... T> void GetLinkStatisticsTelecommandTest::Run(T... params)
+    {
+        std::array<std::uint8_t, sizeof...(T)> buffer{static_cast<std::uint8_t>(params)...};
+
+        _telecommand.Handle(_transmitter, buffer);
+    }
+
+    TEST_F(GetLinkStatisticsTelecommandTest, ShouldRespondWithLinkStatistics)
+    {
+        PollingStatistics polling{0x01020304, 0x0506, 100ms, 250ms, 0x12345ms, 0x0203ms};
+        ON_CALL(_polling, GetPollingStatistics()).WillByDefault(Return(polling));
+        ON_CALL(_diagnostics, GetAvoidedTransactions()).WillByDefault(Return(0x0A0B0C0D));
+
+        testing::NiceMock<TelecommandMock> normalCommand;
+        ON_CALL(normalCommand, CommandCode()).WillByDefault(Return(0xAB));
+
+        const std::uint8_t parameters[] = {1};
+        _executor.Execute(_transmitter, normalCommand, parameters);
+        _executor.Execute(_transmitter, normalCommand, parameters);
+        _executor.ExecuteNext(telecommunication::uplink::ExecutionLane::Normal, 0ms);
+
+        const std::uint8_t frame[] = {num(DownlinkAPID::FileSend), 0, 0};
+        ON_CALL(_downlinkTransmitter, SendFrame(_, _)).WillByDefault(DoAll(SetArgReferee<1>(7), Return(true)));
+        _downlink.SendFrame(frame);
+        _downlink.TransmitNext(0ms);
+
+        // clang-format off
+        std::array<std::uint8_t, 87> expectedPayload = {
+            0x11, 0x00,
+            0x04, 0x03, 0x02, 0x01,
+            0x06, 0x05, 0x00, 0x00,
+            0x64, 0x00,
+            0xFA, 0x00,
+            0xFF, 0xFF,
+            0x03, 0x02,
+            0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00,
+            0x00, 0x00,
+            0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00,
+            0x01, 0x02,
+            0x00, 0x00,
+            0x00, 0x00,
+            0x0D, 0x0C, 0x0B, 0x0A,
+            0x01, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00,
+            0x07,
+            0x01, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00
+        };
+        // clang-format on
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::LinkStatistics, 0, expectedPayload)));
+
+        Run(0x11);
+    }
+
+    TEST_F(GetLinkStatisticsTelecommandTest, ShouldRespondWithErrorOnMalformedRequest)
+    {
+        std::array<std::uint8_t, 2> expectedPayload = {0x00, 0x01};
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::LinkStatistics, 0, expectedPayload)));
+
+        Run();
+    }
+}
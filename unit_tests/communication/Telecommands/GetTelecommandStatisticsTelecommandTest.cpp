@@ -0,0 +1,99 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/statistics.hpp"
+#include "telecommunication/downlink.h"
+
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::uplink::TelecommandStatistics;
+using testing::_;
+using testing::Eq;
+using testing::Invoke;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    class GetTelecommandStatisticsTelecommandTest : public testing::Test
+    {
+      protected:
+        template <typename... T> void Run(T... params);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+
+        TelecommandStatistics _statistics;
+
+        obc::telecommands::GetTelecommandStatisticsTelecommand _telecommand{_statistics};
+    };
+
+    template <typename... T> void GetTelecommandStatisticsTelecommandTest::Run(T... params)
+    {
+        std::array<std::uint8_t, sizeof...(T)> buffer{static_cast<std::uint8_t>(params)...};
+
+        _telecommand.Handle(_transmitter, buffer);
+    }
+
+    TEST_F(GetTelecommandStatisticsTelecommandTest, ShouldRespondWithNonEmptyEntries)
+    {
+        _statistics.RecordExecution(0x02, 300ms);
+        _statistics.RecordExecution(0x02, 2ms);
+        _statistics.RecordFailure(0x02);
+        _statistics.RecordExecution(0x29, 0x1234ms);
+        _statistics.RecordFailure(0xFE);
+
+        // clang-format off
+        std::array<std::uint8_t, 23> expectedPayload = {
+            0x11, 0x00,
+            0x02, 0x02, 0x00, 0x01, 0x00, 0x2C, 0x01,
+            0x29, 0x01, 0x00, 0x00, 0x00, 0x34, 0x12,
+            0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00
+        };
+        // clang-format on
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelecommandStatistics, 0, expectedPayload)));
+
+        Run(0x11, 0x00);
+    }
+
+    TEST_F(GetTelecommandStatisticsTelecommandTest, ShouldStartFromRequestedCode)
+    {
+        _statistics.RecordExecution(0x02, 1ms);
+        _statistics.RecordExecution(0x29, 1ms);
+
+        std::array<std::uint8_t, 9> expectedPayload = {0x11, 0x00, 0x29, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00};
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelecommandStatistics, 0, expectedPayload)));
+
+        Run(0x11, 0x03);
+    }
+
+    TEST_F(GetTelecommandStatisticsTelecommandTest, ShouldLimitResponseToSingleFrame)
+    {
+        for (auto code = 0; code < 256; code++)
+        {
+            _statistics.RecordExecution(code, 1ms);
+        }
+
+        EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Invoke([](gsl::span<const std::uint8_t> frame) {
+            const auto entries = (frame.size() - 5) / 7;
+
+            EXPECT_THAT((frame.size() - 5) % 7, Eq(0));
+            EXPECT_THAT(entries, Eq(32));
+            EXPECT_THAT(frame[5], Eq(0x00));
+            EXPECT_THAT(frame[5 + 7 * (entries - 1)], Eq(entries - 1));
+            return true;
+        }));
+
+        Run(0x11, 0x00);
+    }
+
+    TEST_F(GetTelecommandStatisticsTelecommandTest, ShouldRespondWithErrorOnMalformedRequest)
+    {
+        std::array<std::uint8_t, 2> expectedPayload = {0x11, 0x01};
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TelecommandStatistics, 0, expectedPayload)));
+
+        Run(0x11);
+    }
+}
@@ -0,0 +1,87 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/statistics.hpp"
+#include "telecommunication/downlink.h"
+
+using devices::comm::ResponseCommand;
+using devices::comm::TurnaroundStatistics;
+using telecommunication::downlink::DownlinkAPID;
+using testing::ElementsAre;
+using testing::Return;
+using testing::_;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    class GetTurnaroundStatisticsTelecommandTest : public testing::Test
+    {
+      protected:
+        template <typename... T> void Run(T... params);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+
+        testing::NiceMock<CommDiagnosticsMock> _diagnostics;
+
+        obc::telecommands::GetTurnaroundStatisticsTelecommand _telecommand{_diagnostics};
+    };
+
+    template <typename... T> void GetTurnaroundStatisticsTelecommandTest::Run(T... params)
+    {
+        std::array<std::uint8_t, sizeof...(T)> buffer{static_cast<std::uint8_t>(params)...};
+
+        _telecommand.Handle(_transmitter, buffer);
+    }
+
+    TEST_F(GetTurnaroundStatisticsTelecommandTest, ShouldSendTurnaroundStatistics)
+    {
+        TurnaroundStatistics statistics;
+        statistics.Exchanges = 0x01020304;
+        statistics.Nacks = 5;
+        statistics.Failures = 1;
+        statistics.Longest = 70s;
+        statistics.Histogram = {1, 2, 3, 4, 5, 6};
+
+        EXPECT_CALL(_diagnostics, GetMinimumTurnaround(ResponseCommand::TransmitterSendFrame)).WillOnce(Return(2ms));
+        EXPECT_CALL(_diagnostics, GetTurnaroundStatistics(ResponseCommand::TransmitterSendFrame)).WillOnce(Return(statistics));
+
+        // clang-format off
+        std::array<std::uint8_t, 42> expectedPayload = {
+            0x11, 0x00,
+            0x02, 0x00,
+            0x04, 0x03, 0x02, 0x01,
+            0x05, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00,
+            0xFF, 0xFF,
+            0x01, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00,
+            0x03, 0x00, 0x00, 0x00,
+            0x04, 0x00, 0x00, 0x00,
+            0x05, 0x00, 0x00, 0x00,
+            0x06, 0x00, 0x00, 0x00
+        };
+        // clang-format on
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TurnaroundStatistics, 0, expectedPayload)));
+
+        Run(0x11, num(ResponseCommand::TransmitterSendFrame));
+    }
+
+    TEST_F(GetTurnaroundStatisticsTelecommandTest, ShouldRespondWithErrorOnMalformedRequest)
+    {
+        EXPECT_CALL(_diagnostics, GetTurnaroundStatistics(_)).Times(0);
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TurnaroundStatistics, 0, ElementsAre(0x11, 0x01))));
+
+        Run(0x11);
+    }
+
+    TEST_F(GetTurnaroundStatisticsTelecommandTest, ShouldRespondWithErrorOnUnknownCommand)
+    {
+        EXPECT_CALL(_diagnostics, GetTurnaroundStatistics(_)).Times(0);
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::TurnaroundStatistics, 0, ElementsAre(0x11, 0x01))));
+
+        Run(0x11, num(ResponseCommand::Count));
+    }
+}
@@ -149,6 +149,25 @@ namespace
         ASSERT_THAT(result, Contains(Pair("very_long_name_of_sixth_file_in_folder"s, A<std::size_t>())));
     }
 
+    TEST_F(ListFilesTelecommandTest, ShouldTakeFileSizeFromDirectoryEntry)
+    {
+        BufferArray<7> file;
+
+        this->_fs.AddFile("/a/file1", file);
+
+        EXPECT_CALL(this->_fs, GetFileSize(A<const char*>(), A<const char*>())).Times(0);
+
+        ResultVector result;
+        ReceiveTo(result);
+
+        BufferArray<20> args{0x11, '/', 'a', 0};
+
+        this->_telecommand.Handle(this->_transmitter, args);
+
+        ASSERT_THAT(result.size(), Eq(1U));
+        ASSERT_THAT(get<1>(result[0]), Eq(7U));
+    }
+
     TEST_F(ListFilesTelecommandTest, RespondWithErrorFrameIfUnableToOpenDirectory)
     {
         ON_CALL(this->_fs, OpenDirectory(_)).WillByDefault(Return(services::fs::DirectoryOpenResult(OSResult::DeviceNotFound, nullptr)));
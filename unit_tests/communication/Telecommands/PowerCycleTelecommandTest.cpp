@@ -2,12 +2,15 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "mock/comm.hpp"
+#include "mock/YaffsDeviceOperationsMock.hpp"
 #include "mock/power.hpp"
 
 #include "obc/telecommands/power.hpp"
 
 using testing::Eq;
+using testing::InSequence;
 using testing::Invoke;
+using testing::Return;
 using testing::_;
 using testing::ElementsAre;
 using telecommunication::downlink::DownlinkAPID;
@@ -21,8 +24,9 @@ namespace
 
         testing::NiceMock<TransmitterMock> _transmitter;
         PowerControlMock _power;
+        testing::NiceMock<YaffsDeviceOperationsMock> _deviceOperations;
 
-        obc::telecommands::PowerCycle _telecommand{_power};
+        obc::telecommands::PowerCycle _telecommand{_power, _deviceOperations};
     };
 
     template <typename... T> void PowerCycleTelecommandTest::Run(T... params)
@@ -41,9 +45,29 @@ namespace
         Run(0x11);
     }
 
+    TEST_F(PowerCycleTelecommandTest, ShouldWriteFileSystemCheckpointBeforePowerCycle)
+    {
+        {
+            InSequence s;
+            EXPECT_CALL(this->_deviceOperations, Checkpoint()).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(this->_power, PowerCycle());
+        }
+
+        Run(0x11);
+    }
+
+    TEST_F(PowerCycleTelecommandTest, ShouldPerformPowerCycleWhenCheckpointFails)
+    {
+        EXPECT_CALL(this->_deviceOperations, Checkpoint()).WillOnce(Return(OSResult::IOError));
+        EXPECT_CALL(this->_power, PowerCycle());
+
+        Run(0x11);
+    }
+
     TEST_F(PowerCycleTelecommandTest, ShouldRespondWithErrorFrameOnInvalidFrame)
     {
         EXPECT_CALL(this->_power, PowerCycle()).Times(0);
+        EXPECT_CALL(this->_deviceOperations, Checkpoint()).Times(0);
         EXPECT_CALL(this->_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Powercycle, 0, ElementsAre(0x0, 0x1))));
 
         Run();
@@ -0,0 +1,211 @@
+#include <algorithm>
+#include <array>
+#include <string>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/writer.h"
+#include "mock/FsMock.hpp"
+#include "mock/comm.hpp"
+#include "obc/telecommands/file_system.hpp"
+#include "telecommunication/TelecommandCancellation.hpp"
+#include "telecommunication/downlink.h"
+
+using std::uint8_t;
+using testing::_;
+using testing::ElementsAre;
+using testing::Eq;
+using testing::InSequence;
+using testing::Invoke;
+using testing::Return;
+
+using obc::telecommands::DownloadFileTelecommand;
+using obc::telecommands::SelectiveDownloadFileTelecommand;
+using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::DownlinkFrame;
+
+namespace
+{
+    constexpr uint8_t MaxFileDataSize = DownlinkFrame::MaxPayloadSize - 2;
+
+    class SelectiveDownloadFileTelecommandTest : public testing::Test
+    {
+      protected:
+        SelectiveDownloadFileTelecommandTest();
+
+        void Send(std::uint32_t startSeq, gsl::span<const uint8_t> selectors);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+        testing::NiceMock<FsMock> _fs;
+
+        std::array<uint8_t, 10 * MaxFileDataSize> _file;
+
+        telecommunication::uplink::TelecommandCancellation _cancellation;
+
+        SelectiveDownloadFileTelecommand _telecommand{_fs, _cancellation};
+
+        const std::string _path{"/a/file"};
+    };
+
+    SelectiveDownloadFileTelecommandTest::SelectiveDownloadFileTelecommandTest()
+    {
+        for (auto i = 0; i < 10; i++)
+        {
+            std::fill_n(_file.begin() + i * MaxFileDataSize, MaxFileDataSize, i);
+        }
+
+        this->_fs.AddFile(_path.c_str(), _file);
+
+        ON_CALL(_transmitter, SendFrame(_)).WillByDefault(Return(true));
+    }
+
+    void SelectiveDownloadFileTelecommandTest::Send(std::uint32_t startSeq, gsl::span<const uint8_t> selectors)
+    {
+        std::array<uint8_t, 200> buffer;
+        Writer w(buffer);
+        w.WriteByte(0x11);
+        w.WriteByte(_path.length());
+        w.WriteArray(gsl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(_path.data()), _path.length()));
+        w.WriteByte(0);
+        w.WriteDoubleWordLE(startSeq);
+        w.WriteArray(selectors);
+
+        _telecommand.Handle(_transmitter, w.Capture());
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldSendChunksSelectedByBitmap)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 2U, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 4U, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 9U, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::Success), 3, 0, 0, 0, 16, 0, 0, 0, 10, 0, 0, 0))));
+
+        const uint8_t selectors[] = {num(SelectiveDownloadFileTelecommand::Selector::Bitmap), 2, 0b00010100, 0b00000010};
+
+        Send(0, selectors);
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldSendChunksSelectedByRanges)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 1U, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 2U, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 6U, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::Success), 3, 0, 0, 0, 7, 0, 0, 0, 10, 0, 0, 0))));
+
+        const uint8_t selectors[] = {
+            num(SelectiveDownloadFileTelecommand::Selector::Range), 0, 0, 2, 0, //
+            num(SelectiveDownloadFileTelecommand::Selector::Range), 3, 0, 1, 0  //
+        };
+
+        Send(1, selectors);
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldMixBitmapsAndRanges)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 0U, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 9U, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted, 0U, 0x11, _)));
+
+        const uint8_t selectors[] = {
+            num(SelectiveDownloadFileTelecommand::Selector::Bitmap), 1, 0b00000001, //
+            num(SelectiveDownloadFileTelecommand::Selector::Range), 1, 0, 1, 0      //
+        };
+
+        Send(0, selectors);
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldStopOnChunkBeyondFile)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 9U, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::TooBigSeq), 1, 0, 0, 0, 10, 0, 0, 0, 10, 0, 0, 0))));
+
+        const uint8_t selectors[] = {num(SelectiveDownloadFileTelecommand::Selector::Range), 0, 0, 5, 0};
+
+        Send(9, selectors);
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldReportResumePointWhenSendingFails)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 3U, _))).WillOnce(Return(true));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 5U, _))).WillOnce(Return(false));
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::SendFailed), 1, 0, 0, 0, 5, 0, 0, 0, 10, 0, 0, 0))));
+
+        const uint8_t selectors[] = {num(SelectiveDownloadFileTelecommand::Selector::Bitmap), 1, 0b10101000};
+
+        Send(0, selectors);
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldReportResumePointWhenTransferIsAborted)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 3U, _))).WillOnce(Invoke([this](auto) {
+            this->_cancellation.Cancel();
+            return true;
+        }));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, 5U, _))).Times(0);
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::Aborted), 1, 0, 0, 0, 5, 0, 0, 0, 10, 0, 0, 0))));
+
+        const uint8_t selectors[] = {num(SelectiveDownloadFileTelecommand::Selector::Bitmap), 1, 0b10101000};
+
+        Send(0, selectors);
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldRejectUnknownSelector)
+    {
+        InSequence s;
+
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend, _, _))).Times(0);
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSendCompleted,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::MalformedRequest), 0, 0, 0, 0, 4, 0, 0, 0, 10, 0, 0, 0))));
+
+        const uint8_t selectors[] = {0x7F, 1, 0xFF};
+
+        Send(4, selectors);
+    }
+
+    TEST_F(SelectiveDownloadFileTelecommandTest, ShouldRespondWithErrorWhenFileDoesNotExist)
+    {
+        EXPECT_CALL(_transmitter,
+            SendFrame(IsDownlinkFrame(DownlinkAPID::FileSend,
+                0U,
+                0x11,
+                ElementsAre(num(DownloadFileTelecommand::ErrorCode::FileNotFound), '/', 'b', '/', 'f', 'i', 'l', 'e'))));
+
+        const uint8_t request[] = {0x11, 7, '/', 'b', '/', 'f', 'i', 'l', 'e', 0, 0, 0, 0, 0};
+
+        _telecommand.Handle(_transmitter, request);
+    }
+}
@@ -27,8 +27,6 @@ namespace
 
     TEST_F(SendBeaconTelecommandTest, ShouldSendBeacon)
     {
-        ON_CALL(_os, TakeSemaphore(_, _)).WillByDefault(Return(OSResult::Success));
-
         telemetry::TelemetryState tm;
 
         ON_CALL(_stateProvider, MockGetState()).WillByDefault(ReturnRef(tm));
@@ -40,9 +38,8 @@ namespace
 
     TEST_F(SendBeaconTelecommandTest, ShouldSendErrorFrameWhenUnableToWriteBeacon)
     {
-        ON_CALL(_os, TakeSemaphore(_, _)).WillByDefault(Return(OSResult::Timeout));
-
         telemetry::TelemetryState tm;
+        tm.serializedTelemetryVersion = 1;
 
         ON_CALL(_stateProvider, MockGetState()).WillByDefault(ReturnRef(tm));
 
@@ -0,0 +1,59 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "mock/comm.hpp"
+#include "obc/telecommands/comm.hpp"
+#include "telecommunication/downlink.h"
+
+using devices::comm::ResponseCommand;
+using telecommunication::downlink::DownlinkAPID;
+using testing::Eq;
+using testing::_;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    class SetMinimumTurnaroundTelecommandTest : public testing::Test
+    {
+      protected:
+        template <typename... T> void Run(T... params);
+
+        testing::NiceMock<TransmitterMock> _transmitter;
+
+        testing::NiceMock<CommDiagnosticsMock> _diagnostics;
+
+        obc::telecommands::SetMinimumTurnaroundTelecommand _telecommand{_diagnostics};
+    };
+
+    template <typename... T> void SetMinimumTurnaroundTelecommandTest::Run(T... params)
+    {
+        std::array<std::uint8_t, sizeof...(T)> buffer{static_cast<std::uint8_t>(params)...};
+
+        _telecommand.Handle(_transmitter, buffer);
+    }
+
+    TEST_F(SetMinimumTurnaroundTelecommandTest, ShouldSetMinimumTurnaround)
+    {
+        EXPECT_CALL(_diagnostics, SetMinimumTurnaround(ResponseCommand::ReceiverGetFrameCount, Eq(1ms)));
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Comm, 0, testing::ElementsAre(0x11, 0x00))));
+
+        Run(0x11, num(ResponseCommand::ReceiverGetFrameCount), 1);
+    }
+
+    TEST_F(SetMinimumTurnaroundTelecommandTest, ShouldRespondWithErrorOnMalformedRequest)
+    {
+        EXPECT_CALL(_diagnostics, SetMinimumTurnaround(_, _)).Times(0);
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Comm, 0, testing::ElementsAre(0x11, 0xFF))));
+
+        Run(0x11, num(ResponseCommand::ReceiverGetFrameCount));
+    }
+
+    TEST_F(SetMinimumTurnaroundTelecommandTest, ShouldRespondWithErrorOnUnknownCommand)
+    {
+        EXPECT_CALL(_diagnostics, SetMinimumTurnaround(_, _)).Times(0);
+        EXPECT_CALL(_transmitter, SendFrame(IsDownlinkFrame(DownlinkAPID::Comm, 0, testing::ElementsAre(0x11, 0xFF))));
+
+        Run(0x11, num(ResponseCommand::Count), 1);
+    }
+}
@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "comm/CommDriver.hpp"
+#include "comm/Frame.hpp"
+#include "comm/IHandleFrame.hpp"
+#include "i2c/i2c.h"
+#include "mock/error_counter.hpp"
+#include "os/os.hpp"
+
+using testing::_;
+using testing::Eq;
+using testing::Lt;
+using testing::Invoke;
+using testing::NiceMock;
+using drivers::i2c::I2CAddress;
+using drivers::i2c::I2CResult;
+using namespace devices::comm;
+using namespace std::chrono_literals;
+
+namespace
+{
+    /** @brief Bus time of a single byte (8 data bits + ACK) on 100kHz I2C bus. */
+    static constexpr std::chrono::microseconds ByteTime{90};
+
+    /**
+     * @brief Simulated COMM receiver that keeps queue of uplink frames and records bus usage
+     */
+    class ReceiverSimulator : public drivers::i2c::II2CBus
+    {
+      public:
+        I2CResult Write(const I2CAddress address, gsl::span<const std::uint8_t> inData) override
+        {
+            Account(inData.size());
+
+            if (address != num(Address::Receiver) || inData.empty())
+            {
+                return I2CResult::OK;
+            }
+
+            _lastCommand = inData[0];
+            if (_lastCommand == num(ReceiverCommand::RemoveFrame) && !_frames.empty())
+            {
+                _frames.pop_front();
+            }
+
+            return I2CResult::OK;
+        }
+
+        I2CResult Read(const I2CAddress address, gsl::span<std::uint8_t> outData) override
+        {
+            Account(outData.size());
+            std::fill(outData.begin(), outData.end(), 0);
+
+            if (address != num(Address::Receiver))
+            {
+                return I2CResult::OK;
+            }
+
+            if (_lastCommand == num(ReceiverCommand::GetFrameCount) && outData.size() >= 2)
+            {
+                outData[0] = _frames.size() & 0xff;
+                outData[1] = (_frames.size() >> 8) & 0xff;
+            }
+            else if (_lastCommand == num(ReceiverCommand::GetFrame) && !_frames.empty())
+            {
+                const auto& frame = _frames.front();
+                std::vector<std::uint8_t> raw{static_cast<std::uint8_t>(frame.size() & 0xff),
+                    static_cast<std::uint8_t>((frame.size() >> 8) & 0xff),
+                    0x10,
+                    0x02,
+                    0x20,
+                    0x03};
+                raw.insert(raw.end(), frame.begin(), frame.end());
+                std::copy_n(raw.begin(), std::min<std::size_t>(raw.size(), outData.size()), outData.begin());
+            }
+
+            return I2CResult::OK;
+        }
+
+        I2CResult WriteRead(const I2CAddress /*address*/, gsl::span<const std::uint8_t> inData, gsl::span<std::uint8_t> outData) override
+        {
+            Account(inData.size() + outData.size());
+            return I2CResult::Failure;
+        }
+
+        void Enqueue(std::size_t count, std::size_t frameSize)
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                _frames.emplace_back(frameSize, static_cast<std::uint8_t>(i));
+            }
+        }
+
+        std::size_t Pending() const
+        {
+            return _frames.size();
+        }
+
+        std::uint32_t Transactions = 0;
+        std::chrono::microseconds BusTime{0};
+
+      private:
+        void Account(std::ptrdiff_t bytes)
+        {
+            Transactions++;
+            // address byte + payload
+            BusTime += ByteTime * (1 + bytes);
+        }
+
+        std::deque<std::vector<std::uint8_t>> _frames;
+        std::uint8_t _lastCommand = 0;
+    };
+
+    struct CountingFrameHandler : IHandleFrame
+    {
+        void HandleFrame(ITransmitter& /*transmitter*/, Frame& frame) override
+        {
+            Frames++;
+            Bytes += frame.Size();
+        }
+
+        std::uint32_t Frames = 0;
+        std::uint32_t Bytes = 0;
+    };
+
+    struct DrainResult
+    {
+        std::uint32_t Frames;
+        std::uint32_t Transactions;
+        std::chrono::microseconds Elapsed;
+    };
+
+    class CommReceiveBenchmarkTest : public testing::TestWithParam<std::tuple<std::size_t, std::size_t>>
+    {
+      protected:
+        CommReceiveBenchmarkTest();
+
+        DrainResult Drain(ReceiveMode mode);
+
+        NiceMock<OSMock> os;
+        OSReset guard;
+        NiceMock<ErrorCountingConfigrationMock> errorsConfig;
+        error_counter::ErrorCounting errors{errorsConfig};
+        std::chrono::microseconds slept{0};
+    };
+
+    CommReceiveBenchmarkTest::CommReceiveBenchmarkTest()
+    {
+        this->guard = InstallProxy(&os);
+        ON_CALL(os, Sleep(_)).WillByDefault(Invoke([this](std::chrono::milliseconds time) { this->slept += time; }));
+    }
+
+    DrainResult CommReceiveBenchmarkTest::Drain(ReceiveMode mode)
+    {
+        const auto frameCount = std::get<0>(GetParam());
+        const auto frameSize = std::get<1>(GetParam());
+
+        ReceiverSimulator bus;
+        CountingFrameHandler handler;
+        CommObject comm(errors, bus);
+        comm.SetFrameHandler(handler);
+        comm.SetReceiveMode(mode);
+
+        bus.Enqueue(frameCount, frameSize);
+        this->slept = 0us;
+
+        while (comm.PollHardware())
+        {
+        }
+
+        EXPECT_THAT(bus.Pending(), Eq(0U));
+        EXPECT_THAT(handler.Frames, Eq(frameCount));
+        EXPECT_THAT(handler.Bytes, Eq(frameCount * frameSize));
+
+        return DrainResult{handler.Frames, bus.Transactions, bus.BusTime + this->slept};
+    }
+
+    TEST_P(CommReceiveBenchmarkTest, AdaptiveReceiveDrainsReceiverFaster)
+    {
+        const auto frameCount = std::get<0>(GetParam());
+        const auto frameSize = std::get<1>(GetParam());
+
+        const auto twoPhase = Drain(ReceiveMode::TwoPhase);
+        const auto single = Drain(ReceiveMode::SingleTransaction);
+        const auto adaptive = Drain(ReceiveMode::Adaptive);
+
+        std::printf("[ BENCH    ] %u frames x %u bytes: two-phase %lu transactions, %lu us (%lu us/frame); "
+                    "single %lu transactions, %lu us (%lu us/frame); adaptive %lu transactions, %lu us (%lu us/frame)\n",
+            static_cast<unsigned>(frameCount),
+            static_cast<unsigned>(frameSize),
+            static_cast<unsigned long>(twoPhase.Transactions),
+            static_cast<unsigned long>(twoPhase.Elapsed.count()),
+            static_cast<unsigned long>(twoPhase.Elapsed.count() / twoPhase.Frames),
+            static_cast<unsigned long>(single.Transactions),
+            static_cast<unsigned long>(single.Elapsed.count()),
+            static_cast<unsigned long>(single.Elapsed.count() / single.Frames),
+            static_cast<unsigned long>(adaptive.Transactions),
+            static_cast<unsigned long>(adaptive.Elapsed.count()),
+            static_cast<unsigned long>(adaptive.Elapsed.count() / adaptive.Frames));
+
+        ASSERT_THAT(single.Transactions, Lt(twoPhase.Transactions));
+
+        // first frame is always downloaded in two phases, following ones of the same length with single transaction
+        if (frameCount == 1)
+        {
+            ASSERT_THAT(adaptive.Elapsed, Eq(twoPhase.Elapsed));
+        }
+        else
+        {
+            ASSERT_THAT(adaptive.Transactions, Lt(twoPhase.Transactions));
+            ASSERT_THAT(adaptive.Elapsed, Lt(twoPhase.Elapsed));
+        }
+    }
+
+    INSTANTIATE_TEST_CASE_P(CommReceiveBenchmarkTest,
+        CommReceiveBenchmarkTest,
+        testing::Values(std::make_tuple<std::size_t, std::size_t>(1, 20),
+            std::make_tuple<std::size_t, std::size_t>(8, 20),
+            std::make_tuple<std::size_t, std::size_t>(16, 100),
+            std::make_tuple<std::size_t, std::size_t>(32, 200)), );
+}
@@ -20,6 +20,7 @@
 
 using testing::_;
 using testing::Eq;
+using testing::Each;
 using testing::Ne;
 using testing::Ge;
 using testing::StrEq;
@@ -313,13 +314,82 @@ namespace
     TEST_F(CommTest, TestGetFrameResponseFailure)
     {
         i2c.ExpectWriteCommand(ReceiverAddress, ReceiverGetFrameCount).WillOnce(Return(I2CResult::OK));
-        EXPECT_CALL(i2c, Read(ReceiverAddress, _)).WillOnce(Return(I2CResult::Nack));
+        EXPECT_CALL(i2c, Read(ReceiverAddress, _)).Times(TurnaroundProfile::MaxPolls).WillRepeatedly(Return(I2CResult::Nack));
         const auto result = comm.GetFrameCount();
         ASSERT_THAT(result.status, Eq(false));
         ASSERT_THAT(result.frameCount, Eq(0));
         ASSERT_THAT(error_counter, Eq(5));
     }
 
+    TEST_F(CommTest, TestZeroTurnaroundDoesNotWaitForResponse)
+    {
+        comm.SetMinimumTurnaround(ResponseCommand::ReceiverGetFrameCount, 0ms);
+        EXPECT_CALL(system, Sleep(_)).Times(0);
+        MockFrameCount(3);
+        const auto result = comm.GetFrameCount();
+        ASSERT_THAT(result.status, Eq(true));
+        ASSERT_THAT(result.frameCount, Eq(3));
+    }
+
+    TEST_F(CommTest, TestResponseReadAfterMinimumTurnaround)
+    {
+        comm.SetMinimumTurnaround(ResponseCommand::ReceiverGetFrameCount, 3ms);
+        {
+            InSequence s;
+            EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetFrameCount))).WillOnce(Return(I2CResult::OK));
+            EXPECT_CALL(system, Sleep(3ms));
+            EXPECT_CALL(i2c, Read(ReceiverAddress, _)).WillOnce(Invoke([](uint8_t /*address*/, gsl::span<uint8_t> outData) {
+                std::fill(outData.begin(), outData.end(), 0);
+                return I2CResult::OK;
+            }));
+        }
+
+        const auto result = comm.GetFrameCount();
+        ASSERT_THAT(result.status, Eq(true));
+    }
+
+    TEST_F(CommTest, TestResponsePolledUntilAcknowledged)
+    {
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetFrameCount))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(system, Sleep(TurnaroundProfile::DefaultMinimumTurnaround));
+        EXPECT_CALL(system, Sleep(TurnaroundProfile::PollInterval)).Times(2);
+        EXPECT_CALL(system, GetUptime()).WillOnce(Return(10ms)).WillOnce(Return(14ms));
+        EXPECT_CALL(i2c, Read(ReceiverAddress, _))
+            .WillOnce(Return(I2CResult::Nack))
+            .WillOnce(Return(I2CResult::Nack))
+            .WillOnce(Invoke([](uint8_t /*address*/, gsl::span<uint8_t> outData) {
+                outData[0] = 7;
+                outData[1] = 0;
+                return I2CResult::OK;
+            }));
+
+        const auto result = comm.GetFrameCount();
+        ASSERT_THAT(result.status, Eq(true));
+        ASSERT_THAT(result.frameCount, Eq(7));
+        ASSERT_THAT(error_counter, Eq(0));
+
+        const auto statistics = comm.GetTurnaroundStatistics(ResponseCommand::ReceiverGetFrameCount);
+        ASSERT_THAT(statistics.Exchanges, Eq(1U));
+        ASSERT_THAT(statistics.Nacks, Eq(2U));
+        ASSERT_THAT(statistics.Failures, Eq(0U));
+        ASSERT_THAT(statistics.Longest, Eq(4ms));
+        ASSERT_THAT(statistics.Histogram, ElementsAre(0, 0, 0, 1, 0, 0));
+    }
+
+    TEST_F(CommTest, TestResponseFailureRecordedInTurnaroundStatistics)
+    {
+        i2c.ExpectWriteCommand(ReceiverAddress, ReceiverGetFrameCount).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Read(ReceiverAddress, _)).WillOnce(Return(I2CResult::BusErr));
+
+        const auto result = comm.GetFrameCount();
+        ASSERT_THAT(result.status, Eq(false));
+
+        const auto statistics = comm.GetTurnaroundStatistics(ResponseCommand::ReceiverGetFrameCount);
+        ASSERT_THAT(statistics.Exchanges, Eq(0U));
+        ASSERT_THAT(statistics.Nacks, Eq(0U));
+        ASSERT_THAT(statistics.Failures, Eq(1U));
+    }
+
     TEST_F(CommTest, TestGetFrameCountOnLimit)
     {
         MockFrameCount(64);
@@ -460,7 +530,7 @@ namespace
     {
         uint8_t buffer[10] = {0};
         EXPECT_CALL(i2c, Write(TransmitterAddress, BeginsWith(TransmitterSendFrame))).WillOnce(Return(I2CResult::OK));
-        EXPECT_CALL(i2c, Read(TransmitterAddress, _)).WillOnce(Return(I2CResult::Nack));
+        EXPECT_CALL(i2c, Read(TransmitterAddress, _)).Times(TurnaroundProfile::MaxPolls).WillRepeatedly(Return(I2CResult::Nack));
         const auto status = comm.SendFrame(span<const uint8_t, 10>(buffer));
         ASSERT_THAT(status, Eq(false));
         ASSERT_THAT(error_counter, Eq(5));
@@ -498,7 +568,7 @@ namespace
     {
         Frame frame;
         EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetFrame))).WillOnce(Return(I2CResult::OK));
-        EXPECT_CALL(i2c, Read(ReceiverAddress, _)).WillOnce(Return(I2CResult::Nack));
+        EXPECT_CALL(i2c, Read(ReceiverAddress, _)).Times(TurnaroundProfile::MaxPolls).WillRepeatedly(Return(I2CResult::Nack));
         const auto status = comm.ReceiveFrame(dataBuffer, frame);
         ASSERT_THAT(status, Eq(false));
         ASSERT_THAT(error_counter, Eq(5));
@@ -544,12 +614,13 @@ namespace
     {
         Frame frame;
         EXPECT_CALL(i2c, Read(ReceiverAddress, _))
+            .Times(1 + TurnaroundProfile::MaxPolls)
             .WillOnce(Invoke([](uint8_t /*address*/, span<uint8_t> outData) {
                 std::fill(outData.begin(), outData.end(), 0);
                 outData[0] = 1;
                 return I2CResult::OK;
             }))
-            .WillOnce(Return(I2CResult::Nack));
+            .WillRepeatedly(Return(I2CResult::Nack));
         const auto status = comm.ReceiveFrame(dataBuffer, frame);
         ASSERT_THAT(status, Eq(false));
         ASSERT_THAT(error_counter, Eq(5));
@@ -603,6 +674,149 @@ namespace
         ASSERT_THAT(error_counter, Eq(0));
     }
 
+    TEST_F(CommTest, TestReceiveFrameSingleTransaction)
+    {
+        Frame frame;
+        const uint8_t expected[] = {0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetFrame))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Read(ReceiverAddress, SpanOfSize(6 + MaxUplinkFrameSize)))
+            .WillOnce(Invoke([&](uint8_t /*address*/, span<uint8_t> outData) {
+                std::fill(outData.begin(), outData.end(), 0xAA);
+                outData[0] = COUNT_OF(expected);
+                outData[1] = 0;
+                outData[2] = 0xab;
+                outData[3] = 0x0c;
+                outData[4] = 0xde;
+                outData[5] = 0x0d;
+                std::copy(std::begin(expected), std::end(expected), outData.begin() + 6);
+                return I2CResult::OK;
+            }));
+
+        comm.SetReceiveMode(ReceiveMode::SingleTransaction);
+        const auto status = comm.ReceiveFrame(dataBuffer, frame);
+        ASSERT_THAT(status, Eq(true));
+        ASSERT_THAT(frame.Verify(), Eq(true));
+        ASSERT_THAT(frame.Size(), Eq(COUNT_OF(expected)));
+        ASSERT_THAT(frame.Doppler(), Eq(0xcab));
+        ASSERT_THAT(frame.Rssi(), Eq(0xdde));
+        ASSERT_THAT(gsl::span<const std::uint8_t>(frame.Payload()), Eq(span<const uint8_t>(expected)));
+        ASSERT_THAT(error_counter, Eq(0));
+    }
+
+    TEST_F(CommTest, TestReceiveFrameSingleTransactionPartialData)
+    {
+        std::uint8_t buffer[22];
+        Frame frame;
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetFrame))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Read(ReceiverAddress, SpanOfSize(22))).WillOnce(Invoke([&](uint8_t /*address*/, span<uint8_t> outData) {
+            std::fill(outData.begin(), outData.end(), 0x11);
+            outData[0] = 32;
+            outData[1] = 0;
+            return I2CResult::OK;
+        }));
+
+        comm.SetReceiveMode(ReceiveMode::SingleTransaction);
+        const auto status = comm.ReceiveFrame(buffer, frame);
+        ASSERT_THAT(status, Eq(true));
+        ASSERT_THAT(frame.Size(), Eq(16));
+        ASSERT_THAT(frame.FullSize(), Eq(32));
+        ASSERT_THAT(frame.IsComplete(), Eq(false));
+        ASSERT_THAT(error_counter, Eq(0));
+    }
+
+    TEST_F(CommTest, TestReceiveFrameSingleTransactionFailure)
+    {
+        Frame frame;
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetFrame))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Read(ReceiverAddress, _)).Times(TurnaroundProfile::MaxPolls).WillRepeatedly(Return(I2CResult::Nack));
+
+        comm.SetReceiveMode(ReceiveMode::SingleTransaction);
+        const auto status = comm.ReceiveFrame(dataBuffer, frame);
+        ASSERT_THAT(status, Eq(false));
+        ASSERT_THAT(error_counter, Eq(5));
+    }
+
+    TEST_F(CommTest, TestPollHardwareSingleTransactionReceive)
+    {
+        std::uint8_t buffer[10] = {0};
+        i2c.ExpectWriteCommand(ReceiverAddress, ReceiverWatchdogReset).WillOnce(Return(I2CResult::OK));
+        MockFrameCount(2);
+        MockFrame(buffer, 1, 2);
+        i2c.ExpectWriteCommand(ReceiverAddress, ReceiverRemoveFrame).Times(2).WillRepeatedly(Return(I2CResult::OK));
+        EXPECT_CALL(frameHandler, HandleFrame(_, _)).Times(2);
+
+        comm.SetReceiveMode(ReceiveMode::SingleTransaction);
+        auto result = comm.PollHardware();
+        ASSERT_THAT(result, Eq(true));
+        ASSERT_THAT(error_counter, Eq(0));
+    }
+
+    TEST_F(CommTest, TestReceiveFrameAdaptive)
+    {
+        const auto fill = [](std::uint8_t length) {
+            return Invoke([length](uint8_t /*address*/, span<uint8_t> outData) {
+                std::fill(outData.begin(), outData.end(), length);
+                outData[0] = length;
+                outData[1] = 0;
+                return I2CResult::OK;
+            });
+        };
+
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetFrame))).WillRepeatedly(Return(I2CResult::OK));
+
+        {
+            InSequence s;
+
+            // first frame: length query followed by frame download
+            EXPECT_CALL(i2c, Read(ReceiverAddress, SpanOfSize(2))).WillOnce(fill(3));
+            EXPECT_CALL(i2c, Read(ReceiverAddress, SpanOfSize(6 + 3))).WillOnce(fill(3));
+            // frame of the same length: single transaction
+            EXPECT_CALL(i2c, Read(ReceiverAddress, SpanOfSize(6 + 3))).WillOnce(fill(3));
+            // longer frame: frame is downloaded again
+            EXPECT_CALL(i2c, Read(ReceiverAddress, SpanOfSize(6 + 3))).WillOnce(fill(5));
+            EXPECT_CALL(i2c, Read(ReceiverAddress, SpanOfSize(6 + 5))).WillOnce(fill(5));
+            // shorter frame fits into single transaction
+            EXPECT_CALL(i2c, Read(ReceiverAddress, SpanOfSize(6 + 5))).WillOnce(fill(2));
+        }
+
+        comm.SetReceiveMode(ReceiveMode::Adaptive);
+
+        for (const std::uint8_t length : {3, 3, 5, 2})
+        {
+            Frame frame;
+            ASSERT_THAT(comm.ReceiveFrame(dataBuffer, frame), Eq(true));
+            ASSERT_THAT(frame.Size(), Eq(length));
+            ASSERT_THAT(frame.IsComplete(), Eq(true));
+            ASSERT_THAT(frame.Payload(), Each(Eq(length)));
+        }
+
+        ASSERT_THAT(error_counter, Eq(0));
+    }
+
+    TEST_F(CommTest, TestPollHardwareUpdatesPollingStatistics)
+    {
+        std::uint8_t buffer[10] = {0};
+        i2c.ExpectWriteCommand(ReceiverAddress, ReceiverWatchdogReset).WillRepeatedly(Return(I2CResult::OK));
+        MockFrameCount(1);
+        MockFrame(buffer);
+        i2c.ExpectWriteCommand(ReceiverAddress, ReceiverRemoveFrame).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(frameHandler, HandleFrame(_, _)).Times(1);
+        EXPECT_CALL(system, GetUptime()).WillRepeatedly(Return(1s));
+
+        comm.SetReceiveMode(ReceiveMode::SingleTransaction);
+        ASSERT_THAT(comm.PollHardware(), Eq(true));
+
+        MockFrameCount(0);
+        EXPECT_CALL(system, GetUptime()).WillRepeatedly(Return(1300ms));
+        ASSERT_THAT(comm.PollHardware(), Eq(false));
+
+        const auto stats = comm.GetPollingStatistics();
+        ASSERT_THAT(stats.Polls, Eq(2u));
+        ASSERT_THAT(stats.FramePolls, Eq(1u));
+        ASSERT_THAT(stats.LastLatency, Eq(1s));
+        ASSERT_THAT(stats.CurrentInterval, Eq(100ms));
+    }
+
     TEST_F(CommTest, TestReceiverTelemetry)
     {
         ReceiverTelemetry telemetry;
@@ -997,6 +1211,87 @@ namespace
         ASSERT_THAT(error_counter, Eq(0));
     }
 
+    TEST_F(CommTest, TestGetTelemetryServesRepeatedRequestFromCache)
+    {
+        CommTelemetry telemetry;
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetTelemetryLastTransmission))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetTelemetryInstant))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetUptime))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetState))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetTelemetry))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetUptime))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(system, GetUptime()).WillOnce(Return(10s)).WillOnce(Return(10s)).WillRepeatedly(Return(11s));
+
+        ASSERT_THAT(comm.GetTelemetry(telemetry), Eq(true));
+        ASSERT_THAT(comm.GetAvoidedTransactions(), Eq(0U));
+
+        ASSERT_THAT(comm.GetTelemetry(telemetry), Eq(true));
+        ASSERT_THAT(comm.GetAvoidedTransactions(), Eq(6U));
+        ASSERT_THAT(error_counter, Eq(0));
+    }
+
+    TEST_F(CommTest, TestGetTelemetryRefreshesExpiredEntries)
+    {
+        CommTelemetry telemetry;
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetTelemetryLastTransmission))).Times(2);
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetTelemetryInstant))).Times(2);
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetUptime))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetState))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetTelemetry))).Times(2);
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetUptime))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(system, GetUptime()).WillRepeatedly(Return(10s));
+
+        ASSERT_THAT(comm.GetTelemetry(telemetry), Eq(true));
+        EXPECT_CALL(system, GetUptime()).WillRepeatedly(Return(20s));
+        ASSERT_THAT(comm.GetTelemetry(telemetry), Eq(true));
+        ASSERT_THAT(comm.GetAvoidedTransactions(), Eq(3U));
+    }
+
+    TEST_F(CommTest, TestCachedUptimeIsExtrapolated)
+    {
+        TransmitterTelemetry telemetry;
+
+        uint8_t uptimeRaw[] = {5, 20, 3, 1};
+        EXPECT_CALL(i2c, Write(TransmitterAddress, _)).WillRepeatedly(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetUptime))).WillOnce(Return(I2CResult::OK));
+        ON_CALL(i2c, Read(TransmitterAddress, _)).WillByDefault(Invoke([&](uint8_t /*address*/, span<uint8_t> outData) {
+            std::fill(outData.begin(), outData.end(), 0);
+            std::copy_n(std::begin(uptimeRaw), std::min<std::size_t>(sizeof(uptimeRaw), outData.size()), outData.begin());
+            return I2CResult::OK;
+        }));
+        EXPECT_CALL(system, GetUptime()).WillOnce(Return(10s)).WillRepeatedly(Return(13s));
+
+        ASSERT_THAT(comm.GetTransmitterTelemetry(telemetry), Eq(true));
+        ASSERT_THAT(telemetry.Uptime, Eq(27h + 20min + 5s));
+
+        ASSERT_THAT(comm.GetTransmitterTelemetry(telemetry), Eq(true));
+        ASSERT_THAT(telemetry.Uptime, Eq(27h + 20min + 8s));
+    }
+
+    TEST_F(CommTest, TestSetBitrateInvalidatesCachedTransmitterState)
+    {
+        TransmitterTelemetry telemetry;
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetTelemetryLastTransmission))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetTelemetryInstant))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetUptime))).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterGetState))).Times(2);
+        EXPECT_CALL(i2c, Write(TransmitterAddress, ElementsAre(TransmitterSetBitrate, _))).WillOnce(Return(I2CResult::OK));
+
+        ASSERT_THAT(comm.GetTransmitterTelemetry(telemetry), Eq(true));
+        ASSERT_THAT(comm.SetTransmitterBitRate(Bitrate::Comm9600bps), Eq(true));
+        ASSERT_THAT(comm.GetTransmitterTelemetry(telemetry), Eq(true));
+    }
+
+    TEST_F(CommTest, TestFailedTelemetryQueryIsNotCached)
+    {
+        ReceiverTelemetry telemetry;
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetUptime))).WillOnce(Return(I2CResult::Nack)).WillOnce(Return(I2CResult::OK));
+        EXPECT_CALL(i2c, Write(ReceiverAddress, ElementsAre(ReceiverGetTelemetry))).WillOnce(Return(I2CResult::OK));
+
+        ASSERT_THAT(comm.GetReceiverTelemetry(telemetry), Eq(false));
+        ASSERT_THAT(comm.GetReceiverTelemetry(telemetry), Eq(true));
+    }
+
     TEST_F(CommTest, TestSetBeaconTransmittFailure)
     {
         std::uint8_t buffer[1];
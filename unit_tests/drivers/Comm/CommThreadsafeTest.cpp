@@ -39,6 +39,7 @@ namespace
 
         OSSemaphoreHandle transmitterSemaphore{reinterpret_cast<OSSemaphoreHandle>(0x1234)};
         OSSemaphoreHandle receiverSemaphore{reinterpret_cast<OSSemaphoreHandle>(0x5678)};
+        OSSemaphoreHandle telemetrySemaphore{reinterpret_cast<OSSemaphoreHandle>(0x9ABC)};
         error_counter::ErrorCounting errors{errorsConfig};
     };
 
@@ -48,6 +49,7 @@ namespace
 
         ON_CALL(os, CreateBinarySemaphore(CommObject::transmitterSemaphoreId)).WillByDefault(Return(transmitterSemaphore));
         ON_CALL(os, CreateBinarySemaphore(CommObject::receiverSemaphoreId)).WillByDefault(Return(receiverSemaphore));
+        ON_CALL(os, CreateBinarySemaphore(CommObject::telemetrySemaphoreId)).WillByDefault(Return(telemetrySemaphore));
     }
 
     TEST_F(CommThreadsafeTest, ShouldSynchronizeTransmitter)
@@ -63,6 +65,7 @@ namespace
 
         EXPECT_CALL(os, TakeSemaphore(receiverSemaphore, _)).Times(0);
         EXPECT_CALL(os, GiveSemaphore(receiverSemaphore)).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(os, GiveSemaphore(telemetrySemaphore)).WillOnce(Return(OSResult::Success));
 
         CommObject comm{errors, i2c};
         comm.Initialize();
@@ -86,6 +89,7 @@ namespace
 
         EXPECT_CALL(os, TakeSemaphore(transmitterSemaphore, _)).Times(0);
         EXPECT_CALL(os, GiveSemaphore(transmitterSemaphore)).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(os, GiveSemaphore(telemetrySemaphore)).WillOnce(Return(OSResult::Success));
 
         CommObject comm{errors, i2c};
         comm.Initialize();
@@ -94,4 +98,29 @@ namespace
         Frame frame;
         comm.ReceiveFrame(buffer, frame);
     }
+
+    TEST_F(CommThreadsafeTest, ShouldHoldTelemetryLockDuringTelemetryRefresh)
+    {
+        {
+            InSequence dummy;
+            UNREFERENCED_PARAMETER(dummy);
+
+            EXPECT_CALL(os, GiveSemaphore(telemetrySemaphore)).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(os, TakeSemaphore(telemetrySemaphore, _)).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(os, TakeSemaphore(receiverSemaphore, _)).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(os, GiveSemaphore(receiverSemaphore)).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(os, TakeSemaphore(receiverSemaphore, _)).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(os, GiveSemaphore(receiverSemaphore)).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(os, GiveSemaphore(telemetrySemaphore)).WillOnce(Return(OSResult::Success));
+        }
+
+        EXPECT_CALL(os, GiveSemaphore(transmitterSemaphore)).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(os, GiveSemaphore(receiverSemaphore)).WillOnce(Return(OSResult::Success)).RetiresOnSaturation();
+
+        CommObject comm{errors, i2c};
+        comm.Initialize();
+
+        ReceiverTelemetry telemetry;
+        comm.GetReceiverTelemetry(telemetry);
+    }
 }
@@ -15,6 +15,8 @@ using std::uint8_t;
 using std::uint32_t;
 using telecommunication::downlink::DownlinkFrame;
 using telecommunication::downlink::DownlinkAPID;
+using telecommunication::downlink::PackedDownlinkFrame;
+using testing::ElementsAre;
 namespace
 {
     TEST(DownlinkFrameTest, ShouldBuildProperDownlinkFrame)
@@ -43,4 +45,49 @@ namespace
         ASSERT_THAT(frame.PayloadWriter().WriteArray(payload), Eq(true));
         ASSERT_THAT(frame.PayloadWriter().WriteByte(0xAA), Eq(false));
     }
+
+    TEST(DownlinkFrameTest, ShouldPackShortFramesIntoContainer)
+    {
+        DownlinkFrame first(DownlinkAPID::SetBitrate, 0);
+        first.PayloadWriter().WriteByte(0x11);
+        first.PayloadWriter().WriteByte(0x00);
+
+        DownlinkFrame second(DownlinkAPID::TimeSet, 0);
+        second.PayloadWriter().WriteByte(0x22);
+
+        PackedDownlinkFrame packed;
+
+        ASSERT_THAT(packed.Append(first.Frame()), Eq(true));
+        ASSERT_THAT(packed.Append(second.Frame()), Eq(true));
+        ASSERT_THAT(packed.Count(), Eq(2));
+
+        ASSERT_THAT(packed.Frame(),
+            ElementsAre(num(DownlinkAPID::Packed), 0, 0, num(DownlinkAPID::SetBitrate), 2, 0x11, 0x00, num(DownlinkAPID::TimeSet), 1, 0x22));
+    }
+
+    TEST(DownlinkFrameTest, ShouldNotPackMultiFrameResponses)
+    {
+        DownlinkFrame frame(DownlinkAPID::FileList, 1);
+        frame.PayloadWriter().WriteByte(0x11);
+
+        PackedDownlinkFrame packed;
+
+        ASSERT_THAT(PackedDownlinkFrame::CanPack(frame.Frame()), Eq(false));
+        ASSERT_THAT(packed.Append(frame.Frame()), Eq(false));
+        ASSERT_THAT(packed.Count(), Eq(0));
+    }
+
+    TEST(DownlinkFrameTest, ShouldNotPackFrameThatDoesNotFit)
+    {
+        DownlinkFrame big(DownlinkAPID::Operation, 0);
+        array<uint8_t, 150> payload;
+        payload.fill(0xAA);
+        big.PayloadWriter().WriteArray(payload);
+
+        PackedDownlinkFrame packed;
+
+        ASSERT_THAT(packed.Append(big.Frame()), Eq(true));
+        ASSERT_THAT(packed.Append(big.Frame()), Eq(false));
+        ASSERT_THAT(packed.Count(), Eq(1));
+    }
 }
@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock-matchers.h"
+#include "comm/PollingScheduler.hpp"
+
+namespace
+{
+    using testing::Eq;
+
+    using namespace devices::comm;
+    using namespace std::chrono_literals;
+
+    class PollingSchedulerTest : public testing::Test
+    {
+      protected:
+        PollingSchedulerTest();
+
+        PollingScheduler scheduler;
+    };
+
+    PollingSchedulerTest::PollingSchedulerTest() : scheduler(100ms, 2s, 15s)
+    {
+    }
+
+    TEST_F(PollingSchedulerTest, ShouldStartWithMinimalInterval)
+    {
+        ASSERT_THAT(scheduler.NextInterval(0ms), Eq(100ms));
+
+        const auto stats = scheduler.Statistics();
+        ASSERT_THAT(stats.Polls, Eq(0u));
+        ASSERT_THAT(stats.FramePolls, Eq(0u));
+        ASSERT_THAT(stats.CurrentInterval, Eq(100ms));
+    }
+
+    TEST_F(PollingSchedulerTest, ShouldBackOffWhenIdle)
+    {
+        scheduler.PollCompleted(100ms, false);
+        ASSERT_THAT(scheduler.NextInterval(100ms), Eq(200ms));
+
+        scheduler.PollCompleted(300ms, false);
+        ASSERT_THAT(scheduler.NextInterval(300ms), Eq(400ms));
+
+        scheduler.PollCompleted(700ms, false);
+        ASSERT_THAT(scheduler.NextInterval(700ms), Eq(800ms));
+
+        scheduler.PollCompleted(1500ms, false);
+        ASSERT_THAT(scheduler.NextInterval(1500ms), Eq(1600ms));
+
+        scheduler.PollCompleted(3100ms, false);
+        ASSERT_THAT(scheduler.NextInterval(3100ms), Eq(2s));
+
+        scheduler.PollCompleted(5100ms, false);
+        ASSERT_THAT(scheduler.NextInterval(5100ms), Eq(2s));
+
+        ASSERT_THAT(scheduler.Statistics().Polls, Eq(6u));
+        ASSERT_THAT(scheduler.Statistics().CurrentInterval, Eq(2s));
+    }
+
+    TEST_F(PollingSchedulerTest, ShouldPollFastAfterReceivedFrame)
+    {
+        scheduler.PollCompleted(1s, false);
+        scheduler.PollCompleted(2s, false);
+        scheduler.PollCompleted(3s, false);
+        ASSERT_THAT(scheduler.NextInterval(3s), Eq(800ms));
+
+        scheduler.PollCompleted(3800ms, true);
+        ASSERT_THAT(scheduler.NextInterval(3800ms), Eq(100ms));
+
+        scheduler.PollCompleted(3900ms, false);
+        ASSERT_THAT(scheduler.NextInterval(3900ms), Eq(100ms));
+
+        ASSERT_THAT(scheduler.NextInterval(18700ms), Eq(100ms));
+    }
+
+    TEST_F(PollingSchedulerTest, ShouldBackOffAfterActivityHoldExpires)
+    {
+        scheduler.PollCompleted(1s, true);
+        scheduler.PollCompleted(15s, false);
+        ASSERT_THAT(scheduler.NextInterval(15s), Eq(100ms));
+
+        scheduler.PollCompleted(16s, false);
+        ASSERT_THAT(scheduler.NextInterval(16s), Eq(200ms));
+    }
+
+    TEST_F(PollingSchedulerTest, ShouldTrackLatency)
+    {
+        scheduler.PollCompleted(1s, false);
+        scheduler.PollCompleted(1200ms, true);
+        scheduler.PollCompleted(1300ms, false);
+        scheduler.PollCompleted(1700ms, true);
+
+        const auto stats = scheduler.Statistics();
+        ASSERT_THAT(stats.Polls, Eq(4u));
+        ASSERT_THAT(stats.FramePolls, Eq(2u));
+        ASSERT_THAT(stats.LastLatency, Eq(400ms));
+        ASSERT_THAT(stats.MaxLatency, Eq(400ms));
+        ASSERT_THAT(stats.AverageLatency, Eq(300ms));
+    }
+
+    TEST_F(PollingSchedulerTest, ShouldPollFastDuringExpectedPass)
+    {
+        scheduler.PollCompleted(1s, false);
+        scheduler.PollCompleted(2s, false);
+        ASSERT_THAT(scheduler.NextInterval(2s), Eq(400ms));
+
+        scheduler.ExpectPass(10s);
+        ASSERT_THAT(scheduler.NextInterval(3s), Eq(100ms));
+
+        scheduler.PollCompleted(9s, false);
+        ASSERT_THAT(scheduler.NextInterval(9s), Eq(100ms));
+
+        scheduler.PollCompleted(10s, false);
+        ASSERT_THAT(scheduler.NextInterval(10s), Eq(200ms));
+    }
+}
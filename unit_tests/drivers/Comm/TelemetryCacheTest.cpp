@@ -0,0 +1,109 @@
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock-matchers.h"
+#include "comm/TelemetryCache.hpp"
+
+namespace
+{
+    using testing::ElementsAre;
+    using testing::Eq;
+
+    using namespace devices::comm;
+    using namespace std::chrono_literals;
+
+    class TelemetryCacheTest : public testing::Test
+    {
+      protected:
+        TelemetryCache cache;
+        std::array<std::uint8_t, 4> response{{1, 2, 3, 4}};
+        std::array<std::uint8_t, 4> buffer{{0, 0, 0, 0}};
+    };
+
+    TEST_F(TelemetryCacheTest, ShouldStartEmpty)
+    {
+        ASSERT_THAT(cache.Read(TelemetryQuery::ReceiverUptime, 0ms, buffer), Eq(false));
+        ASSERT_THAT(cache.Age(TelemetryQuery::ReceiverUptime, 10s), Eq(0ms));
+        ASSERT_THAT(cache.AvoidedTransactions(), Eq(0U));
+    }
+
+    TEST_F(TelemetryCacheTest, ShouldReturnStoredResponseWithinTimeToLive)
+    {
+        cache.Store(TelemetryQuery::ReceiverInstant, 10s, response);
+
+        ASSERT_THAT(cache.Read(TelemetryQuery::ReceiverInstant, 12s, buffer), Eq(true));
+        ASSERT_THAT(buffer, ElementsAre(1, 2, 3, 4));
+        ASSERT_THAT(cache.Age(TelemetryQuery::ReceiverInstant, 12s), Eq(2s));
+        ASSERT_THAT(cache.AvoidedTransactions(), Eq(1U));
+    }
+
+    TEST_F(TelemetryCacheTest, ShouldExpireResponseAfterTimeToLive)
+    {
+        cache.Store(TelemetryQuery::TransmitterInstant, 10s, response);
+
+        ASSERT_THAT(cache.Read(TelemetryQuery::TransmitterInstant, 10s + TelemetryCache::TimeToLive(TelemetryQuery::TransmitterInstant), buffer),
+            Eq(false));
+        ASSERT_THAT(cache.AvoidedTransactions(), Eq(0U));
+    }
+
+    TEST_F(TelemetryCacheTest, ShouldKeepEntriesWithDifferentTimeToLive)
+    {
+        cache.Store(TelemetryQuery::TransmitterUptime, 10s, response);
+        cache.Store(TelemetryQuery::TransmitterInstant, 10s, response);
+
+        ASSERT_THAT(cache.Read(TelemetryQuery::TransmitterUptime, 30s, buffer), Eq(true));
+        ASSERT_THAT(cache.Read(TelemetryQuery::TransmitterInstant, 30s, buffer), Eq(false));
+    }
+
+    TEST_F(TelemetryCacheTest, ShouldNotReturnResponseFromTheFuture)
+    {
+        cache.Store(TelemetryQuery::ReceiverInstant, 10s, response);
+
+        ASSERT_THAT(cache.Read(TelemetryQuery::ReceiverInstant, 5s, buffer), Eq(false));
+    }
+
+    TEST_F(TelemetryCacheTest, ShouldInvalidateSingleEntry)
+    {
+        cache.Store(TelemetryQuery::TransmitterState, 10s, response);
+        cache.Store(TelemetryQuery::TransmitterUptime, 10s, response);
+
+        cache.Invalidate(TelemetryQuery::TransmitterState);
+
+        ASSERT_THAT(cache.Read(TelemetryQuery::TransmitterState, 10s, buffer), Eq(false));
+        ASSERT_THAT(cache.Read(TelemetryQuery::TransmitterUptime, 10s, buffer), Eq(true));
+    }
+
+    TEST_F(TelemetryCacheTest, ShouldInvalidateTransmitterEntries)
+    {
+        cache.Store(TelemetryQuery::TransmitterState, 10s, response);
+        cache.Store(TelemetryQuery::TransmitterUptime, 10s, response);
+        cache.Store(TelemetryQuery::ReceiverUptime, 10s, response);
+
+        cache.InvalidateTransmitter();
+
+        ASSERT_THAT(cache.Read(TelemetryQuery::TransmitterState, 10s, buffer), Eq(false));
+        ASSERT_THAT(cache.Read(TelemetryQuery::TransmitterUptime, 10s, buffer), Eq(false));
+        ASSERT_THAT(cache.Read(TelemetryQuery::ReceiverUptime, 10s, buffer), Eq(true));
+    }
+
+    TEST_F(TelemetryCacheTest, ShouldInvalidateReceiverEntries)
+    {
+        cache.Store(TelemetryQuery::ReceiverInstant, 10s, response);
+        cache.Store(TelemetryQuery::ReceiverUptime, 10s, response);
+        cache.Store(TelemetryQuery::TransmitterUptime, 10s, response);
+
+        cache.InvalidateReceiver();
+
+        ASSERT_THAT(cache.Read(TelemetryQuery::ReceiverInstant, 10s, buffer), Eq(false));
+        ASSERT_THAT(cache.Read(TelemetryQuery::ReceiverUptime, 10s, buffer), Eq(false));
+        ASSERT_THAT(cache.Read(TelemetryQuery::TransmitterUptime, 10s, buffer), Eq(true));
+    }
+
+    TEST_F(TelemetryCacheTest, ShouldIgnoreTooLongResponse)
+    {
+        std::array<std::uint8_t, TelemetryCache::MaxResponseSize + 1> tooLong{};
+
+        cache.Store(TelemetryQuery::ReceiverInstant, 10s, tooLong);
+
+        ASSERT_THAT(cache.Read(TelemetryQuery::ReceiverInstant, 10s, buffer), Eq(false));
+    }
+}
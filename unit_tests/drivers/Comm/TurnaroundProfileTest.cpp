@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock-matchers.h"
+#include "comm/TurnaroundProfile.hpp"
+#include "system.h"
+
+namespace
+{
+    using testing::ElementsAre;
+    using testing::Eq;
+
+    using namespace devices::comm;
+    using namespace std::chrono_literals;
+
+    class TurnaroundProfileTest : public testing::Test
+    {
+      protected:
+        TurnaroundProfile profile;
+    };
+
+    TEST_F(TurnaroundProfileTest, ShouldClassifyCommands)
+    {
+        ASSERT_THAT(TurnaroundProfile::Classify(Address::Receiver, num(ReceiverCommand::GetFrameCount)),
+            Eq(ResponseCommand::ReceiverGetFrameCount));
+        ASSERT_THAT(TurnaroundProfile::Classify(Address::Receiver, num(ReceiverCommand::GetFrame)), Eq(ResponseCommand::ReceiverGetFrame));
+        ASSERT_THAT(TurnaroundProfile::Classify(Address::Transmitter, num(TransmitterCommand::SendFrame)),
+            Eq(ResponseCommand::TransmitterSendFrame));
+        ASSERT_THAT(TurnaroundProfile::Classify(Address::Transmitter, num(TransmitterCommand::GetUptime)),
+            Eq(ResponseCommand::TransmitterGetUptime));
+        ASSERT_THAT(TurnaroundProfile::Classify(Address::Receiver, num(ReceiverCommand::RemoveFrame)), Eq(ResponseCommand::Other));
+    }
+
+    TEST_F(TurnaroundProfileTest, ShouldStartWithDefaultProfile)
+    {
+        ASSERT_THAT(profile.MinimumTurnaround(ResponseCommand::ReceiverGetFrameCount), Eq(TurnaroundProfile::DefaultMinimumTurnaround));
+        ASSERT_THAT(profile.MinimumTurnaround(ResponseCommand::ReceiverGetTelemetry), Eq(2ms));
+
+        const auto statistics = profile.Statistics(ResponseCommand::ReceiverGetFrameCount);
+        ASSERT_THAT(statistics.Exchanges, Eq(0U));
+        ASSERT_THAT(statistics.Histogram, ElementsAre(0, 0, 0, 0, 0, 0));
+    }
+
+    TEST_F(TurnaroundProfileTest, ShouldOverrideMinimumTurnaround)
+    {
+        profile.SetMinimumTurnaround(ResponseCommand::ReceiverGetTelemetry, 5ms);
+        profile.SetMinimumTurnaround(ResponseCommand::ReceiverGetFrame, -1ms);
+
+        ASSERT_THAT(profile.MinimumTurnaround(ResponseCommand::ReceiverGetTelemetry), Eq(5ms));
+        ASSERT_THAT(profile.MinimumTurnaround(ResponseCommand::ReceiverGetFrame), Eq(0ms));
+        ASSERT_THAT(profile.MinimumTurnaround(ResponseCommand::TransmitterGetTelemetryInstant), Eq(2ms));
+    }
+
+    TEST_F(TurnaroundProfileTest, ShouldBuildTurnaroundHistogram)
+    {
+        for (auto turnaround : {0ms, 0ms, 1ms, 2ms, 3ms, 4ms, 8ms, 9ms, 100ms})
+        {
+            profile.Record(ResponseCommand::TransmitterSendFrame, turnaround, 0, true);
+        }
+
+        const auto statistics = profile.Statistics(ResponseCommand::TransmitterSendFrame);
+        ASSERT_THAT(statistics.Exchanges, Eq(9U));
+        ASSERT_THAT(statistics.Longest, Eq(100ms));
+        ASSERT_THAT(statistics.Histogram, ElementsAre(2, 1, 1, 2, 1, 2));
+    }
+
+    TEST_F(TurnaroundProfileTest, ShouldCountNacksAndFailures)
+    {
+        profile.Record(ResponseCommand::ReceiverGetFrame, 1ms, 1, true);
+        profile.Record(ResponseCommand::ReceiverGetFrame, 5ms, TurnaroundProfile::MaxPolls, false);
+
+        const auto statistics = profile.Statistics(ResponseCommand::ReceiverGetFrame);
+        ASSERT_THAT(statistics.Exchanges, Eq(1U));
+        ASSERT_THAT(statistics.Nacks, Eq(1U + TurnaroundProfile::MaxPolls));
+        ASSERT_THAT(statistics.Failures, Eq(1U));
+        ASSERT_THAT(statistics.Longest, Eq(1ms));
+        ASSERT_THAT(profile.Statistics(ResponseCommand::ReceiverGetFrameCount).Nacks, Eq(0U));
+    }
+}
@@ -0,0 +1,287 @@
+#include <chrono>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "OsMock.hpp"
+#include "n25q/background_eraser.hpp"
+
+using testing::Eq;
+using testing::InSequence;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+using testing::StrictMock;
+using testing::_;
+using namespace devices::n25q;
+using namespace std::chrono_literals;
+
+namespace
+{
+    struct BlockEraserMock : IBlockEraser
+    {
+        MOCK_METHOD1(EraseBlockNow, bool(std::uint32_t block));
+    };
+
+    class BackgroundEraserTest : public testing::Test
+    {
+      protected:
+        BackgroundEraserTest();
+
+        /**
+         * @brief Makes erase of block take given time
+         * @param[in] block Block number
+         * @param[in] duration Erase duration
+         * @param[in] result Erase result
+         */
+        void ExpectErase(std::uint32_t block, std::chrono::milliseconds duration = 700ms, bool result = true);
+
+        NiceMock<OSMock> _os;
+        OSReset _osReset;
+
+        std::chrono::milliseconds _now;
+
+        StrictMock<BlockEraserMock> _blockEraser;
+        StaticBackgroundEraser<3> _eraser;
+    };
+
+    BackgroundEraserTest::BackgroundEraserTest() : _now(10s), _eraser(500ms)
+    {
+        this->_osReset = InstallProxy(&this->_os);
+
+        ON_CALL(this->_os, GetUptime()).WillByDefault(Invoke([this]() { return this->_now; }));
+        ON_CALL(this->_os, CreateBinarySemaphore(_)).WillByDefault(Return(reinterpret_cast<OSSemaphoreHandle>(1)));
+        ON_CALL(this->_os, CreateEventGroup()).WillByDefault(Return(reinterpret_cast<OSEventGroupHandle>(1)));
+        ON_CALL(this->_os, TakeSemaphore(_, _)).WillByDefault(Return(OSResult::Success));
+        ON_CALL(this->_os, CreateTask(_, _, _, _, _, _)).WillByDefault(Return(OSResult::Success));
+
+        _eraser.SetEraser(_blockEraser);
+        _eraser.Initialize();
+    }
+
+    void BackgroundEraserTest::ExpectErase(std::uint32_t block, std::chrono::milliseconds duration, bool result)
+    {
+        EXPECT_CALL(_blockEraser, EraseBlockNow(block)).WillOnce(Invoke([this, duration, result](std::uint32_t) {
+            this->_now += duration;
+            return result;
+        }));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldEraseQueuedBlockWhenIdle)
+    {
+        ASSERT_THAT(_eraser.Defer(5), Eq(true));
+        ASSERT_THAT(_eraser.Statistics().Pending, Eq(1));
+
+        _now += 100ms;
+        ASSERT_THAT(_eraser.EraseIfIdle(), Eq(false));
+
+        ExpectErase(5);
+
+        _now += 400ms;
+        ASSERT_THAT(_eraser.EraseIfIdle(), Eq(true));
+
+        auto statistics = _eraser.Statistics();
+        ASSERT_THAT(statistics.Pending, Eq(0));
+        ASSERT_THAT(statistics.BackgroundErases, Eq(1u));
+        ASSERT_THAT(statistics.ForcedErases, Eq(0u));
+        ASSERT_THAT(statistics.TotalStall, Eq(0ms));
+
+        _now += 1s;
+        ASSERT_THAT(_eraser.EraseIfIdle(), Eq(false));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldPostponeBackgroundEraseAfterAccess)
+    {
+        _eraser.Defer(5);
+
+        _now += 400ms;
+        {
+            BackgroundEraser::BlockAccess access(&_eraser, 7);
+            ASSERT_THAT(access(), Eq(true));
+        }
+
+        _now += 400ms;
+        ASSERT_THAT(_eraser.EraseIfIdle(), Eq(false));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldEraseBlocksInRequestOrder)
+    {
+        _eraser.Defer(3);
+        _eraser.Defer(1);
+        _eraser.Defer(2);
+
+        {
+            InSequence s;
+            ExpectErase(3);
+            ExpectErase(1);
+            ExpectErase(2);
+        }
+
+        for (auto i = 0; i < 3; i++)
+        {
+            _now += 1s;
+            ASSERT_THAT(_eraser.EraseIfIdle(), Eq(true));
+        }
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldEraseQueuedBlockBeforeAccess)
+    {
+        _eraser.Defer(1);
+        _eraser.Defer(2);
+        _eraser.Defer(3);
+
+        {
+            InSequence s;
+            ExpectErase(1, 600ms);
+            ExpectErase(2, 800ms);
+        }
+
+        {
+            BackgroundEraser::BlockAccess access(&_eraser, 2);
+            ASSERT_THAT(access(), Eq(true));
+        }
+
+        auto statistics = _eraser.Statistics();
+        ASSERT_THAT(statistics.Pending, Eq(1));
+        ASSERT_THAT(statistics.ForcedErases, Eq(2u));
+        ASSERT_THAT(statistics.LongestStall, Eq(1400ms));
+        ASSERT_THAT(statistics.TotalStall, Eq(1400ms));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldNotEraseOnAccessToOtherBlock)
+    {
+        _eraser.Defer(1);
+
+        BackgroundEraser::BlockAccess access(&_eraser, 7);
+        ASSERT_THAT(access(), Eq(true));
+
+        ASSERT_THAT(_eraser.Statistics().Pending, Eq(1));
+        ASSERT_THAT(_eraser.Statistics().LongestStall, Eq(0ms));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldReportFailedPendingEraseOnAccess)
+    {
+        _eraser.Defer(1);
+
+        ExpectErase(1, 100ms, false);
+
+        BackgroundEraser::BlockAccess access(&_eraser, 1);
+        ASSERT_THAT(access(), Eq(false));
+
+        auto statistics = _eraser.Statistics();
+        ASSERT_THAT(statistics.Pending, Eq(0));
+        ASSERT_THAT(statistics.Failures, Eq(1u));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldNotReportFailedEraseOfPrecedingBlockOnAccess)
+    {
+        _eraser.Defer(1);
+        _eraser.Defer(2);
+
+        {
+            InSequence s;
+            ExpectErase(1, 100ms, false);
+            ExpectErase(2);
+        }
+
+        BackgroundEraser::BlockAccess access(&_eraser, 2);
+        ASSERT_THAT(access(), Eq(true));
+
+        auto statistics = _eraser.Statistics();
+        ASSERT_THAT(statistics.Pending, Eq(0));
+        ASSERT_THAT(statistics.ForcedErases, Eq(1u));
+        ASSERT_THAT(statistics.Failures, Eq(1u));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldDropFailedBackgroundErase)
+    {
+        _eraser.Defer(1);
+        _eraser.Defer(2);
+
+        {
+            InSequence s;
+            ExpectErase(1, 100ms, false);
+            ExpectErase(2);
+        }
+
+        _now += 1s;
+        ASSERT_THAT(_eraser.EraseIfIdle(), Eq(false));
+        ASSERT_THAT(_eraser.Statistics().Pending, Eq(1));
+
+        _now += 1s;
+        ASSERT_THAT(_eraser.EraseIfIdle(), Eq(true));
+
+        auto statistics = _eraser.Statistics();
+        ASSERT_THAT(statistics.Pending, Eq(0));
+        ASSERT_THAT(statistics.BackgroundErases, Eq(1u));
+        ASSERT_THAT(statistics.Failures, Eq(1u));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldEraseOldestBlockWhenQueueIsFull)
+    {
+        _eraser.Defer(1);
+        _eraser.Defer(2);
+        _eraser.Defer(3);
+
+        ExpectErase(1);
+
+        ASSERT_THAT(_eraser.Defer(4), Eq(true));
+
+        auto statistics = _eraser.Statistics();
+        ASSERT_THAT(statistics.Pending, Eq(3));
+        ASSERT_THAT(statistics.ForcedErases, Eq(1u));
+        ASSERT_THAT(statistics.LongestStall, Eq(700ms));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldQueueBlockWhenQueueIsFullAndEraseFails)
+    {
+        _eraser.Defer(1);
+        _eraser.Defer(2);
+        _eraser.Defer(3);
+
+        ExpectErase(1, 100ms, false);
+
+        ASSERT_THAT(_eraser.Defer(4), Eq(true));
+
+        auto statistics = _eraser.Statistics();
+        ASSERT_THAT(statistics.Pending, Eq(3));
+        ASSERT_THAT(statistics.Failures, Eq(1u));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldDrainAllQueuedBlocks)
+    {
+        _eraser.Defer(1);
+        _eraser.Defer(2);
+
+        {
+            InSequence s;
+            ExpectErase(1);
+            ExpectErase(2);
+        }
+
+        ASSERT_THAT(_eraser.Drain(), Eq(OSResult::Success));
+        ASSERT_THAT(_eraser.Statistics().Pending, Eq(0));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldDrainBlocksQueuedAfterFailedErase)
+    {
+        _eraser.Defer(1);
+        _eraser.Defer(2);
+
+        {
+            InSequence s;
+            ExpectErase(1, 100ms, false);
+            ExpectErase(2);
+        }
+
+        ASSERT_THAT(_eraser.Drain(), Eq(OSResult::IOError));
+        ASSERT_THAT(_eraser.Statistics().Pending, Eq(0));
+    }
+
+    TEST_F(BackgroundEraserTest, ShouldAllowAccessWithoutEraser)
+    {
+        BackgroundEraser::BlockAccess access(nullptr, 1);
+        ASSERT_THAT(access(), Eq(true));
+    }
+}
@@ -0,0 +1,284 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <gsl/span>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "mock/error_counter.hpp"
+#include "mock/n25q.hpp"
+#include "n25q/chunk_cache.hpp"
+#include "n25q/yaffs.h"
+
+using testing::Eq;
+using testing::Each;
+using testing::ElementsAre;
+using testing::InSequence;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+using testing::StrictMock;
+using testing::_;
+using namespace devices::n25q;
+
+namespace
+{
+    struct ChunkWriterMock : IChunkWriter
+    {
+        MOCK_METHOD2(ProgramChunk, bool(std::uint32_t chunk, gsl::span<const std::uint8_t> data));
+    };
+
+    MATCHER_P(IsFilledWith, value, "")
+    {
+        return std::all_of(arg.begin(), arg.end(), [this](std::uint8_t b) { return b == value; });
+    }
+
+    class ChunkCacheTest : public testing::TestWithParam<ChunkCacheMode>
+    {
+      protected:
+        ChunkCacheTest();
+
+        static constexpr std::size_t ChunkSize = 16;
+
+        std::array<std::uint8_t, ChunkSize> Chunk(std::uint8_t value);
+
+        StrictMock<ChunkWriterMock> _writer;
+        StaticChunkCache<3, ChunkSize> _cache;
+    };
+
+    constexpr std::size_t ChunkCacheTest::ChunkSize;
+
+    ChunkCacheTest::ChunkCacheTest() : _cache(GetParam())
+    {
+        _cache.SetWriter(_writer);
+    }
+
+    std::array<std::uint8_t, ChunkCacheTest::ChunkSize> ChunkCacheTest::Chunk(std::uint8_t value)
+    {
+        std::array<std::uint8_t, ChunkSize> chunk;
+        chunk.fill(value);
+        return chunk;
+    }
+
+    TEST_P(ChunkCacheTest, ShouldMissOnEmptyCache)
+    {
+        std::array<std::uint8_t, ChunkSize> buffer;
+
+        ASSERT_THAT(_cache.Read(1, buffer), Eq(false));
+
+        auto statistics = _cache.Statistics();
+        ASSERT_THAT(statistics.Hits, Eq(0u));
+        ASSERT_THAT(statistics.Misses, Eq(1u));
+        ASSERT_THAT(statistics.Evictions, Eq(0u));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldHitStoredChunk)
+    {
+        _cache.Store(1, Chunk(0x11));
+        _cache.Store(2, Chunk(0x22));
+
+        std::array<std::uint8_t, ChunkSize> buffer;
+
+        ASSERT_THAT(_cache.Read(2, buffer), Eq(true));
+        ASSERT_THAT(buffer, Each(Eq(0x22)));
+
+        ASSERT_THAT(_cache.Read(1, buffer), Eq(true));
+        ASSERT_THAT(buffer, Each(Eq(0x11)));
+
+        ASSERT_THAT(_cache.Statistics().Hits, Eq(2u));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldServePartialRead)
+    {
+        _cache.Store(1, Chunk(0x11));
+
+        std::array<std::uint8_t, 4> buffer;
+        ASSERT_THAT(_cache.Read(1, buffer), Eq(true));
+        ASSERT_THAT(buffer, Each(Eq(0x11)));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldMissIfCachedChunkIsShorterThanRead)
+    {
+        auto chunk = Chunk(0x11);
+        _cache.Store(1, gsl::make_span(chunk).subspan(0, 4));
+
+        std::array<std::uint8_t, ChunkSize> buffer;
+        ASSERT_THAT(_cache.Read(1, buffer), Eq(false));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldReplaceLeastRecentlyUsedChunk)
+    {
+        std::array<std::uint8_t, ChunkSize> buffer;
+
+        _cache.Store(1, Chunk(0x11));
+        _cache.Store(2, Chunk(0x22));
+        _cache.Store(3, Chunk(0x33));
+
+        _cache.Read(1, buffer);
+
+        _cache.Store(4, Chunk(0x44));
+
+        ASSERT_THAT(_cache.Read(2, buffer), Eq(false));
+        ASSERT_THAT(_cache.Read(1, buffer), Eq(true));
+        ASSERT_THAT(_cache.Read(3, buffer), Eq(true));
+        ASSERT_THAT(_cache.Read(4, buffer), Eq(true));
+        ASSERT_THAT(buffer, Each(Eq(0x44)));
+
+        ASSERT_THAT(_cache.Statistics().Evictions, Eq(1u));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldUpdateCachedChunk)
+    {
+        _cache.Store(1, Chunk(0x11));
+        _cache.Store(1, Chunk(0x12));
+
+        std::array<std::uint8_t, ChunkSize> buffer;
+        ASSERT_THAT(_cache.Read(1, buffer), Eq(true));
+        ASSERT_THAT(buffer, Each(Eq(0x12)));
+        ASSERT_THAT(_cache.Statistics().Evictions, Eq(0u));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldInvalidateChunksInRange)
+    {
+        _cache.Store(3, Chunk(0x33));
+        _cache.Store(4, Chunk(0x44));
+        _cache.Store(6, Chunk(0x66));
+
+        _cache.Invalidate(4, 2);
+
+        std::array<std::uint8_t, ChunkSize> buffer;
+        ASSERT_THAT(_cache.Read(3, buffer), Eq(true));
+        ASSERT_THAT(_cache.Read(4, buffer), Eq(false));
+        ASSERT_THAT(_cache.Read(6, buffer), Eq(true));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldDeferWriteOnlyInWriteBackMode)
+    {
+        if (GetParam() == ChunkCacheMode::WriteBack)
+        {
+            ASSERT_THAT(_cache.Defer(1, Chunk(0x11)), Eq(true));
+
+            std::array<std::uint8_t, ChunkSize> buffer;
+            ASSERT_THAT(_cache.Read(1, buffer), Eq(true));
+            ASSERT_THAT(buffer, Each(Eq(0x11)));
+        }
+        else
+        {
+            ASSERT_THAT(_cache.Defer(1, Chunk(0x11)), Eq(false));
+        }
+    }
+
+    TEST_P(ChunkCacheTest, ShouldFlushDirtyChunksInAscendingOrder)
+    {
+        if (GetParam() == ChunkCacheMode::WriteThrough)
+        {
+            ASSERT_THAT(_cache.Flush(), Eq(OSResult::Success));
+            return;
+        }
+
+        _cache.Defer(7, Chunk(0x77));
+        _cache.Store(2, Chunk(0x22));
+        _cache.Defer(5, Chunk(0x55));
+
+        {
+            InSequence s;
+            EXPECT_CALL(_writer, ProgramChunk(5, IsFilledWith(0x55))).WillOnce(Return(true));
+            EXPECT_CALL(_writer, ProgramChunk(7, IsFilledWith(0x77))).WillOnce(Return(true));
+        }
+
+        ASSERT_THAT(_cache.Flush(), Eq(OSResult::Success));
+
+        // chunks are clean after flush
+        ASSERT_THAT(_cache.Flush(), Eq(OSResult::Success));
+
+        std::array<std::uint8_t, ChunkSize> buffer;
+        ASSERT_THAT(_cache.Read(7, buffer), Eq(true));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldWriteBackEvictedDirtyChunk)
+    {
+        if (GetParam() == ChunkCacheMode::WriteThrough)
+        {
+            return;
+        }
+
+        _cache.Defer(1, Chunk(0x11));
+        _cache.Store(2, Chunk(0x22));
+        _cache.Store(3, Chunk(0x33));
+
+        EXPECT_CALL(_writer, ProgramChunk(1, IsFilledWith(0x11))).WillOnce(Return(true));
+
+        _cache.Store(4, Chunk(0x44));
+
+        ASSERT_THAT(_cache.Flush(), Eq(OSResult::Success));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldDropDirtyChunkOnErase)
+    {
+        if (GetParam() == ChunkCacheMode::WriteThrough)
+        {
+            return;
+        }
+
+        _cache.Defer(1, Chunk(0x11));
+        _cache.Invalidate(0, 2);
+
+        ASSERT_THAT(_cache.Flush(), Eq(OSResult::Success));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldReportFailedWriteBack)
+    {
+        if (GetParam() == ChunkCacheMode::WriteThrough)
+        {
+            return;
+        }
+
+        _cache.Defer(1, Chunk(0x11));
+        _cache.Defer(2, Chunk(0x22));
+
+        EXPECT_CALL(_writer, ProgramChunk(1, _)).WillOnce(Return(false));
+        EXPECT_CALL(_writer, ProgramChunk(2, _)).WillOnce(Return(true));
+
+        ASSERT_THAT(_cache.Flush(), Eq(OSResult::IOError));
+
+        std::array<std::uint8_t, ChunkSize> buffer;
+        ASSERT_THAT(_cache.Read(1, buffer), Eq(false));
+        ASSERT_THAT(_cache.Read(2, buffer), Eq(true));
+    }
+
+    TEST_P(ChunkCacheTest, ShouldNotCacheFailedRead)
+    {
+        NiceMock<ErrorCountingMock> errors;
+        std::array<NiceMock<N25QDriverMock>, 3> chips;
+        RedundantN25QDriver driver(errors, {&chips[0], &chips[1], &chips[2]});
+        N25QYaffsDevice<BlockMapping::Sector, ChunkSize, 1024 * 1024> device("/", driver, ChunkIntegrity::Redundancy, &_cache);
+
+        auto dev = device.Device();
+
+        std::array<std::uint8_t, ChunkSize> buffer;
+        auto ecc = YAFFS_ECC_RESULT_UNKNOWN;
+
+        EXPECT_CALL(chips[0], ReadMemory(_, _)).WillOnce(Return(OSResult::IOError));
+
+        ASSERT_THAT(dev->drv.drv_read_chunk_fn(dev, 1, buffer.data(), ChunkSize, nullptr, 0, &ecc), Eq(YAFFS_FAIL));
+        ASSERT_THAT(ecc, Eq(YAFFS_ECC_RESULT_UNFIXED));
+        ASSERT_THAT(_cache.Read(1, buffer), Eq(false));
+
+        auto fill = [](std::size_t, gsl::span<std::uint8_t> b) {
+            std::fill(b.begin(), b.end(), 0x11);
+            return OSResult::Success;
+        };
+
+        EXPECT_CALL(chips[0], ReadMemory(_, _)).WillOnce(Invoke(fill));
+        EXPECT_CALL(chips[1], ReadMemory(_, _)).WillOnce(Invoke(fill));
+
+        ASSERT_THAT(dev->drv.drv_read_chunk_fn(dev, 1, buffer.data(), ChunkSize, nullptr, 0, &ecc), Eq(YAFFS_OK));
+        ASSERT_THAT(ecc, Eq(YAFFS_ECC_RESULT_NO_ERROR));
+        ASSERT_THAT(_cache.Read(1, buffer), Eq(true));
+        ASSERT_THAT(buffer, Each(Eq(0x11)));
+    }
+
+    INSTANTIATE_TEST_CASE_P(ChunkCacheTest, ChunkCacheTest, testing::Values(ChunkCacheMode::WriteThrough, ChunkCacheMode::WriteBack), );
+}
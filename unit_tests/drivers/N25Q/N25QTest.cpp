@@ -45,6 +45,7 @@ enum Command
     ReadStatusRegister = 0x05,
     ReadFlagStatusRegister = 0x70,
     ReadMemory = 0x03,
+    FastReadMemory = 0x0B,
     WriteEnable = 0x06,
     WriteDisable = 0x05,
     ProgramMemory = 0x02,
@@ -327,6 +328,33 @@ TEST_F(N25QDriverTest, ReadRequestShouldBePropertlyFormed)
     ASSERT_THAT(_error_counter, Eq(0));
 }
 
+TEST_F(N25QDriverTest, FastReadRequestShouldBePropertlyFormed)
+{
+    const uint32_t address = 0xAB0000;
+
+    N25QDriver driver{_errors, 1, _spi, ReadMode::Fast};
+
+    array<uint8_t, 260> memory;
+    memory.fill(0xCC);
+
+    {
+        InSequence s;
+        auto selected = this->_spi.ExpectSelected();
+
+        EXPECT_CALL(this->_spi, Write(ElementsAre(Command::FastReadMemory, 0xAB, 0x00, 0x00, 0x00)));
+
+        EXPECT_CALL(this->_spi, Read(SpanOfSize(260))).WillOnce(DoAll(FillBuffer<0>(memory), Return(OSResult::Success)));
+    }
+
+    array<uint8_t, 260> buffer;
+    buffer.fill(0);
+
+    driver.ReadMemory(address, buffer);
+
+    ASSERT_THAT(buffer, ContainerEq(memory));
+    ASSERT_THAT(_error_counter, Eq(0));
+}
+
 TEST_F(N25QDriverTest, ShouldRetryReadOnTimeout)
 {
     const uint32_t address = 0xAB0000;
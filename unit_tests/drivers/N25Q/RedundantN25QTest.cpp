@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <array>
 #include <limits>
+#include <vector>
 
 #include <gsl/span>
 #include <gtest/gtest.h>
@@ -13,6 +14,7 @@
 #include "OsMock.hpp"
 #include "SPI/SPIMock.h"
 #include "base/os.h"
+#include "base/writer.h"
 #include "mock/error_counter.hpp"
 #include "mock/n25q.hpp"
 #include "os/os.hpp"
@@ -30,6 +32,7 @@ using testing::StrictMock;
 using testing::_;
 using testing::Invoke;
 using testing::ElementsAre;
+using testing::Each;
 using testing::PrintToString;
 using testing::InSequence;
 using testing::WithArg;
@@ -275,3 +278,133 @@ TEST_F(RedundantN25QDriverTest, ShouldPropagateReadMemoryTimeout)
     auto r = _driver.ReadMemory(address, buffer1, buffer2, buffer3);
     ASSERT_THAT(r, Eq(OSResult::Timeout));
 }
+
+static auto FillWith(uint8_t value)
+{
+    return Invoke([value](size_t /*address*/, span<uint8_t> buffer) {
+        std::fill(buffer.begin(), buffer.end(), value);
+        return OSResult::Success;
+    });
+}
+
+static auto FillWithTagOf(uint8_t value, size_t length)
+{
+    std::vector<uint8_t> data(length, value);
+    auto tag = RedundantN25QDriver::CalculateTag(data);
+
+    return Invoke([tag](size_t /*address*/, span<uint8_t> buffer) {
+        Writer writer(buffer);
+        writer.WriteDoubleWordLE(tag);
+        return OSResult::Success;
+    });
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldReadTaggedMemoryFromSingleChip)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    size_t address = 0x0F;
+
+    InSequence s;
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address, span<uint8_t>(buffer1))).WillOnce(FillWith(0xCC));
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address + 256, _)).WillOnce(FillWithTagOf(0xCC, 256));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(_, _)).Times(0);
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(_, _)).Times(0);
+
+    auto r = _driver.ReadTaggedMemory(address, buffer1, buffer2, buffer3);
+
+    ASSERT_THAT(r, Eq(OSResult::Success));
+    ASSERT_THAT(buffer1, Each(Eq(0xCC)));
+    ASSERT_THAT(_error_counter, Eq(0));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldReadSecondChipIfTagDoesNotMatch)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    size_t address = 0x0F;
+
+    InSequence s;
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address, span<uint8_t>(buffer1))).WillOnce(FillWith(0xCD));
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address + 256, _)).WillOnce(FillWithTagOf(0xCC, 256));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(address, span<uint8_t>(buffer2))).WillOnce(FillWith(0xCC));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(address + 256, _)).WillOnce(FillWithTagOf(0xCC, 256));
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(_, _)).Times(0);
+
+    auto r = _driver.ReadTaggedMemory(address, buffer1, buffer2, buffer3);
+
+    ASSERT_THAT(r, Eq(OSResult::Success));
+    ASSERT_THAT(buffer1, Each(Eq(0xCC)));
+    ASSERT_THAT(_error_counter, Eq(5));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldVoteIfNoTagMatches)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    size_t address = 0x0F;
+
+    InSequence s;
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address, span<uint8_t>(buffer1))).WillOnce(FillWith(0xCD));
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address + 256, _)).WillOnce(FillWithTagOf(0xCC, 256));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(address, span<uint8_t>(buffer2))).WillOnce(FillWith(0xEC));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(address + 256, _)).WillOnce(FillWithTagOf(0xCC, 256));
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(address, span<uint8_t>(buffer3))).WillOnce(FillWith(0xCC));
+
+    auto r = _driver.ReadTaggedMemory(address, buffer1, buffer2, buffer3);
+
+    ASSERT_THAT(r, Eq(OSResult::Success));
+    ASSERT_THAT(buffer1, Each(Eq(0xCC)));
+    ASSERT_THAT(_error_counter, Eq(5));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldAcceptConsistentMemoryWithoutValidTag)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    size_t address = 0x0F;
+
+    InSequence s;
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address, span<uint8_t>(buffer1))).WillOnce(FillWith(0xFF));
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address + 256, _)).WillOnce(FillWith(0xFF));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(address, span<uint8_t>(buffer2))).WillOnce(FillWith(0xFF));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(address + 256, _)).WillOnce(FillWith(0xFF));
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(_, _)).Times(0);
+
+    auto r = _driver.ReadTaggedMemory(address, buffer1, buffer2, buffer3);
+
+    ASSERT_THAT(r, Eq(OSResult::Success));
+    ASSERT_THAT(buffer1, Each(Eq(0xFF)));
+    ASSERT_THAT(_error_counter, Eq(0));
+}
+
+TEST_F(RedundantN25QDriverTest, ShouldPropagateReadTaggedMemoryTimeout)
+{
+    array<uint8_t, 256> buffer1;
+    array<uint8_t, 256> buffer2;
+    array<uint8_t, 256> buffer3;
+
+    size_t address = 0x0F;
+
+    InSequence s;
+
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address, span<uint8_t>(buffer1))).WillOnce(FillWith(0xCD));
+    EXPECT_CALL(_n25qDriver[0], ReadMemory(address + 256, _)).WillOnce(FillWithTagOf(0xCC, 256));
+    EXPECT_CALL(_n25qDriver[1], ReadMemory(address, span<uint8_t>(buffer2))).WillOnce(Return(OSResult::Timeout));
+    EXPECT_CALL(_n25qDriver[2], ReadMemory(_, _)).Times(0);
+
+    auto r = _driver.ReadTaggedMemory(address, buffer1, buffer2, buffer3);
+    ASSERT_THAT(r, Eq(OSResult::Timeout));
+}
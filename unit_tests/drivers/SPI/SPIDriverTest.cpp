@@ -143,23 +143,56 @@ namespace
             EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
             EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
 
-            EXPECT_CALL(this->_dma, MemoryPeripheral(2, txSignal, _, buf, true, 1024, dmadrvDataSize1, _, _));
-
+            EXPECT_CALL(this->_dma, MemoryPeripheralChained(2, txSignal, _, buf, true, 2148, dmadrvDataSize1, _, _, _));
             EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
 
+            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_RXBLOCKDIS));
+        }
+
+        EFMSPIInterface spi;
+
+        spi.Initialize();
+
+        spi.Write(gsl::make_span(buf, 2148));
+
+        delete[] buf;
+    }
+
+    TEST_F(SPIDriverTest, ShouldSplitWriteLongerThanMaxTransferSize)
+    {
+        auto txSignal = efm::DMASignal<efm::DMASignalUSART::TXBL>(io_map::SPI::Peripheral);
+
+        constexpr auto MaxTransferSize = EFMSPIInterface::MaxTransferSize;
+
+        auto buf = new uint8_t[2 * MaxTransferSize + 100];
+        {
+            InSequence s;
+
+            EXPECT_CALL(this->_dma, AllocateChannel(_, nullptr)).WillOnce(DoAll(SetArgPointee<0>(1), Return(ECODE_EMDRV_DMADRV_OK)));
+            EXPECT_CALL(this->_dma, AllocateChannel(_, nullptr)).WillOnce(DoAll(SetArgPointee<0>(2), Return(ECODE_EMDRV_DMADRV_OK)));
+
+            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_RXBLOCKEN));
+
             EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARRX));
             EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
             EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
 
-            EXPECT_CALL(this->_dma, MemoryPeripheral(2, txSignal, _, buf + 1024, true, 1024, dmadrvDataSize1, _, _));
+            EXPECT_CALL(this->_dma, MemoryPeripheralChained(2, txSignal, _, buf, true, MaxTransferSize, dmadrvDataSize1, _, _, _));
+            EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
+
+            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARRX));
+            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
+            EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
 
+            EXPECT_CALL(this->_dma,
+                MemoryPeripheralChained(2, txSignal, _, buf + MaxTransferSize, true, MaxTransferSize, dmadrvDataSize1, _, _, _));
             EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
 
             EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARRX));
             EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
             EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
 
-            EXPECT_CALL(this->_dma, MemoryPeripheral(2, txSignal, _, buf + 2048, true, 100, dmadrvDataSize1, _, _));
+            EXPECT_CALL(this->_dma, MemoryPeripheral(2, txSignal, _, buf + 2 * MaxTransferSize, true, 100, dmadrvDataSize1, _, _));
             EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
 
             EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_RXBLOCKDIS));
@@ -169,7 +202,7 @@ namespace
 
         spi.Initialize();
 
-        spi.Write(gsl::make_span(buf, 2148));
+        spi.Write(gsl::make_span(buf, 2 * MaxTransferSize + 100));
 
         delete[] buf;
     }
@@ -191,22 +224,8 @@ namespace
             EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
             EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
 
-            EXPECT_CALL(this->_dma, PeripheralMemory(1, rxSignal, buf, _, true, 1024, dmadrvDataSize1, _, _));
-            EXPECT_CALL(this->_dma, MemoryPeripheral(2, txSignal, _, _, true, 1024, dmadrvDataSize1, _, _));
-
-            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARRX));
-            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
-            EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
-
-            EXPECT_CALL(this->_dma, PeripheralMemory(1, rxSignal, buf + 1024, _, true, 1024, dmadrvDataSize1, _, _));
-            EXPECT_CALL(this->_dma, MemoryPeripheral(2, txSignal, _, _, true, 1024, dmadrvDataSize1, _, _));
-
-            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARRX));
-            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
-            EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
-
-            EXPECT_CALL(this->_dma, PeripheralMemory(1, rxSignal, buf + 2048, _, true, 100, dmadrvDataSize1, _, _));
-            EXPECT_CALL(this->_dma, MemoryPeripheral(2, txSignal, _, _, true, 100, dmadrvDataSize1, _, _));
+            EXPECT_CALL(this->_dma, PeripheralMemoryChained(1, rxSignal, buf, _, true, 2148, dmadrvDataSize1, _, _, _));
+            EXPECT_CALL(this->_dma, MemoryPeripheralChained(2, txSignal, _, _, true, 2148, dmadrvDataSize1, _, _, _));
         }
 
         EFMSPIInterface spi;
@@ -214,6 +233,8 @@ namespace
         spi.Initialize();
 
         spi.Read(gsl::make_span(buf, 2148));
+
+        delete[] buf;
     }
 
     TEST_F(SPIDriverTest, ShouldReturnTimeoutOnDMATimeoutWhenReading)
@@ -221,7 +242,9 @@ namespace
         auto rxSignal = efm::DMASignal<efm::DMASignalUSART::RXDATAV>(io_map::SPI::Peripheral);
         auto txSignal = efm::DMASignal<efm::DMASignalUSART::TXBL>(io_map::SPI::Peripheral);
 
-        auto buf = new uint8_t[2148];
+        constexpr auto MaxTransferSize = EFMSPIInterface::MaxTransferSize;
+
+        auto buf = new uint8_t[2 * MaxTransferSize + 100];
 
         {
             InSequence s;
@@ -233,8 +256,8 @@ namespace
             EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
             EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
 
-            EXPECT_CALL(this->_dma, PeripheralMemory(1, rxSignal, buf, _, true, 1024, dmadrvDataSize1, _, _));
-            EXPECT_CALL(this->_dma, MemoryPeripheral(2, txSignal, _, _, true, 1024, dmadrvDataSize1, _, _));
+            EXPECT_CALL(this->_dma, PeripheralMemoryChained(1, rxSignal, buf, _, true, MaxTransferSize, dmadrvDataSize1, _, _, _));
+            EXPECT_CALL(this->_dma, MemoryPeripheralChained(2, txSignal, _, _, true, MaxTransferSize, dmadrvDataSize1, _, _, _));
 
             EXPECT_CALL(this->_os, EventGroupWaitForBits(_, _, _, _, _)).WillOnce(Return(0xFF));
 
@@ -242,25 +265,23 @@ namespace
             EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
             EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
 
-            EXPECT_CALL(this->_dma, PeripheralMemory(1, rxSignal, buf + 1024, _, true, 1024, dmadrvDataSize1, _, _));
-            EXPECT_CALL(this->_dma, MemoryPeripheral(2, txSignal, _, _, true, 1024, dmadrvDataSize1, _, _));
+            EXPECT_CALL(this->_dma,
+                PeripheralMemoryChained(1, rxSignal, buf + MaxTransferSize, _, true, MaxTransferSize, dmadrvDataSize1, _, _, _));
+            EXPECT_CALL(this->_dma, MemoryPeripheralChained(2, txSignal, _, _, true, MaxTransferSize, dmadrvDataSize1, _, _, _));
 
             EXPECT_CALL(this->_os, EventGroupWaitForBits(_, _, _, _, _)).WillOnce(Return(0));
 
-            //            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARRX));
-            //            EXPECT_CALL(this->_usart, Command(io_map::SPI::Peripheral, USART_CMD_CLEARTX));
-            //            EXPECT_CALL(this->_usart, IntClear(io_map::SPI::Peripheral, _));
-            //
-            //            EXPECT_CALL(this->_dma, PeripheralMemory(1, rxSignal, buf + 2048, _, true, 100, dmadrvDataSize1, _, _));
-            //            EXPECT_CALL(this->_dma, MemoryPeripheral(2, txSignal, _, _, true, 100, dmadrvDataSize1, _, _));
+            EXPECT_CALL(this->_dma, PeripheralMemory(_, _, _, _, _, _, _, _, _)).Times(0);
         }
 
         EFMSPIInterface spi;
 
         spi.Initialize();
 
-        auto r = spi.Read(gsl::make_span(buf, 2148));
+        auto r = spi.Read(gsl::make_span(buf, 2 * MaxTransferSize + 100));
 
         ASSERT_THAT(r, Eq(OSResult::Timeout));
+
+        delete[] buf;
     }
 }
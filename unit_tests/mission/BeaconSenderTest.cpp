@@ -47,7 +47,8 @@ namespace
         EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Return(true));
         _sender.RunOnce();
 
-        EXPECT_CALL(_os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Timeout));
+        _telemetry.serializedTelemetryVersion = 1;
+        EXPECT_CALL(_os, Sleep(telemetry::TelemetryState::SnapshotRetryDelay)).Times(telemetry::TelemetryState::MaxSnapshotAttempts);
         EXPECT_CALL(_os, Sleep(5000ms));
         EXPECT_CALL(_transmitter, SendFrame(_)).WillOnce(Return(true));
         _sender.RunOnce();
@@ -55,7 +56,8 @@ namespace
 
     TEST_F(BeaconSenderTest, ShouldNotSendEmptyFrameAndShouldWaitShortDelayOnFailureToGetTelemetry)
     {
-        EXPECT_CALL(_os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Timeout));
+        _telemetry.serializedTelemetryVersion = 1;
+        EXPECT_CALL(_os, Sleep(telemetry::TelemetryState::SnapshotRetryDelay)).Times(telemetry::TelemetryState::MaxSnapshotAttempts);
         EXPECT_CALL(_os, Sleep(5000ms));
         EXPECT_CALL(_transmitter, SendFrame(_)).Times(0);
         _sender.RunOnce();
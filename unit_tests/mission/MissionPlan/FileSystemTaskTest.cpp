@@ -6,6 +6,7 @@
 #include "mission/time.hpp"
 #include "mock/FsMock.hpp"
 #include "mock/RtcMock.hpp"
+#include "mock/YaffsDeviceOperationsMock.hpp"
 #include "os/os.hpp"
 #include "time/TimeSpan.hpp"
 #include "time/timer.h"
@@ -16,13 +17,6 @@ using namespace std::chrono_literals;
 
 namespace
 {
-    struct YaffsDeviceOperationsMock : services::fs::IYaffsDeviceOperations
-    {
-        MOCK_METHOD1(AddDeviceAndMount, OSResult(yaffs_dev* device));
-        MOCK_METHOD1(ClearDevice, OSResult(yaffs_dev* device));
-        MOCK_METHOD0(Sync, void());
-    };
-
     struct FileSystemTaskTest : public testing::Test
     {
         FileSystemTaskTest();
@@ -4,6 +4,7 @@
 #include "gmock/gmock.h"
 #include "OsMock.hpp"
 #include "mission/power/power_cycle.hpp"
+#include "mock/YaffsDeviceOperationsMock.hpp"
 #include "mock/experiment.hpp"
 #include "mock/power.hpp"
 
@@ -11,6 +12,7 @@ using namespace mission;
 using namespace mission::power;
 using namespace std::chrono_literals;
 using testing::Eq;
+using testing::InSequence;
 using testing::ReturnPointee;
 using testing::Return;
 using testing::Combine;
@@ -36,8 +38,10 @@ namespace
         testing::NiceMock<ScrubbingStatusMock> _scrubbingStatus;
         testing::NiceMock<ExperimentControllerMock> _experimentController;
         testing::StrictMock<PowerControlMock> _power;
+        testing::NiceMock<YaffsDeviceOperationsMock> _deviceOperations;
 
-        PeriodicPowerCycleTask _task{std::make_tuple(std::ref(_power), std::ref(_scrubbingStatus), std::ref(_experimentController))};
+        PeriodicPowerCycleTask _task{std::make_tuple(
+            std::ref(_power), std::ref(_scrubbingStatus), std::ref(_experimentController), std::ref(_deviceOperations))};
         ActionDescriptor<SystemState> _action{_task.BuildAction()};
     };
 
@@ -52,6 +56,17 @@ namespace
         _action.Execute(_state);
     }
 
+    TEST_F(PeriodicPowerCycleTest, ShouldWriteFileSystemCheckpointBeforePowerCycle)
+    {
+        {
+            InSequence s;
+            EXPECT_CALL(_deviceOperations, Checkpoint()).WillOnce(Return(OSResult::Success));
+            EXPECT_CALL(_power, PowerCycle());
+        }
+
+        _action.Execute(_state);
+    }
+
     TEST_F(PeriodicPowerCycleTest, ShouldNotTriggerPowerCycleBeforeTimeIsRight)
     {
         _state.Time = 0s;
@@ -2,16 +2,22 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock-matchers.h"
 #include "OsMock.hpp"
+#include "base/writer.h"
 #include "mission/telemetry.hpp"
 #include "mock/FsMock.hpp"
+#include "mock/YaffsDeviceOperationsMock.hpp"
 #include "telemetry/TimeTelemetry.hpp"
+#include "telemetry/archive.hpp"
 
 namespace
 {
     using testing::Eq;
     using testing::_;
+    using testing::ElementsAreArray;
+    using testing::Invoke;
     using testing::Return;
     using testing::SizeIs;
+    using testing::StrEq;
 
     using services::fs::FileOpenResult;
     using services::fs::IOResult;
@@ -31,15 +37,16 @@ namespace
         OSReset osReset;
         telemetry::TelemetryState state;
         testing::NiceMock<FsMock> fs;
+        testing::NiceMock<YaffsDeviceOperationsMock> deviceOperations;
         mission::TelemetryConfiguration config;
         mission::TelemetryTask task;
         mission::ActionDescriptor<telemetry::TelemetryState> descriptor;
     };
 
     TelemetryTest::TelemetryTest()
-        : osReset(InstallProxy(&os)),                 //
-          config{"/current", "/previous", 1024, 30s}, //
-          task(std::tie(fs, config))
+        : osReset(InstallProxy(&os)),                     //
+          config{"/current", "/previous", 1024, 30s, 0s}, //
+          task(std::tie(fs, deviceOperations, config))
     {
         this->descriptor = task.BuildAction();
     }
@@ -100,13 +107,121 @@ namespace
     {
         auto guard = InstallProxy(&os);
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
-        EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(WriteSuccessful()));
+        EXPECT_CALL(fs, WriteAt(10, 0, SizeIs(telemetry::ManagedTelemetry::TotalSerializedSize))).WillOnce(Return(WriteSuccessful()));
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(0));
-        EXPECT_CALL(fs, Close(10));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
-        EXPECT_CALL(os, GiveSemaphore(_)).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(fs, Close(10)).Times(0);
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
         this->descriptor.Execute(this->state);
+        testing::Mock::VerifyAndClearExpectations(&fs);
+    }
+
+    TEST_F(TelemetryTest, TestSaveKeepsFileOpen)
+    {
+        std::array<std::uint8_t, 100> frame;
+        frame.fill(0x55);
+
+        EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
+        EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(0));
+        EXPECT_CALL(fs, WriteAt(10, 0, SizeIs(100))).WillOnce(Return(WriteSuccessful()));
+        EXPECT_CALL(fs, WriteAt(10, 100, SizeIs(130 + 100))).WillOnce(Return(WriteSuccessful()));
+        EXPECT_CALL(fs, Close(10)).Times(0);
+
+        ASSERT_THAT(task.SaveToFile(frame), Eq(true));
+        ASSERT_THAT(task.SaveToFile(frame), Eq(true));
+        testing::Mock::VerifyAndClearExpectations(&fs);
+    }
+
+    TEST_F(TelemetryTest, TestSaveIndexesRecordWithMissionTime)
+    {
+        std::array<std::uint8_t, telemetry::ArchiveRecordSize> frame;
+        frame.fill(0x55);
+        Writer w(gsl::make_span(frame).subspan(telemetry::ArchiveRecordTimeOffset));
+        w.WriteQuadWordLE(0x0102030405060708ULL);
+
+        mission::TelemetryConfiguration indexedConfig{"/current", "/previous", 1024, 30s, 0s, "/current.idx", "/previous.idx", 4};
+        mission::TelemetryTask indexedTask(std::tie(fs, deviceOperations, indexedConfig));
+
+        ON_CALL(os, CreateBinarySemaphore(_)).WillByDefault(Return(reinterpret_cast<OSSemaphoreHandle>(1)));
+
+        services::fs::IBufferedWriter* writer = nullptr;
+        EXPECT_CALL(deviceOperations, AttachWriter(_)).WillOnce(Invoke([&writer](services::fs::IBufferedWriter& w) { writer = &w; }));
+
+        ASSERT_THAT(indexedTask.Initialize(), Eq(true));
+        ASSERT_THAT(writer, testing::NotNull());
+
+        const std::array<std::uint8_t, 12> entry{0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00};
+
+        EXPECT_CALL(fs, Open(StrEq("/current"), _, _)).WillOnce(Return(OpenSuccessful(10)));
+        EXPECT_CALL(fs, Open(StrEq("/current.idx"), _, _)).WillOnce(Return(OpenSuccessful(11)));
+        EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(0));
+        EXPECT_CALL(fs, GetFileSize(11)).WillOnce(Return(0));
+        EXPECT_CALL(fs, WriteAt(10, 0, SizeIs(telemetry::ArchiveRecordSize))).WillOnce(Return(WriteSuccessful()));
+        EXPECT_CALL(fs, WriteAt(11, 0, ElementsAreArray(entry))).WillOnce(Return(WriteSuccessful()));
+
+        ASSERT_THAT(indexedTask.SaveToFile(frame), Eq(true));
+        ASSERT_THAT(writer->Flush(), Eq(OSResult::Success));
+        testing::Mock::VerifyAndClearExpectations(&fs);
+    }
+
+    TEST_F(TelemetryTest, TestSaveBufferedUntilFlushDelay)
+    {
+        std::array<std::uint8_t, 100> frame;
+        frame.fill(0x55);
+
+        auto now = 10min;
+        ON_CALL(os, GetUptime()).WillByDefault(Invoke([&now]() { return now; }));
+
+        mission::TelemetryConfiguration bufferedConfig{"/current", "/previous", 1024, 30s, 5min};
+        mission::TelemetryTask bufferedTask(std::tie(fs, deviceOperations, bufferedConfig));
+
+        EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
+        EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(0));
+        EXPECT_CALL(fs, WriteAt(10, _, _)).Times(0);
+
+        ASSERT_THAT(bufferedTask.SaveToFile(frame), Eq(true));
+        now = 14min;
+        ASSERT_THAT(bufferedTask.SaveToFile(frame), Eq(true));
+        testing::Mock::VerifyAndClearExpectations(&fs);
+
+        EXPECT_CALL(fs, WriteAt(10, 0, SizeIs(3 * 230 - 130))).WillOnce(Return(WriteSuccessful()));
+        now = 15min;
+        ASSERT_THAT(bufferedTask.SaveToFile(frame), Eq(true));
+        testing::Mock::VerifyAndClearExpectations(&fs);
+    }
+
+    TEST_F(TelemetryTest, TestInitializeAttachesWriterToFileSystemSync)
+    {
+        std::array<std::uint8_t, 100> frame;
+        frame.fill(0x55);
+
+        auto now = 10min;
+        ON_CALL(os, GetUptime()).WillByDefault(Invoke([&now]() { return now; }));
+        ON_CALL(os, CreateBinarySemaphore(_)).WillByDefault(Return(reinterpret_cast<OSSemaphoreHandle>(1)));
+
+        mission::TelemetryConfiguration bufferedConfig{"/current", "/previous", 1024, 30s, 5min};
+        mission::TelemetryTask bufferedTask(std::tie(fs, deviceOperations, bufferedConfig));
+
+        services::fs::IBufferedWriter* writer = nullptr;
+        EXPECT_CALL(deviceOperations, AttachWriter(_)).WillOnce(Invoke([&writer](services::fs::IBufferedWriter& w) { writer = &w; }));
+
+        ASSERT_THAT(bufferedTask.Initialize(), Eq(true));
+        ASSERT_THAT(writer, testing::NotNull());
+
+        EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
+        EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(0));
+        EXPECT_CALL(fs, WriteAt(10, 0, SizeIs(100))).WillOnce(Return(WriteSuccessful()));
+
+        ASSERT_THAT(bufferedTask.SaveToFile(frame), Eq(true));
+        ASSERT_THAT(writer->Flush(), Eq(OSResult::Success));
+        testing::Mock::VerifyAndClearExpectations(&fs);
+    }
+
+    TEST_F(TelemetryTest, TestInitializeFailure)
+    {
+        EXPECT_CALL(os, CreateBinarySemaphore(_)).WillOnce(Return(nullptr));
+        EXPECT_CALL(deviceOperations, AttachWriter(_)).Times(0);
+
+        ASSERT_THAT(task.Initialize(), Eq(false));
     }
 
     TEST_F(TelemetryTest, TestConditionAfterFailedSave)
@@ -124,7 +239,8 @@ namespace
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
 
         ASSERT_THAT(this->descriptor.EvaluateCondition(this->state), Eq(true));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Deadlock));
+        state.serializedTelemetryVersion = 1;
+        EXPECT_CALL(fs, Open(_, _, _)).Times(0);
         this->descriptor.Execute(this->state);
 
         ASSERT_THAT(this->descriptor.EvaluateCondition(this->state), Eq(true));
@@ -133,8 +249,8 @@ namespace
     TEST_F(TelemetryTest, TestSaveChangeSlightlyBelowLimit)
     {
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
-        EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(WriteSuccessful()));
+        EXPECT_CALL(fs, WriteAt(10, 1023, SizeIs(1150 - 1023 + telemetry::ManagedTelemetry::TotalSerializedSize)))
+            .WillOnce(Return(WriteSuccessful()));
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(1023));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
         this->descriptor.Execute(this->state);
@@ -143,7 +259,6 @@ namespace
     TEST_F(TelemetryTest, TestSaveChangeFileOpenFailure)
     {
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(FileOpenResult(OSResult::IOError, 0)));
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
         this->descriptor.Execute(this->state);
         ASSERT_THAT(state.telemetry.IsModified(), Eq(true));
@@ -151,18 +266,16 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveWriteFailure)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10)));
-        EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(IOResult(OSResult::IOError, gsl::span<const std::uint8_t>())));
+        EXPECT_CALL(fs, WriteAt(10, _, _)).WillOnce(Return(IOResult(OSResult::IOError, gsl::span<const std::uint8_t>())));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
         this->descriptor.Execute(this->state);
     }
 
     TEST_F(TelemetryTest, TestSaveChangeOverLimitSuccess)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillRepeatedly(Return(OpenSuccessful(10)));
-        EXPECT_CALL(fs, Write(10, _)).WillOnce(Return(WriteSuccessful()));
+        EXPECT_CALL(fs, WriteAt(10, _, _)).WillOnce(Return(WriteSuccessful()));
         EXPECT_CALL(fs, GetFileSize(10)).Times(2).WillOnce(Return(1024));
         EXPECT_CALL(fs, Move(this->config.currentFileName, this->config.previousFileName)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Close(10)).Times(2);
@@ -172,9 +285,8 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveChangeOverLimitArchivizerFailure)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillRepeatedly(Return(OpenSuccessful(10)));
-        EXPECT_CALL(fs, Write(10, _)).Times(0);
+        EXPECT_CALL(fs, WriteAt(10, _, _)).Times(0);
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(1024));
         EXPECT_CALL(fs, Move(this->config.currentFileName, this->config.previousFileName)).WillOnce(Return(OSResult::IOError));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
@@ -183,9 +295,8 @@ namespace
 
     TEST_F(TelemetryTest, TestSaveChangeOverLimitFileReopenFailure)
     {
-        EXPECT_CALL(os, TakeSemaphore(_, _)).WillOnce(Return(OSResult::Success));
         EXPECT_CALL(fs, Open(_, _, _)).WillOnce(Return(OpenSuccessful(10))).WillOnce(Return(FileOpenResult(OSResult::IOError, 0)));
-        EXPECT_CALL(fs, Write(10, _)).Times(0);
+        EXPECT_CALL(fs, WriteAt(10, _, _)).Times(0);
         EXPECT_CALL(fs, GetFileSize(10)).WillOnce(Return(1024));
         EXPECT_CALL(fs, Move(this->config.currentFileName, this->config.previousFileName)).WillOnce(Return(OSResult::Success));
         state.telemetry.Set(telemetry::InternalTimeTelemetry(10min));
@@ -0,0 +1,245 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/reader.h"
+#include "fs/archive_index.hpp"
+#include "fs/archive_writer.hpp"
+#include "fs/fs.h"
+#include "fs/yaffs.h"
+#include "yaffs.hpp"
+
+#include "FileSystem/MemoryDriver.hpp"
+
+#include "storage/nand_driver.h"
+
+using testing::ElementsAre;
+using testing::Eq;
+using testing::Pair;
+using namespace services::fs;
+using namespace std::chrono_literals;
+
+extern "C" void yaffs_remove_device(struct yaffs_dev* dev);
+
+namespace
+{
+    /** @brief Entry alignment of archive */
+    constexpr FileSize Alignment = 30;
+
+    /** @brief Index entry pair: key and archive offset */
+    using Entry = std::pair<std::uint64_t, FileSize>;
+
+    class ArchiveIndexTest : public testing::Test
+    {
+      protected:
+        ArchiveIndexTest();
+        ~ArchiveIndexTest();
+
+        /**
+         * @brief Reads all entries from index file
+         * @param[in] path Index file path
+         * @return Index entries
+         */
+        std::vector<Entry> ReadIndex(const char* path);
+
+        /**
+         * @brief Appends archive entry with given key
+         * @param[in] key Entry key
+         * @return Result of append
+         */
+        bool Append(std::uint64_t key);
+
+        yaffs_dev device;
+        YaffsNANDDriver driver;
+        YaffsFileSystem api;
+
+        ArchiveIndex index;
+
+        std::array<std::uint8_t, 100> buffer;
+        ArchiveWriter writer;
+    };
+
+    ArchiveIndexTest::ArchiveIndexTest()
+        : index(api, "/index.current", "/index.previous", 2), //
+          writer(api, "/archive.current", "/archive.previous", 300, Alignment, 1min, buffer)
+    {
+        memset(&driver, 0, sizeof(driver));
+        driver.geometry.pageSize = 512;
+        driver.geometry.spareAreaPerPage = 12;
+        driver.geometry.pagesPerBlock = 32;
+        driver.geometry.pagesPerChunk = 2;
+
+        NANDCalculateGeometry(&driver.geometry);
+
+        InitializeMemoryNAND(&driver.flash);
+
+        memset(&device, 0, sizeof(device));
+
+        SetupYaffsNANDDriver(&device, &driver);
+
+        device.param.name = "/";
+        device.param.inband_tags = false;
+        device.param.is_yaffs2 = true;
+        device.param.total_bytes_per_chunk = driver.geometry.chunkSize;
+        device.param.chunks_per_block = driver.geometry.chunksPerBlock;
+        device.param.spare_bytes_per_chunk = driver.geometry.spareAreaPerPage * driver.geometry.pagesPerChunk;
+        device.param.start_block = 1;
+        device.param.n_reserved_blocks = 3;
+        device.param.no_tags_ecc = true;
+        device.param.always_check_erased = true;
+
+        device.param.end_block = 1 * 1024 * 1024 / driver.geometry.blockSize - device.param.start_block - device.param.n_reserved_blocks;
+
+        yaffs_add_device(&device);
+        yaffs_mount("/");
+    }
+
+    ArchiveIndexTest::~ArchiveIndexTest()
+    {
+        yaffs_unmount("/");
+        yaffs_remove_device(&device);
+    }
+
+    std::vector<Entry> ArchiveIndexTest::ReadIndex(const char* path)
+    {
+        File f(api, path, FileOpen::Existing, FileAccess::ReadOnly);
+        EXPECT_TRUE(f);
+
+        std::vector<std::uint8_t> contents(f.Size());
+        EXPECT_THAT(f.Read(contents).Status, Eq(OSResult::Success));
+
+        std::vector<Entry> entries;
+
+        Reader r(contents);
+        while (r.RemainingSize() >= ArchiveIndex::EntrySize)
+        {
+            const auto key = r.ReadQuadWordLE();
+            const auto offset = static_cast<FileSize>(r.ReadDoubleWordLE());
+            entries.emplace_back(key, offset);
+        }
+
+        return entries;
+    }
+
+    bool ArchiveIndexTest::Append(std::uint64_t key)
+    {
+        std::array<std::uint8_t, 20> entry;
+        entry.fill(static_cast<std::uint8_t>(key));
+
+        return writer.Append(entry, key);
+    }
+
+    TEST_F(ArchiveIndexTest, ShouldFindLastEntryWithSmallerKey)
+    {
+        ASSERT_TRUE(index.Open(0));
+
+        for (std::uint32_t i = 0; i < 100; i++)
+        {
+            index.Add(1000 + i * 10, i * 100);
+        }
+
+        ASSERT_THAT(index.Close(), Eq(OSResult::Success));
+
+        ASSERT_THAT(ArchiveIndex::Find(api, "/index.current", 0), Eq(0));
+        ASSERT_THAT(ArchiveIndex::Find(api, "/index.current", 1000), Eq(0));
+        ASSERT_THAT(ArchiveIndex::Find(api, "/index.current", 1001), Eq(0));
+        ASSERT_THAT(ArchiveIndex::Find(api, "/index.current", 1011), Eq(100));
+        ASSERT_THAT(ArchiveIndex::Find(api, "/index.current", 1500), Eq(4900));
+        ASSERT_THAT(ArchiveIndex::Find(api, "/index.current", 1501), Eq(5000));
+        ASSERT_THAT(ArchiveIndex::Find(api, "/index.current", 5000), Eq(9900));
+    }
+
+    TEST_F(ArchiveIndexTest, ShouldReturnBeginningOfArchiveWithoutIndex)
+    {
+        ASSERT_THAT(ArchiveIndex::Find(api, "/index.current", 1000), Eq(0));
+    }
+
+    TEST_F(ArchiveIndexTest, ShouldKeepEntriesInRamUntilFlush)
+    {
+        ASSERT_TRUE(index.Open(0));
+
+        index.Add(10, 0);
+        index.Add(20, 60);
+
+        ASSERT_THAT(ReadIndex("/index.current"), ElementsAre());
+
+        ASSERT_THAT(index.Flush(), Eq(OSResult::Success));
+
+        ASSERT_THAT(ReadIndex("/index.current"), ElementsAre(Pair(10u, 0), Pair(20u, 60)));
+    }
+
+    TEST_F(ArchiveIndexTest, ShouldDropEntriesPastEndOfArchiveOnOpen)
+    {
+        ASSERT_TRUE(index.Open(0));
+
+        index.Add(10, 0);
+        index.Add(20, 100);
+        index.Add(30, 200);
+        index.Add(40, 300);
+
+        ASSERT_THAT(index.Close(), Eq(OSResult::Success));
+
+        ASSERT_TRUE(index.Open(200));
+        index.Add(50, 200);
+        ASSERT_THAT(index.Close(), Eq(OSResult::Success));
+
+        ASSERT_THAT(ReadIndex("/index.current"), ElementsAre(Pair(10u, 0), Pair(20u, 100), Pair(50u, 200)));
+    }
+
+    TEST_F(ArchiveIndexTest, ShouldIndexEveryNthSlotOfArchive)
+    {
+        writer.AttachIndex(index);
+
+        for (std::uint64_t key = 1; key <= 5; key++)
+        {
+            ASSERT_TRUE(Append(key));
+        }
+
+        ASSERT_THAT(ReadIndex("/index.current"), ElementsAre());
+
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+
+        ASSERT_THAT(ReadIndex("/index.current"), ElementsAre(Pair(1u, 0), Pair(3u, 60), Pair(5u, 120)));
+    }
+
+    TEST_F(ArchiveIndexTest, ShouldRotateIndexTogetherWithArchive)
+    {
+        writer.AttachIndex(index);
+
+        // 11 entries fill current file up to maximal size, last one starts new file
+        for (std::uint64_t key = 1; key <= 12; key++)
+        {
+            ASSERT_TRUE(Append(key));
+        }
+
+        ASSERT_THAT(writer.Close(), Eq(OSResult::Success));
+
+        ASSERT_THAT(ReadIndex("/index.previous"),
+            ElementsAre(Pair(1u, 0), Pair(3u, 60), Pair(5u, 120), Pair(7u, 180), Pair(9u, 240), Pair(11u, 300)));
+        ASSERT_THAT(ReadIndex("/index.current"), ElementsAre(Pair(12u, 0)));
+    }
+
+    TEST_F(ArchiveIndexTest, ShouldContinueIndexAfterReopen)
+    {
+        writer.AttachIndex(index);
+
+        for (std::uint64_t key = 1; key <= 3; key++)
+        {
+            ASSERT_TRUE(Append(key));
+        }
+
+        ASSERT_THAT(writer.Close(), Eq(OSResult::Success));
+
+        for (std::uint64_t key = 4; key <= 5; key++)
+        {
+            ASSERT_TRUE(Append(key));
+        }
+
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+
+        ASSERT_THAT(ReadIndex("/index.current"), ElementsAre(Pair(1u, 0), Pair(3u, 60), Pair(5u, 120)));
+    }
+}
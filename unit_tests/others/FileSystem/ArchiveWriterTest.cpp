@@ -0,0 +1,298 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "gsl/span"
+
+#include "OsMock.hpp"
+#include "fs/archive_writer.hpp"
+#include "mock/FsMock.hpp"
+
+using testing::_;
+using testing::ElementsAreArray;
+using testing::Eq;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+using testing::SizeIs;
+using testing::StrEq;
+
+using namespace services::fs;
+using namespace std::chrono_literals;
+
+namespace
+{
+    /** @brief Handle of opened current file */
+    constexpr FileHandle Handle = 10;
+
+    /** @brief Size of single entry */
+    constexpr std::size_t EntrySize = 20;
+
+    /** @brief Entry alignment */
+    constexpr FileSize Alignment = 30;
+
+    class ArchiveWriterTest : public testing::Test
+    {
+      protected:
+        ArchiveWriterTest();
+
+        /**
+         * @brief Appends entry filled with given value
+         * @param[in] value Entry contents
+         * @return Result of append
+         */
+        bool Append(std::uint8_t value);
+
+        /**
+         * @brief Builds expected file contents with entries placed at aligned offsets
+         * @param[in] values Entries contents
+         * @param[in] start Offset of first entry
+         * @return Expected file contents
+         */
+        std::vector<std::uint8_t> Expected(std::initializer_list<std::uint8_t> values, FileSize start = 0);
+
+        NiceMock<OSMock> os;
+        OSReset osReset;
+        NiceMock<FsMock> fs;
+
+        std::chrono::milliseconds now;
+
+        std::vector<std::uint8_t> current;
+
+        std::array<std::uint8_t, 100> buffer;
+
+        ArchiveWriter writer;
+    };
+
+    ArchiveWriterTest::ArchiveWriterTest()
+        : osReset(InstallProxy(&os)), //
+          now(0ms),                   //
+          writer(fs, "/current", "/previous", 200, Alignment, 1min, buffer)
+    {
+        ON_CALL(os, GetUptime()).WillByDefault(Invoke([this]() { return this->now; }));
+
+        ON_CALL(fs, Open(_, _, _)).WillByDefault(Invoke([this](const char* /*path*/, FileOpen mode, FileAccess /*access*/) {
+            if (mode == FileOpen::CreateAlways)
+            {
+                this->current.clear();
+            }
+
+            return MakeOpenedFile(Handle);
+        }));
+
+        ON_CALL(fs, GetFileSize(Handle)).WillByDefault(Invoke([this](FileHandle /*file*/) {
+            return static_cast<FileSize>(this->current.size());
+        }));
+
+        ON_CALL(fs, WriteAt(Handle, _, _))
+            .WillByDefault(Invoke([this](FileHandle /*file*/, FileSize offset, gsl::span<const std::uint8_t> data) {
+                this->current.resize(std::max<std::size_t>(this->current.size(), offset + data.size()));
+                std::copy(data.begin(), data.end(), this->current.begin() + offset);
+                return MakeFSIOResult(data);
+            }));
+
+        ON_CALL(fs, Move(_, _)).WillByDefault(Return(OSResult::Success));
+    }
+
+    bool ArchiveWriterTest::Append(std::uint8_t value)
+    {
+        std::array<std::uint8_t, EntrySize> entry;
+        entry.fill(value);
+
+        return writer.Append(entry);
+    }
+
+    std::vector<std::uint8_t> ArchiveWriterTest::Expected(std::initializer_list<std::uint8_t> values, FileSize start)
+    {
+        std::vector<std::uint8_t> expected(start, 0);
+
+        for (auto value : values)
+        {
+            expected.resize((expected.size() + Alignment - 1) / Alignment * Alignment, 0);
+            expected.insert(expected.end(), EntrySize, value);
+        }
+
+        return expected;
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldKeepEntriesInRamUntilWindowIsFilled)
+    {
+        EXPECT_CALL(fs, Open(StrEq("/current"), FileOpen::OpenAlways, _)).Times(1);
+        EXPECT_CALL(fs, Close(_)).Times(0);
+        EXPECT_CALL(fs, WriteAt(Handle, 0, SizeIs(100))).Times(1);
+
+        ASSERT_TRUE(Append(1));
+        ASSERT_TRUE(Append(2));
+        ASSERT_TRUE(Append(3));
+
+        ASSERT_THAT(current, SizeIs(0));
+
+        ASSERT_TRUE(Append(4));
+
+        ASSERT_THAT(writer.Writes(), Eq(1u));
+        ASSERT_THAT(current, ElementsAreArray(Expected({1, 2, 3, 4}).data(), 100));
+
+        testing::Mock::VerifyAndClearExpectations(&fs);
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldWriteOnlyNewPartOfWindowOnFlush)
+    {
+        EXPECT_CALL(fs, WriteAt(Handle, 0, SizeIs(50))).Times(1);
+        EXPECT_CALL(fs, WriteAt(Handle, 50, SizeIs(30))).Times(1);
+
+        ASSERT_TRUE(Append(1));
+        ASSERT_TRUE(Append(2));
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+
+        ASSERT_TRUE(Append(3));
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+
+        ASSERT_THAT(current, Eq(Expected({1, 2, 3})));
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldFlushWhenOldestEntryWaitsForFlushDelay)
+    {
+        ASSERT_TRUE(Append(1));
+
+        now = 30s;
+        ASSERT_TRUE(Append(2));
+        ASSERT_THAT(writer.Writes(), Eq(0u));
+
+        now = 1min;
+        ASSERT_TRUE(Append(3));
+        ASSERT_THAT(writer.Writes(), Eq(1u));
+        ASSERT_THAT(current, Eq(Expected({1, 2, 3})));
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldContinueExistingFile)
+    {
+        current.assign(130, 0xEE);
+
+        EXPECT_CALL(fs, Open(_, _, _)).Times(1);
+        EXPECT_CALL(fs, WriteAt(Handle, 130, SizeIs(40))).Times(1);
+        EXPECT_CALL(fs, WriteAt(Handle, 170, SizeIs(30))).Times(1);
+
+        ASSERT_TRUE(Append(1));
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+
+        ASSERT_TRUE(Append(2));
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+
+        auto expected = Expected({1, 2}, 130);
+        std::fill(expected.begin(), expected.begin() + 130, 0xEE);
+
+        ASSERT_THAT(current, Eq(expected));
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldRotateFileWhenItReachesMaximalSize)
+    {
+        EXPECT_CALL(fs, Open(StrEq("/current"), FileOpen::OpenAlways, _)).Times(1);
+        EXPECT_CALL(fs, Close(Handle)).Times(1);
+        EXPECT_CALL(fs, Move(StrEq("/current"), StrEq("/previous"))).Times(1);
+        EXPECT_CALL(fs, Open(StrEq("/current"), FileOpen::CreateAlways, _)).Times(1);
+
+        for (std::uint8_t i = 1; i <= 7; i++)
+        {
+            ASSERT_TRUE(Append(i));
+        }
+
+        ASSERT_THAT(writer.Writes(), Eq(1u));
+        ASSERT_THAT(current, SizeIs(100));
+
+        EXPECT_CALL(fs, WriteAt(Handle, 100, SizeIs(100))).Times(1);
+        EXPECT_CALL(fs, WriteAt(Handle, 0, SizeIs(20))).Times(1);
+
+        ASSERT_TRUE(Append(8));
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+
+        ASSERT_THAT(writer.Writes(), Eq(3u));
+        ASSERT_THAT(current, Eq(Expected({8})));
+
+        testing::Mock::VerifyAndClearExpectations(&fs);
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldReopenFileWhenRotationFails)
+    {
+        current.assign(200, 0xEE);
+
+        EXPECT_CALL(fs, Move(_, _)).WillOnce(Return(OSResult::IOError)).WillOnce(Return(OSResult::Success));
+        EXPECT_CALL(fs, Open(_, FileOpen::OpenAlways, _)).Times(2);
+        EXPECT_CALL(fs, Open(_, FileOpen::CreateAlways, _)).Times(1);
+
+        ASSERT_FALSE(Append(1));
+        ASSERT_TRUE(Append(1));
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+
+        ASSERT_THAT(current, Eq(Expected({1})));
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldRejectEntryWhenFilledWindowCannotBeWritten)
+    {
+        ASSERT_TRUE(Append(1));
+        ASSERT_TRUE(Append(2));
+        ASSERT_TRUE(Append(3));
+
+        EXPECT_CALL(fs, WriteAt(Handle, 0, _)).WillOnce(Return(MakeFSIOResult(OSResult::IOError)));
+        ASSERT_FALSE(Append(4));
+        ASSERT_THAT(current, SizeIs(0));
+
+        testing::Mock::VerifyAndClearExpectations(&fs);
+
+        ASSERT_TRUE(Append(5));
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+
+        ASSERT_THAT(current, Eq(Expected({1, 2, 3, 5})));
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldKeepEntriesInRamWhenDelayedFlushFails)
+    {
+        ASSERT_TRUE(Append(1));
+
+        now = 1min;
+        EXPECT_CALL(fs, WriteAt(Handle, 0, _)).WillOnce(Return(MakeFSIOResult(OSResult::IOError)));
+        ASSERT_TRUE(Append(2));
+
+        testing::Mock::VerifyAndClearExpectations(&fs);
+
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+        ASSERT_THAT(current, Eq(Expected({1, 2})));
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldWriteEntriesAndReopenFileAfterClose)
+    {
+        EXPECT_CALL(fs, Open(_, FileOpen::OpenAlways, _)).Times(2);
+        EXPECT_CALL(fs, Close(Handle)).Times(1);
+
+        ASSERT_TRUE(Append(1));
+        ASSERT_THAT(writer.Close(), Eq(OSResult::Success));
+        ASSERT_THAT(current, Eq(Expected({1})));
+
+        ASSERT_TRUE(Append(2));
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+        ASSERT_THAT(current, Eq(Expected({1, 2})));
+
+        testing::Mock::VerifyAndClearExpectations(&fs);
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldRejectEntryLongerThanBuffer)
+    {
+        std::array<std::uint8_t, 80> entry;
+        entry.fill(1);
+
+        EXPECT_CALL(fs, Open(_, _, _)).Times(0);
+
+        ASSERT_FALSE(writer.Append(entry));
+    }
+
+    TEST_F(ArchiveWriterTest, ShouldNotTouchFileOnFlushWithoutEntries)
+    {
+        EXPECT_CALL(fs, Open(_, _, _)).Times(0);
+        EXPECT_CALL(fs, WriteAt(_, _, _)).Times(0);
+
+        ASSERT_THAT(writer.Flush(), Eq(OSResult::Success));
+    }
+}
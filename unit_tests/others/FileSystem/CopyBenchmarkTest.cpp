@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "fs/fs.h"
+#include "fs/yaffs.h"
+#include "yaffs.hpp"
+
+#include "FileSystem/MemoryDriver.hpp"
+
+#include "storage/nand_driver.h"
+
+using testing::Eq;
+using testing::Le;
+using namespace services::fs;
+
+extern "C" void yaffs_remove_device(struct yaffs_dev* dev);
+
+namespace
+{
+    /** @brief Size of copied file (single photo) */
+    constexpr std::size_t FileLength = 512 * 1024;
+
+    /** @brief Size of buffer used by copy made of separate reads and writes */
+    constexpr std::size_t PieceSize = 1024;
+
+    /** @brief Number of chunk writes issued by YAFFS */
+    std::uint32_t ChunkWrites = 0;
+
+    /** @brief Original chunk write procedure of NAND driver */
+    int (*WriteChunk)(yaffs_dev*, int, const u8*, int, const u8*, int) = nullptr;
+
+    int CountingWriteChunk(yaffs_dev* dev, int nand_chunk, const u8* data, int data_len, const u8* oob, int oob_len)
+    {
+        ChunkWrites++;
+
+        return WriteChunk(dev, nand_chunk, data, data_len, oob, oob_len);
+    }
+
+    /**
+     * @brief Compares number of flash writes issued while copying photo-sized file on device with 2KB chunks
+     */
+    class CopyBenchmarkTest : public testing::Test
+    {
+      protected:
+        CopyBenchmarkTest();
+        ~CopyBenchmarkTest();
+
+        /**
+         * @brief Copies file using separate 1KB reads and writes
+         * @param[in] from Source path
+         * @param[in] to Destination path
+         */
+        void CopyInPieces(const char* from, const char* to);
+
+        /**
+         * @brief Starts counting chunk writes
+         */
+        void StartCounting();
+
+        /**
+         * @brief Returns number of chunk writes since @ref StartCounting, excluding chunks moved by garbage collector
+         * @return Number of chunk writes
+         */
+        std::uint32_t CountedWrites();
+
+        /**
+         * @brief Verifies content of file
+         * @param[in] path File path
+         */
+        void Verify(const char* path);
+
+        yaffs_dev device;
+        YaffsNANDDriver driver;
+        YaffsFileSystem api;
+
+        std::vector<std::uint8_t> contents;
+
+        std::uint32_t gcCopies;
+    };
+
+    CopyBenchmarkTest::CopyBenchmarkTest() : contents(FileLength), gcCopies(0)
+    {
+        memset(&driver, 0, sizeof(driver));
+        driver.geometry.pageSize = 512;
+        driver.geometry.spareAreaPerPage = 12;
+        driver.geometry.pagesPerBlock = 32;
+        driver.geometry.pagesPerChunk = 4;
+
+        NANDCalculateGeometry(&driver.geometry);
+
+        InitializeMemoryNAND(&driver.flash);
+
+        memset(&device, 0, sizeof(device));
+
+        SetupYaffsNANDDriver(&device, &driver);
+
+        device.param.name = "/";
+        device.param.inband_tags = false;
+        device.param.is_yaffs2 = true;
+        device.param.total_bytes_per_chunk = driver.geometry.chunkSize;
+        device.param.chunks_per_block = driver.geometry.chunksPerBlock;
+        device.param.spare_bytes_per_chunk = driver.geometry.spareAreaPerPage * driver.geometry.pagesPerChunk;
+        device.param.start_block = 1;
+        device.param.n_reserved_blocks = 3;
+        device.param.no_tags_ecc = true;
+        device.param.always_check_erased = true;
+
+        device.param.end_block = 2 * 1024 * 1024 / driver.geometry.blockSize - device.param.start_block - device.param.n_reserved_blocks;
+
+        WriteChunk = device.drv.drv_write_chunk_fn;
+        device.drv.drv_write_chunk_fn = CountingWriteChunk;
+
+        yaffs_add_device(&device);
+        yaffs_mount("/");
+
+        std::uint8_t seed = 1;
+        for (auto& b : contents)
+        {
+            seed = seed * 97 + 13;
+            b = seed;
+        }
+
+        File f(api, "/photo", FileOpen::CreateAlways, FileAccess::WriteOnly);
+        f.Write(contents);
+    }
+
+    CopyBenchmarkTest::~CopyBenchmarkTest()
+    {
+        yaffs_unmount("/");
+        yaffs_remove_device(&device);
+    }
+
+    void CopyBenchmarkTest::CopyInPieces(const char* from, const char* to)
+    {
+        File source(api, from, FileOpen::Existing, FileAccess::ReadOnly);
+        File destination(api, to, FileOpen::CreateAlways, FileAccess::WriteOnly);
+
+        std::array<std::uint8_t, PieceSize> buffer;
+
+        while (true)
+        {
+            auto read = source.Read(buffer);
+            ASSERT_THAT(read.Status, Eq(OSResult::Success));
+
+            auto written = destination.Write(read.Result);
+            ASSERT_THAT(written.Status, Eq(OSResult::Success));
+
+            if (read.Result.size() < static_cast<std::ptrdiff_t>(buffer.size()))
+            {
+                break;
+            }
+        }
+    }
+
+    void CopyBenchmarkTest::StartCounting()
+    {
+        ChunkWrites = 0;
+        gcCopies = device.n_gc_copies;
+    }
+
+    std::uint32_t CopyBenchmarkTest::CountedWrites()
+    {
+        return ChunkWrites - (device.n_gc_copies - gcCopies);
+    }
+
+    void CopyBenchmarkTest::Verify(const char* path)
+    {
+        File f(api, path, FileOpen::Existing, FileAccess::ReadOnly);
+        ASSERT_THAT(f.Size(), Eq(static_cast<FileSize>(FileLength)));
+
+        std::vector<std::uint8_t> actual(FileLength);
+        auto read = f.Read(actual);
+
+        ASSERT_THAT(read.Status, Eq(OSResult::Success));
+        ASSERT_THAT(actual, Eq(contents));
+    }
+
+    TEST_F(CopyBenchmarkTest, ShouldWriteEveryDestinationChunkOnce)
+    {
+        const auto dataChunks = (FileLength + device.data_bytes_per_chunk - 1) / device.data_bytes_per_chunk;
+
+        StartCounting();
+        CopyInPieces("/photo", "/photo.pieces");
+        const auto inPieces = CountedWrites();
+
+        Verify("/photo.pieces");
+        ASSERT_THAT(api.Unlink("/photo.pieces"), Eq(OSResult::Success));
+
+        StartCounting();
+        ASSERT_THAT(api.Copy("/photo", "/photo.copy"), Eq(OSResult::Success));
+        const auto streamed = CountedWrites();
+
+        Verify("/photo.copy");
+
+        StartCounting();
+        ASSERT_THAT(api.Move("/photo.copy", "/photo.archive"), Eq(OSResult::Success));
+        const auto moved = CountedWrites();
+
+        Verify("/photo.archive");
+        ASSERT_FALSE(api.Exists("/photo.copy"));
+
+        std::printf("[ BENCH    ] %u KB file, %u data chunks: "
+                    "1KB pieces %u chunk writes, chunk copy %u chunk writes, move %u chunk writes\n",
+            static_cast<unsigned>(FileLength / 1024),
+            static_cast<unsigned>(dataChunks),
+            static_cast<unsigned>(inPieces),
+            static_cast<unsigned>(streamed),
+            static_cast<unsigned>(moved));
+
+        // every 1KB piece written separately programs partially filled chunk
+        ASSERT_THAT(dataChunks * 2, Le(inPieces));
+
+        // data chunks, block summaries (last chunk of every block) and object headers written on create and close
+        const auto chunksPerBlock = static_cast<std::size_t>(device.param.chunks_per_block);
+        ASSERT_THAT(streamed, Le(dataChunks + dataChunks / (chunksPerBlock - 1) + 4));
+
+        // rename rewrites only object header
+        ASSERT_THAT(moved, Le(2u));
+    }
+}
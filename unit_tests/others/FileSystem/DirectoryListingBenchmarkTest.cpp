@@ -0,0 +1,176 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "fs/fs.h"
+#include "fs/yaffs.h"
+#include "yaffs.hpp"
+
+#include "FileSystem/MemoryDriver.hpp"
+
+#include "storage/nand_driver.h"
+
+using testing::Eq;
+using testing::Lt;
+using namespace services::fs;
+
+extern "C" void yaffs_remove_device(struct yaffs_dev* dev);
+
+namespace
+{
+    /** @brief Number of files in listed directory */
+    constexpr std::size_t FilesCount = 500;
+
+    /** @brief Listed directory */
+    constexpr const char* Directory = "/dir";
+
+    using Listing = std::vector<std::pair<std::string, FileSize>>;
+
+    /**
+     * @brief Compares listing directory with per-entry size lookup against listing with inline stat
+     */
+    class DirectoryListingBenchmarkTest : public testing::Test
+    {
+      protected:
+        DirectoryListingBenchmarkTest();
+        ~DirectoryListingBenchmarkTest();
+
+        /**
+         * @brief Lists directory using name returned by ReadDirectory to look up size of each entry
+         * @param[out] listing Names and sizes of entries
+         * @return Listing duration
+         */
+        std::chrono::microseconds ListByName(Listing& listing);
+
+        /**
+         * @brief Lists directory using ReadDirectoryWithStat
+         * @param[out] listing Names and sizes of entries
+         * @return Listing duration
+         */
+        std::chrono::microseconds ListWithStat(Listing& listing);
+
+        yaffs_dev device;
+        YaffsNANDDriver driver;
+        YaffsFileSystem api;
+    };
+
+    DirectoryListingBenchmarkTest::DirectoryListingBenchmarkTest()
+    {
+        memset(&driver, 0, sizeof(driver));
+        driver.geometry.pageSize = 512;
+        driver.geometry.spareAreaPerPage = 12;
+        driver.geometry.pagesPerBlock = 32;
+        driver.geometry.pagesPerChunk = 2;
+
+        NANDCalculateGeometry(&driver.geometry);
+
+        InitializeMemoryNAND(&driver.flash);
+
+        memset(&device, 0, sizeof(device));
+
+        SetupYaffsNANDDriver(&device, &driver);
+
+        device.param.name = "/";
+        device.param.inband_tags = false;
+        device.param.is_yaffs2 = true;
+        device.param.total_bytes_per_chunk = driver.geometry.chunkSize;
+        device.param.chunks_per_block = driver.geometry.chunksPerBlock;
+        device.param.spare_bytes_per_chunk = driver.geometry.spareAreaPerPage * driver.geometry.pagesPerChunk;
+        device.param.start_block = 1;
+        device.param.n_reserved_blocks = 3;
+        device.param.no_tags_ecc = true;
+        device.param.always_check_erased = true;
+
+        device.param.end_block = 1 * 1024 * 1024 / driver.geometry.blockSize - device.param.start_block - device.param.n_reserved_blocks;
+
+        yaffs_add_device(&device);
+        yaffs_mount("/");
+
+        api.MakeDirectory(Directory);
+
+        std::uint8_t data[64] = {0};
+
+        for (std::size_t i = 0; i < FilesCount; i++)
+        {
+            char path[32];
+            std::snprintf(path, sizeof(path), "%s/file_%03u", Directory, static_cast<unsigned>(i));
+
+            auto file = yaffs_open(path, O_CREAT | O_WRONLY, S_IRWXU);
+
+            // every file with data occupies additional chunk, only some of them are filled to fit in 1MB device
+            if (i % 4 == 0)
+            {
+                yaffs_write(file, data, i % sizeof(data) + 1);
+            }
+
+            yaffs_close(file);
+        }
+    }
+
+    DirectoryListingBenchmarkTest::~DirectoryListingBenchmarkTest()
+    {
+        yaffs_unmount("/");
+        yaffs_remove_device(&device);
+    }
+
+    std::chrono::microseconds DirectoryListingBenchmarkTest::ListByName(Listing& listing)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        auto dir = api.OpenDirectory(Directory);
+        EXPECT_THAT(dir.Status, Eq(OSResult::Success));
+
+        char* name;
+        while ((name = api.ReadDirectory(dir.Result)) != nullptr)
+        {
+            listing.emplace_back(name, api.GetFileSize(Directory, name));
+        }
+
+        api.CloseDirectory(dir.Result);
+
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    std::chrono::microseconds DirectoryListingBenchmarkTest::ListWithStat(Listing& listing)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        auto dir = api.OpenDirectory(Directory);
+        EXPECT_THAT(dir.Status, Eq(OSResult::Success));
+
+        DirectoryEntry entry;
+        while (api.ReadDirectoryWithStat(dir.Result, entry))
+        {
+            listing.emplace_back(entry.Name, entry.Size);
+        }
+
+        api.CloseDirectory(dir.Result);
+
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    TEST_F(DirectoryListingBenchmarkTest, ShouldListDirectoryFasterWithInlineStat)
+    {
+        Listing byName;
+        Listing withStat;
+
+        auto byNameTime = ListByName(byName);
+        auto withStatTime = ListWithStat(withStat);
+
+        std::printf("[ BENCH    ] %u files: ReadDirectory + GetFileSize %ld us, ReadDirectoryWithStat %ld us\n",
+            static_cast<unsigned>(FilesCount),
+            static_cast<long>(byNameTime.count()),
+            static_cast<long>(withStatTime.count()));
+
+        ASSERT_THAT(withStat.size(), Eq(FilesCount));
+        ASSERT_THAT(withStat, Eq(byName));
+
+        // name lookup scans directory, so listing by name is quadratic in number of entries
+        ASSERT_THAT(withStatTime, Lt(byNameTime));
+    }
+}
@@ -437,4 +437,84 @@ namespace
 
         yaffs_unmount("/");
     }
+
+    TEST_F(FileSystemTest, ShouldReadDirectoryWithStat)
+    {
+        yaffs_mount("/");
+
+        yaffs_mkdir("/a", 0777);
+        yaffs_mkdir("/a/dir", 0777);
+
+        auto file = yaffs_open("/a/file", O_CREAT | O_WRONLY, S_IRWXU);
+        yaffs_write(file, "abcdef", 6);
+        yaffs_close(file);
+
+        auto dir = api.OpenDirectory("/a");
+        ASSERT_THAT(dir.Status, Eq(OSResult::Success));
+
+        bool fileFound = false;
+        bool dirFound = false;
+
+        DirectoryEntry entry;
+        while (api.ReadDirectoryWithStat(dir.Result, entry))
+        {
+            if (strcmp(entry.Name, "file") == 0)
+            {
+                fileFound = true;
+                ASSERT_THAT(entry.Type, Eq(DirectoryEntryType::File));
+                ASSERT_THAT(entry.Size, Eq(6));
+            }
+            else if (strcmp(entry.Name, "dir") == 0)
+            {
+                dirFound = true;
+                ASSERT_THAT(entry.Type, Eq(DirectoryEntryType::Directory));
+            }
+            else
+            {
+                FAIL() << "Unexpected entry " << entry.Name;
+            }
+        }
+
+        ASSERT_THAT(fileFound, Eq(true));
+        ASSERT_THAT(dirFound, Eq(true));
+
+        api.CloseDirectory(dir.Result);
+
+        yaffs_unmount("/");
+    }
+
+    TEST_F(FileSystemTest, ShouldReadAndWriteAtGivenPositionWithoutMovingFilePosition)
+    {
+        yaffs_mount("/");
+
+        auto file = api.Open("/file", FileOpen::CreateAlways, FileAccess::ReadWrite);
+        ASSERT_THAT(file.Status, Eq(OSResult::Success));
+
+        const uint8_t data[] = {'a', 'b', 'c', 'd', 'e', 'f'};
+        api.Write(file.Result, data);
+
+        const uint8_t patch[] = {'X', 'Y'};
+        auto written = api.WriteAt(file.Result, 2, patch);
+        ASSERT_THAT(written.Status, Eq(OSResult::Success));
+        ASSERT_THAT(written.Result.size(), Eq(2));
+
+        uint8_t positional[3];
+        auto read = api.ReadAt(file.Result, 1, positional);
+        ASSERT_THAT(read.Status, Eq(OSResult::Success));
+        ASSERT_THAT(read.Result.size(), Eq(3));
+        ASSERT_THAT(memcmp(positional, "bXY", 3), Eq(0));
+
+        // position is still at the end of sequential write
+        const uint8_t tail[] = {'g'};
+        api.Write(file.Result, tail);
+
+        uint8_t contents[8];
+        auto readAll = api.ReadAt(file.Result, 0, contents);
+        ASSERT_THAT(readAll.Result.size(), Eq(7));
+        ASSERT_THAT(memcmp(contents, "abXYefg", 7), Eq(0));
+
+        api.Close(file.Result);
+
+        yaffs_unmount("/");
+    }
 }
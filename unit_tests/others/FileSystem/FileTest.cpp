@@ -92,6 +92,59 @@ namespace
         ASSERT_THAT(r.Status, Eq(OSResult::Success));
     }
 
+    TEST_F(FileTest, ShouldReadFromGivenPosition)
+    {
+        std::array<uint8_t, 2> data{1, 2};
+
+        EXPECT_CALL(this->_fs, Open("/file", _, _)).WillOnce(Return(MakeOpenedFile(1)));
+
+        EXPECT_CALL(this->_fs, ReadAt(1, 100, SpanOfSize(2))).WillOnce(Invoke([&data](FileHandle, FileSize, span<uint8_t> buffer) {
+            std::copy(data.begin(), data.end(), buffer.begin());
+            return MakeFSIOResult(buffer);
+        }));
+
+        EXPECT_CALL(this->_fs, Close(1));
+
+        File f(this->_fs, "/file", FileOpen::Existing, FileAccess::ReadOnly);
+
+        std::array<uint8_t, 2> buffer;
+
+        auto r = f.ReadAt(100, buffer);
+
+        ASSERT_THAT(r.Result, ElementsAre(1, 2));
+        ASSERT_THAT(r.Status, Eq(OSResult::Success));
+    }
+
+    TEST_F(FileTest, ShouldWriteAtGivenPosition)
+    {
+        std::array<const uint8_t, 2> data{1, 2};
+
+        EXPECT_CALL(this->_fs, Open("/file", _, _)).WillOnce(Return(MakeOpenedFile(1)));
+
+        EXPECT_CALL(this->_fs, WriteAt(1, 100, SpanOfSize(2))).WillOnce(Invoke([](FileHandle, FileSize, span<const uint8_t> buffer) {
+            EXPECT_THAT(buffer, ElementsAre(1, 2));
+            return MakeFSIOResult(buffer);
+        }));
+
+        EXPECT_CALL(this->_fs, Close(1));
+
+        File f(this->_fs, "/file", FileOpen::CreateNew, FileAccess::WriteOnly);
+
+        auto r = f.WriteAt(100, data);
+
+        ASSERT_THAT(r.Result.size(), Eq(2));
+        ASSERT_THAT(r.Status, Eq(OSResult::Success));
+    }
+
+    TEST_F(FileTest, ShouldNotReadAtFromClosedFile)
+    {
+        File f;
+
+        std::array<uint8_t, 2> buffer;
+
+        ASSERT_THAT(f.ReadAt(0, buffer).Status, Eq(OSResult::InvalidOperation));
+    }
+
     TEST_F(FileTest, ShouldTruncateFile)
     {
         EXPECT_CALL(this->_fs, Open("/file", _, _)).WillOnce(Return(MakeOpenedFile(1)));
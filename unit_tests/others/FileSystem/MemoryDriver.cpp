@@ -6,7 +6,7 @@
 #include "base/ecc.h"
 #include "system.h"
 
-#define MEMORY_SIZE (1 * 1024 * 1024)
+#define MEMORY_SIZE (2 * 1024 * 1024)
 
 struct DriverContext
 {
@@ -134,7 +134,7 @@ static FlashStatus EraseBlock(FlashNANDInterface* interface, uint32_t offset)
     uint32_t spareAddress = blockNo * 32 * 16;
 
     memset((void*)(context->memory + offset), 0xFF, 32 * 512);
-    memset((void*)spareAddress, 0xFF, 32 * 16);
+    memset((void*)(context->spare + spareAddress), 0xFF, 32 * 16);
 
     return FlashStatusOK;
 }
@@ -0,0 +1,707 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "fs/fs.h"
+#include "fs/yaffs.h"
+#include "mock/error_counter.hpp"
+#include "n25q/background_eraser.hpp"
+#include "n25q/chunk_cache.hpp"
+#include "n25q/n25q.h"
+#include "n25q/yaffs.h"
+#include "yaffs.hpp"
+
+using testing::Eq;
+using testing::Gt;
+using testing::Le;
+using testing::NiceMock;
+using testing::Return;
+using testing::_;
+using namespace services::fs;
+using namespace devices::n25q;
+using namespace std::chrono_literals;
+
+extern "C" void yaffs_remove_device(struct yaffs_dev* dev);
+
+namespace
+{
+    /** @brief Size of simulated flash chip */
+    constexpr std::size_t ChipSize = 2_MB;
+
+    /** @brief Size of test file */
+    constexpr std::size_t FileLength = 128 * 1024;
+
+    /** @brief Size of single file read */
+    constexpr std::size_t PartSize = 1024;
+
+    /** @brief Number of bytes clocked before data in single read transaction (command + 3 byte address) */
+    constexpr std::size_t ReadOverhead = 4;
+
+    /** @brief SPI clock used by flash memories on flight model */
+    constexpr std::uint32_t SPIClock = 20000000;
+
+    /**
+     * @brief N25Q chip simulated in memory
+     *
+     * Programming behaves like NOR flash (clears bits only). Each read transaction is counted. Reads can be set to fail.
+     */
+    class SimulatedN25Q final : public IN25QDriver
+    {
+      public:
+        SimulatedN25Q(std::size_t size = ChipSize) : Memory(size, 0xFF), Transactions(0), BytesRead(0), ReadFails(false)
+        {
+        }
+
+        virtual OSResult ReadMemory(std::size_t address, gsl::span<uint8_t> buffer) override
+        {
+            Transactions++;
+            BytesRead += buffer.size();
+
+            if (ReadFails)
+            {
+                return OSResult::IOError;
+            }
+
+            std::copy(Memory.begin() + address, Memory.begin() + address + buffer.size(), buffer.begin());
+            return OSResult::Success;
+        }
+
+        virtual OperationWaiter BeginWritePage(size_t address, ptrdiff_t offset, gsl::span<const uint8_t> page) override
+        {
+            for (std::ptrdiff_t i = 0; i < page.size(); i++)
+            {
+                Memory[address + offset + i] &= page[i];
+            }
+
+            return OperationWaiter(this, 1ms, FlagStatus::ProgramError);
+        }
+
+        virtual OperationWaiter BeginEraseSubSector(size_t address) override
+        {
+            std::fill_n(Memory.begin() + address, 4_KB, 0xFF);
+            return OperationWaiter(this, 1ms, FlagStatus::EraseError);
+        }
+
+        virtual OperationWaiter BeginEraseSector(size_t address) override
+        {
+            std::fill_n(Memory.begin() + address, 64_KB, 0xFF);
+            return OperationWaiter(this, 1ms, FlagStatus::EraseError);
+        }
+
+        virtual OperationWaiter BeginEraseChip() override
+        {
+            std::fill(Memory.begin(), Memory.end(), 0xFF);
+            return OperationWaiter(this, 1ms, FlagStatus::EraseError);
+        }
+
+        virtual OperationResult Reset() override
+        {
+            return OperationResult::Success;
+        }
+
+        virtual OperationResult WaitForOperation(std::chrono::milliseconds /*timeout*/, FlagStatus /*status*/) override
+        {
+            return OperationResult::Success;
+        }
+
+        /**
+         * @brief Returns number of bytes clocked on SPI bus by read transactions
+         * @return Bus bytes
+         */
+        std::size_t BusBytes() const
+        {
+            return BytesRead + Transactions * ReadOverhead;
+        }
+
+        std::vector<std::uint8_t> Memory;
+        std::size_t Transactions;
+        std::size_t BytesRead;
+        bool ReadFails;
+    };
+
+    /**
+     * @brief File system on three simulated N25Q chips
+     *
+     * Parameter selects chunk integrity method.
+     */
+    class N25QIntegrityTest : public testing::TestWithParam<ChunkIntegrity>
+    {
+      protected:
+        N25QIntegrityTest();
+        ~N25QIntegrityTest();
+
+        /**
+         * @brief Reads whole test file part by part
+         * @return true if file content is correct
+         */
+        bool ReadFile();
+
+        /** @brief Resets read statistics of all chips */
+        void ResetStatistics();
+
+        /**
+         * @brief Flips bits in all chunks of test file on selected chip
+         * @param[in] chip Chip index
+         * @param[in] offset Offset in chunk of the flipped byte
+         * @param[in] mask Flipped bits
+         */
+        void Corrupt(std::uint8_t chip, std::size_t offset, std::uint8_t mask);
+
+        NiceMock<ErrorCountingMock> errors;
+        std::array<SimulatedN25Q, 3> chips;
+        RedundantN25QDriver driver;
+        N25QYaffsDevice<BlockMapping::Sector, 2_KB, ChipSize> device;
+        YaffsFileSystem api;
+
+        std::vector<std::uint8_t> contents;
+    };
+
+    N25QIntegrityTest::N25QIntegrityTest()
+        : driver(errors, {&chips[0], &chips[1], &chips[2]}), //
+          device("/", driver, GetParam()),                   //
+          contents(FileLength)
+    {
+        device.Mount(api);
+
+        std::uint8_t seed = 1;
+        for (auto& b : contents)
+        {
+            seed = seed * 97 + 13;
+            b = seed;
+        }
+
+        File f(api, "/file", FileOpen::CreateAlways, FileAccess::WriteOnly);
+        f.Write(contents);
+    }
+
+    N25QIntegrityTest::~N25QIntegrityTest()
+    {
+        yaffs_unmount("/");
+        yaffs_remove_device(device.Device());
+    }
+
+    bool N25QIntegrityTest::ReadFile()
+    {
+        // drop chunks cached by yaffs so that every part is read from flash
+        yaffs_unmount("/");
+        yaffs_mount("/");
+
+        ResetStatistics();
+
+        File f(api, "/file", FileOpen::Existing, FileAccess::ReadOnly);
+
+        std::vector<std::uint8_t> read(FileLength);
+        for (std::size_t offset = 0; offset < FileLength; offset += PartSize)
+        {
+            auto r = f.Read(gsl::make_span(read).subspan(offset, PartSize));
+            if (r.Status != OSResult::Success)
+            {
+                return false;
+            }
+        }
+
+        return read == contents;
+    }
+
+    void N25QIntegrityTest::ResetStatistics()
+    {
+        for (auto& chip : chips)
+        {
+            chip.Transactions = 0;
+            chip.BytesRead = 0;
+        }
+    }
+
+    void N25QIntegrityTest::Corrupt(std::uint8_t chip, std::size_t offset, std::uint8_t mask)
+    {
+        // first block is not used by yaffs, file is written in following blocks
+        for (std::size_t chunk = 64_KB / 2_KB; chunk < ChipSize / 2_KB; chunk++)
+        {
+            chips[chip].Memory[chunk * 2_KB + offset] ^= mask;
+        }
+    }
+
+    TEST_P(N25QIntegrityTest, ShouldStoreExpectedDataBytesPerChunk)
+    {
+        ASSERT_THAT(device.Device()->data_bytes_per_chunk, Eq(DataBytesPerChunk(2_KB, GetParam())));
+    }
+
+    TEST_P(N25QIntegrityTest, ShouldReadFileFromSingleChip)
+    {
+        ASSERT_TRUE(ReadFile());
+
+        auto bus = chips[0].BusBytes() + chips[1].BusBytes() + chips[2].BusBytes();
+
+        std::printf("[ BENCH    ] %s: chip reads %u/%u/%u, %u bus bytes, %.1f KB/s at 20 MHz SPI\n",
+            GetParam() == ChunkIntegrity::Crc32 ? "crc32" : "redundancy",
+            static_cast<unsigned>(chips[0].Transactions),
+            static_cast<unsigned>(chips[1].Transactions),
+            static_cast<unsigned>(chips[2].Transactions),
+            static_cast<unsigned>(bus),
+            FileLength / 1024.0 / (bus * 8.0 / SPIClock));
+
+        ASSERT_THAT(chips[2].Transactions, Eq(0U));
+
+        if (GetParam() == ChunkIntegrity::Crc32)
+        {
+            ASSERT_THAT(chips[1].Transactions, Eq(0U));
+        }
+        else
+        {
+            ASSERT_THAT(chips[1].Transactions, Eq(chips[0].Transactions));
+        }
+    }
+
+    TEST_P(N25QIntegrityTest, ShouldCorrectErrorOnFirstChip)
+    {
+        Corrupt(0, 100, 0x10);
+
+        ASSERT_TRUE(ReadFile());
+
+        if (GetParam() == ChunkIntegrity::Crc32)
+        {
+            ASSERT_THAT(chips[1].Transactions, Eq(chips[0].Transactions));
+            ASSERT_THAT(chips[2].Transactions, Eq(0U));
+        }
+        else
+        {
+            ASSERT_THAT(chips[2].Transactions, Eq(chips[0].Transactions));
+        }
+    }
+
+    TEST_P(N25QIntegrityTest, ShouldCorrectErrorOnSecondChip)
+    {
+        Corrupt(1, 200, 0x01);
+
+        ASSERT_TRUE(ReadFile());
+
+        if (GetParam() == ChunkIntegrity::Crc32)
+        {
+            ASSERT_THAT(chips[1].Transactions, Eq(0U));
+        }
+    }
+
+    TEST_P(N25QIntegrityTest, ShouldCorrectErrorsOnTwoChipsByVoting)
+    {
+        Corrupt(0, 100, 0x10);
+        Corrupt(1, 1500, 0x80);
+
+        ASSERT_TRUE(ReadFile());
+        ASSERT_THAT(chips[2].Transactions, Gt(0U));
+    }
+
+    TEST_P(N25QIntegrityTest, ShouldCorrectErrorAtEndOfChunk)
+    {
+        Corrupt(0, 2_KB - 1, 0x04);
+
+        ASSERT_TRUE(ReadFile());
+    }
+
+    TEST_P(N25QIntegrityTest, ShouldReportDriverFailureToYaffs)
+    {
+        auto dev = device.Device();
+
+        std::vector<std::uint8_t> buffer(dev->param.total_bytes_per_chunk);
+        auto ecc = YAFFS_ECC_RESULT_UNKNOWN;
+
+        // first chunk of file
+        const auto chunk = 64_KB / 2_KB;
+
+        chips[0].ReadFails = true;
+
+        ASSERT_THAT(dev->drv.drv_read_chunk_fn(dev, chunk, buffer.data(), buffer.size(), nullptr, 0, &ecc), Eq(YAFFS_FAIL));
+        ASSERT_THAT(ecc, Eq(YAFFS_ECC_RESULT_UNFIXED));
+
+        chips[0].ReadFails = false;
+
+        ASSERT_THAT(dev->drv.drv_read_chunk_fn(dev, chunk, buffer.data(), buffer.size(), nullptr, 0, &ecc), Eq(YAFFS_OK));
+        ASSERT_THAT(ecc, Eq(YAFFS_ECC_RESULT_NO_ERROR));
+        ASSERT_TRUE(ReadFile());
+    }
+
+    INSTANTIATE_TEST_CASE_P(N25QIntegrityTest, N25QIntegrityTest, testing::Values(ChunkIntegrity::Redundancy, ChunkIntegrity::Crc32), );
+
+    /**
+     * @brief File system on three simulated N25Q chips with chunk cache
+     *
+     * Parameter selects cache write policy.
+     */
+    class N25QChunkCacheTest : public testing::TestWithParam<ChunkCacheMode>
+    {
+      protected:
+        /**
+         * @brief Writes test file and reads it back in download frame sized parts
+         * @param[in] cache Chunk cache (nullptr disables cache)
+         * @param[out] valid true if both mounted file system and chips after unmount contain written file
+         * @return Number of bytes clocked on SPI bus while reading
+         */
+        std::size_t Run(ChunkCache* cache, bool& valid);
+
+        NiceMock<ErrorCountingMock> errors;
+        YaffsFileSystem api;
+    };
+
+    std::size_t N25QChunkCacheTest::Run(ChunkCache* cache, bool& valid)
+    {
+        constexpr std::size_t FramePartSize = 230;
+
+        std::array<SimulatedN25Q, 3> chips;
+        RedundantN25QDriver driver(errors, {&chips[0], &chips[1], &chips[2]});
+
+        std::vector<std::uint8_t> contents(FileLength / 4);
+        std::uint8_t seed = 7;
+        for (auto& b : contents)
+        {
+            seed = seed * 97 + 13;
+            b = seed;
+        }
+
+        std::vector<std::uint8_t> read(contents.size());
+        std::size_t bus = 0;
+
+        {
+            N25QYaffsDevice<BlockMapping::Sector, 2_KB, ChipSize> device("/", driver, ChunkIntegrity::Crc32, cache);
+            device.Mount(api);
+
+            {
+                File f(api, "/file", FileOpen::CreateAlways, FileAccess::WriteOnly);
+                f.Write(contents);
+            }
+
+            for (auto& chip : chips)
+            {
+                chip.Transactions = 0;
+                chip.BytesRead = 0;
+            }
+
+            {
+                File f(api, "/file", FileOpen::Existing, FileAccess::ReadOnly);
+                for (std::size_t offset = 0; offset < read.size(); offset += FramePartSize)
+                {
+                    f.Read(gsl::make_span(read).subspan(offset, std::min(FramePartSize, read.size() - offset)));
+                }
+            }
+
+            bus = chips[0].BusBytes() + chips[1].BusBytes() + chips[2].BusBytes();
+
+            yaffs_unmount("/");
+            yaffs_remove_device(device.Device());
+        }
+
+        valid = read == contents;
+
+        // content must be present in memory after unmount, also when it was held by write-back cache
+        N25QYaffsDevice<BlockMapping::Sector, 2_KB, ChipSize> device("/", driver, ChunkIntegrity::Crc32);
+        device.Mount(api);
+
+        {
+            File f(api, "/file", FileOpen::Existing, FileAccess::ReadOnly);
+            std::fill(read.begin(), read.end(), 0);
+            f.Read(read);
+        }
+
+        valid = valid && read == contents;
+
+        yaffs_unmount("/");
+        yaffs_remove_device(device.Device());
+
+        return bus;
+    }
+
+    TEST_P(N25QChunkCacheTest, ShouldReduceMemoryReads)
+    {
+        StaticChunkCache<4, 2_KB> cache(GetParam());
+
+        bool valid = false;
+
+        auto direct = Run(nullptr, valid);
+        ASSERT_TRUE(valid);
+
+        auto cached = Run(&cache, valid);
+        ASSERT_TRUE(valid);
+
+        auto statistics = cache.Statistics();
+
+        std::printf("[ BENCH    ] %s: direct %u bus bytes, cached %u bus bytes (hits %u, misses %u, evictions %u)\n",
+            GetParam() == ChunkCacheMode::WriteBack ? "write-back" : "write-through",
+            static_cast<unsigned>(direct),
+            static_cast<unsigned>(cached),
+            static_cast<unsigned>(statistics.Hits),
+            static_cast<unsigned>(statistics.Misses),
+            static_cast<unsigned>(statistics.Evictions));
+
+        ASSERT_THAT(cached * 4, Le(direct));
+    }
+
+    INSTANTIATE_TEST_CASE_P(N25QChunkCacheTest, N25QChunkCacheTest, testing::Values(ChunkCacheMode::WriteThrough, ChunkCacheMode::WriteBack), );
+
+    /** @brief Size of flight model volume (Yaffs writes checkpoint only on devices with at least 60 blocks) */
+    constexpr std::size_t VolumeSize = 16_MB;
+
+    /** @brief Number of files written before remount */
+    constexpr std::size_t MountFilesCount = 200;
+
+    /** @brief Size of single file written before remount */
+    constexpr std::size_t MountFileLength = 10 * 1024;
+
+    /**
+     * @brief Mount of file system on three simulated N25Q chips filled with files
+     */
+    class N25QMountTest : public testing::Test
+    {
+      protected:
+        using Device = N25QYaffsDevice<BlockMapping::Sector, 2_KB, VolumeSize>;
+
+        N25QMountTest();
+        ~N25QMountTest();
+
+        /**
+         * @brief Creates device and eraser (state held in RAM) and mounts file system
+         * @param[in] scan true to ignore checkpoint and scan whole memory
+         */
+        void Mount(bool scan);
+
+        /** @brief Unmounts file system and destroys device and eraser */
+        void Unmount();
+
+        /**
+         * @brief Writes all files
+         * @param[in] seed Seed of file content
+         */
+        void WriteFiles(std::uint8_t seed);
+
+        /**
+         * @brief Verifies content of all files
+         * @param[in] seed Seed of expected file content
+         * @return true if content of all files is correct
+         */
+        bool VerifyFiles(std::uint8_t seed);
+
+        /**
+         * @brief Rewrites all files until garbage collector releases blocks of deleted files
+         * @param[in] seed Seed of file content used by first rewrite
+         * @return Seed of file content used by last rewrite
+         *
+         * Chunks of deleted files are released lazily, so blocks are queued for erase only when free space runs low.
+         */
+        std::uint8_t RewriteUntilEraseIsQueued(std::uint8_t seed);
+
+        /**
+         * @brief Cuts power (without unmount) and mounts file system again
+         * @param[in] scan true to ignore checkpoint and scan whole memory
+         * @return Number of bytes clocked on SPI bus during mount
+         */
+        std::size_t PowerCycle(bool scan);
+
+        NiceMock<OSMock> os;
+        OSReset osReset;
+
+        NiceMock<ErrorCountingMock> errors;
+        std::array<SimulatedN25Q, 3> chips{{SimulatedN25Q(VolumeSize), SimulatedN25Q(VolumeSize), SimulatedN25Q(VolumeSize)}};
+        RedundantN25QDriver driver;
+        std::unique_ptr<StaticBackgroundEraser<64>> eraser;
+        std::unique_ptr<Device> device;
+        YaffsFileSystem api;
+    };
+
+    N25QMountTest::N25QMountTest()
+        : osReset(InstallProxy(&os)), //
+          driver(errors, {&chips[0], &chips[1], &chips[2]})
+    {
+        ON_CALL(os, CreateBinarySemaphore(_)).WillByDefault(Return(reinterpret_cast<OSSemaphoreHandle>(1)));
+        ON_CALL(os, CreateEventGroup()).WillByDefault(Return(reinterpret_cast<OSEventGroupHandle>(1)));
+        ON_CALL(os, TakeSemaphore(_, _)).WillByDefault(Return(OSResult::Success));
+        ON_CALL(os, CreateTask(_, _, _, _, _, _)).WillByDefault(Return(OSResult::Success));
+
+        Mount(false);
+    }
+
+    N25QMountTest::~N25QMountTest()
+    {
+        Unmount();
+    }
+
+    void N25QMountTest::Mount(bool scan)
+    {
+        eraser = std::make_unique<StaticBackgroundEraser<64>>();
+        device = std::make_unique<Device>("/", driver, ChunkIntegrity::Crc32, nullptr, eraser.get());
+
+        // background task is not running, so queued blocks are erased only on access, on drain or when queue is full
+        eraser->Initialize();
+
+        device->Device()->param.skip_checkpt_rd = scan ? 1 : 0;
+        device->Mount(api);
+    }
+
+    void N25QMountTest::Unmount()
+    {
+        yaffs_unmount("/");
+        yaffs_remove_device(device->Device());
+
+        device.reset();
+        eraser.reset();
+    }
+
+    void N25QMountTest::WriteFiles(std::uint8_t seed)
+    {
+        std::vector<std::uint8_t> contents(MountFileLength);
+
+        for (std::size_t i = 0; i < MountFilesCount; i++)
+        {
+            for (auto& b : contents)
+            {
+                seed = seed * 97 + 13;
+                b = seed;
+            }
+
+            char path[32];
+            std::snprintf(path, sizeof(path), "/file_%02u", static_cast<unsigned>(i));
+
+            // truncated file leaves shrink header that keeps its blocks from being erased, so file is recreated
+            api.Unlink(path);
+
+            File f(api, path, FileOpen::CreateAlways, FileAccess::WriteOnly);
+            f.Write(contents);
+        }
+    }
+
+    bool N25QMountTest::VerifyFiles(std::uint8_t seed)
+    {
+        std::vector<std::uint8_t> expected(MountFileLength);
+        std::vector<std::uint8_t> actual(MountFileLength);
+
+        for (std::size_t i = 0; i < MountFilesCount; i++)
+        {
+            for (auto& b : expected)
+            {
+                seed = seed * 97 + 13;
+                b = seed;
+            }
+
+            char path[32];
+            std::snprintf(path, sizeof(path), "/file_%02u", static_cast<unsigned>(i));
+
+            File f(api, path, FileOpen::Existing, FileAccess::ReadOnly);
+            std::fill(actual.begin(), actual.end(), 0);
+
+            auto r = f.Read(actual);
+            if (r.Status != OSResult::Success || actual != expected)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::uint8_t N25QMountTest::RewriteUntilEraseIsQueued(std::uint8_t seed)
+    {
+        WriteFiles(seed);
+
+        for (auto i = 0; i < 10 && eraser->Statistics().Pending == 0; i++)
+        {
+            seed++;
+            WriteFiles(seed);
+        }
+
+        return seed;
+    }
+
+    std::size_t N25QMountTest::PowerCycle(bool scan)
+    {
+        // unmount writes checkpoint, so memory is restored afterwards to state left by power loss
+        std::array<std::vector<std::uint8_t>, 3> memory{chips[0].Memory, chips[1].Memory, chips[2].Memory};
+
+        Unmount();
+
+        for (std::size_t i = 0; i < chips.size(); i++)
+        {
+            chips[i].Memory = memory[i];
+            chips[i].Transactions = 0;
+            chips[i].BytesRead = 0;
+        }
+
+        Mount(scan);
+
+        return chips[0].BusBytes() + chips[1].BusBytes() + chips[2].BusBytes();
+    }
+
+    TEST_F(N25QMountTest, ShouldMountFromCheckpointWrittenBeforePowerCycle)
+    {
+        WriteFiles(1);
+
+        auto scan = PowerCycle(true);
+        ASSERT_THAT(api.GetMountStatistics().FromCheckpoint, Eq(false));
+        ASSERT_TRUE(VerifyFiles(1));
+
+        ASSERT_THAT(api.Checkpoint(), Eq(OSResult::Success));
+
+        auto checkpoint = PowerCycle(false);
+        ASSERT_THAT(api.GetMountStatistics().FromCheckpoint, Eq(true));
+        ASSERT_TRUE(VerifyFiles(1));
+
+        std::printf("[ BENCH    ] %u files: scan mount %u bus bytes (%.1f ms), checkpoint mount %u bus bytes (%.1f ms) at 20 MHz SPI\n",
+            static_cast<unsigned>(MountFilesCount),
+            static_cast<unsigned>(scan),
+            scan * 8.0 * 1000 / SPIClock,
+            static_cast<unsigned>(checkpoint),
+            checkpoint * 8.0 * 1000 / SPIClock);
+
+        ASSERT_THAT(checkpoint * 4, Le(scan));
+    }
+
+    TEST_F(N25QMountTest, ShouldScanMemoryWhenCheckpointIsStale)
+    {
+        WriteFiles(1);
+        ASSERT_THAT(api.Checkpoint(), Eq(OSResult::Success));
+
+        // invalidates checkpoint, its blocks must be erased before power loss
+        {
+            std::array<std::uint8_t, 16> data;
+            data.fill(0x5A);
+
+            File f(api, "/new", FileOpen::CreateAlways, FileAccess::WriteOnly);
+            f.Write(data);
+        }
+
+        PowerCycle(false);
+        ASSERT_THAT(api.GetMountStatistics().FromCheckpoint, Eq(false));
+        ASSERT_TRUE(api.Exists("/new"));
+        ASSERT_TRUE(VerifyFiles(1));
+    }
+
+    TEST_F(N25QMountTest, ShouldNotWriteCheckpointOnSyncWhileEraseIsPending)
+    {
+        auto seed = RewriteUntilEraseIsQueued(1);
+        ASSERT_THAT(eraser->Statistics().Pending, Gt(0));
+
+        // checkpoint would describe queued blocks as erased, while they still hold data after power loss
+        api.Sync();
+
+        PowerCycle(false);
+        ASSERT_THAT(api.GetMountStatistics().FromCheckpoint, Eq(false));
+        ASSERT_TRUE(VerifyFiles(seed));
+    }
+
+    TEST_F(N25QMountTest, ShouldDrainEraserBeforeCheckpoint)
+    {
+        auto seed = RewriteUntilEraseIsQueued(1);
+        ASSERT_THAT(eraser->Statistics().Pending, Gt(0));
+
+        ASSERT_THAT(api.Checkpoint(), Eq(OSResult::Success));
+        ASSERT_THAT(eraser->Statistics().Pending, Eq(0));
+
+        PowerCycle(false);
+        ASSERT_THAT(api.GetMountStatistics().FromCheckpoint, Eq(true));
+        ASSERT_TRUE(VerifyFiles(seed));
+
+        // blocks described by checkpoint as free must be erased
+        seed = RewriteUntilEraseIsQueued(seed + 1);
+        ASSERT_TRUE(VerifyFiles(seed));
+    }
+}
@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "fs/fs.h"
+#include "fs/read_ahead.hpp"
+#include "fs/yaffs.h"
+#include "yaffs.hpp"
+
+#include "FileSystem/MemoryDriver.hpp"
+
+#include "storage/nand_driver.h"
+
+using testing::Eq;
+using testing::Le;
+using namespace services::fs;
+
+extern "C" void yaffs_remove_device(struct yaffs_dev* dev);
+
+namespace
+{
+    /** @brief Size of file part carried by single download frame */
+    constexpr std::size_t PartSize = 230;
+
+    /** @brief Size of read-ahead window used by file download telecommands */
+    constexpr std::size_t WindowSize = ChunkDataSize;
+
+    /** @brief Size of downloaded file */
+    constexpr std::size_t FileLength = 256 * 1024;
+
+    /** @brief Number of chunk reads issued by YAFFS */
+    std::uint32_t ChunkReads = 0;
+
+    /** @brief Original chunk read procedure of NAND driver */
+    int (*ReadChunk)(yaffs_dev*, int, u8*, int, u8*, int, yaffs_ecc_result*) = nullptr;
+
+    int CountingReadChunk(yaffs_dev* dev, int nand_chunk, u8* data, int data_len, u8* oob, int oob_len, yaffs_ecc_result* ecc_result)
+    {
+        if (data != nullptr)
+        {
+            ChunkReads++;
+        }
+
+        return ReadChunk(dev, nand_chunk, data, data_len, oob, oob_len, ecc_result);
+    }
+
+    /**
+     * @brief Compares number of flash reads issued while downloading file part by part
+     *
+     * Parameter is stride (in parts) between requested parts - 1 means sequential download,
+     * larger values simulate selective retransmission of every n-th part.
+     */
+    class ReadAheadBenchmarkTest : public testing::TestWithParam<std::size_t>
+    {
+      protected:
+        ReadAheadBenchmarkTest();
+        ~ReadAheadBenchmarkTest();
+
+        /**
+         * @brief Downloads file using read-ahead source with given window
+         * @param[in] window Read-ahead window (empty disables read-ahead)
+         * @return Number of chunk reads
+         */
+        std::uint32_t Download(gsl::span<std::uint8_t> window);
+
+        yaffs_dev device;
+        YaffsNANDDriver driver;
+        YaffsFileSystem api;
+
+        std::vector<std::uint8_t> contents;
+    };
+
+    ReadAheadBenchmarkTest::ReadAheadBenchmarkTest() : contents(FileLength)
+    {
+        memset(&driver, 0, sizeof(driver));
+        driver.geometry.pageSize = 512;
+        driver.geometry.spareAreaPerPage = 12;
+        driver.geometry.pagesPerBlock = 32;
+        driver.geometry.pagesPerChunk = 2;
+
+        NANDCalculateGeometry(&driver.geometry);
+
+        InitializeMemoryNAND(&driver.flash);
+
+        memset(&device, 0, sizeof(device));
+
+        SetupYaffsNANDDriver(&device, &driver);
+
+        device.param.name = "/";
+        device.param.inband_tags = false;
+        device.param.is_yaffs2 = true;
+        device.param.total_bytes_per_chunk = driver.geometry.chunkSize;
+        device.param.chunks_per_block = driver.geometry.chunksPerBlock;
+        device.param.spare_bytes_per_chunk = driver.geometry.spareAreaPerPage * driver.geometry.pagesPerChunk;
+        device.param.start_block = 1;
+        device.param.n_reserved_blocks = 3;
+        device.param.no_tags_ecc = true;
+        device.param.always_check_erased = true;
+
+        device.param.end_block = 1 * 1024 * 1024 / driver.geometry.blockSize - device.param.start_block - device.param.n_reserved_blocks;
+
+        ReadChunk = device.drv.drv_read_chunk_fn;
+        device.drv.drv_read_chunk_fn = CountingReadChunk;
+
+        yaffs_add_device(&device);
+        yaffs_mount("/");
+
+        std::uint8_t seed = 1;
+        for (auto& b : contents)
+        {
+            seed = seed * 97 + 13;
+            b = seed;
+        }
+
+        File f(api, "/file", FileOpen::CreateAlways, FileAccess::WriteOnly);
+        f.Write(contents);
+    }
+
+    ReadAheadBenchmarkTest::~ReadAheadBenchmarkTest()
+    {
+        yaffs_unmount("/");
+        yaffs_remove_device(&device);
+    }
+
+    std::uint32_t ReadAheadBenchmarkTest::Download(gsl::span<std::uint8_t> window)
+    {
+        File f(api, "/file", FileOpen::Existing, FileAccess::ReadOnly);
+        ReadAheadFile source(f, window);
+
+        std::array<std::uint8_t, PartSize> part;
+
+        ChunkReads = 0;
+
+        for (std::size_t offset = 0; offset < FileLength; offset += PartSize * GetParam())
+        {
+            auto length = std::min(PartSize, FileLength - offset);
+            auto target = gsl::make_span(part).subspan(0, length);
+
+            auto r = source.Read(offset, target);
+
+            EXPECT_THAT(r.Status, Eq(OSResult::Success));
+            EXPECT_THAT(r.Result.size(), Eq(static_cast<std::ptrdiff_t>(length)));
+            EXPECT_TRUE(std::equal(target.begin(), target.end(), contents.begin() + offset));
+        }
+
+        return ChunkReads;
+    }
+
+    TEST_P(ReadAheadBenchmarkTest, ShouldReduceNumberOfFlashReads)
+    {
+        std::vector<std::uint8_t> window(WindowSize);
+
+        auto direct = Download(gsl::span<std::uint8_t>());
+        auto readAhead = Download(window);
+
+        auto parts = (FileLength + PartSize * GetParam() - 1) / (PartSize * GetParam());
+
+        std::printf("[ BENCH    ] stride=%u: direct %u chunk reads (%.2f/part), read-ahead %u chunk reads (%.2f/part)\n",
+            static_cast<unsigned>(GetParam()),
+            static_cast<unsigned>(direct),
+            static_cast<double>(direct) / parts,
+            static_cast<unsigned>(readAhead),
+            static_cast<double>(readAhead) / parts);
+
+        if (GetParam() == 1)
+        {
+            ASSERT_THAT(readAhead * 2, Le(direct));
+        }
+        else
+        {
+            // only the window filled by the first request is wasted
+            ASSERT_THAT(readAhead, Le(direct + WindowSize / driver.geometry.chunkSize + 1));
+        }
+    }
+
+    INSTANTIATE_TEST_CASE_P(ReadAheadBenchmarkTest, ReadAheadBenchmarkTest, testing::Values(1, 2, 4), );
+}
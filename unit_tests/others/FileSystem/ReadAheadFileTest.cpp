@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "gsl/span"
+
+#include "fs/read_ahead.hpp"
+#include "mock/FsMock.hpp"
+
+using gsl::span;
+using testing::_;
+using testing::ElementsAreArray;
+using testing::Eq;
+using testing::NiceMock;
+using testing::Return;
+
+using namespace services::fs;
+
+namespace
+{
+    class ReadAheadFileTest : public testing::Test
+    {
+      protected:
+        ReadAheadFileTest();
+
+        /**
+         * @brief Reads range from read-ahead source and verifies it against file contents
+         * @param[in] offset Position in file
+         * @param[in] length Number of bytes to read
+         */
+        void ReadAndVerify(FileSize offset, std::size_t length);
+
+        NiceMock<FsMock> fs;
+
+        std::array<std::uint8_t, 990> contents;
+
+        std::array<std::uint8_t, 100> window;
+
+        File file;
+
+        ReadAheadFile source;
+    };
+
+    ReadAheadFileTest::ReadAheadFileTest() : source(file, window)
+    {
+        for (std::size_t i = 0; i < contents.size(); i++)
+        {
+            contents[i] = static_cast<std::uint8_t>(i * 7);
+        }
+
+        fs.AddFile("/file", contents);
+        file = File(fs, "/file", FileOpen::Existing, FileAccess::ReadOnly);
+    }
+
+    void ReadAheadFileTest::ReadAndVerify(FileSize offset, std::size_t length)
+    {
+        std::array<std::uint8_t, 256> buffer;
+        auto target = span<std::uint8_t>(buffer).subspan(0, length);
+
+        const auto result = source.Read(offset, target);
+        ASSERT_THAT(result.Status, Eq(OSResult::Success));
+
+        const auto expected = std::min<std::size_t>(length, contents.size() - offset);
+        ASSERT_THAT(result.Result, ElementsAreArray(contents.begin() + offset, contents.begin() + offset + expected));
+    }
+
+    TEST_F(ReadAheadFileTest, ShouldServeConsecutiveReadsFromWindow)
+    {
+        EXPECT_CALL(fs, ReadAt(_, _, _)).Times(4);
+        EXPECT_CALL(fs, Seek(_, _, _)).Times(0);
+
+        for (FileSize offset = 0; offset < 370; offset += 30)
+        {
+            ReadAndVerify(offset, 30);
+        }
+
+        ASSERT_THAT(source.Refills(), Eq(4u));
+        ASSERT_THAT(source.DirectReads(), Eq(0u));
+    }
+
+    TEST_F(ReadAheadFileTest, ShouldAlignWindowToItsSize)
+    {
+        EXPECT_CALL(fs, ReadAt(_, 0, _)).Times(1);
+        EXPECT_CALL(fs, ReadAt(_, 100, _)).Times(1);
+
+        ReadAndVerify(0, 40);
+        ReadAndVerify(40, 30);
+        ReadAndVerify(70, 60);
+    }
+
+    TEST_F(ReadAheadFileTest, ShouldKeepServingSkippedForwardReadsFromWindow)
+    {
+        ReadAndVerify(0, 10);
+        ReadAndVerify(40, 10);
+        ReadAndVerify(90, 10);
+
+        ASSERT_THAT(source.Refills(), Eq(1u));
+        ASSERT_THAT(source.DirectReads(), Eq(0u));
+    }
+
+    TEST_F(ReadAheadFileTest, ShouldNotRefillWindowForSkippedForwardReads)
+    {
+        ReadAndVerify(0, 10);
+        ReadAndVerify(150, 10);
+        ReadAndVerify(260, 10);
+
+        ASSERT_THAT(source.Refills(), Eq(1u));
+        ASSERT_THAT(source.DirectReads(), Eq(2u));
+    }
+
+    TEST_F(ReadAheadFileTest, ShouldReadDirectlyOnRandomAccess)
+    {
+        ReadAndVerify(0, 10);
+        ReadAndVerify(600, 30);
+        ReadAndVerify(300, 30);
+
+        ASSERT_THAT(source.Refills(), Eq(1u));
+        ASSERT_THAT(source.DirectReads(), Eq(2u));
+    }
+
+    TEST_F(ReadAheadFileTest, ShouldReturnWindowHitAfterRandomAccess)
+    {
+        ReadAndVerify(0, 10);
+        ReadAndVerify(600, 30);
+        ReadAndVerify(20, 30);
+
+        ASSERT_THAT(source.Refills(), Eq(1u));
+        ASSERT_THAT(source.DirectReads(), Eq(1u));
+    }
+
+    TEST_F(ReadAheadFileTest, ShouldStopAtEndOfFile)
+    {
+        for (FileSize offset = 0; offset < 990; offset += 230)
+        {
+            ReadAndVerify(offset, 230);
+        }
+
+        ASSERT_THAT(source.DirectReads(), Eq(0u));
+    }
+
+    TEST_F(ReadAheadFileTest, ShouldReadDirectlyWithoutWindow)
+    {
+        ReadAheadFile direct(file, span<std::uint8_t>());
+
+        std::array<std::uint8_t, 30> buffer;
+        EXPECT_CALL(fs, ReadAt(_, _, _)).Times(2);
+
+        ASSERT_THAT(direct.Read(0, buffer).Status, Eq(OSResult::Success));
+        ASSERT_THAT(direct.Read(30, buffer).Status, Eq(OSResult::Success));
+        ASSERT_THAT(buffer, ElementsAreArray(contents.begin() + 30, contents.begin() + 60));
+        ASSERT_THAT(direct.DirectReads(), Eq(2u));
+    }
+
+    TEST_F(ReadAheadFileTest, ShouldReportReadFailure)
+    {
+        EXPECT_CALL(fs, ReadAt(_, _, _)).WillOnce(Return(MakeFSIOResult(OSResult::IOError)));
+
+        std::array<std::uint8_t, 30> buffer;
+        ASSERT_THAT(source.Read(0, buffer).Status, Eq(OSResult::IOError));
+    }
+}
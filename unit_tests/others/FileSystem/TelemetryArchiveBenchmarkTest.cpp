@@ -0,0 +1,292 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "fs/archive_writer.hpp"
+#include "fs/fs.h"
+#include "fs/yaffs.h"
+#include "yaffs.hpp"
+
+#include "FileSystem/MemoryDriver.hpp"
+
+#include "storage/nand_driver.h"
+
+using testing::Eq;
+using testing::Le;
+using testing::Lt;
+using namespace services::fs;
+using namespace std::chrono_literals;
+
+extern "C" void yaffs_remove_device(struct yaffs_dev* dev);
+
+namespace
+{
+    /** @brief Number of saved telemetry records */
+    constexpr std::size_t Records = 1000;
+
+    /** @brief Size of single telemetry record */
+    constexpr std::size_t RecordSize = 200;
+
+    /** @brief Alignment of records in file */
+    constexpr FileSize Alignment = 230;
+
+    /** @brief Size of current file that triggers rotation */
+    constexpr FileSize MaxFileSize = 128 * 1024;
+
+    /** @brief Size of archive writer buffer (data part of single chunk, tags are kept in spare area) */
+    constexpr std::size_t WindowSize = 2048;
+
+    /** @brief Number of chunk writes issued by YAFFS */
+    std::uint32_t ChunkWrites = 0;
+
+    /** @brief Original chunk write procedure of NAND driver */
+    int (*WriteChunk)(yaffs_dev*, int, const u8*, int, const u8*, int) = nullptr;
+
+    int CountingWriteChunk(yaffs_dev* dev, int nand_chunk, const u8* data, int data_len, const u8* oob, int oob_len)
+    {
+        ChunkWrites++;
+
+        return WriteChunk(dev, nand_chunk, data, data_len, oob, oob_len);
+    }
+
+    /**
+     * @brief Result of single benchmark run
+     */
+    struct RunResult
+    {
+        /** @brief Number of chunk writes, excluding chunks moved by garbage collector */
+        std::uint32_t ChunkWrites;
+        /** @brief Time spent in saving records */
+        std::chrono::microseconds Duration;
+    };
+
+    /**
+     * @brief Compares telemetry archive written record by record (open, write, close) with buffered archive writer
+     */
+    class TelemetryArchiveBenchmarkTest : public testing::Test
+    {
+      protected:
+        TelemetryArchiveBenchmarkTest();
+        ~TelemetryArchiveBenchmarkTest();
+
+        /**
+         * @brief Saves record the way telemetry task did before archive writer: open, check size, write and close
+         * @param[in] current Path to current file
+         * @param[in] previous Path to previous file
+         * @param[in] record Record contents
+         */
+        void LegacyAppend(const char* current, const char* previous, gsl::span<const std::uint8_t> record);
+
+        /**
+         * @brief Saves all records using legacy procedure
+         * @return Run result
+         */
+        RunResult RunLegacy();
+
+        /**
+         * @brief Saves all records using archive writer attached to file system sync
+         * @return Run result
+         */
+        RunResult RunArchive();
+
+        /**
+         * @brief Reads whole file
+         * @param[in] path File path
+         * @return File contents
+         */
+        std::vector<std::uint8_t> ReadAll(const char* path);
+
+        /**
+         * @brief Builds record contents
+         * @param[in] index Record number
+         * @return Record
+         */
+        std::array<std::uint8_t, RecordSize> Record(std::size_t index);
+
+        yaffs_dev device;
+        YaffsNANDDriver driver;
+        YaffsFileSystem api;
+
+        std::array<std::uint8_t, WindowSize> window;
+        ArchiveWriter writer;
+
+        std::uint32_t gcCopies;
+    };
+
+    TelemetryArchiveBenchmarkTest::TelemetryArchiveBenchmarkTest()
+        : writer(api, "/archive.current", "/archive.previous", MaxFileSize, Alignment, 5min, window), //
+          gcCopies(0)
+    {
+        memset(&driver, 0, sizeof(driver));
+        driver.geometry.pageSize = 512;
+        driver.geometry.spareAreaPerPage = 12;
+        driver.geometry.pagesPerBlock = 32;
+        driver.geometry.pagesPerChunk = 4;
+
+        NANDCalculateGeometry(&driver.geometry);
+
+        InitializeMemoryNAND(&driver.flash);
+
+        memset(&device, 0, sizeof(device));
+
+        SetupYaffsNANDDriver(&device, &driver);
+
+        device.param.name = "/";
+        device.param.inband_tags = false;
+        device.param.is_yaffs2 = true;
+        device.param.total_bytes_per_chunk = driver.geometry.chunkSize;
+        device.param.chunks_per_block = driver.geometry.chunksPerBlock;
+        device.param.spare_bytes_per_chunk = driver.geometry.spareAreaPerPage * driver.geometry.pagesPerChunk;
+        device.param.start_block = 1;
+        device.param.n_reserved_blocks = 3;
+        device.param.no_tags_ecc = true;
+        device.param.always_check_erased = true;
+        // sync is used only to flush buffered records, checkpoint would add the same writes to both runs
+        device.param.skip_checkpt_wr = true;
+
+        device.param.end_block = 2 * 1024 * 1024 / driver.geometry.blockSize - device.param.start_block - device.param.n_reserved_blocks;
+
+        WriteChunk = device.drv.drv_write_chunk_fn;
+        device.drv.drv_write_chunk_fn = CountingWriteChunk;
+
+        yaffs_add_device(&device);
+        yaffs_mount("/");
+
+        api.AttachWriter(writer);
+    }
+
+    TelemetryArchiveBenchmarkTest::~TelemetryArchiveBenchmarkTest()
+    {
+        yaffs_unmount("/");
+        yaffs_remove_device(&device);
+    }
+
+    void TelemetryArchiveBenchmarkTest::LegacyAppend(const char* current, const char* previous, gsl::span<const std::uint8_t> record)
+    {
+        File file(api, current, FileOpen::OpenAlways, FileAccess::WriteOnly);
+        ASSERT_TRUE(file);
+
+        auto size = file.Size();
+        if (size >= MaxFileSize)
+        {
+            file.Close();
+
+            ASSERT_THAT(api.Move(current, previous), Eq(OSResult::Success));
+
+            file = File(api, current, FileOpen::CreateAlways, FileAccess::WriteOnly);
+            ASSERT_TRUE(file);
+
+            size = file.Size();
+        }
+
+        const auto offset = (size + Alignment - 1) / Alignment * Alignment;
+        ASSERT_TRUE(file.WriteAt(offset, record));
+    }
+
+    RunResult TelemetryArchiveBenchmarkTest::RunLegacy()
+    {
+        ChunkWrites = 0;
+        gcCopies = device.n_gc_copies;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0; i < Records; i++)
+        {
+            LegacyAppend("/legacy.current", "/legacy.previous", Record(i));
+        }
+
+        api.Sync();
+
+        const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        return RunResult{ChunkWrites - (device.n_gc_copies - gcCopies), duration};
+    }
+
+    RunResult TelemetryArchiveBenchmarkTest::RunArchive()
+    {
+        ChunkWrites = 0;
+        gcCopies = device.n_gc_copies;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0; i < Records; i++)
+        {
+            EXPECT_TRUE(writer.Append(Record(i)));
+        }
+
+        api.Sync();
+
+        const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        const auto result = RunResult{ChunkWrites - (device.n_gc_copies - gcCopies), duration};
+
+        writer.Close();
+
+        return result;
+    }
+
+    std::vector<std::uint8_t> TelemetryArchiveBenchmarkTest::ReadAll(const char* path)
+    {
+        File f(api, path, FileOpen::Existing, FileAccess::ReadOnly);
+        EXPECT_TRUE(f);
+
+        std::vector<std::uint8_t> contents(f.Size());
+        EXPECT_THAT(f.Read(contents).Status, Eq(OSResult::Success));
+
+        return contents;
+    }
+
+    std::array<std::uint8_t, RecordSize> TelemetryArchiveBenchmarkTest::Record(std::size_t index)
+    {
+        std::array<std::uint8_t, RecordSize> record;
+
+        std::uint8_t seed = static_cast<std::uint8_t>(index);
+        for (auto& b : record)
+        {
+            seed = seed * 97 + 13;
+            b = seed;
+        }
+
+        return record;
+    }
+
+    TEST_F(TelemetryArchiveBenchmarkTest, ShouldWriteArchiveInWholeChunks)
+    {
+        const auto legacy = RunLegacy();
+        const auto archive = RunArchive();
+
+        ASSERT_THAT(ReadAll("/archive.current"), Eq(ReadAll("/legacy.current")));
+        ASSERT_THAT(ReadAll("/archive.previous"), Eq(ReadAll("/legacy.previous")));
+
+        const auto payload = Records * RecordSize;
+        const auto chunkSize = static_cast<std::size_t>(device.data_bytes_per_chunk);
+        ASSERT_THAT(chunkSize, Eq(WindowSize));
+
+        std::printf("[ BENCH    ] %u records of %u bytes: "
+                    "open/write/close %u chunk writes (amplification %.1f, %.1f us/record), "
+                    "archive writer %u chunk writes (amplification %.1f, %.1f us/record)\n",
+            static_cast<unsigned>(Records),
+            static_cast<unsigned>(RecordSize),
+            static_cast<unsigned>(legacy.ChunkWrites),
+            static_cast<double>(legacy.ChunkWrites * chunkSize) / payload,
+            static_cast<double>(legacy.Duration.count()) / Records,
+            static_cast<unsigned>(archive.ChunkWrites),
+            static_cast<double>(archive.ChunkWrites * chunkSize) / payload,
+            static_cast<double>(archive.Duration.count()) / Records);
+
+        // every record rewrites last data chunk and object header of the file
+        ASSERT_THAT(Records, Le(legacy.ChunkWrites));
+
+        // data chunks (aligned records occupy 230 bytes each, last chunk of rotated file is written partially filled),
+        // block summaries and object headers written on create, rotation and sync
+        const auto dataChunks = (Records * Alignment + chunkSize - 1) / chunkSize + 1;
+        const auto chunksPerBlock = static_cast<std::size_t>(device.param.chunks_per_block);
+        ASSERT_THAT(archive.ChunkWrites, Le(dataChunks + dataChunks / (chunksPerBlock - 1) + 12));
+
+        ASSERT_THAT(archive.Duration, Lt(legacy.Duration));
+    }
+}
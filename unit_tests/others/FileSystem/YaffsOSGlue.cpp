@@ -1,13 +1,18 @@
 #include <limits.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <algorithm>
 #include <yaffs_trace.h>
 #include <yaffsfs.h>
+#include "YaffsOSGlue.hpp"
+#include "fs/yaffs_pools.hpp"
 #include "heap.h"
 #include "system.h"
 
 int yaffsError = 0;
 
+YaffsAllocationStatistics YaffsAllocations;
+
 #define YAFFS_TRACE_ALL 0xFFFFFFFF
 
 unsigned int yaffs_trace_mask =
@@ -44,7 +49,22 @@ int yaffsfs_GetLastError(void)
 
 void* yaffsfs_malloc(size_t size)
 {
-    void* ptr = pvPortMalloc(size);
+    auto start = std::chrono::steady_clock::now();
+
+    void* ptr = services::fs::YaffsPools.Allocate(size);
+    if (ptr != nullptr)
+    {
+        YaffsAllocations.FromPools++;
+    }
+    else
+    {
+        ptr = pvPortMalloc(size);
+        YaffsAllocations.FromHeap++;
+    }
+
+    auto duration = std::chrono::steady_clock::now() - start;
+    YaffsAllocations.Total += duration;
+    YaffsAllocations.Longest = std::max<std::chrono::nanoseconds>(YaffsAllocations.Longest, duration);
 
     if (!ptr)
     {
@@ -55,7 +75,10 @@ void* yaffsfs_malloc(size_t size)
 }
 void yaffsfs_free(void* ptr)
 {
-    vPortFree(ptr);
+    if (!services::fs::YaffsPools.Free(ptr))
+    {
+        vPortFree(ptr);
+    }
 }
 
 int yaffsfs_CheckMemRegion(const void* addr, size_t size, int write_request)
@@ -0,0 +1,25 @@
+#ifndef UNIT_TESTS_FILESYSTEM_YAFFSOSGLUE_HPP_
+#define UNIT_TESTS_FILESYSTEM_YAFFSOSGLUE_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Measurements of memory requests made by Yaffs
+ */
+struct YaffsAllocationStatistics
+{
+    /** @brief Number of requests served by pools */
+    std::uint32_t FromPools;
+    /** @brief Number of requests served by heap */
+    std::uint32_t FromHeap;
+    /** @brief Total time spent in allocation */
+    std::chrono::nanoseconds Total;
+    /** @brief Longest allocation */
+    std::chrono::nanoseconds Longest;
+};
+
+/** @brief Measurements of memory requests made by Yaffs since last reset */
+extern YaffsAllocationStatistics YaffsAllocations;
+
+#endif /* UNIT_TESTS_FILESYSTEM_YAFFSOSGLUE_HPP_ */
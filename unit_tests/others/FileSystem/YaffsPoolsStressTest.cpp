@@ -0,0 +1,284 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "fs/fs.h"
+#include "fs/yaffs.h"
+#include "fs/yaffs_pools.hpp"
+#include "heap.h"
+#include "yaffs.hpp"
+
+#include "FileSystem/MemoryDriver.hpp"
+#include "FileSystem/YaffsOSGlue.hpp"
+
+#include "storage/nand_driver.h"
+
+using testing::Eq;
+using testing::Le;
+using testing::Lt;
+using namespace services::fs;
+
+extern "C" void yaffs_remove_device(struct yaffs_dev* dev);
+
+namespace
+{
+    /** @brief Number of workload rounds */
+    constexpr std::size_t Rounds = 600;
+
+    /** @brief Number of rounds between remounts */
+    constexpr std::size_t RemountPeriod = 100;
+
+    /** @brief Number of rounds between long-lived allocations made by the rest of software */
+    constexpr std::size_t ForeignAllocationPeriod = 8;
+
+    /**
+     * @brief Heap state and Yaffs allocation measurements after workload
+     */
+    struct WorkloadResult
+    {
+        /** @brief Number of free heap blocks created by workload */
+        std::ptrdiff_t Holes;
+        /** @brief Number of free heap bytes outside of the largest free block */
+        std::size_t Stranded;
+        /** @brief Yaffs allocation measurements */
+        YaffsAllocationStatistics Allocations;
+    };
+
+    /**
+     * @brief Runs Yaffs through long sequence of file operations and remounts interleaved with long-lived heap allocations
+     */
+    class YaffsPoolsStressTest : public testing::Test
+    {
+      protected:
+        ~YaffsPoolsStressTest();
+
+        /**
+         * @brief Runs workload
+         * @param[in] usePools true if Yaffs should allocate from pools
+         * @return Measurements
+         */
+        WorkloadResult Run(bool usePools);
+
+        /**
+         * @brief Creates and mounts device on fresh memory
+         */
+        void Mount();
+
+        /**
+         * @brief Unmounts and removes device
+         */
+        void Unmount();
+
+        /**
+         * @brief Executes single workload round
+         * @param[in] round Round number
+         */
+        void Round(std::size_t round);
+
+        /**
+         * @brief Prints measurements
+         * @param[in] name Workload variant
+         * @param[in] result Measurements
+         */
+        void Report(const char* name, const WorkloadResult& result);
+
+        yaffs_dev device;
+        YaffsNANDDriver driver;
+        YaffsFileSystem api;
+
+        std::vector<std::uint8_t> arena;
+        std::vector<void*> foreign;
+    };
+
+    YaffsPoolsStressTest::~YaffsPoolsStressTest()
+    {
+        YaffsPools.Initialize(gsl::span<std::uint8_t>());
+    }
+
+    void YaffsPoolsStressTest::Mount()
+    {
+        memset(&driver, 0, sizeof(driver));
+        driver.geometry.pageSize = 512;
+        driver.geometry.spareAreaPerPage = 12;
+        driver.geometry.pagesPerBlock = 32;
+        driver.geometry.pagesPerChunk = 4;
+
+        NANDCalculateGeometry(&driver.geometry);
+
+        InitializeMemoryNAND(&driver.flash);
+
+        memset(&device, 0, sizeof(device));
+
+        SetupYaffsNANDDriver(&device, &driver);
+
+        device.param.name = "/";
+        device.param.inband_tags = false;
+        device.param.is_yaffs2 = true;
+        device.param.total_bytes_per_chunk = driver.geometry.chunkSize;
+        device.param.chunks_per_block = driver.geometry.chunksPerBlock;
+        device.param.spare_bytes_per_chunk = driver.geometry.spareAreaPerPage * driver.geometry.pagesPerChunk;
+        device.param.start_block = 1;
+        device.param.n_reserved_blocks = 3;
+        device.param.no_tags_ecc = true;
+        device.param.always_check_erased = true;
+
+        device.param.end_block = 2 * 1024 * 1024 / driver.geometry.blockSize - device.param.start_block - device.param.n_reserved_blocks;
+
+        yaffs_add_device(&device);
+        ASSERT_THAT(yaffs_mount("/"), Eq(0));
+    }
+
+    void YaffsPoolsStressTest::Unmount()
+    {
+        yaffs_unmount("/");
+        yaffs_remove_device(&device);
+    }
+
+    void YaffsPoolsStressTest::Round(std::size_t round)
+    {
+        static std::uint8_t data[12 * 1024];
+
+        char path[64];
+        std::snprintf(path, sizeof(path), "/d%u/file_%.*s%u", //
+            static_cast<unsigned>(round % 4),
+            static_cast<int>(round % 40),
+            "_with_quite_long_name_to_vary_string_sizes",
+            static_cast<unsigned>(round));
+
+        if (round % 4 == round)
+        {
+            char directory[8];
+            std::snprintf(directory, sizeof(directory), "/d%u", static_cast<unsigned>(round));
+            api.MakeDirectory(directory);
+        }
+
+        {
+            File f(api, path, FileOpen::CreateAlways, FileAccess::WriteOnly);
+            ASSERT_TRUE(f);
+
+            auto written = f.Write(gsl::make_span(data, (round * 997) % sizeof(data) + 1));
+            ASSERT_THAT(written.Status, Eq(OSResult::Success));
+
+            if (round % 5 == 0)
+            {
+                ASSERT_THAT(f.Truncate(100), Eq(OSResult::Success));
+            }
+        }
+
+        if (round % 7 == 0)
+        {
+            char moved[72];
+            std::snprintf(moved, sizeof(moved), "%s.old", path);
+            ASSERT_THAT(api.Move(path, moved), Eq(OSResult::Success));
+            ASSERT_THAT(api.Unlink(moved), Eq(OSResult::Success));
+        }
+        else if (round % 9 != 0)
+        {
+            ASSERT_THAT(api.Unlink(path), Eq(OSResult::Success));
+        }
+
+        if (round % 25 == 0)
+        {
+            api.Checkpoint();
+        }
+
+        if (round % ForeignAllocationPeriod == 0)
+        {
+            foreign.push_back(pvPortMalloc(64 + (round * 131) % 1500));
+        }
+
+        if (round % RemountPeriod == RemountPeriod - 1)
+        {
+            yaffs_unmount("/");
+            ASSERT_THAT(yaffs_mount("/"), Eq(0));
+        }
+    }
+
+    WorkloadResult YaffsPoolsStressTest::Run(bool usePools)
+    {
+        if (usePools)
+        {
+            arena.resize(YaffsPools.ArenaSize());
+            EXPECT_THAT(YaffsPools.Initialize(arena), Eq(true));
+        }
+
+        std::size_t largest = 0;
+        const auto holesBefore = xPortGetFreeBlocksCount(&largest);
+        const auto freeBefore = xPortGetFreeHeapSize();
+        const auto strandedBefore = freeBefore - largest;
+
+        YaffsAllocations = YaffsAllocationStatistics{0, 0, std::chrono::nanoseconds::zero(), std::chrono::nanoseconds::zero()};
+
+        Mount();
+
+        for (std::size_t round = 0; round < Rounds && !HasFatalFailure(); round++)
+        {
+            Round(round);
+        }
+
+        Unmount();
+
+        WorkloadResult result;
+        result.Allocations = YaffsAllocations;
+
+        const auto holesAfter = xPortGetFreeBlocksCount(&largest);
+        result.Holes = static_cast<std::ptrdiff_t>(holesAfter) - static_cast<std::ptrdiff_t>(holesBefore);
+        result.Stranded = xPortGetFreeHeapSize() - largest - strandedBefore;
+
+        for (auto ptr : foreign)
+        {
+            vPortFree(ptr);
+        }
+        foreign.clear();
+
+        return result;
+    }
+
+    void YaffsPoolsStressTest::Report(const char* name, const WorkloadResult& result)
+    {
+        const auto count = result.Allocations.FromPools + result.Allocations.FromHeap;
+
+        std::printf("[ BENCH    ] %-5s: %u allocations (%u from heap), average %ld ns, longest %ld ns, "
+                    "%ld heap holes, %u bytes stranded in holes\n",
+            name,
+            static_cast<unsigned>(count),
+            static_cast<unsigned>(result.Allocations.FromHeap),
+            static_cast<long>(count == 0 ? 0 : result.Allocations.Total.count() / count),
+            static_cast<long>(result.Allocations.Longest.count()),
+            static_cast<long>(result.Holes),
+            static_cast<unsigned>(result.Stranded));
+    }
+
+    TEST_F(YaffsPoolsStressTest, ShouldKeepYaffsAllocationsAwayFromHeap)
+    {
+        const auto heap = Run(false);
+        ASSERT_FALSE(HasFatalFailure());
+
+        const auto pools = Run(true);
+        ASSERT_FALSE(HasFatalFailure());
+
+        Report("heap", heap);
+        Report("pools", pools);
+
+        for (std::size_t i = 0; i < YaffsPools.Classes(); i++)
+        {
+            auto statistics = YaffsPools.Statistics(i);
+
+            std::printf("[ BENCH    ] class %5u B: capacity %3u, peak %3u, overflows %u\n",
+                static_cast<unsigned>(statistics.BlockSize),
+                statistics.Capacity,
+                statistics.HighWaterMark,
+                static_cast<unsigned>(statistics.Overflows));
+
+            // every block is returned on unmount
+            ASSERT_THAT(statistics.InUse, Eq(0));
+        }
+
+        ASSERT_THAT(pools.Allocations.FromHeap, Lt(pools.Allocations.FromPools / 10));
+        ASSERT_THAT(pools.Holes, Le(heap.Holes));
+        ASSERT_THAT(pools.Stranded, Le(heap.Stranded));
+    }
+}
@@ -74,3 +74,36 @@ INSTANTIATE_TEST_CASE_P(CRC,
 
         Case(0x0000, {}) //
         ), );
+
+TEST(CRC32Test, ShouldCalculateCheckValue)
+{
+    const std::uint8_t input[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    ASSERT_THAT(Hex(CRC32_calc(input)), Eq(Hex(0xCBF43926U)));
+}
+
+TEST(CRC32Test, ShouldCalculateEmptyBuffer)
+{
+    ASSERT_THAT(Hex(CRC32_calc(gsl::span<const std::uint8_t>())), Eq(Hex(0U)));
+}
+
+TEST(CRC32Test, ShouldCalculateErasedArea)
+{
+    std::vector<std::uint8_t> input(32, 0xFF);
+
+    ASSERT_THAT(Hex(CRC32_calc(input)), Eq(Hex(0xFF6CAB0BU)));
+}
+
+TEST(CRC32Test, ShouldDetectSingleBitFlip)
+{
+    std::vector<std::uint8_t> input(2044, 0xA5);
+
+    auto expected = CRC32_calc(input);
+
+    for (std::size_t i = 0; i < input.size(); i += 97)
+    {
+        input[i] ^= 1 << (i % 8);
+        ASSERT_THAT(CRC32_calc(input), testing::Ne(expected));
+        input[i] ^= 1 << (i % 8);
+    }
+}
@@ -0,0 +1,127 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <tuple>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/erasure.hpp"
+
+using testing::Eq;
+using std::uint8_t;
+
+namespace
+{
+    /** @brief Size of file part carried by single download frame */
+    constexpr std::size_t ChunkSize = 230;
+
+    /** @brief Number of times every measurement is repeated */
+    constexpr std::size_t Rounds = 200;
+
+    /**
+     * @brief Reference shift-and-add multiplication used to compare against table driven implementation
+     */
+    uint8_t SlowMultiply(uint8_t a, uint8_t b)
+    {
+        uint8_t result = 0;
+        while (b != 0)
+        {
+            if ((b & 1) != 0)
+            {
+                result ^= a;
+            }
+
+            a = static_cast<uint8_t>((a << 1) ^ ((a & 0x80) != 0 ? 0x1D : 0));
+            b >>= 1;
+        }
+
+        return result;
+    }
+
+    class ErasureBenchmarkTest : public testing::TestWithParam<std::tuple<std::size_t, std::size_t>>
+    {
+      protected:
+        template <typename Encoder> std::chrono::nanoseconds Measure(std::vector<uint8_t>& repairs, Encoder encoder);
+
+        std::vector<std::vector<uint8_t>> MakeGroup(std::size_t groupSize);
+    };
+
+    std::vector<std::vector<uint8_t>> ErasureBenchmarkTest::MakeGroup(std::size_t groupSize)
+    {
+        std::vector<std::vector<uint8_t>> group(groupSize, std::vector<uint8_t>(ChunkSize));
+        uint8_t seed = 1;
+        for (auto& chunk : group)
+        {
+            for (auto& b : chunk)
+            {
+                seed = seed * 97 + 13;
+                b = seed;
+            }
+        }
+
+        return group;
+    }
+
+    template <typename Encoder> std::chrono::nanoseconds ErasureBenchmarkTest::Measure(std::vector<uint8_t>& repairs, Encoder encoder)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t round = 0; round < Rounds; round++)
+        {
+            std::fill(repairs.begin(), repairs.end(), 0);
+            encoder();
+        }
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    TEST_P(ErasureBenchmarkTest, EncodeThroughputPerChunk)
+    {
+        const auto groupSize = std::get<0>(GetParam());
+        const auto repairCount = std::get<1>(GetParam());
+
+        auto group = MakeGroup(groupSize);
+        std::vector<uint8_t> tableRepairs(repairCount * ChunkSize);
+        std::vector<uint8_t> slowRepairs(repairCount * ChunkSize);
+
+        auto table = Measure(tableRepairs, [&]() {
+            for (std::size_t i = 0; i < groupSize; i++)
+            {
+                erasure::Encode(tableRepairs, ChunkSize, i, group[i]);
+            }
+        });
+
+        auto slow = Measure(slowRepairs, [&]() {
+            for (std::size_t i = 0; i < groupSize; i++)
+            {
+                for (std::size_t j = 0; j < repairCount; j++)
+                {
+                    auto c = erasure::RepairCoefficient(j, i);
+                    for (std::size_t k = 0; k < ChunkSize; k++)
+                    {
+                        slowRepairs[j * ChunkSize + k] ^= SlowMultiply(c, group[i][k]);
+                    }
+                }
+            }
+        });
+
+        const auto chunks = Rounds * groupSize;
+
+        std::printf("[ BENCH    ] K=%u M=%u: table %lu ns/chunk (%lu MB/s), shift-and-add %lu ns/chunk (%lu MB/s)\n",
+            static_cast<unsigned>(groupSize),
+            static_cast<unsigned>(repairCount),
+            static_cast<unsigned long>(table.count() / chunks),
+            static_cast<unsigned long>(chunks * ChunkSize * 1000ULL / std::max<long long>(table.count(), 1)),
+            static_cast<unsigned long>(slow.count() / chunks),
+            static_cast<unsigned long>(chunks * ChunkSize * 1000ULL / std::max<long long>(slow.count(), 1)));
+
+        ASSERT_THAT(tableRepairs, Eq(slowRepairs));
+    }
+
+    INSTANTIATE_TEST_CASE_P(ErasureBenchmarkTest,
+        ErasureBenchmarkTest,
+        testing::Values(std::make_tuple<std::size_t, std::size_t>(8, 1),
+            std::make_tuple<std::size_t, std::size_t>(16, 2),
+            std::make_tuple<std::size_t, std::size_t>(32, 4),
+            std::make_tuple<std::size_t, std::size_t>(128, 4)), );
+}
@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/erasure.hpp"
+
+using testing::Eq;
+using testing::ElementsAreArray;
+using testing::Each;
+using std::uint8_t;
+
+namespace
+{
+    using Block = std::vector<uint8_t>;
+
+    /**
+     * @brief Rebuilds data blocks of group from any K received blocks
+     * @param groupSize Number of data blocks (K)
+     * @param indices Indices of received blocks (0..K-1 - data, K.. - repair)
+     * @param blocks Received blocks
+     * @return Data blocks
+     */
+    std::vector<Block> Rebuild(std::size_t groupSize, const std::vector<std::size_t>& indices, const std::vector<Block>& blocks)
+    {
+        const auto blockSize = blocks[0].size();
+
+        std::vector<std::vector<uint8_t>> matrix(groupSize, std::vector<uint8_t>(groupSize, 0));
+        std::vector<Block> values(blocks.begin(), blocks.begin() + groupSize);
+
+        for (std::size_t row = 0; row < groupSize; row++)
+        {
+            for (std::size_t col = 0; col < groupSize; col++)
+            {
+                if (indices[row] < groupSize)
+                {
+                    matrix[row][col] = indices[row] == col ? 1 : 0;
+                }
+                else
+                {
+                    matrix[row][col] = erasure::RepairCoefficient(indices[row] - groupSize, col);
+                }
+            }
+        }
+
+        for (std::size_t col = 0; col < groupSize; col++)
+        {
+            auto pivot = col;
+            while (matrix[pivot][col] == 0)
+            {
+                pivot++;
+            }
+
+            std::swap(matrix[pivot], matrix[col]);
+            std::swap(values[pivot], values[col]);
+
+            auto scale = erasure::Inverse(matrix[col][col]);
+            for (auto& v : matrix[col])
+            {
+                v = erasure::Multiply(v, scale);
+            }
+            for (auto& v : values[col])
+            {
+                v = erasure::Multiply(v, scale);
+            }
+
+            for (std::size_t row = 0; row < groupSize; row++)
+            {
+                auto factor = matrix[row][col];
+                if (row == col || factor == 0)
+                {
+                    continue;
+                }
+
+                for (std::size_t k = 0; k < groupSize; k++)
+                {
+                    matrix[row][k] ^= erasure::Multiply(factor, matrix[col][k]);
+                }
+
+                for (std::size_t k = 0; k < blockSize; k++)
+                {
+                    values[row][k] ^= erasure::Multiply(factor, values[col][k]);
+                }
+            }
+        }
+
+        return values;
+    }
+
+    std::vector<Block> MakeGroup(std::size_t groupSize, std::size_t blockSize)
+    {
+        std::vector<Block> group(groupSize, Block(blockSize));
+        uint8_t seed = 7;
+        for (auto& block : group)
+        {
+            for (auto& b : block)
+            {
+                seed = seed * 73 + 11;
+                b = seed;
+            }
+        }
+
+        return group;
+    }
+
+    std::vector<Block> EncodeGroup(const std::vector<Block>& group, std::size_t repairCount)
+    {
+        const auto blockSize = group[0].size();
+        Block repairs(repairCount * blockSize, 0);
+
+        for (std::size_t i = 0; i < group.size(); i++)
+        {
+            erasure::Encode(repairs, blockSize, i, group[i]);
+        }
+
+        std::vector<Block> result;
+        for (std::size_t j = 0; j < repairCount; j++)
+        {
+            result.emplace_back(repairs.begin() + j * blockSize, repairs.begin() + (j + 1) * blockSize);
+        }
+
+        return result;
+    }
+
+    TEST(ErasureTest, ShouldMultiplyInField)
+    {
+        ASSERT_THAT(erasure::Multiply(0, 0x53), Eq(0));
+        ASSERT_THAT(erasure::Multiply(1, 0x53), Eq(0x53));
+        ASSERT_THAT(erasure::Multiply(2, 0x80), Eq(0x1D));
+        ASSERT_THAT(erasure::Multiply(0x53, 0xCA), Eq(erasure::Multiply(0xCA, 0x53)));
+    }
+
+    TEST(ErasureTest, EveryNonZeroElementShouldHaveInverse)
+    {
+        for (std::uint16_t a = 1; a < 256; a++)
+        {
+            ASSERT_THAT(erasure::Multiply(a, erasure::Inverse(a)), Eq(1)) << "a=" << a;
+        }
+    }
+
+    TEST(ErasureTest, RepairOfSingleBlockShouldBeScaledCopy)
+    {
+        Block data{1, 2, 3, 0, 255};
+        Block repair(5, 0);
+
+        erasure::Encode(repair, repair.size(), 0, data);
+
+        auto c = erasure::RepairCoefficient(0, 0);
+        ASSERT_THAT(repair,
+            ElementsAreArray({erasure::Multiply(c, 1), erasure::Multiply(c, 2), erasure::Multiply(c, 3), uint8_t(0), erasure::Multiply(c, 255)}));
+    }
+
+    TEST(ErasureTest, ShortBlockShouldBeTreatedAsZeroPadded)
+    {
+        Block full{9, 8, 7, 0, 0};
+        Block shortBlock{9, 8, 7};
+
+        Block a(10, 0);
+        Block b(10, 0);
+
+        erasure::Encode(a, 5, 3, full);
+        erasure::Encode(b, 5, 3, shortBlock);
+
+        ASSERT_THAT(a, Eq(b));
+    }
+
+    TEST(ErasureTest, ShouldRebuildGroupFromAnySubsetOfBlocks)
+    {
+        constexpr std::size_t K = 5;
+        constexpr std::size_t M = 3;
+
+        auto group = MakeGroup(K, 17);
+        auto repairs = EncodeGroup(group, M);
+
+        std::vector<Block> all(group);
+        all.insert(all.end(), repairs.begin(), repairs.end());
+
+        for (unsigned mask = 0; mask < (1u << (K + M)); mask++)
+        {
+            std::vector<std::size_t> indices;
+            std::vector<Block> received;
+
+            for (std::size_t i = 0; i < K + M; i++)
+            {
+                if ((mask & (1u << i)) != 0)
+                {
+                    indices.push_back(i);
+                    received.push_back(all[i]);
+                }
+            }
+
+            if (indices.size() != K)
+            {
+                continue;
+            }
+
+            ASSERT_THAT(Rebuild(K, indices, received), Eq(group)) << "mask=" << mask;
+        }
+    }
+
+    TEST(ErasureTest, ShouldRebuildLargeGroup)
+    {
+        constexpr std::size_t K = erasure::MaxDataBlocks;
+        constexpr std::size_t M = 4;
+
+        auto group = MakeGroup(K, 8);
+        auto repairs = EncodeGroup(group, M);
+
+        std::vector<std::size_t> indices;
+        std::vector<Block> received;
+
+        for (std::size_t i = 0; i < K; i++)
+        {
+            if (i % 37 != 3)
+            {
+                indices.push_back(i);
+                received.push_back(group[i]);
+            }
+        }
+
+        for (std::size_t j = 0; j < M; j++)
+        {
+            indices.push_back(K + j);
+            received.push_back(repairs[j]);
+        }
+
+        indices.resize(K);
+        received.resize(K);
+
+        ASSERT_THAT(Rebuild(K, indices, received), Eq(group));
+    }
+}
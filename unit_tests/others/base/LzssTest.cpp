@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/lzss.hpp"
+
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+using testing::Eq;
+using testing::Le;
+
+namespace
+{
+    std::vector<std::uint8_t> RoundTrip(const std::vector<std::uint8_t>& input, std::size_t* compressedSize = nullptr)
+    {
+        std::array<std::uint8_t, 512> compressed;
+        std::array<std::uint8_t, 512> decompressed;
+
+        auto packed = lzss::Compress(input, compressed);
+        if (compressedSize != nullptr)
+        {
+            *compressedSize = packed.size();
+        }
+
+        auto unpacked = lzss::Decompress(packed, decompressed);
+        return std::vector<std::uint8_t>(unpacked.begin(), unpacked.end());
+    }
+
+    TEST(LzssTest, ShouldEncodeLiterals)
+    {
+        const std::uint8_t input[] = {1, 2, 3};
+        std::array<std::uint8_t, 10> output;
+
+        auto packed = lzss::Compress(input, output);
+
+        ASSERT_THAT(packed, ElementsAre(0x00, 1, 2, 3));
+    }
+
+    TEST(LzssTest, ShouldEncodeRunAsOverlappingMatch)
+    {
+        std::vector<std::uint8_t> input(100, 0xAA);
+        std::array<std::uint8_t, 10> output;
+
+        auto packed = lzss::Compress(input, output);
+
+        ASSERT_THAT(packed, ElementsAre(0x02, 0xAA, 0, 99 - lzss::MinMatchLength));
+    }
+
+    TEST(LzssTest, ShouldRoundTripPaddedData)
+    {
+        std::vector<std::uint8_t> input(230, 0xAA);
+        for (auto i = 0; i < 40; i++)
+        {
+            input[i] = i;
+        }
+
+        std::size_t compressedSize = 0;
+        ASSERT_THAT(RoundTrip(input, &compressedSize), ElementsAreArray(input));
+        ASSERT_THAT(compressedSize, Le(50u));
+    }
+
+    TEST(LzssTest, ShouldRoundTripRandomData)
+    {
+        std::srand(42);
+
+        for (auto size = 0; size < 300; size += 7)
+        {
+            std::vector<std::uint8_t> input(size);
+            std::generate(input.begin(), input.end(), [size]() { return static_cast<std::uint8_t>(std::rand() % (size % 5 == 0 ? 256 : 4)); });
+
+            ASSERT_THAT(RoundTrip(input), ElementsAreArray(input)) << "Size " << size;
+        }
+    }
+
+    TEST(LzssTest, ShouldFailWhenOutputIsTooSmall)
+    {
+        const std::uint8_t input[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+        std::array<std::uint8_t, 9> output;
+
+        ASSERT_THAT(lzss::Compress(input, output).empty(), Eq(true));
+    }
+
+    TEST(LzssTest, ShouldRejectMatchBeforeBlockStart)
+    {
+        const std::uint8_t input[] = {0x02, 0xAA, 5, 0};
+        std::array<std::uint8_t, 10> output;
+
+        ASSERT_THAT(lzss::Decompress(input, output).empty(), Eq(true));
+    }
+
+    TEST(LzssTest, ShouldRejectTruncatedMatch)
+    {
+        const std::uint8_t input[] = {0x02, 0xAA, 0};
+        std::array<std::uint8_t, 10> output;
+
+        ASSERT_THAT(lzss::Decompress(input, output).empty(), Eq(true));
+    }
+}
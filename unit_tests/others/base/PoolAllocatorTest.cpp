@@ -0,0 +1,164 @@
+#include <array>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "base/pool_allocator.hpp"
+
+using testing::Eq;
+using testing::Ne;
+using testing::IsNull;
+using testing::NotNull;
+using namespace memory;
+
+namespace
+{
+    class PoolAllocatorTest : public testing::Test
+    {
+      protected:
+        PoolAllocatorTest();
+
+        alignas(PoolAllocator::Alignment) std::array<std::uint8_t, 512> _arena;
+
+        StaticPoolAllocator<3> _pools;
+    };
+
+    PoolAllocatorTest::PoolAllocatorTest() : _pools({{{64, 2}, {16, 4}, {12, 2}}})
+    {
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldCalculateArenaSizeFromAlignedBlocks)
+    {
+        ASSERT_THAT(_pools.ArenaSize(), Eq(64u * 2 + 16 * 4 + 16 * 2));
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldNotAllocateBeforeInitialization)
+    {
+        ASSERT_THAT(_pools.Allocate(8), IsNull());
+        ASSERT_THAT(_pools.Statistics(0).Overflows, Eq(0u));
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldRejectTooSmallArena)
+    {
+        ASSERT_THAT(_pools.Initialize(gsl::make_span(_arena.data(), 200)), Eq(false));
+        ASSERT_THAT(_pools.Allocate(8), IsNull());
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldRejectMisalignedArena)
+    {
+        ASSERT_THAT(_pools.Initialize(gsl::make_span(_arena.data() + 1, 500)), Eq(false));
+        ASSERT_THAT(_pools.Allocate(8), IsNull());
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldAllocateFromSmallestMatchingClass)
+    {
+        ASSERT_THAT(_pools.Initialize(_arena), Eq(true));
+
+        auto small = static_cast<std::uint8_t*>(_pools.Allocate(10));
+        auto medium = static_cast<std::uint8_t*>(_pools.Allocate(13));
+        auto large = static_cast<std::uint8_t*>(_pools.Allocate(17));
+
+        ASSERT_THAT(small, Eq(_arena.data() + 64 * 2 + 16 * 4));
+        ASSERT_THAT(medium, Eq(_arena.data() + 64 * 2));
+        ASSERT_THAT(large, Eq(_arena.data()));
+
+        ASSERT_THAT(_pools.Statistics(0).InUse, Eq(1));
+        ASSERT_THAT(_pools.Statistics(1).InUse, Eq(1));
+        ASSERT_THAT(_pools.Statistics(2).InUse, Eq(1));
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldNotServeRequestLargerThanEveryClass)
+    {
+        _pools.Initialize(_arena);
+
+        ASSERT_THAT(_pools.Allocate(65), IsNull());
+
+        for (std::size_t i = 0; i < _pools.Classes(); i++)
+        {
+            ASSERT_THAT(_pools.Statistics(i).Overflows, Eq(0u));
+        }
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldReportOverflowWhenClassIsExhausted)
+    {
+        _pools.Initialize(_arena);
+
+        ASSERT_THAT(_pools.Allocate(64), NotNull());
+        ASSERT_THAT(_pools.Allocate(64), NotNull());
+        ASSERT_THAT(_pools.Allocate(64), IsNull());
+
+        auto statistics = _pools.Statistics(0);
+        ASSERT_THAT(statistics.BlockSize, Eq(64u));
+        ASSERT_THAT(statistics.Capacity, Eq(2));
+        ASSERT_THAT(statistics.InUse, Eq(2));
+        ASSERT_THAT(statistics.Overflows, Eq(1u));
+
+        // smaller classes are not used for larger requests and larger classes are not used when matching one is full
+        ASSERT_THAT(_pools.Statistics(1).InUse, Eq(0));
+        ASSERT_THAT(_pools.Statistics(2).InUse, Eq(0));
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldReuseReleasedBlock)
+    {
+        _pools.Initialize(_arena);
+
+        auto first = _pools.Allocate(64);
+        auto second = _pools.Allocate(64);
+
+        ASSERT_THAT(_pools.Free(first), Eq(true));
+        ASSERT_THAT(_pools.Allocate(64), Eq(first));
+
+        ASSERT_THAT(_pools.Free(second), Eq(true));
+        ASSERT_THAT(_pools.Allocate(64), Eq(second));
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldTrackHighWaterMark)
+    {
+        _pools.Initialize(_arena);
+
+        void* blocks[3];
+        for (auto& block : blocks)
+        {
+            block = _pools.Allocate(16);
+        }
+
+        for (auto& block : blocks)
+        {
+            _pools.Free(block);
+        }
+
+        _pools.Allocate(16);
+
+        auto statistics = _pools.Statistics(1);
+        ASSERT_THAT(statistics.InUse, Eq(1));
+        ASSERT_THAT(statistics.HighWaterMark, Eq(3));
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldNotReleaseForeignPointer)
+    {
+        _pools.Initialize(_arena);
+
+        std::uint8_t other[16];
+
+        ASSERT_THAT(_pools.Free(other), Eq(false));
+        ASSERT_THAT(_pools.Free(_arena.data() + _pools.ArenaSize()), Eq(false));
+        ASSERT_THAT(_pools.Free(nullptr), Eq(false));
+    }
+
+    TEST_F(PoolAllocatorTest, ShouldResetStatisticsOnInitialization)
+    {
+        _pools.Initialize(_arena);
+
+        _pools.Allocate(64);
+        _pools.Allocate(64);
+        _pools.Allocate(64);
+
+        ASSERT_THAT(_pools.Initialize(_arena), Eq(true));
+
+        auto statistics = _pools.Statistics(0);
+        ASSERT_THAT(statistics.InUse, Eq(0));
+        ASSERT_THAT(statistics.HighWaterMark, Eq(0));
+        ASSERT_THAT(statistics.Overflows, Eq(0u));
+
+        ASSERT_THAT(_pools.Allocate(64), Ne(nullptr));
+    }
+}
@@ -2,6 +2,7 @@
 #include "gmock/gmock-matchers.h"
 #include "mission/base.hpp"
 #include "mock/FsMock.hpp"
+#include "mock/YaffsDeviceOperationsMock.hpp"
 #include "telemetry/collect_fs.hpp"
 #include "telemetry/state.hpp"
 
@@ -14,6 +15,7 @@ namespace
     using testing::Invoke;
 
     using namespace services::fs;
+    using namespace std::chrono_literals;
 
     class FileSystemTelemetryAcquisitionTest : public testing::Test
     {
@@ -21,13 +23,17 @@ namespace
         FileSystemTelemetryAcquisitionTest();
         mission::UpdateResult Run();
         FsMock mock;
+        testing::NiceMock<YaffsDeviceOperationsMock> deviceOperations;
         telemetry::TelemetryState state;
         telemetry::FileSystemTelemetryAcquisition task;
         mission::UpdateDescriptor<telemetry::TelemetryState> descriptor;
     };
 
-    FileSystemTelemetryAcquisitionTest::FileSystemTelemetryAcquisitionTest() : task(mock), descriptor(task.BuildUpdate())
+    FileSystemTelemetryAcquisitionTest::FileSystemTelemetryAcquisitionTest() //
+        : task(std::tie(mock, deviceOperations)),
+          descriptor(task.BuildUpdate())
     {
+        ON_CALL(deviceOperations, GetCacheStatistics()).WillByDefault(Return(ChunkCacheStatistics{0, 0, 0}));
     }
 
     mission::UpdateResult FileSystemTelemetryAcquisitionTest::Run()
@@ -54,7 +60,31 @@ namespace
     {
         EXPECT_CALL(mock, GetFreeSpace(_)).WillOnce(Return(0x12345678u));
         Run();
-        ASSERT_THAT(state.telemetry.Get<telemetry::FileSystemTelemetry>().GetValue(), Eq(0x12345678u));
+        ASSERT_THAT(state.telemetry.Get<telemetry::FileSystemTelemetry>().FreeSpace(), Eq(0x12345678u));
         ASSERT_THAT(state.telemetry.IsModified(), Eq(true));
     }
+
+    TEST_F(FileSystemTelemetryAcquisitionTest, TestCacheStatisticsUpdate)
+    {
+        EXPECT_CALL(mock, GetFreeSpace(_)).WillOnce(Return(0x12345678u));
+        EXPECT_CALL(deviceOperations, GetCacheStatistics()).WillOnce(Return(ChunkCacheStatistics{30, 10, 5}));
+        Run();
+
+        const auto& fs = state.telemetry.Get<telemetry::FileSystemTelemetry>();
+        ASSERT_THAT(fs.CacheHits(), Eq(30u));
+        ASSERT_THAT(fs.CacheMisses(), Eq(10u));
+        ASSERT_THAT(fs.CacheEvictions(), Eq(5u));
+        ASSERT_THAT(fs.CacheHitRate(), Eq(75u));
+    }
+
+    TEST_F(FileSystemTelemetryAcquisitionTest, TestEraseStatisticsUpdate)
+    {
+        EXPECT_CALL(mock, GetFreeSpace(_)).WillOnce(Return(0x12345678u));
+        EXPECT_CALL(deviceOperations, GetEraseStatistics()).WillOnce(Return(EraseStatistics{3, 10, 2, 0, 700ms, 900ms}));
+        Run();
+
+        const auto& fs = state.telemetry.Get<telemetry::FileSystemTelemetry>();
+        ASSERT_THAT(fs.PendingErases(), Eq(3u));
+        ASSERT_THAT(fs.LongestEraseStall(), Eq(700ms));
+    }
 }
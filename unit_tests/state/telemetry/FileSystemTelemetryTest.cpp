@@ -1,36 +1,68 @@
+#include <chrono>
 #include "gtest/gtest.h"
 #include "gmock/gmock-matchers.h"
 #include "base/BitWriter.hpp"
-#include "telemetry/BasicTelemetry.hpp"
-#include "telemetry/fwd.hpp"
+#include "telemetry/FileSystemTelemetry.hpp"
 
 namespace
 {
     using testing::Eq;
+    using namespace std::chrono_literals;
 
     TEST(FileSystemTelemetryTest, TestDefaultConstruction)
     {
         telemetry::FileSystemTelemetry object;
-        ASSERT_THAT(object.GetValue(), Eq(0u));
+        ASSERT_THAT(object.FreeSpace(), Eq(0u));
+        ASSERT_THAT(object.CacheHits(), Eq(0u));
+        ASSERT_THAT(object.CacheMisses(), Eq(0u));
+        ASSERT_THAT(object.CacheEvictions(), Eq(0u));
+        ASSERT_THAT(object.CacheHitRate(), Eq(0u));
+        ASSERT_THAT(object.PendingErases(), Eq(0u));
+        ASSERT_THAT(object.LongestEraseStall(), Eq(0ms));
     }
 
     TEST(FileSystemTelemetryTest, TestCustomConstruction)
     {
-        telemetry::FileSystemTelemetry object(0x11223344);
-        ASSERT_THAT(object.GetValue(), Eq(0x11223344u));
+        telemetry::FileSystemTelemetry object(0x11223344, 30, 10, 5, 3, 600ms);
+        ASSERT_THAT(object.FreeSpace(), Eq(0x11223344u));
+        ASSERT_THAT(object.CacheHits(), Eq(30u));
+        ASSERT_THAT(object.CacheMisses(), Eq(10u));
+        ASSERT_THAT(object.CacheEvictions(), Eq(5u));
+        ASSERT_THAT(object.PendingErases(), Eq(3u));
+        ASSERT_THAT(object.LongestEraseStall(), Eq(600ms));
+    }
+
+    TEST(FileSystemTelemetryTest, TestCacheHitRate)
+    {
+        ASSERT_THAT(telemetry::FileSystemTelemetry(0, 30, 10, 0, 0, 0ms).CacheHitRate(), Eq(75u));
+        ASSERT_THAT(telemetry::FileSystemTelemetry(0, 0, 10, 0, 0, 0ms).CacheHitRate(), Eq(0u));
+        ASSERT_THAT(telemetry::FileSystemTelemetry(0, 10, 0, 0, 0, 0ms).CacheHitRate(), Eq(100u));
+        ASSERT_THAT(telemetry::FileSystemTelemetry(0, 0xFFFFFFFF, 0xFFFFFFFF, 0, 0, 0ms).CacheHitRate(), Eq(50u));
     }
 
     TEST(FileSystemTelemetryTest, TestSerialization)
     {
-        std::uint8_t expected[] = {0x44, 0x33, 0x22, 0x11};
+        std::uint8_t expected[] = {0x44, 0x33, 0x22, 75, 0x23};
 
         std::array<std::uint8_t, (telemetry::FileSystemTelemetry::BitSize() + 7) / 8> buffer;
-        telemetry::FileSystemTelemetry object(0x11223344);
+        telemetry::FileSystemTelemetry object(0x223344, 30, 10, 5, 3, 600ms);
         BitWriter writer(buffer);
         object.Write(writer);
         ASSERT_THAT(writer.Status(), Eq(true));
         ASSERT_THAT(writer.GetBitDataLength(), Eq(telemetry::FileSystemTelemetry::BitSize()));
-        ASSERT_THAT(writer.GetBitDataLength(), Eq(32u));
+        ASSERT_THAT(writer.GetBitDataLength(), Eq(40u));
+        ASSERT_THAT(writer.Capture(), Eq(gsl::make_span(expected)));
+    }
+
+    TEST(FileSystemTelemetryTest, TestSerializationSaturation)
+    {
+        std::uint8_t expected[] = {0xFF, 0xFF, 0xFF, 0, 0xFF};
+
+        std::array<std::uint8_t, (telemetry::FileSystemTelemetry::BitSize() + 7) / 8> buffer;
+        telemetry::FileSystemTelemetry object(0x11223344, 0, 0, 0, 100, 10000ms);
+        BitWriter writer(buffer);
+        object.Write(writer);
+        ASSERT_THAT(writer.Status(), Eq(true));
         ASSERT_THAT(writer.Capture(), Eq(gsl::make_span(expected)));
     }
 }
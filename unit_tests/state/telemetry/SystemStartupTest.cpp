@@ -8,6 +8,7 @@
 namespace
 {
     using testing::Eq;
+    using namespace std::chrono_literals;
 
     TEST(SystemStartupTest, TestDefaultConstruction)
     {
@@ -15,22 +16,26 @@ namespace
         ASSERT_THAT(object.BootCounter(), Eq(0u));
         ASSERT_THAT(object.BootIndex(), Eq(0));
         ASSERT_THAT(object.BootReason(), Eq(0u));
+        ASSERT_THAT(object.MountDuration(), Eq(0ms));
+        ASSERT_THAT(object.MountedFromCheckpoint(), Eq(false));
     }
 
     TEST(SystemStartupTest, TestCustomConstruction)
     {
-        telemetry::SystemStartup object(0x11223344, 0x55, 0x8899);
+        telemetry::SystemStartup object(0x11223344, 0x55, 0x8899, 1500ms, true);
         ASSERT_THAT(object.BootCounter(), Eq(0x11223344u));
         ASSERT_THAT(object.BootIndex(), Eq(0x55));
         ASSERT_THAT(object.BootReason(), Eq(0x8899u));
+        ASSERT_THAT(object.MountDuration(), Eq(1500ms));
+        ASSERT_THAT(object.MountedFromCheckpoint(), Eq(true));
     }
 
     TEST(SystemStartupTest, TestSerialization)
     {
-        std::uint8_t expected[] = {0x44, 0x33, 0x22, 0x11, 0x55, 0x99, 0x88};
+        std::uint8_t expected[] = {0x44, 0x33, 0x22, 0x55, 0x99, 0x88, 0x07};
 
         std::array<std::uint8_t, (telemetry::SystemStartup::BitSize() + 7) / 8> buffer;
-        telemetry::SystemStartup object(0x11223344, 0x55, 0x8899);
+        telemetry::SystemStartup object(0x223344, 0x55, 0x8899, 1500ms, true);
         BitWriter writer(buffer);
         object.Write(writer);
         ASSERT_THAT(writer.Status(), Eq(true));
@@ -39,6 +44,18 @@ namespace
         ASSERT_THAT(writer.Capture(), Eq(gsl::make_span(expected)));
     }
 
+    TEST(SystemStartupTest, TestSerializationSaturatesCounterAndMountDuration)
+    {
+        std::uint8_t expected[] = {0xff, 0xff, 0xff, 0x55, 0x99, 0x88, 0xfe};
+
+        std::array<std::uint8_t, (telemetry::SystemStartup::BitSize() + 7) / 8> buffer;
+        telemetry::SystemStartup object(0x11223344, 0x55, 0x8899, 100s, false);
+        BitWriter writer(buffer);
+        object.Write(writer);
+        ASSERT_THAT(writer.Status(), Eq(true));
+        ASSERT_THAT(writer.Capture(), Eq(gsl::make_span(expected)));
+    }
+
     TEST(ProgramStateTest, TestDefaultConstruction)
     {
         telemetry::ProgramState object;
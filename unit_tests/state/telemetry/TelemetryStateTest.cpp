@@ -0,0 +1,71 @@
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "OsMock.hpp"
+#include "telemetry/state.hpp"
+
+namespace
+{
+    using testing::ElementsAreArray;
+    using testing::Eq;
+    using testing::Invoke;
+    using testing::_;
+    using telemetry::TelemetryState;
+
+    class TelemetryStateTest : public testing::Test
+    {
+      protected:
+        TelemetryStateTest();
+
+        testing::NiceMock<OSMock> os;
+        OSReset osReset;
+        TelemetryState state;
+        decltype(TelemetryState::lastSerializedTelemetry) published;
+        decltype(TelemetryState::lastSerializedTelemetry) snapshot;
+    };
+
+    TelemetryStateTest::TelemetryStateTest() : osReset(InstallProxy(&os))
+    {
+        std::fill(published.begin(), published.end(), 0xA5);
+        std::fill(snapshot.begin(), snapshot.end(), 0);
+        state.Initialize();
+    }
+
+    TEST_F(TelemetryStateTest, ShouldReadPublishedTelemetry)
+    {
+        state.PublishSerializedTelemetry(published);
+
+        ASSERT_THAT(state.ReadSerializedTelemetry(snapshot), Eq(true));
+        ASSERT_THAT(snapshot, ElementsAreArray(published));
+        ASSERT_THAT(state.serializedTelemetryVersion.load(), Eq(2U));
+    }
+
+    TEST_F(TelemetryStateTest, ShouldFailWhenUpdateIsInProgress)
+    {
+        state.serializedTelemetryVersion = 1;
+
+        EXPECT_CALL(os, Sleep(TelemetryState::SnapshotRetryDelay)).Times(TelemetryState::MaxSnapshotAttempts);
+
+        ASSERT_THAT(state.ReadSerializedTelemetry(snapshot), Eq(false));
+    }
+
+    TEST_F(TelemetryStateTest, ShouldRetryAfterWriterFinishesUpdate)
+    {
+        state.serializedTelemetryVersion = 1;
+
+        EXPECT_CALL(os, Sleep(TelemetryState::SnapshotRetryDelay)).WillOnce(Invoke([this](auto) {
+            state.serializedTelemetryVersion = 0;
+            state.PublishSerializedTelemetry(published);
+        }));
+
+        ASSERT_THAT(state.ReadSerializedTelemetry(snapshot), Eq(true));
+        ASSERT_THAT(snapshot, ElementsAreArray(published));
+    }
+
+    TEST_F(TelemetryStateTest, ShouldRejectTooSmallBuffer)
+    {
+        std::array<std::uint8_t, 10> buffer;
+
+        ASSERT_THAT(state.ReadSerializedTelemetry(buffer), Eq(false));
+    }
+}